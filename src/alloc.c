@@ -0,0 +1,425 @@
+/* This file is part of the DuctTape (dt) high-level assembler for 
+ * RISC-V. The dt project was written by Justin Severeid and Elliott 
+ * Forbes, University of Wisconsin-La Crosse, copyright 2020-2024.
+ *
+ * DuctTape is free software: you can redistribute it and/or modify 
+ * it under the terms of the GNU General Public License as published 
+ * by the Free Software Foundation, either version 3 of the License, 
+ * or (at your option) any later version.
+ *
+ * DuctTape is distributed in the hope that it will be useful, but 
+ * WITHOUT ANY WARRANTY; without even the implied warranty of 
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU 
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License 
+ * along with DuctTape. If not, see <https://www.gnu.org/licenses/>. 
+ *
+ *
+ *
+ * The dt project can be found at https://cs.uwlax.edu/~eforbes/dt/
+ *
+ * If you use dt in your published research, please consider 
+ * citing the following:
+ *
+ * Severeid, J. and Forbes, E., "dt: A High-level Assembler for RISC-V," 
+ * Proceedings of the 53rd Midwest Instruction and Computing Symposium, 
+ * April 2020. 
+ *
+ * If you found dt helpful, please let us know! Email eforbes@uwlax.edu
+ *
+ * There are bound to be bugs, let us know those too.
+ */
+
+
+
+/*
+ * var declarations, and a linear-scan allocator that gives each one a 
+ * physical integer register
+ *
+ *     var sum
+ *     var ptr
+ *     sum = 0
+ *     ...
+ *
+ * A var is used like a register label, but which register it gets is 
+ * left to allocate_vars(), after parsing and before anything else looks 
+ * at register numbers. Liveness is worked out over the lowered IR, with 
+ * the branches and jumps as the control flow, so a var that is live 
+ * around a loop's back edge is live through the whole loop. Every var 
+ * then gets one live interval and one register for the whole program.
+ *
+ * The free registers are handed out least recently freed first, so two 
+ * vars share a register only when there is no other choice. Reusing a 
+ * register as soon as it is free would add WAR and WAW dependencies 
+ * between otherwise independent chains.
+ *
+ * The registers a var can get are the ones the program never names. 
+ * $zero, $ra, $sp, $gp and $tp are never used, nor is $t1, which 
+ * relaxation needs for a far j. If there is an ecall, $a0-$a7 are not 
+ * used either. A var that is live across a call keeps its register to 
+ * itself, because nothing is known about what the callee overwrites. If 
+ * more vars are live at once than there are registers for them, that 
+ * is an error. Nothing is ever spilled, so no loads or stores appear 
+ * that the source doesn't have.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <inttypes.h>
+
+#include "riscvarch.h"
+#include "alloc.h"
+#include "inst.h"
+#include "mem.h"
+#include "stream.h"
+#include "symtab.h"
+#include "util.h"
+
+typedef struct {
+    char *name;
+    int reg;         /* the physical register, -1 until allocated */
+    int64_t start;   /* the live interval, as positions in the code, -1 if never used */
+    int64_t end;
+    BOOL across_call;
+} var_t;
+
+/* one per instruction, in the order the mem() blocks were parsed */
+typedef struct {
+    mem_entry_t *entry;
+    int64_t next;    /* the fall-through position, -1 if control can't fall through */
+    int64_t target;  /* the branch or jump target, -1 if none is known */
+    BOOL call;       /* a jal or jalr that links, it returns to next */
+} position_t;
+
+/* the registers to try, temporaries before saved registers before arguments */
+static const int alloc_order[] = {5, 7, 28, 29, 30, 31, 8, 9, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27,
+                                  10, 11, 12, 13, 14, 15, 16, 17};
+
+static var_t *vars = NULL;
+static int var_count = 0;
+static int var_capacity = 0;
+static int alloc_free_regs = 0; /* registers a var could have */
+static int alloc_max_live = 0;  /* most vars live at once */
+
+
+int64_t new_var(char *name){
+    if (streaming())
+        yyerror("A var needs the whole program to pick its register, it cannot be used with -stream.");
+    if (var_count == var_capacity){
+        var_capacity = var_capacity ? var_capacity * 2 : 32;
+        vars = (var_t*)realloc(vars,sizeof(var_t)*var_capacity);
+    }
+    vars[var_count].name = strdup(name);
+    vars[var_count].reg = -1;
+    vars[var_count].start = -1;
+    vars[var_count].end = -1;
+    vars[var_count].across_call = FALSE;
+    symtab_new(name,SYMTAB_IREG);
+    symtab_update(name,VAR_BASE + var_count);
+    return VAR_BASE + var_count++;
+}
+
+/* the integer register fields an instruction reads and writes */
+static void int_operands(instruction_t *inst, uint32_t **uses, int *use_count, uint32_t **def){
+    operands_t ops;
+    int i;
+
+    find_operands(inst,&ops);
+    *use_count = 0;
+    for (i=0;i<ops.src_count;i++){
+        if (ops.src[i].reg_class == OPERAND_INT)
+            uses[(*use_count)++] = ops.src[i].field;
+    }
+    *def = (ops.dst.reg_class == OPERAND_INT) ? ops.dst.field : NULL;
+}
+
+/* where a branch or jump goes, as an address, FALSE if that isn't known */
+static BOOL target_address(mem_entry_t *entry, uint64_t *address){
+    instruction_t *inst = entry->inst;
+    int64_t offset;
+
+    if ((inst->opcode != 0x63) && (inst->opcode != 0x6f))
+        return FALSE;
+    if (inst->target_name){
+        int64_t value = symtab_lookup(inst->target_name);
+        if ((value < 0) || (symtab_type(inst->target_name) != SYMTAB_MEM))
+            return FALSE; /* calculate_offsets() will complain */
+        *address = value;
+        return TRUE;
+    }
+    if (inst->opcode == 0x63)
+        offset = ((int64_t)(inst->imm & 0x1fff) ^ 0x1000) - 0x1000;
+    else
+        offset = ((int64_t)(inst->imm & 0x1fffff) ^ 0x100000) - 0x100000;
+    *address = entry->address + offset;
+    return TRUE;
+}
+
+static int compare_address(const void *a, const void *b){
+    const position_t *pa = *(const position_t * const *)a;
+    const position_t *pb = *(const position_t * const *)b;
+    if (pa->entry->address != pb->entry->address)
+        return (pa->entry->address < pb->entry->address) ? -1 : 1;
+    return (pa < pb) ? -1 : (pa > pb);
+}
+
+/* the position of the instruction at an address, -1 if there isn't one */
+static int64_t find_position(position_t **by_address, int64_t count, position_t *base, uint64_t address){
+    int64_t low = 0, high = count;
+
+    while (low < high){
+        int64_t middle = (low + high) / 2;
+        if (by_address[middle]->entry->address < address)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    if ((low < count) && (by_address[low]->entry->address == address))
+        return by_address[low] - base;
+    return -1;
+}
+
+static void alloc_error(mem_entry_t *entry, char *message){
+    yyerror_at(entry->loc.file,entry->loc.line,message);
+}
+
+static int compare_start(const void *a, const void *b){
+    const var_t *va = &vars[*(const int *)a];
+    const var_t *vb = &vars[*(const int *)b];
+    if (va->start != vb->start)
+        return (va->start < vb->start) ? -1 : 1;
+    return *(const int *)a - *(const int *)b;
+}
+
+void allocate_vars(){
+    memblock_list_t *list;
+    mem_entry_t *working;
+    position_t *positions;
+    position_t **by_address;
+    uint64_t *use, *def, *live_in, *live_out;
+    int64_t count = 0;
+    int64_t i;
+    int words = (var_count + 63) / 64;
+    BOOL named[32] = {FALSE};
+    BOOL changed;
+    int free_queue[32];
+    int free_head = 0, free_count = 0;
+    int *order, *active;
+    int ordered = 0, active_count = 0;
+    symtab_entry_t *symbol;
+    int v, r;
+
+    if (var_count == 0)
+        return;
+
+    for (list = block_list; list; list = list->next){
+        for (working = list->head; working; working = working->next){
+            if (working->type == ENTRY_INSTRUCTION)
+                count++;
+        }
+    }
+    positions = (position_t*)malloc(sizeof(position_t)*(count+1));
+    by_address = (position_t**)malloc(sizeof(position_t*)*(count+1));
+    use = (uint64_t*)calloc(count*words+1,sizeof(uint64_t));
+    def = (uint64_t*)calloc(count*words+1,sizeof(uint64_t));
+    live_in = (uint64_t*)calloc(count*words+1,sizeof(uint64_t));
+    live_out = (uint64_t*)calloc(count*words+1,sizeof(uint64_t));
+
+    /* the uses and definitions of every instruction, and the registers 
+       the program names for itself */
+    named[0] = named[1] = named[2] = named[3] = named[4] = named[6] = TRUE;
+    i = 0;
+    for (list = block_list; list; list = list->next){
+        int64_t first = i;
+        for (working = list->head; working; working = working->next){
+            instruction_t *inst;
+            uint32_t *uses[3] = {NULL};
+            uint32_t *dst;
+            int use_count, u;
+
+            if (working->type != ENTRY_INSTRUCTION)
+                continue;
+            inst = working->inst;
+            positions[i].entry = working;
+            positions[i].next = i + 1;
+            positions[i].target = -1;
+            positions[i].call = FALSE;
+            by_address[i] = &positions[i];
+
+            int_operands(inst,uses,&use_count,&dst);
+            for (u=0;u<use_count;u++){
+                if (*uses[u] >= VAR_BASE)
+                    use[i*words + (*uses[u]-VAR_BASE)/64] |= (uint64_t)1 << ((*uses[u]-VAR_BASE)%64);
+                else
+                    named[*uses[u] & 0x1f] = TRUE;
+            }
+            if (dst && (*dst >= VAR_BASE))
+                def[i*words + (*dst-VAR_BASE)/64] |= (uint64_t)1 << ((*dst-VAR_BASE)%64);
+            else if (dst)
+                named[*dst & 0x1f] = TRUE;
+            if ((inst->opcode == 0x73) && (inst->funct3 == 0)){
+                for (r=10;r<=17;r++)
+                    named[r] = TRUE; /* the syscall number, arguments and result */
+            }
+            i++;
+        }
+        if (i > first)
+            positions[i-1].next = -1; /* the end of the block */
+    }
+
+    /* the control flow */
+    qsort(by_address,count,sizeof(position_t*),compare_address);
+    for (i=0;i<count;i++){
+        instruction_t *inst = positions[i].entry->inst;
+        uint64_t address;
+
+        if (target_address(positions[i].entry,&address))
+            positions[i].target = find_position(by_address,count,positions,address);
+        if ((inst->opcode == 0x6f) || (inst->opcode == 0x67)){
+            if (inst->rdst != 0)
+                positions[i].call = TRUE;
+            else
+                positions[i].next = -1;
+        }
+    }
+
+    /* liveness, backwards to a fixed point */
+    do {
+        changed = FALSE;
+        for (i=count-1;i>=0;i--){
+            int w;
+            for (w=0;w<words;w++){
+                uint64_t out = 0;
+                uint64_t in;
+                if (positions[i].next >= 0)
+                    out |= live_in[positions[i].next*words + w];
+                if (positions[i].target >= 0)
+                    out |= live_in[positions[i].target*words + w];
+                in = use[i*words + w] | (out & ~def[i*words + w]);
+                live_out[i*words + w] = out;
+                if (in != live_in[i*words + w]){
+                    live_in[i*words + w] = in;
+                    changed = TRUE;
+                }
+            }
+        }
+    } while (changed);
+
+    /* one interval per var, from the first position it occupies to the last */
+    for (i=0;i<count;i++){
+        int w;
+        for (w=0;w<words;w++){
+            uint64_t here = live_in[i*words + w] | live_out[i*words + w] |
+                            use[i*words + w] | def[i*words + w];
+            while (here){
+                v = w*64 + __builtin_ctzll(here);
+                here &= here - 1;
+                if (vars[v].start < 0)
+                    vars[v].start = i;
+                vars[v].end = i;
+                if (positions[i].call && (live_out[i*words + w] & ((uint64_t)1 << (v%64))))
+                    vars[v].across_call = TRUE;
+            }
+        }
+    }
+    for (v=0;v<var_count;v++){
+        if (vars[v].across_call){
+            vars[v].start = 0;
+            vars[v].end = count - 1;
+        }
+    }
+
+    /* linear scan, taking registers from the front of the free queue 
+       and putting them back at the end */
+    for (r=0;r<(int)(sizeof(alloc_order)/sizeof(alloc_order[0]));r++){
+        if (!named[alloc_order[r]])
+            free_queue[free_count++] = alloc_order[r];
+    }
+    alloc_free_regs = free_count;
+    order = (int*)malloc(sizeof(int)*var_count);
+    active = (int*)malloc(sizeof(int)*var_count);
+    for (v=0;v<var_count;v++){
+        if (vars[v].start >= 0)
+            order[ordered++] = v;
+    }
+    qsort(order,ordered,sizeof(int),compare_start);
+    for (i=0;i<ordered;i++){
+        var_t *var = &vars[order[i]];
+        int a, kept = 0;
+
+        /* active is kept in order of end, so registers go back in the 
+           order their vars died */
+        for (a=0;a<active_count;a++){
+            if (vars[active[a]].end < var->start)
+                free_queue[(free_head + free_count++) % 32] = vars[active[a]].reg;
+            else
+                active[kept++] = active[a];
+        }
+        active_count = kept;
+
+        if (free_count == 0){
+            char buff[300];
+            snprintf(buff,sizeof(buff),"Out of registers for var %s, %d vars are live here and only "
+                                       "%d registers are free for them. vars are never spilled.",
+                                       var->name,active_count+1,alloc_free_regs);
+            alloc_error(positions[var->start].entry,buff);
+        }
+        var->reg = free_queue[free_head];
+        free_head = (free_head + 1) % 32;
+        free_count--;
+
+        for (a=active_count;(a>0) && (vars[active[a-1]].end > var->end);a--)
+            active[a] = active[a-1];
+        active[a] = order[i];
+        active_count++;
+        if (active_count > alloc_max_live)
+            alloc_max_live = active_count;
+    }
+
+    /* rewrite the operands, and the symbol table for -checking */
+    for (i=0;i<count;i++){
+        uint32_t *uses[3] = {NULL};
+        uint32_t *dst;
+        int use_count, u;
+
+        int_operands(positions[i].entry->inst,uses,&use_count,&dst);
+        for (u=0;u<use_count;u++){
+            if (*uses[u] >= VAR_BASE)
+                *uses[u] = vars[*uses[u]-VAR_BASE].reg;
+        }
+        if (dst && (*dst >= VAR_BASE))
+            *dst = vars[*dst-VAR_BASE].reg;
+    }
+    for (symbol = symtab_entries(); symbol; symbol = symbol->next){
+        if ((symbol->type == SYMTAB_IREG) && (symbol->value >= VAR_BASE) && (vars[symbol->value-VAR_BASE].reg >= 0))
+            symbol->value = vars[symbol->value-VAR_BASE].reg;
+    }
+
+    free(positions);
+    free(by_address);
+    free(use);
+    free(def);
+    free(live_in);
+    free(live_out);
+    free(order);
+    free(active);
+}
+
+void dump_vars(){
+    int v;
+
+    if (var_count == 0)
+        return;
+    printf("\nVars: %d, %d registers free for them, at most %d live at once\n",
+           var_count,alloc_free_regs,alloc_max_live);
+    for (v=0;v<var_count;v++){
+        if (vars[v].reg < 0)
+            printf("var %s:\tunused\n",vars[v].name);
+        else
+            printf("var %s:\t$x%d, live for %" PRId64 " instructions%s\n",vars[v].name,vars[v].reg,
+                   vars[v].end - vars[v].start + 1,vars[v].across_call ? ", across a call" : "");
+    }
+}
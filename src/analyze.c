@@ -0,0 +1,632 @@
+/* This file is part of the DuctTape (dt) high-level assembler for 
+ * RISC-V. The dt project was written by Justin Severeid and Elliott 
+ * Forbes, University of Wisconsin-La Crosse, copyright 2020-2024.
+ *
+ * DuctTape is free software: you can redistribute it and/or modify 
+ * it under the terms of the GNU General Public License as published 
+ * by the Free Software Foundation, either version 3 of the License, 
+ * or (at your option) any later version.
+ *
+ * DuctTape is distributed in the hope that it will be useful, but 
+ * WITHOUT ANY WARRANTY; without even the implied warranty of 
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU 
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License 
+ * along with DuctTape. If not, see <https://www.gnu.org/licenses/>. 
+ *
+ *
+ *
+ * The dt project can be found at https://cs.uwlax.edu/~eforbes/dt/
+ *
+ * If you use dt in your published research, please consider 
+ * citing the following:
+ *
+ * Severeid, J. and Forbes, E., "dt: A High-level Assembler for RISC-V," 
+ * Proceedings of the 53rd Midwest Instruction and Computing Symposium, 
+ * April 2020. 
+ *
+ * If you found dt helpful, please let us know! Email eforbes@uwlax.edu
+ *
+ * There are bound to be bugs, let us know those too.
+ */
+
+
+/*
+ * -analyze: a static throughput report for every loop in the program, 
+ * in the spirit of llvm-mca. A loop is a branch or j back to a label in 
+ * the same mem() block, and its body is everything from the label to 
+ * the branch. Each loop gets three bounds on its cycles per iteration -- 
+ * the longest loop-carried chain of register dependencies, the issue 
+ * width, and the busiest execution port -- and the prediction is the 
+ * largest of them. Only register dependencies are followed, memory is 
+ * assumed not to alias. Latencies and ports come from a table, either the 
+ * built-in one below or a file given with -latency.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <inttypes.h>
+
+#include "riscvarch.h"
+#include "analyze.h"
+#include "inst.h"
+#include "mem.h"
+#include "output.h"
+#include "symtab.h"
+#include "util.h"
+
+#define AN_MAX_PORTS 16
+#define AN_NUM_REGS 96   /* x0-x31, then f0-f31, then v0-v31 */
+#define AN_ITERATIONS 64 /* iterations of dataflow run to find the loop-carried rate */
+
+extern char *current_file; /* from dt.y, pointed at the latency table while it is read */
+extern int yylineno;
+
+/* one line of the latency table */
+typedef struct latency_entry_type {
+    char *mnemonic;  /* a trailing '*' matches every mnemonic with that prefix */
+    int latency;
+    uint32_t ports;  /* bit i set if the instruction can issue to port_names[i] */
+    struct latency_entry_type *next;
+} latency_entry_t;
+
+/* one instruction of a loop body, with the registers it reads and writes */
+typedef struct {
+    mem_entry_t *entry;
+    int src[OPERAND_MAX_SRCS];
+    int src_count;
+    int dst;         /* -1 if it writes no register */
+    latency_entry_t *timing;
+    double share[AN_MAX_PORTS]; /* how much of each iteration's instance goes to each port */
+} an_inst_t;
+
+static char *port_names[AN_MAX_PORTS];
+static int port_count = 0;
+static int issue_width = 0;
+static latency_entry_t *latency_table = NULL;
+static latency_entry_t default_timing;
+static BOOL have_default = FALSE;
+
+/* a generic dual-issue in-order core, in the same format -latency reads */
+static const char *builtin_latencies[] = {
+    "width 2",
+    "ports alu0 alu1 mem fpu vec",
+    "default    1  alu0 alu1",
+    "mul*       3  alu1",
+    "div*      20  alu1",
+    "rem*      20  alu1",
+    "lb         3  mem",
+    "lh         3  mem",
+    "lw         3  mem",
+    "ld         3  mem",
+    "lbu        3  mem",
+    "lhu        3  mem",
+    "lwu        3  mem",
+    "sb         1  mem",
+    "sh         1  mem",
+    "sw         1  mem",
+    "sd         1  mem",
+    "lr*        3  mem",
+    "sc*        3  mem",
+    "amo*       5  mem",
+    "flw        3  mem",
+    "fld        3  mem",
+    "fsw        1  mem",
+    "fsd        1  mem",
+    "f*         4  fpu",
+    "fmadd.*    5  fpu",
+    "fmsub.*    5  fpu",
+    "fnmadd.*   5  fpu",
+    "fnmsub.*   5  fpu",
+    "fdiv.s    12  fpu",
+    "fdiv.d    20  fpu",
+    "fsqrt.s   16  fpu",
+    "fsqrt.d   28  fpu",
+    "fsgnj*     2  fpu",
+    "fmin.*     2  fpu",
+    "fmax.*     2  fpu",
+    "fmv.*      2  fpu",
+    "fence      1  mem",
+    "fence.i    1  mem",
+    "v*         4  vec",
+    "vsetvli    1  alu0 alu1",
+    "vsetivli   1  alu0 alu1",
+    "vsetvl     1  alu0 alu1",
+    "vle*       4  mem",
+    "vlse*      4  mem",
+    "vluxei*    4  mem",
+    "vloxei*    4  mem",
+    "vlm.v      4  mem",
+    "vse*       1  mem",
+    "vsse*      1  mem",
+    "vsuxei*    1  mem",
+    "vsoxei*    1  mem",
+    "vsm.v      1  mem",
+    "vdiv*     20  vec",
+    "vrem*     20  vec",
+    "vfdiv.*   16  vec",
+    "vfrdiv.*  16  vec",
+    NULL
+};
+
+static int find_port(char *name){
+    int i;
+    for (i=0;i<port_count;i++){
+        if (strcmp(port_names[i],name) == 0)
+            return i;
+    }
+    return -1;
+}
+
+/* reads one line of a latency table, returns an error message or NULL */
+static const char *parse_latency_line(char *line){
+    static char buff[200];
+    char *hash = strchr(line,'#');
+    char *word;
+
+    if (hash)
+        *hash = '\0';
+    word = strtok(line," \t\r\n");
+    if (!word)
+        return NULL;
+
+    if (strcmp(word,"width") == 0){
+        char *value = strtok(NULL," \t\r\n");
+        if (!value || (atoi(value) <= 0))
+            return "width needs a positive number of instructions per cycle.";
+        issue_width = atoi(value);
+    }
+    else if (strcmp(word,"ports") == 0){
+        char *name;
+        if (latency_table || have_default)
+            return "ports must be listed before any latencies.";
+        port_count = 0;
+        while ((name = strtok(NULL," \t\r\n"))){
+            if (port_count == AN_MAX_PORTS){
+                sprintf(buff,"At most %d ports are supported.",AN_MAX_PORTS);
+                return buff;
+            }
+            if (find_port(name) >= 0){
+                snprintf(buff,sizeof(buff),"Port \"%s\" is listed twice.",name);
+                return buff;
+            }
+            port_names[port_count++] = strdup(name);
+        }
+        if (port_count == 0)
+            return "ports needs at least one port name.";
+    }
+    else {
+        latency_entry_t entry;
+        char *value = strtok(NULL," \t\r\n");
+        char *name;
+
+        if (port_count == 0)
+            return "ports must be listed before any latencies.";
+        if (!value || (atoi(value) <= 0)){
+            snprintf(buff,sizeof(buff),"\"%s\" needs a latency of at least one cycle.",word);
+            return buff;
+        }
+        entry.latency = atoi(value);
+        entry.ports = 0;
+        while ((name = strtok(NULL," \t\r\n"))){
+            int port = find_port(name);
+            if (port < 0){
+                snprintf(buff,sizeof(buff),"\"%s\" uses port \"%s\", which is not in the ports list.",word,name);
+                return buff;
+            }
+            entry.ports |= 1 << port;
+        }
+        if (entry.ports == 0){
+            snprintf(buff,sizeof(buff),"\"%s\" needs at least one port.",word);
+            return buff;
+        }
+
+        if (strcmp(word,"default") == 0){
+            default_timing = entry;
+            default_timing.mnemonic = "default";
+            have_default = TRUE;
+        }
+        else {
+            latency_entry_t *copy = (latency_entry_t*)malloc(sizeof(latency_entry_t));
+            *copy = entry;
+            copy->mnemonic = strdup(word);
+            copy->next = latency_table;
+            latency_table = copy;
+        }
+    }
+    return NULL;
+}
+
+/* anything the table leaves out: one cycle per instruction, on any port */
+static void finish_latency_table(){
+    if (!have_default){
+        default_timing.mnemonic = "default";
+        default_timing.latency = 1;
+        default_timing.ports = (1 << port_count) - 1;
+        have_default = TRUE;
+    }
+    if (issue_width == 0)
+        issue_width = port_count;
+}
+
+static void load_builtin_latencies(){
+    int i;
+    for (i=0;builtin_latencies[i];i++){
+        char line[100];
+        strcpy(line,builtin_latencies[i]);
+        parse_latency_line(line);
+    }
+    finish_latency_table();
+}
+
+/* replaces the built-in table with the one in filename */
+static void load_latency_file(char *filename){
+    FILE *fd = fopen(filename,"r");
+    char line[1024];
+    int line_number = 0;
+
+    if (!fd){
+        fprintf(stderr,"Could not open latency table: %s\n",filename);
+        exit(1);
+    }
+    while (fgets(line,sizeof(line),fd)){
+        const char *error;
+        line_number++;
+        error = parse_latency_line(line);
+        if (error){
+            current_file = filename;
+            yylineno = line_number;
+            yyerror(error);
+        }
+    }
+    fclose(fd);
+    if (port_count == 0){
+        current_file = filename;
+        yylineno = line_number;
+        yyerror("The latency table has no ports line.");
+    }
+    finish_latency_table();
+}
+
+/* an exact mnemonic wins, then the longest matching prefix, then the default */
+static latency_entry_t *lookup_timing(instruction_t *inst){
+    latency_entry_t *working = latency_table;
+    latency_entry_t *best = NULL;
+    size_t best_length = 0;
+    char buff[200];
+    char *space;
+
+    sprint_asm(buff,inst);
+    space = strchr(buff,' ');
+    if (space)
+        *space = '\0';
+
+    while (working){
+        size_t length = strlen(working->mnemonic);
+        if (strcmp(working->mnemonic,buff) == 0)
+            return working;
+        if ((length > 0) && (working->mnemonic[length-1] == '*') &&
+            (strncmp(working->mnemonic,buff,length-1) == 0) && (length > best_length)){
+            best = working;
+            best_length = length;
+        }
+        working = working->next;
+    }
+    return best ? best : &default_timing;
+}
+
+/* the registers an instruction reads and writes, numbered in operand_class_t 
+   order: x0-x31, then f0-f31, then v0-v31 */
+static int an_reg(operand_t *operand){
+    return 32*(int)operand->reg_class + (int)operand_reg(operand);
+}
+
+static void an_operands(an_inst_t *an){
+    operands_t ops;
+    int i;
+
+    find_operands(an->entry->inst,&ops);
+    for (i=0;i<ops.src_count;i++)
+        an->src[i] = an_reg(&ops.src[i]);
+    an->src_count = ops.src_count;
+    an->dst = ops.dst.field ? an_reg(&ops.dst) : -1;
+}
+
+/* TRUE if entry branches or jumps backwards (or to itself), target is set to where */
+static BOOL back_edge(mem_entry_t *entry, uint64_t *target){
+    instruction_t *inst = entry->inst;
+    int64_t offset;
+
+    if (inst->opcode == 0x63)
+        offset = ((int64_t)(inst->imm & 0x1fff) ^ 0x1000) - 0x1000;
+    else if ((inst->opcode == 0x6f) && (inst->rdst == 0))
+        offset = ((int64_t)(inst->imm & 0x1fffff) ^ 0x100000) - 0x100000;
+    else
+        return FALSE;
+    if (offset > 0)
+        return FALSE;
+    *target = entry->address + offset;
+    return TRUE;
+}
+
+static BOOL is_user_label(mem_entry_t *entry){
+    return entry->name && (entry->type != ENTRY_DEFINITION) && strncmp(entry->name,"__",2);
+}
+
+/* loops are keyed by the source label at the top, or an offset from the closest one before it */
+static void sprint_loop_name(char *buff, memblock_list_t *list, uint64_t target){
+    mem_entry_t *working = list->head;
+    mem_entry_t *closest = NULL;
+
+    while (working && (working->address <= target)){
+        if (is_user_label(working)){
+            if (working->address == target){
+                sprintf(buff,"%s",working->name);
+                return;
+            }
+            closest = working;
+        }
+        working = working->next;
+    }
+    if (closest)
+        sprintf(buff,"%s+0x%" PRIx64,closest->name,target - closest->address);
+    else
+        sprintf(buff,"0x%012" PRIx64,target);
+}
+
+static void sprint_reg(char *buff, int reg){
+    if (reg < 32)
+        sprintf(buff,"x%d",reg);
+    else if (reg < 64)
+        sprintf(buff,"f%d",reg - 32);
+    else
+        sprintf(buff,"v%d",reg - 64);
+}
+
+static int count_ports(uint32_t ports){
+    int count = 0;
+    while (ports){
+        count += ports & 1;
+        ports >>= 1;
+    }
+    return count;
+}
+
+/* puts one instruction on the ports it can use, filling the least loaded 
+   of them up to a common level, the way water fills the lowest ground */
+static void fill_ports(an_inst_t *an, double *pressure){
+    int eligible[AN_MAX_PORTS];
+    int n = 0;
+    double level = 0.0;
+    double total = 1.0;
+    int i, j;
+
+    /* the eligible ports, from the least loaded up */
+    for (j=0;j<port_count;j++){
+        if (an->timing->ports & (1 << j)){
+            for (i=n;(i > 0) && (pressure[eligible[i-1]] > pressure[j]);i--)
+                eligible[i] = eligible[i-1];
+            eligible[i] = j;
+            n++;
+        }
+    }
+    for (i=0;i<n;i++){
+        total += pressure[eligible[i]];
+        level = total / (i+1);
+        if ((i+1 == n) || (level <= pressure[eligible[i+1]]))
+            break;
+    }
+    for (j=0;j<port_count;j++)
+        an->share[j] = 0.0;
+    for (j=0;j<=i && j<n;j++){
+        an->share[eligible[j]] = level - pressure[eligible[j]];
+        pressure[eligible[j]] = level;
+    }
+}
+
+/* the split of the body over the ports that keeps the busiest port least 
+   busy: the most constrained instructions are placed first, then each one 
+   in turn is taken off and filled in again until the loads settle */
+static void assign_ports(an_inst_t *body, int count, double *pressure){
+    int ports, i, j, k;
+
+    for (j=0;j<port_count;j++)
+        pressure[j] = 0.0;
+    for (ports=1;ports<=port_count;ports++){
+        for (i=0;i<count;i++){
+            if (count_ports(body[i].timing->ports) == ports)
+                fill_ports(&body[i],pressure);
+        }
+    }
+    for (k=0;k<AN_ITERATIONS;k++){
+        for (i=0;i<count;i++){
+            for (j=0;j<port_count;j++)
+                pressure[j] -= body[i].share[j];
+            fill_ports(&body[i],pressure);
+        }
+    }
+}
+
+static void report_loop(memblock_list_t *list, mem_entry_t *branch, uint64_t target){
+    mem_entry_t *working;
+    an_inst_t *body;
+    int count = 0;
+    int internal_branches = 0;
+    int64_t ready[AN_NUM_REGS];
+    int64_t halfway[AN_NUM_REGS];
+    BOOL carried[AN_NUM_REGS];   /* read before it is written, so the value comes from the last iteration */
+    BOOL written[AN_NUM_REGS];
+    double pressure[AN_MAX_PORTS];
+    int64_t chain = 0;
+    double recurrence = 0.0;
+    double issue_bound;
+    double port_bound = 0.0;
+    double predicted;
+    const char *bound;
+    char buff[200];
+    int i, j, k;
+
+    for (working=list->head;working;working=working->next){
+        if ((working->type == ENTRY_INSTRUCTION) && (working->address >= target) && (working->address <= branch->address))
+            count++;
+    }
+    body = (an_inst_t*)calloc(count,sizeof(an_inst_t));
+    count = 0;
+    for (working=list->head;working;working=working->next){
+        if ((working->type == ENTRY_INSTRUCTION) && (working->address >= target) && (working->address <= branch->address)){
+            body[count].entry = working;
+            an_operands(&body[count]);
+            body[count].timing = lookup_timing(working->inst);
+            if ((working != branch) && ((working->inst->opcode == 0x63) || (working->inst->opcode == 0x6f) ||
+                                        (working->inst->opcode == 0x67)))
+                internal_branches++;
+            count++;
+        }
+    }
+
+    /* longest chain of dependencies through a single iteration */
+    memset(ready,0,sizeof(ready));
+    for (i=0;i<count;i++){
+        int64_t start = 0;
+        for (j=0;j<body[i].src_count;j++){
+            if (ready[body[i].src[j]] > start)
+                start = ready[body[i].src[j]];
+        }
+        if (start + body[i].timing->latency > chain)
+            chain = start + body[i].timing->latency;
+        if (body[i].dst >= 0)
+            ready[body[i].dst] = start + body[i].timing->latency;
+    }
+
+    /* run the dataflow for many iterations, whatever grows fastest is the recurrence */
+    memset(ready,0,sizeof(ready));
+    memset(carried,0,sizeof(carried));
+    memset(written,0,sizeof(written));
+    for (k=0;k<AN_ITERATIONS;k++){
+        if (k == AN_ITERATIONS/2)
+            memcpy(halfway,ready,sizeof(ready));
+        for (i=0;i<count;i++){
+            int64_t start = 0;
+            for (j=0;j<body[i].src_count;j++){
+                if (ready[body[i].src[j]] > start)
+                    start = ready[body[i].src[j]];
+                if ((k == 0) && !written[body[i].src[j]])
+                    carried[body[i].src[j]] = TRUE;
+            }
+            if (body[i].dst >= 0){
+                ready[body[i].dst] = start + body[i].timing->latency;
+                written[body[i].dst] = TRUE;
+            }
+        }
+    }
+    for (i=0;i<AN_NUM_REGS;i++){
+        double rate = (double)(ready[i] - halfway[i]) / (AN_ITERATIONS/2);
+        if (carried[i] && written[i] && (rate > recurrence))
+            recurrence = rate;
+    }
+
+    assign_ports(body,count,pressure);
+    for (j=0;j<port_count;j++){
+        if (pressure[j] > port_bound)
+            port_bound = pressure[j];
+    }
+    issue_bound = (double)count / issue_width;
+
+    predicted = recurrence;
+    bound = "the loop-carried chain";
+    if (issue_bound > predicted){
+        predicted = issue_bound;
+        bound = "issue width";
+    }
+    if (port_bound > predicted){
+        predicted = port_bound;
+        bound = "port pressure";
+    }
+
+    sprint_loop_name(buff,list,target);
+    printf("\nLoop \"%s\" @0x%012" PRIx64 "-0x%012" PRIx64 ", %d instruction%s\n",
+           buff,target,branch->address,count,(count == 1) ? "" : "s");
+    printf("    Dependency chain:  %" PRId64 " cycles through one iteration\n",chain);
+    printf("    Loop-carried:      %.2f cycles/iteration",recurrence);
+    if (recurrence > 0.0){
+        const char *separator = " through";
+        for (i=0;i<AN_NUM_REGS;i++){
+            if (carried[i] && written[i] && ((double)(ready[i] - halfway[i]) / (AN_ITERATIONS/2) == recurrence)){
+                sprint_reg(buff,i);
+                printf("%s %s",separator,buff);
+                separator = ",";
+            }
+        }
+    }
+    printf("\n");
+    printf("    Issue width:       %.2f cycles/iteration\n",issue_bound);
+    printf("    Port pressure:     %.2f cycles/iteration",port_bound);
+    for (j=0;j<port_count;j++){
+        if (pressure[j] == port_bound){
+            printf(" on %s",port_names[j]);
+            break;
+        }
+    }
+    printf("\n");
+    printf("    Predicted:         %.2f cycles/iteration, IPC %.2f, bound by %s\n",
+           predicted,(predicted > 0.0) ? count / predicted : 0.0,bound);
+    if (internal_branches)
+        printf("    Note:              %d branch%s inside the body, every instruction is counted each iteration\n",
+               internal_branches,(internal_branches == 1) ? "" : "es");
+
+    printf("\n    lat");
+    for (j=0;j<port_count;j++)
+        printf(" %7s",port_names[j]);
+    printf("   instruction\n");
+    for (i=0;i<count;i++){
+        printf("    %3d",body[i].timing->latency);
+        for (j=0;j<port_count;j++){
+            if (body[i].timing->ports & (1 << j))
+                printf(" %7.2f",body[i].share[j]);
+            else
+                printf(" %7s","-");
+        }
+        sprint_entry(buff,body[i].entry);
+        printf("   %s\n",buff);
+    }
+    printf("       ");
+    for (j=0;j<port_count;j++)
+        printf(" %7.2f",pressure[j]);
+    printf("   per iteration\n");
+
+    free(body);
+}
+
+void analyze_memblocks(char *latency_file){
+    memblock_list_t *list = block_list;
+    int loops = 0;
+    int j;
+
+    if (latency_file)
+        load_latency_file(latency_file);
+    else
+        load_builtin_latencies();
+
+    printf("\nAnalysis: issue width %d, ports",issue_width);
+    for (j=0;j<port_count;j++)
+        printf(" %s",port_names[j]);
+    printf("\n");
+
+    while (list){
+        mem_entry_t *working = list->head;
+        while (working){
+            uint64_t target;
+            if ((working->type == ENTRY_INSTRUCTION) && back_edge(working,&target) && (target >= list->min_address)){
+                report_loop(list,working,target);
+                loops++;
+            }
+            working = working->next;
+        }
+        list = list->next;
+    }
+    if (loops == 0)
+        printf("\nNo loops found.\n");
+}
@@ -0,0 +1,273 @@
+/* This file is part of the DuctTape (dt) high-level assembler for 
+ * RISC-V. The dt project was written by Justin Severeid and Elliott 
+ * Forbes, University of Wisconsin-La Crosse, copyright 2020-2024.
+ *
+ * DuctTape is free software: you can redistribute it and/or modify 
+ * it under the terms of the GNU General Public License as published 
+ * by the Free Software Foundation, either version 3 of the License, 
+ * or (at your option) any later version.
+ *
+ * DuctTape is distributed in the hope that it will be useful, but 
+ * WITHOUT ANY WARRANTY; without even the implied warranty of 
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU 
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License 
+ * along with DuctTape. If not, see <https://www.gnu.org/licenses/>. 
+ *
+ *
+ *
+ * The dt project can be found at https://cs.uwlax.edu/~eforbes/dt/
+ *
+ * If you use dt in your published research, please consider 
+ * citing the following:
+ *
+ * Severeid, J. and Forbes, E., "dt: A High-level Assembler for RISC-V," 
+ * Proceedings of the 53rd Midwest Instruction and Computing Symposium, 
+ * April 2020. 
+ *
+ * If you found dt helpful, please let us know! Email eforbes@uwlax.edu
+ *
+ * There are bound to be bugs, let us know those too.
+ */
+
+
+/*
+ * The A extension's lr, sc and amos are plain instructions in the 
+ * grammar, these are the constructs built on top of them:
+ *
+ *     atomic_add (name, $reg)   amoadd.d of $reg into the counter name
+ *     lock (name)               test and test-and-set, amoswap.w.aq
+ *     unlock (name)             amoswap.w.rl of zero
+ *     barrier (name, N)         a sense-reversing barrier for N harts
+ *
+ * Each lowers to the canonical sequence from the ISA manual. The words 
+ * behind a name are made the first time it is used, zeroed, and laid 
+ * out at the end of that mem() block, a cache line apiece so that two 
+ * locks never share one. A barrier keeps its count and its sense a line 
+ * apart, so the spinning does not slow down the counting, and every 
+ * hart takes its own next sense from the shared one on the way in, as 
+ * the sense can not flip until that hart has arrived -- nothing is kept 
+ * per hart between barriers.
+ *
+ * As with the perf regions, $t4-$t6 are clobbered.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <inttypes.h>
+
+#include "riscvarch.h"
+#include "atomic.h"
+#include "perf.h"
+#include "inst.h"
+#include "mem.h"
+#include "symtab.h"
+#include "util.h"
+
+#define ATOMIC_ADDR_REG 29 // $t4
+#define ATOMIC_REG_A 30    // $t5
+#define ATOMIC_REG_B 31    // $t6
+
+#define ATOMIC_MAX_COUNT 2048 /* the barrier count goes in an addi */
+
+atomic_object_t *atomic_objects = NULL;
+static atomic_object_t *last_object = NULL;
+
+/* objects waiting for the end of the current mem() block */
+static mem_entry_t *pending_objects = NULL;
+
+mem_entry_t *gen_amo(int inst_id, uint32_t opcode, uint32_t funct3, uint32_t funct7, int64_t order, uint32_t rd, uint32_t rs1, uint32_t rs2){
+    mem_entry_t *entry = new_instruction(opcode);
+    entry->inst->inst_id = inst_id;
+    entry->inst->funct3 = funct3;
+    entry->inst->funct7 = funct7 | order;
+    entry->inst->rdst = rd;
+    entry->inst->rsrc1 = rs1;
+    entry->inst->rsrc2 = rs2;
+    entry->status = ENTRY_COMPLETE;
+    return entry;
+}
+
+static mem_entry_t *new_join_node(){
+    mem_entry_t *join_node = new_mem_entry(ENTRY_JOIN_NODE,0);
+    join_node->name = internal_name();
+    symtab_new(join_node->name,SYMTAB_MEM);
+    return join_node;
+}
+
+static mem_entry_t *gen_jump(char *target){
+    mem_entry_t *entry = new_instruction(OP_JAL);
+    entry->inst->inst_id = RISCV_J;
+    entry->inst->rdst = 0;
+    entry->inst->target_name = strdup(target);
+    return entry;
+}
+
+static mem_entry_t *gen_word_load(uint32_t rd, uint32_t base, int32_t offset){
+    return gen_imm_op(RISCV_LW,OP_LW,F3_LW,rd,base,offset);
+}
+
+static mem_entry_t *gen_word_store(uint32_t value, uint32_t base, int32_t offset){
+    mem_entry_t *entry = new_instruction(OP_SW);
+    entry->inst->inst_id = RISCV_SW;
+    entry->inst->funct3 = F3_SW;
+    entry->inst->rsrc1 = base;
+    entry->inst->rsrc2 = value;
+    entry->inst->imm = offset;
+    entry->status = ENTRY_COMPLETE;
+    return entry;
+}
+
+static const char *kind_name(atomic_kind_t kind){
+    switch (kind){
+        case ATOMIC_COUNTER: return "counter";
+        case ATOMIC_LOCK: return "lock";
+        default: return "barrier";
+    }
+}
+
+/* the object called name, made on first use */
+static atomic_object_t *atomic_object(char *name, atomic_kind_t kind){
+    atomic_object_t *object;
+    mem_entry_t *entry;
+
+    for (object=atomic_objects;object;object=object->next){
+        if (strcmp(object->name,name) == 0){
+            if (object->kind != kind){
+                char buff[200];
+                snprintf(buff,sizeof(buff),"%s is a %s, not a %s",name,kind_name(object->kind),kind_name(kind));
+                yyerror(buff);
+            }
+            return object;
+        }
+    }
+
+    entry = new_fill(((kind == ATOMIC_BARRIER) ? 2 : 1)*ATOMIC_LINE/8,8,0);
+    entry->name = strdup(name);
+    symtab_new(entry->name,SYMTAB_MEM);
+    pending_objects = append_inst(pending_objects,entry);
+
+    object = (atomic_object_t*)malloc(sizeof(atomic_object_t));
+    object->kind = kind;
+    object->name = strdup(name);
+    object->entry = entry;
+    object->count = 0;
+    object->next = NULL;
+    if (last_object)
+        last_object->next = object;
+    else
+        atomic_objects = object;
+    last_object = object;
+    return object;
+}
+
+mem_entry_t *atomic_add(char *name, uint32_t value){
+    mem_entry_t *list;
+
+    if (value == ATOMIC_ADDR_REG)
+        yyerror("atomic_add can not add $t4, it is used for the address");
+    atomic_object(name,ATOMIC_COUNTER);
+    list = gen_address(ATOMIC_ADDR_REG,name);
+    return append_inst(list,gen_amo(RISCV_AMOADD_D,OP_AMOADD_D,F3_AMOADD_D,F7_AMOADD_D,0,0,ATOMIC_ADDR_REG,value));
+}
+
+/* spins on a plain load while the lock is held, so only the swap that can win takes the line */
+mem_entry_t *lock_acquire(char *name){
+    mem_entry_t *again = new_join_node();
+    mem_entry_t *list;
+
+    atomic_object(name,ATOMIC_LOCK);
+    list = gen_address(ATOMIC_ADDR_REG,name);
+    list = append_inst(list,gen_imm_op(RISCV_ADDI,OP_ADDI,F3_ADDI,ATOMIC_REG_A,0,1));
+    list = append_inst(list,again);
+    list = append_inst(list,gen_word_load(ATOMIC_REG_B,ATOMIC_ADDR_REG,0));
+    list = append_inst(list,gen_branch(RISCV_BNE,OP_BNE,F3_BNE,ATOMIC_REG_B,0,again->name));
+    list = append_inst(list,gen_amo(RISCV_AMOSWAP_W,OP_AMOSWAP_W,F3_AMOSWAP_W,F7_AMOSWAP_W,F7_AMO_AQ,ATOMIC_REG_B,ATOMIC_ADDR_REG,ATOMIC_REG_A));
+    list = append_inst(list,gen_branch(RISCV_BNE,OP_BNE,F3_BNE,ATOMIC_REG_B,0,again->name));
+    return list;
+}
+
+mem_entry_t *lock_release(char *name){
+    mem_entry_t *list;
+
+    atomic_object(name,ATOMIC_LOCK);
+    list = gen_address(ATOMIC_ADDR_REG,name);
+    return append_inst(list,gen_amo(RISCV_AMOSWAP_W,OP_AMOSWAP_W,F3_AMOSWAP_W,F7_AMOSWAP_W,F7_AMO_RL,0,ATOMIC_ADDR_REG,0));
+}
+
+/* 
+   the count is at name and the sense a line on: $t5 = the sense this 
+   round ends with, $t6 = the arrivals before this one, less the harts 
+   still to come
+*/
+mem_entry_t *sense_barrier(char *name, int64_t count){
+    mem_entry_t *wait = new_join_node();
+    mem_entry_t *done = new_join_node();
+    mem_entry_t *list;
+
+    list = gen_address(ATOMIC_ADDR_REG,name);
+    list = append_inst(list,gen_word_load(ATOMIC_REG_A,ATOMIC_ADDR_REG,ATOMIC_LINE));
+    list = append_inst(list,gen_imm_op(RISCV_XORI,OP_XORI,F3_XORI,ATOMIC_REG_A,ATOMIC_REG_A,1));
+    list = append_inst(list,gen_imm_op(RISCV_ADDI,OP_ADDI,F3_ADDI,ATOMIC_REG_B,0,1));
+    list = append_inst(list,gen_amo(RISCV_AMOADD_W,OP_AMOADD_W,F3_AMOADD_W,F7_AMOADD_W,F7_AMO_AQ | F7_AMO_RL,ATOMIC_REG_B,ATOMIC_ADDR_REG,ATOMIC_REG_B));
+    list = append_inst(list,gen_imm_op(RISCV_ADDI,OP_ADDI,F3_ADDI,ATOMIC_REG_B,ATOMIC_REG_B,1 - count));
+    list = append_inst(list,gen_branch(RISCV_BNE,OP_BNE,F3_BNE,ATOMIC_REG_B,0,wait->name));
+
+    /* the last one in resets the count, then flips the sense to let the others go */
+    list = append_inst(list,gen_word_store(0,ATOMIC_ADDR_REG,0));
+    list = append_inst(list,gen_imm_op(RISCV_ADDI,OP_ADDI,F3_ADDI,ATOMIC_REG_B,ATOMIC_ADDR_REG,ATOMIC_LINE));
+    list = append_inst(list,gen_amo(RISCV_AMOSWAP_W,OP_AMOSWAP_W,F3_AMOSWAP_W,F7_AMOSWAP_W,F7_AMO_RL,0,ATOMIC_REG_B,ATOMIC_REG_A));
+    list = append_inst(list,gen_jump(done->name));
+
+    list = append_inst(list,wait);
+    list = append_inst(list,gen_word_load(ATOMIC_REG_B,ATOMIC_ADDR_REG,ATOMIC_LINE));
+    list = append_inst(list,gen_branch(RISCV_BNE,OP_BNE,F3_BNE,ATOMIC_REG_B,ATOMIC_REG_A,wait->name));
+    list = append_inst(list,gen_fence());
+    return append_inst(list,done);
+}
+
+mem_entry_t *named_barrier(char *name, int64_t count){
+    atomic_object_t *object;
+
+    if ((count < 1) || (count > ATOMIC_MAX_COUNT)){
+        char buff[100];
+        sprintf(buff,"a barrier waits for 1 to %d harts",ATOMIC_MAX_COUNT);
+        yyerror(buff);
+    }
+    object = atomic_object(name,ATOMIC_BARRIER);
+    if (object->count && (object->count != count)){
+        char buff[200];
+        snprintf(buff,sizeof(buff),"barrier %s waits for %" PRId64 " harts, not %" PRId64,name,object->count,count);
+        yyerror(buff);
+    }
+    object->count = count;
+    return sense_barrier(name,count);
+}
+
+/* appends the pending objects to the end of a mem() block */
+mem_entry_t *flush_atomic_objects(mem_entry_t *list){
+    mem_entry_t *objects = pending_objects;
+    pending_objects = NULL;
+    if (objects)
+        return append_inst(list,objects);
+    return list;
+}
+
+void dump_atomic_objects(){
+    atomic_object_t *object = atomic_objects;
+
+    if (!object)
+        return;
+    printf("\nAtomics:\n");
+    while (object){
+        if (object->kind == ATOMIC_BARRIER)
+            printf("barrier:\t%s\t@0x%012" PRIx64 "\t%" PRId64 " hart%s\n",
+                   object->name,object->entry->address,object->count,(object->count == 1) ? "" : "s");
+        else
+            printf("%s:\t%s\t@0x%012" PRIx64 "\n",kind_name(object->kind),object->name,object->entry->address);
+        object = object->next;
+    }
+}
@@ -0,0 +1,76 @@
+/* This file is part of the DuctTape (dt) high-level assembler for 
+ * RISC-V. The dt project was written by Justin Severeid and Elliott 
+ * Forbes, University of Wisconsin-La Crosse, copyright 2020-2024.
+ *
+ * DuctTape is free software: you can redistribute it and/or modify 
+ * it under the terms of the GNU General Public License as published 
+ * by the Free Software Foundation, either version 3 of the License, 
+ * or (at your option) any later version.
+ *
+ * DuctTape is distributed in the hope that it will be useful, but 
+ * WITHOUT ANY WARRANTY; without even the implied warranty of 
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU 
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License 
+ * along with DuctTape. If not, see <https://www.gnu.org/licenses/>. 
+ *
+ *
+ *
+ * The dt project can be found at https://cs.uwlax.edu/~eforbes/dt/
+ *
+ * If you use dt in your published research, please consider 
+ * citing the following:
+ *
+ * Severeid, J. and Forbes, E., "dt: A High-level Assembler for RISC-V," 
+ * Proceedings of the 53rd Midwest Instruction and Computing Symposium, 
+ * April 2020. 
+ *
+ * If you found dt helpful, please let us know! Email eforbes@uwlax.edu
+ *
+ * There are bound to be bugs, let us know those too.
+ */
+
+
+/*
+ * prototypes for the atomic instructions and the lock, counter and 
+ * barrier constructs built on them
+ */
+
+#ifndef __ATOMIC_H__
+#define __ATOMIC_H__
+
+#include <stdint.h>
+#include <inttypes.h>
+
+#include "mem.h"
+
+#define ATOMIC_LINE 64 /* every object gets a line to itself, a barrier two */
+
+typedef enum {
+    ATOMIC_COUNTER,
+    ATOMIC_LOCK,
+    ATOMIC_BARRIER
+} atomic_kind_t;
+
+/* a lock, counter or barrier, laid out at the end of the mem() block it is first used in */
+typedef struct atomic_object_type {
+    atomic_kind_t kind;
+    char *name;
+    mem_entry_t *entry;
+    int64_t count;       /* barrier only, the harts it waits for */
+    struct atomic_object_type *next;
+} atomic_object_t;
+
+mem_entry_t * gen_amo(int, uint32_t, uint32_t, uint32_t, int64_t, uint32_t, uint32_t, uint32_t);
+mem_entry_t * atomic_add(char *, uint32_t);
+mem_entry_t * lock_acquire(char *);
+mem_entry_t * lock_release(char *);
+mem_entry_t * sense_barrier(char *, int64_t);
+mem_entry_t * named_barrier(char *, int64_t);
+mem_entry_t * flush_atomic_objects(mem_entry_t *);
+void dump_atomic_objects();
+
+extern atomic_object_t *atomic_objects;
+
+#endif
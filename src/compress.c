@@ -0,0 +1,410 @@
+/* This file is part of the DuctTape (dt) high-level assembler for 
+ * RISC-V. The dt project was written by Justin Severeid and Elliott 
+ * Forbes, University of Wisconsin-La Crosse, copyright 2020-2024.
+ *
+ * DuctTape is free software: you can redistribute it and/or modify 
+ * it under the terms of the GNU General Public License as published 
+ * by the Free Software Foundation, either version 3 of the License, 
+ * or (at your option) any later version.
+ *
+ * DuctTape is distributed in the hope that it will be useful, but 
+ * WITHOUT ANY WARRANTY; without even the implied warranty of 
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU 
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License 
+ * along with DuctTape. If not, see <https://www.gnu.org/licenses/>. 
+ *
+ *
+ *
+ * The dt project can be found at https://cs.uwlax.edu/~eforbes/dt/
+ *
+ * If you use dt in your published research, please consider 
+ * citing the following:
+ *
+ * Severeid, J. and Forbes, E., "dt: A High-level Assembler for RISC-V," 
+ * Proceedings of the 53rd Midwest Instruction and Computing Symposium, 
+ * April 2020. 
+ *
+ * If you found dt helpful, please let us know! Email eforbes@uwlax.edu
+ *
+ * There are bound to be bugs, let us know those too.
+ */
+
+
+/*
+ * the -compress pass, which rewrites instructions to their 16-bit
+ * rvc forms and then relaxes branches and jumps to a fixed point
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <inttypes.h>
+
+#include "riscvarch.h"
+#include "compress.h"
+#include "relax.h"
+#include "inst.h"
+#include "mem.h"
+#include "symtab.h"
+#include "util.h"
+
+/* the 3 bit register fields of the rvc formats can only name x8-x15 (f8-f15) */
+#define RVC_REG(r) (((r) >= 8) && ((r) <= 15))
+
+/* value fits in a signed immediate of the given width */
+/* value is a non-negative multiple of scale, no bigger than max */
+static BOOL fits_scaled(int64_t value, int scale, int64_t max){
+    return (value >= 0) && ((value % scale) == 0) && (value <= max);
+}
+
+/* 
+   pick the rvc form of an instruction, or RVC_NONE if it has none. branches and 
+   jumps with a labeled target are picked regardless of distance, the relaxation 
+   loop in compress_memblocks() checks that separately. branches and jumps with 
+   a numeric offset are never compressed, the offset was written by hand.
+*/
+int rvc_form(instruction_t *inst){
+    uint32_t rd = inst->rdst;
+    uint32_t rs1 = inst->rsrc1;
+    uint32_t rs2 = inst->rsrc2;
+    int32_t imm = inst->imm;
+
+    switch(inst->inst_id){
+        case RISCV_ADDI:
+            if ((rd == 0) && (rs1 == 0) && (imm == 0))
+                return RVC_NOP;
+            if ((rd == 2) && (rs1 == 2) && (imm != 0) && ((imm % 16) == 0) && fits_signed(imm,10))
+                return RVC_ADDI16SP;
+            if (RVC_REG(rd) && (rs1 == 2) && (imm != 0) && fits_scaled(imm,4,1020))
+                return RVC_ADDI4SPN;
+            if ((rd != 0) && (rd == rs1) && (imm != 0) && fits_signed(imm,6))
+                return RVC_ADDI;
+            if ((rd != 0) && (rs1 == 0) && fits_signed(imm,6))
+                return RVC_LI;
+            if ((rd != 0) && (rs1 != 0) && (imm == 0))
+                return RVC_MV;
+            break;
+        case RISCV_ADDIW:
+            if (inst->target_name) // the low half of an address-of, filled in later
+                break;
+            if ((rd != 0) && (rd == rs1) && fits_signed(imm,6))
+                return RVC_ADDIW;
+            if ((rd != 0) && (rs1 == 0) && fits_signed(imm,6)) // already sign-extended
+                return RVC_LI;
+            break;
+        case RISCV_LUI:
+            if (inst->target_name) // the high half of an address-of, filled in later
+                break;
+            /* the 20 bit field has to be a sign-extended, non-zero 6 bit value */
+            if ((rd != 0) && (rd != 2) && 
+                ((((imm & 0xfffff) >= 0x1) && ((imm & 0xfffff) <= 0x1f)) || ((imm & 0xfffff) >= 0xfffe0)))
+                return RVC_LUI;
+            break;
+        case RISCV_SLLI:
+            if ((rd != 0) && (rd == rs1) && (rs2 != 0)) // shamt is in rsrc2
+                return RVC_SLLI;
+            break;
+        case RISCV_SRLI:
+            if (RVC_REG(rd) && (rd == rs1) && (rs2 != 0))
+                return RVC_SRLI;
+            break;
+        case RISCV_SRAI:
+            if (RVC_REG(rd) && (rd == rs1) && (rs2 != 0))
+                return RVC_SRAI;
+            break;
+        case RISCV_ANDI:
+            if (RVC_REG(rd) && (rd == rs1) && fits_signed(imm,6))
+                return RVC_ANDI;
+            break;
+        case RISCV_SUB:
+            if (RVC_REG(rd) && (rd == rs1) && RVC_REG(rs2))
+                return RVC_SUB;
+            break;
+        case RISCV_SUBW:
+            if (RVC_REG(rd) && (rd == rs1) && RVC_REG(rs2))
+                return RVC_SUBW;
+            break;
+        /* the commutative ones can use either source as the destination */
+        case RISCV_XOR:
+            if (RVC_REG(rd) && RVC_REG(rs1) && RVC_REG(rs2) && ((rd == rs1) || (rd == rs2)))
+                return RVC_XOR;
+            break;
+        case RISCV_OR:
+            if (RVC_REG(rd) && RVC_REG(rs1) && RVC_REG(rs2) && ((rd == rs1) || (rd == rs2)))
+                return RVC_OR;
+            break;
+        case RISCV_AND:
+            if (RVC_REG(rd) && RVC_REG(rs1) && RVC_REG(rs2) && ((rd == rs1) || (rd == rs2)))
+                return RVC_AND;
+            break;
+        case RISCV_ADDW:
+            if (RVC_REG(rd) && RVC_REG(rs1) && RVC_REG(rs2) && ((rd == rs1) || (rd == rs2)))
+                return RVC_ADDW;
+            break;
+        case RISCV_ADD:
+            if ((rd != 0) && (((rs1 == 0) && (rs2 != 0)) || ((rs2 == 0) && (rs1 != 0))))
+                return RVC_MV;
+            if ((rd != 0) && (((rd == rs1) && (rs2 != 0)) || ((rd == rs2) && (rs1 != 0))))
+                return RVC_ADD;
+            break;
+        case RISCV_LW:
+            if ((rs1 == 2) && (rd != 0) && fits_scaled(imm,4,252))
+                return RVC_LWSP;
+            if (RVC_REG(rd) && RVC_REG(rs1) && fits_scaled(imm,4,124))
+                return RVC_LW;
+            break;
+        case RISCV_LD:
+            if (inst->target_name) // the low half of a pc-relative pair
+                break;
+            if ((rs1 == 2) && (rd != 0) && fits_scaled(imm,8,504))
+                return RVC_LDSP;
+            if (RVC_REG(rd) && RVC_REG(rs1) && fits_scaled(imm,8,248))
+                return RVC_LD;
+            break;
+        case RISCV_FLD:
+            if ((rs1 == 2) && fits_scaled(imm,8,504))
+                return RVC_FLDSP;
+            if (RVC_REG(rd) && RVC_REG(rs1) && fits_scaled(imm,8,248))
+                return RVC_FLD;
+            break;
+        case RISCV_SW:
+            if ((rs1 == 2) && fits_scaled(imm,4,252))
+                return RVC_SWSP;
+            if (RVC_REG(rs2) && RVC_REG(rs1) && fits_scaled(imm,4,124))
+                return RVC_SW;
+            break;
+        case RISCV_SD:
+            if ((rs1 == 2) && fits_scaled(imm,8,504))
+                return RVC_SDSP;
+            if (RVC_REG(rs2) && RVC_REG(rs1) && fits_scaled(imm,8,248))
+                return RVC_SD;
+            break;
+        case RISCV_FSD:
+            if ((rs1 == 2) && fits_scaled(imm,8,504))
+                return RVC_FSDSP;
+            if (RVC_REG(rs2) && RVC_REG(rs1) && fits_scaled(imm,8,248))
+                return RVC_FSD;
+            break;
+        case RISCV_JALR:
+            if ((rd == 0) && (rs1 != 0) && (imm == 0))
+                return RVC_JR;
+            if ((rd == 1) && (rs1 != 0) && (imm == 0))
+                return RVC_JALR;
+            break;
+        case RISCV_RET:
+            return RVC_JR;
+        case RISCV_EBREAK:
+            return RVC_EBREAK;
+        case RISCV_JAL:
+        case RISCV_J:
+            /* rv64 has no c.jal, only jumps that do not link */
+            if ((rd == 0) && inst->target_name)
+                return RVC_J;
+            break;
+        case RISCV_BEQ:
+            if (inst->target_name && ((RVC_REG(rs1) && (rs2 == 0)) || ((rs1 == 0) && RVC_REG(rs2))))
+                return RVC_BEQZ;
+            break;
+        case RISCV_BNE:
+            if (inst->target_name && ((RVC_REG(rs1) && (rs2 == 0)) || ((rs1 == 0) && RVC_REG(rs2))))
+                return RVC_BNEZ;
+            break;
+    }
+    return RVC_NONE;
+}
+
+/* for a compressed branch or jump, is its labeled target reachable at the current addresses */
+int rvc_target_in_range(mem_entry_t *entry){
+    int64_t target_address = symtab_lookup(entry->inst->target_name);
+    int64_t offset;
+
+    if ((target_address < 0) || (symtab_type(entry->inst->target_name) != SYMTAB_MEM))
+        return FALSE; // let calculate_offsets() complain about it
+    offset = target_address - (int64_t)entry->address;
+    if (offset & 0x1)
+        return FALSE;
+    if (rvc_form(entry->inst) == RVC_J)
+        return fits_signed(offset,12);
+    return fits_signed(offset,9);
+}
+
+static uint64_t memblock_bytes(memblock_list_t *block){
+    return block->head ? (block->max_address - block->min_address) + 1 : 0;
+}
+
+/* size of each mem() block before compressing, for the report */
+static uint64_t *uncompressed_bytes = NULL;
+
+/* 
+   start optimistic: everything with an rvc form gets compressed. the 
+   relaxation loop in relax_memblocks() then widens any branch or jump 
+   that can no longer reach its target.
+*/
+void compress_memblocks(){
+    memblock_list_t *list;
+    int nblocks = 0;
+    int i;
+
+    for (list = block_list; list; list = list->next)
+        nblocks++;
+    uncompressed_bytes = (uint64_t*)malloc(sizeof(uint64_t) * (nblocks + 1));
+
+    for (list = block_list, i = 0; list; list = list->next, i++){
+        mem_entry_t *working;
+        uncompressed_bytes[i] = memblock_bytes(list);
+        for (working = list->head; working; working = working->next){
+            if ((working->type == ENTRY_INSTRUCTION) && (rvc_form(working->inst) != RVC_NONE))
+                working->size = 2;
+        }
+    }
+}
+
+/* report the savings for each mem() block, once relaxation is done */
+void report_compression(){
+    memblock_list_t *list;
+    int i;
+
+    for (list = block_list, i = 0; list; list = list->next, i++){
+        mem_entry_t *working;
+        int total = 0;
+        int compressed = 0;
+        uint64_t before = uncompressed_bytes[i];
+        uint64_t after = memblock_bytes(list);
+        for (working = list->head; working; working = working->next){
+            if (working->type == ENTRY_INSTRUCTION){
+                total++;
+                if (working->size == 2)
+                    compressed++;
+            }
+        }
+        printf("compress: mem() block 0x%012" PRIx64 ": %" PRIu64 " -> %" PRIu64 " bytes (%+.1f%%), "
+               "%d of %d instructions compressed\n",
+               list->min_address,before,after,
+               before ? (100.0 * ((int64_t)after - (int64_t)before)) / before : 0.0,
+               compressed,total);
+    }
+    free(uncompressed_bytes);
+    uncompressed_bytes = NULL;
+    printf("compress: relaxation converged after %d pass%s\n",relax_passes,(relax_passes == 1) ? "" : "es");
+}
+
+/* the ci-type immediate is split into bit 5 (inst bit 12) and bits 4:0 (inst bits 6:2) */
+static uint32_t ci_imm(int32_t imm){
+    return (((imm >> 5) & 0x1) << 12) | ((imm & 0x1f) << 2);
+}
+
+uint32_t encode_compressed(instruction_t *inst){
+    uint32_t rd = inst->rdst;
+    uint32_t rs1 = inst->rsrc1;
+    uint32_t rs2 = inst->rsrc2;
+    int32_t imm = inst->imm;
+    uint32_t other; /* the source that is not also the destination, for the two operand forms */
+
+    switch(rvc_form(inst)){
+        /* quadrant 0 */
+        case RVC_ADDI4SPN:
+            return (0x0 << 13) | (((imm >> 4) & 0x3) << 11) | (((imm >> 6) & 0xf) << 7) | 
+                   (((imm >> 2) & 0x1) << 6) | (((imm >> 3) & 0x1) << 5) | ((rd & 0x7) << 2) | 0x0;
+        case RVC_FLD:
+            return (0x1 << 13) | (((imm >> 3) & 0x7) << 10) | ((rs1 & 0x7) << 7) | 
+                   (((imm >> 6) & 0x3) << 5) | ((rd & 0x7) << 2) | 0x0;
+        case RVC_LW:
+            return (0x2 << 13) | (((imm >> 3) & 0x7) << 10) | ((rs1 & 0x7) << 7) | 
+                   (((imm >> 2) & 0x1) << 6) | (((imm >> 6) & 0x1) << 5) | ((rd & 0x7) << 2) | 0x0;
+        case RVC_LD:
+            return (0x3 << 13) | (((imm >> 3) & 0x7) << 10) | ((rs1 & 0x7) << 7) | 
+                   (((imm >> 6) & 0x3) << 5) | ((rd & 0x7) << 2) | 0x0;
+        case RVC_FSD:
+            return (0x5 << 13) | (((imm >> 3) & 0x7) << 10) | ((rs1 & 0x7) << 7) | 
+                   (((imm >> 6) & 0x3) << 5) | ((rs2 & 0x7) << 2) | 0x0;
+        case RVC_SW:
+            return (0x6 << 13) | (((imm >> 3) & 0x7) << 10) | ((rs1 & 0x7) << 7) | 
+                   (((imm >> 2) & 0x1) << 6) | (((imm >> 6) & 0x1) << 5) | ((rs2 & 0x7) << 2) | 0x0;
+        case RVC_SD:
+            return (0x7 << 13) | (((imm >> 3) & 0x7) << 10) | ((rs1 & 0x7) << 7) | 
+                   (((imm >> 6) & 0x3) << 5) | ((rs2 & 0x7) << 2) | 0x0;
+        /* quadrant 1 */
+        case RVC_NOP:
+            return 0x0001;
+        case RVC_ADDI:
+            return (0x0 << 13) | ci_imm(imm) | (rd << 7) | 0x1;
+        case RVC_ADDIW:
+            return (0x1 << 13) | ci_imm(imm) | (rd << 7) | 0x1;
+        case RVC_LI:
+            return (0x2 << 13) | ci_imm(imm) | (rd << 7) | 0x1;
+        case RVC_ADDI16SP:
+            return (0x3 << 13) | (((imm >> 9) & 0x1) << 12) | (2 << 7) | (((imm >> 4) & 0x1) << 6) | 
+                   (((imm >> 6) & 0x1) << 5) | (((imm >> 7) & 0x3) << 3) | (((imm >> 5) & 0x1) << 2) | 0x1;
+        case RVC_LUI:
+            return (0x3 << 13) | ci_imm(imm) | (rd << 7) | 0x1;
+        case RVC_SRLI:
+            return (0x4 << 13) | ci_imm(rs2) | (0x0 << 10) | ((rd & 0x7) << 7) | 0x1;
+        case RVC_SRAI:
+            return (0x4 << 13) | ci_imm(rs2) | (0x1 << 10) | ((rd & 0x7) << 7) | 0x1;
+        case RVC_ANDI:
+            return (0x4 << 13) | ci_imm(imm) | (0x2 << 10) | ((rd & 0x7) << 7) | 0x1;
+        case RVC_SUB:
+            return (0x23 << 10) | ((rd & 0x7) << 7) | (0x0 << 5) | ((rs2 & 0x7) << 2) | 0x1;
+        case RVC_XOR:
+            other = (rd == rs1) ? rs2 : rs1;
+            return (0x23 << 10) | ((rd & 0x7) << 7) | (0x1 << 5) | ((other & 0x7) << 2) | 0x1;
+        case RVC_OR:
+            other = (rd == rs1) ? rs2 : rs1;
+            return (0x23 << 10) | ((rd & 0x7) << 7) | (0x2 << 5) | ((other & 0x7) << 2) | 0x1;
+        case RVC_AND:
+            other = (rd == rs1) ? rs2 : rs1;
+            return (0x23 << 10) | ((rd & 0x7) << 7) | (0x3 << 5) | ((other & 0x7) << 2) | 0x1;
+        case RVC_SUBW:
+            return (0x27 << 10) | ((rd & 0x7) << 7) | (0x0 << 5) | ((rs2 & 0x7) << 2) | 0x1;
+        case RVC_ADDW:
+            other = (rd == rs1) ? rs2 : rs1;
+            return (0x27 << 10) | ((rd & 0x7) << 7) | (0x1 << 5) | ((other & 0x7) << 2) | 0x1;
+        case RVC_J:
+            return (0x5 << 13) | (((imm >> 11) & 0x1) << 12) | (((imm >> 4) & 0x1) << 11) | 
+                   (((imm >> 8) & 0x3) << 9) | (((imm >> 10) & 0x1) << 8) | (((imm >> 6) & 0x1) << 7) | 
+                   (((imm >> 7) & 0x1) << 6) | (((imm >> 1) & 0x7) << 3) | (((imm >> 5) & 0x1) << 2) | 0x1;
+        case RVC_BEQZ:
+        case RVC_BNEZ:
+            /* the register being tested against x0 can be in either source */
+            other = (rs2 == 0) ? rs1 : rs2;
+            return (((rvc_form(inst) == RVC_BEQZ) ? 0x6 : 0x7) << 13) | (((imm >> 8) & 0x1) << 12) | 
+                   (((imm >> 3) & 0x3) << 10) | ((other & 0x7) << 7) | (((imm >> 6) & 0x3) << 5) | 
+                   (((imm >> 1) & 0x3) << 3) | (((imm >> 5) & 0x1) << 2) | 0x1;
+        /* quadrant 2 */
+        case RVC_SLLI:
+            return (0x0 << 13) | ci_imm(rs2) | (rd << 7) | 0x2;
+        case RVC_FLDSP:
+            return (0x1 << 13) | (((imm >> 5) & 0x1) << 12) | (rd << 7) | (((imm >> 3) & 0x3) << 5) | 
+                   (((imm >> 6) & 0x7) << 2) | 0x2;
+        case RVC_LWSP:
+            return (0x2 << 13) | (((imm >> 5) & 0x1) << 12) | (rd << 7) | (((imm >> 2) & 0x7) << 4) | 
+                   (((imm >> 6) & 0x3) << 2) | 0x2;
+        case RVC_LDSP:
+            return (0x3 << 13) | (((imm >> 5) & 0x1) << 12) | (rd << 7) | (((imm >> 3) & 0x3) << 5) | 
+                   (((imm >> 6) & 0x7) << 2) | 0x2;
+        case RVC_JR:
+            return (0x8 << 12) | (rs1 << 7) | 0x2;
+        case RVC_MV:
+            /* addi rd, rs, 0 and add rd, x0, rs are both a move */
+            other = ((inst->inst_id == RISCV_ADD) && (rs1 == 0)) ? rs2 : rs1;
+            return (0x8 << 12) | (rd << 7) | (other << 2) | 0x2;
+        case RVC_EBREAK:
+            return 0x9002;
+        case RVC_JALR:
+            return (0x9 << 12) | (rs1 << 7) | 0x2;
+        case RVC_ADD:
+            other = (rd == rs1) ? rs2 : rs1;
+            return (0x9 << 12) | (rd << 7) | (other << 2) | 0x2;
+        case RVC_FSDSP:
+            return (0x5 << 13) | (((imm >> 3) & 0x7) << 10) | (((imm >> 6) & 0x7) << 7) | (rs2 << 2) | 0x2;
+        case RVC_SWSP:
+            return (0x6 << 13) | (((imm >> 2) & 0xf) << 9) | (((imm >> 6) & 0x3) << 7) | (rs2 << 2) | 0x2;
+        case RVC_SDSP:
+            return (0x7 << 13) | (((imm >> 3) & 0x7) << 10) | (((imm >> 6) & 0x7) << 7) | (rs2 << 2) | 0x2;
+    }
+    yyerror("Instruction marked as compressed has no rvc form");
+    return 0;
+}
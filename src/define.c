@@ -0,0 +1,316 @@
+/* This file is part of the DuctTape (dt) high-level assembler for 
+ * RISC-V. The dt project was written by Justin Severeid and Elliott 
+ * Forbes, University of Wisconsin-La Crosse, copyright 2020-2024.
+ *
+ * DuctTape is free software: you can redistribute it and/or modify 
+ * it under the terms of the GNU General Public License as published 
+ * by the Free Software Foundation, either version 3 of the License, 
+ * or (at your option) any later version.
+ *
+ * DuctTape is distributed in the hope that it will be useful, but 
+ * WITHOUT ANY WARRANTY; without even the implied warranty of 
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU 
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License 
+ * along with DuctTape. If not, see <https://www.gnu.org/licenses/>. 
+ *
+ *
+ *
+ * The dt project can be found at https://cs.uwlax.edu/~eforbes/dt/
+ *
+ * If you use dt in your published research, please consider 
+ * citing the following:
+ *
+ * Severeid, J. and Forbes, E., "dt: A High-level Assembler for RISC-V," 
+ * Proceedings of the 53rd Midwest Instruction and Computing Symposium, 
+ * April 2020. 
+ *
+ * If you found dt helpful, please let us know! Email eforbes@uwlax.edu
+ *
+ * There are bound to be bugs, let us know those too.
+ */
+
+
+
+/*
+ * -D constants and -sweep
+ *
+ * -D NAME=value makes NAME stand for value everywhere in the source, so 
+ * it can go anywhere an immediate can, and .if (NAME > 4) can test it. 
+ * -D NAME on its own is NAME=1.
+ *
+ * -sweep NAME=1..4096:x2 assembles the program once for each value in 
+ * the range, with NAME defined as that value. The step is :xK to 
+ * multiply or :+K to add, +1 if it is left off, and NAME=1,3,7 lists 
+ * the values instead. With more than one -sweep every combination is 
+ * assembled. Each variant's output files get _NAME<value> added to 
+ * their base name, a_N64.out and so on.
+ *
+ * The sources are scanned once into a token tape (see include.c), and 
+ * each variant runs in a forked copy of dt that replays the tape 
+ * through the parser and every pass after it. A swept value can change 
+ * the size of a fill, which arm of an .if is taken and so every address 
+ * after it, so the IR itself is built per variant, but each one starts 
+ * from a clean slate and one that fails to assemble doesn't stop the 
+ * rest.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include "define.h"
+#include "include.h"
+#include "util.h"
+
+typedef struct define_type {
+    char *name;
+    int64_t value;
+    struct define_type *next;
+} define_t;
+
+typedef struct {
+    char *name;
+    int nvalues;
+    int64_t *values;
+} sweep_t;
+
+static define_t *defines = NULL;
+static sweep_t sweeps[SWEEP_MAX];
+static int nsweeps = 0;
+
+static void set_define(char *name, int64_t value){
+    define_t *working;
+
+    for (working = defines; working; working = working->next){
+        if (strcmp(working->name,name) == 0){
+            working->value = value;
+            return;
+        }
+    }
+    working = (define_t*)malloc(sizeof(define_t));
+    working->name = strdup(name);
+    working->value = value;
+    working->next = defines;
+    defines = working;
+}
+
+BOOL lookup_define(char *name, int64_t *value){
+    define_t *working;
+
+    for (working = defines; working; working = working->next){
+        if (strcmp(working->name,name) == 0){
+            *value = working->value;
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+/* a name the lexer would hand out as a label, [a-z][a-z0-9_]* */
+static BOOL valid_name(char *name){
+    int i;
+
+    if (!((name[0] >= 'a') && (name[0] <= 'z')) && !((name[0] >= 'A') && (name[0] <= 'Z')))
+        return FALSE;
+    for (i=1;name[i];i++){
+        if (!((name[i] >= 'a') && (name[i] <= 'z')) && !((name[i] >= 'A') && (name[i] <= 'Z')) &&
+            !((name[i] >= '0') && (name[i] <= '9')) && (name[i] != '_'))
+            return FALSE;
+    }
+    return TRUE;
+}
+
+/* decimal or 0x hex, the same as an immediate in the source, and 
+   nothing may follow it */
+static BOOL parse_number(char *text, int64_t *value){
+    char *end;
+    int base = 10;
+
+    if ((text[0] == '0') && ((text[1] == 'x') || (text[1] == 'X')))
+        base = 16;
+    if (*text == '\0')
+        return FALSE;
+    *value = strtoll(text,&end,base);
+    return *end == '\0';
+}
+
+/* NAME=value or NAME */
+BOOL parse_define(char *arg){
+    char *name = strdup(arg);
+    char *equals = strchr(name,'=');
+    int64_t value = 1;
+
+    if (equals){
+        *equals = '\0';
+        if (!parse_number(equals+1,&value))
+            return FALSE;
+    }
+    if (!valid_name(name))
+        return FALSE;
+    set_define(name,value);
+    return TRUE;
+}
+
+static void push_value(sweep_t *sweep, int64_t value){
+    sweep->values = (int64_t*)realloc(sweep->values,sizeof(int64_t)*(sweep->nvalues+1));
+    sweep->values[sweep->nvalues++] = value;
+}
+
+/* NAME=lo..hi, NAME=lo..hi:xK, NAME=lo..hi:+K or NAME=a,b,c */
+BOOL parse_sweep(char *arg){
+    char *name = strdup(arg);
+    char *equals = strchr(name,'=');
+    char *range;
+    sweep_t *sweep;
+    int i;
+
+    if ((nsweeps == SWEEP_MAX) || !equals)
+        return FALSE;
+    *equals = '\0';
+    if (!valid_name(name))
+        return FALSE;
+    for (i=0;i<nsweeps;i++){
+        if (strcmp(sweeps[i].name,name) == 0)
+            return FALSE;
+    }
+    sweep = &sweeps[nsweeps];
+    sweep->name = name;
+    sweep->nvalues = 0;
+    sweep->values = NULL;
+
+    if ((range = strstr(equals+1,".."))){
+        char *step = strchr(range,':');
+        int64_t low, high, amount = 1, value;
+        BOOL multiply = FALSE;
+
+        *range = '\0';
+        if (step){
+            *step++ = '\0';
+            if ((*step == 'x') || (*step == '*'))
+                multiply = TRUE;
+            else if (*step != '+')
+                return FALSE;
+            if (!parse_number(step+1,&amount))
+                return FALSE;
+        }
+        if (!parse_number(equals+1,&low) || !parse_number(range+2,&high) || (low > high))
+            return FALSE;
+        if (multiply ? ((amount < 2) || (low < 1)) : (amount < 1))
+            return FALSE;
+        for (value = low;;){
+            push_value(sweep,value);
+            if (multiply ? (value > high / amount) : (value > high - amount))
+                break;
+            value = multiply ? value * amount : value + amount;
+        }
+    }
+    else {
+        char *item;
+        for (item = strtok(equals+1,","); item; item = strtok(NULL,",")){
+            int64_t value;
+            if (!parse_number(item,&value))
+                return FALSE;
+            push_value(sweep,value);
+        }
+        if (sweep->nvalues == 0)
+            return FALSE;
+    }
+
+    nsweeps++;
+    return TRUE;
+}
+
+int sweep_count(){
+    return nsweeps;
+}
+
+/* defines the swept names for one variant and returns its file base */
+static char * start_variant(char *file_base, int *index){
+    int length = strlen(file_base) + 1;
+    char *variant;
+    int i;
+
+    for (i=0;i<nsweeps;i++)
+        length += strlen(sweeps[i].name) + 24;
+    variant = (char*)malloc(length);
+    strcpy(variant,file_base);
+    printf("Variant:");
+    for (i=0;i<nsweeps;i++){
+        int64_t value = sweeps[i].values[index[i]];
+        set_define(sweeps[i].name,value);
+        sprintf(variant+strlen(variant),"_%s%" PRId64,sweeps[i].name,value);
+        printf(" %s=%" PRId64,sweeps[i].name,value);
+    }
+    printf(", output %s\n",variant);
+    fflush(stdout);
+    return variant;
+}
+
+/* scans the sources onto the tape, then forks a child for every 
+   combination of the swept values, one at a time. Only the children 
+   return, with their variant's file base, and go on to parse and 
+   assemble as usual. The parent exits with the first non-zero status 
+   any variant had. */
+char * sweep_variants(char *file_base, char **input_files, int input_file_count){
+    int index[SWEEP_MAX] = {0};
+    int variants = 0;
+    int failures = 0;
+    int first_status = 0;
+    int i;
+
+    for (i=0;i<input_file_count;i++){
+        FILE *fd = fopen(input_files[i],"r");
+        if (!fd){
+            fprintf(stderr,"Could not open source file: %s\n",input_files[i]);
+            exit(1);
+        }
+        record_source(fd,input_files[i]);
+        fclose(fd);
+    }
+
+    for (;;){
+        pid_t pid;
+        int status;
+
+        fflush(stdout);
+        fflush(stderr);
+        pid = fork();
+        if (pid < 0){
+            fprintf(stderr,"-sweep could not fork a variant\n");
+            exit(1);
+        }
+        if (pid == 0)
+            return start_variant(file_base,index);
+
+        waitpid(pid,&status,0);
+        status = WIFEXITED(status) ? WEXITSTATUS(status) : 128 + WTERMSIG(status);
+        variants++;
+        if (status != 0){
+            if (failures++ == 0)
+                first_status = status;
+            fprintf(stderr,"variant");
+            for (i=0;i<nsweeps;i++)
+                fprintf(stderr," %s=%" PRId64,sweeps[i].name,sweeps[i].values[index[i]]);
+            fprintf(stderr," exited with status %d\n",status);
+        }
+
+        /* the last -sweep steps fastest */
+        for (i=nsweeps-1;i>=0;i--){
+            if (++index[i] < sweeps[i].nvalues)
+                break;
+            index[i] = 0;
+        }
+        if (i < 0)
+            break;
+    }
+
+    if (failures > 0)
+        fprintf(stderr,"%d of %d variants exited with a non-zero status\n",failures,variants);
+    exit(first_status);
+}
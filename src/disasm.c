@@ -0,0 +1,1157 @@
+/* This file is part of the DuctTape (dt) high-level assembler for 
+ * RISC-V. The dt project was written by Justin Severeid and Elliott 
+ * Forbes, University of Wisconsin-La Crosse, copyright 2020-2024.
+ *
+ * DuctTape is free software: you can redistribute it and/or modify 
+ * it under the terms of the GNU General Public License as published 
+ * by the Free Software Foundation, either version 3 of the License, 
+ * or (at your option) any later version.
+ *
+ * DuctTape is distributed in the hope that it will be useful, but 
+ * WITHOUT ANY WARRANTY; without even the implied warranty of 
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU 
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License 
+ * along with DuctTape. If not, see <https://www.gnu.org/licenses/>. 
+ *
+ *
+ *
+ * The dt project can be found at https://cs.uwlax.edu/~eforbes/dt/
+ *
+ * If you use dt in your published research, please consider 
+ * citing the following:
+ *
+ * Severeid, J. and Forbes, E., "dt: A High-level Assembler for RISC-V," 
+ * Proceedings of the 53rd Midwest Instruction and Computing Symposium, 
+ * April 2020. 
+ *
+ * If you found dt helpful, please let us know! Email eforbes@uwlax.edu
+ *
+ * There are bound to be bugs, let us know those too.
+ */
+
+
+
+/*
+ * -disasm, reading images back in
+ *
+ * Each input is an ELF executable, a .bin file or a .txt file as dt 
+ * writes them, and its instructions are printed the way -checking prints 
+ * them, through sprint_asm() and sprint_entry(). Addresses that have a 
+ * name in the ELF .symtab get a label line, and branches and jumps to 
+ * them are followed by the name.
+ *
+ * A 32-bit word is decoded with decode_table below. Each row is the 
+ * instruction's fixed bits, built from the same OP_, F3_, F7_, F6_, 
+ * MOP_, RS1_ and RS2_ macros the grammar hands to the encoder, and a 
+ * mask of which bits those are. The rows are bucketed on the opcode, 
+ * funct3 and top six bits, and in each bucket the rows with the most 
+ * fixed bits come first, so ret is found before jalr and j before jal. A 16-bit parcel 
+ * is expanded to the instruction that -compress would have shrunk to it, 
+ * so sprint_entry() prints it.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <time.h>
+#include <elf.h>
+
+#include "riscvarch.h"
+#include "disasm.h"
+#include "compress.h"
+#include "inst.h"
+#include "mem.h"
+#include "output.h"
+#include "util.h"
+
+extern char *current_file;
+extern int yylineno;
+
+/* which fields a row's instruction keeps, the same split as encode_instruction() */
+#define DECODE_R        0
+#define DECODE_R4       1
+#define DECODE_I        2
+#define DECODE_S        3
+#define DECODE_B        4
+#define DECODE_U        5
+#define DECODE_J        6
+#define DECODE_SHIFT    7 /* r-type with a 6 bit shamt, its top bit is funct7's low bit */
+#define DECODE_CSR      8 /* i-type with the csr number in imm, not sign-extended */
+
+typedef struct {
+    int inst_id;
+    int format;
+    uint32_t match;
+    uint32_t mask;
+} decode_row_t;
+
+/* a row for every RISCV_ id the grammar makes, in id order. jr is made as a jalr, so RISCV_JR has none */
+static const decode_row_t decode_table[] = {
+    {RISCV_LUI,              DECODE_U,     OP_LUI, 0x0000007f},
+    {RISCV_AUIPC,            DECODE_U,     OP_AUIPC, 0x0000007f},
+    {RISCV_JAL,              DECODE_J,     OP_JAL, 0x0000007f},
+    {RISCV_JALR,             DECODE_I,     OP_JALR, 0x0000707f},
+    {RISCV_BEQ,              DECODE_B,     OP_BEQ, 0x0000707f},
+    {RISCV_BNE,              DECODE_B,     OP_BNE | (F3_BNE<<12), 0x0000707f},
+    {RISCV_BLT,              DECODE_B,     OP_BLT | (F3_BLT<<12), 0x0000707f},
+    {RISCV_BGE,              DECODE_B,     OP_BGE | (F3_BGE<<12), 0x0000707f},
+    {RISCV_BLTU,             DECODE_B,     OP_BLTU | (F3_BLTU<<12), 0x0000707f},
+    {RISCV_BGEU,             DECODE_B,     OP_BGEU | (F3_BGEU<<12), 0x0000707f},
+    {RISCV_LB,               DECODE_I,     OP_LB, 0x0000707f},
+    {RISCV_LH,               DECODE_I,     OP_LH | (F3_LH<<12), 0x0000707f},
+    {RISCV_LW,               DECODE_I,     OP_LW | (F3_LW<<12), 0x0000707f},
+    {RISCV_LBU,              DECODE_I,     OP_LBU | (F3_LBU<<12), 0x0000707f},
+    {RISCV_LHU,              DECODE_I,     OP_LHU | (F3_LHU<<12), 0x0000707f},
+    {RISCV_SB,               DECODE_S,     OP_SB | (F3_SB<<12), 0x0000707f},
+    {RISCV_SH,               DECODE_S,     OP_SH | (F3_SH<<12), 0x0000707f},
+    {RISCV_SW,               DECODE_S,     OP_SW | (F3_SW<<12), 0x0000707f},
+    {RISCV_ADDI,             DECODE_I,     OP_ADDI | (F3_ADDI<<12), 0x0000707f},
+    {RISCV_SLTI,             DECODE_I,     OP_SLTI | (F3_SLTI<<12), 0x0000707f},
+    {RISCV_SLTIU,            DECODE_I,     OP_SLTIU | (F3_SLTIU<<12), 0x0000707f},
+    {RISCV_XORI,             DECODE_I,     OP_XORI | (F3_XORI<<12), 0x0000707f},
+    {RISCV_ORI,              DECODE_I,     OP_ORI | (F3_ORI<<12), 0x0000707f},
+    {RISCV_ANDI,             DECODE_I,     OP_ANDI | (F3_ANDI<<12), 0x0000707f},
+    {RISCV_SLLI,             DECODE_SHIFT, OP_SLLI | (F3_SLLI<<12) | (F7_SLLI<<25), 0xfc00707f},
+    {RISCV_SRLI,             DECODE_SHIFT, OP_SRLI | (F3_SRLI<<12) | (F7_SRLI<<25), 0xfc00707f},
+    {RISCV_SRAI,             DECODE_SHIFT, OP_SRAI | (F3_SRAI<<12) | (F7_SRAI<<25), 0xfc00707f},
+    {RISCV_ADD,              DECODE_R,     OP_ADD, 0xfe00707f},
+    {RISCV_SUB,              DECODE_R,     OP_SUB | (F3_SUB<<12) | (F7_SUB<<25), 0xfe00707f},
+    {RISCV_SLL,              DECODE_R,     OP_SLL | (F3_SLL<<12) | (F7_SLL<<25), 0xfe00707f},
+    {RISCV_SLT,              DECODE_R,     OP_SLT | (F3_SLT<<12) | (F7_SLT<<25), 0xfe00707f},
+    {RISCV_SLTU,             DECODE_R,     OP_SLTU | (F3_SLTU<<12) | (F7_SLTU<<25), 0xfe00707f},
+    {RISCV_XOR,              DECODE_R,     OP_XOR | (F3_XOR<<12) | (F7_XOR<<25), 0xfe00707f},
+    {RISCV_SRL,              DECODE_R,     OP_SRL | (F3_SRL<<12) | (F7_SRL<<25), 0xfe00707f},
+    {RISCV_SRA,              DECODE_R,     OP_SRA | (F3_SRA<<12) | (F7_SRA<<25), 0xfe00707f},
+    {RISCV_OR,               DECODE_R,     OP_OR | (F3_OR<<12) | (F7_OR<<25), 0xfe00707f},
+    {RISCV_AND,              DECODE_R,     OP_AND | (F3_AND<<12) | (F7_AND<<25), 0xfe00707f},
+    {RISCV_FENCE,            DECODE_I,     OP_FENCE | (F3_FENCE<<12) | (FENCE_ALL<<20), 0xffffffff},
+    {RISCV_FENCE_I,          DECODE_I,     OP_FENCE_I | (F3_FENCE_I<<12), 0xffffffff},
+    {RISCV_ECALL,            DECODE_I,     OP_ECALL, 0xffffffff},
+    {RISCV_EBREAK,           DECODE_I,     OP_EBREAK | (0x1<<20), 0xffffffff},
+    {RISCV_CSRRW,            DECODE_CSR,   OP_CSRRW | (F3_CSRRW<<12), 0x0000707f},
+    {RISCV_CSRRS,            DECODE_CSR,   OP_CSRRS | (F3_CSRRS<<12), 0x0000707f},
+    {RISCV_CSRRC,            DECODE_CSR,   OP_CSRRC | (F3_CSRRC<<12), 0x0000707f},
+    {RISCV_CSRRWI,           DECODE_CSR,   OP_CSRRWI | (F3_CSRRWI<<12), 0x0000707f},
+    {RISCV_CSRRSI,           DECODE_CSR,   OP_CSRRSI | (F3_CSRRSI<<12), 0x0000707f},
+    {RISCV_CSRRCI,           DECODE_CSR,   OP_CSRRCI | (F3_CSRRCI<<12), 0x0000707f},
+    {RISCV_J,                DECODE_J,     OP_JAL, 0x00000fff},
+    {RISCV_RET,              DECODE_I,     OP_JALR | (0x1<<15), 0xffffffff},
+    {RISCV_MUL,              DECODE_R,     OP_MUL | (F7_MUL<<25), 0xfe00707f},
+    {RISCV_DIV,              DECODE_R,     OP_DIV | (F3_DIV<<12) | (F7_DIV<<25), 0xfe00707f},
+    {RISCV_ADDIW,            DECODE_I,     OP_ADDIW | (F3_ADDIW<<12), 0x0000707f},
+    {RISCV_LD,               DECODE_I,     OP_LD | (F3_LD<<12), 0x0000707f},
+    {RISCV_SD,               DECODE_S,     OP_SD | (F3_SD<<12), 0x0000707f},
+    {RISCV_LWU,              DECODE_I,     OP_LWU | (F3_LWU<<12), 0x0000707f},
+    {RISCV_SLLIW,            DECODE_R,     OP_SLLIW | (F3_SLLIW<<12) | (F7_SLLIW<<25), 0xfe00707f},
+    {RISCV_SRLIW,            DECODE_R,     OP_SRLIW | (F3_SRLIW<<12) | (F7_SRLIW<<25), 0xfe00707f},
+    {RISCV_SRAIW,            DECODE_R,     OP_SRAIW | (F3_SRAIW<<12) | (F7_SRAIW<<25), 0xfe00707f},
+    {RISCV_ADDW,             DECODE_R,     OP_ADDW | (F3_ADDW<<12) | (F7_ADDW<<25), 0xfe00707f},
+    {RISCV_SUBW,             DECODE_R,     OP_SUBW | (F3_SUBW<<12) | (F7_SUBW<<25), 0xfe00707f},
+    {RISCV_SLLW,             DECODE_R,     OP_SLLW | (F3_SLLW<<12) | (F7_SLLW<<25), 0xfe00707f},
+    {RISCV_SRLW,             DECODE_R,     OP_SRLW | (F3_SRLW<<12) | (F7_SRLW<<25), 0xfe00707f},
+    {RISCV_SRAW,             DECODE_R,     OP_SRAW | (F3_SRAW<<12) | (F7_SRAW<<25), 0xfe00707f},
+    {RISCV_MULH,             DECODE_R,     OP_MULH | (F3_MULH<<12) | (F7_MULH<<25), 0xfe00707f},
+    {RISCV_MULHSU,           DECODE_R,     OP_MULHSU | (F3_MULHSU<<12) | (F7_MULHSU<<25), 0xfe00707f},
+    {RISCV_MULHU,            DECODE_R,     OP_MULHU | (F3_MULHU<<12) | (F7_MULHU<<25), 0xfe00707f},
+    {RISCV_DIVU,             DECODE_R,     OP_DIVU | (F3_DIVU<<12) | (F7_DIVU<<25), 0xfe00707f},
+    {RISCV_REM,              DECODE_R,     OP_REM | (F3_REM<<12) | (F7_REM<<25), 0xfe00707f},
+    {RISCV_REMU,             DECODE_R,     OP_REMU | (F3_REMU<<12) | (F7_REMU<<25), 0xfe00707f},
+    {RISCV_MULW,             DECODE_R,     OP_MULW | (F3_MULW<<12) | (F7_MULW<<25), 0xfe00707f},
+    {RISCV_DIVW,             DECODE_R,     OP_DIVW | (F3_DIVW<<12) | (F7_DIVW<<25), 0xfe00707f},
+    {RISCV_DIVUW,            DECODE_R,     OP_DIVUW | (F3_DIVUW<<12) | (F7_DIVUW<<25), 0xfe00707f},
+    {RISCV_REMW,             DECODE_R,     OP_REMW | (F3_REMW<<12) | (F7_REMW<<25), 0xfe00707f},
+    {RISCV_REMUW,            DECODE_R,     OP_REMUW | (F3_REMUW<<12) | (F7_REMUW<<25), 0xfe00707f},
+    {RISCV_FLW,              DECODE_I,     OP_FLW | (F3_FLW<<12), 0x0000707f},
+    {RISCV_FSW,              DECODE_S,     OP_FSW | (F3_FSW<<12), 0x0000707f},
+    {RISCV_FMADD_S,          DECODE_R4,    OP_FMADD_S | (F7_FMADD_S<<25), 0x0600007f},
+    {RISCV_FMSUB_S,          DECODE_R4,    OP_FMSUB_S | (F7_FMSUB_S<<25), 0x0600007f},
+    {RISCV_FNMSUB_S,         DECODE_R4,    OP_FNMSUB_S | (F7_FNMSUB_S<<25), 0x0600007f},
+    {RISCV_FNMADD_S,         DECODE_R4,    OP_FNMADD_S | (F7_FNMADD_S<<25), 0x0600007f},
+    {RISCV_FADD_S,           DECODE_R,     OP_FADD_S | (F7_FADD_S<<25), 0xfe00007f},
+    {RISCV_FSUB_S,           DECODE_R,     OP_FSUB_S | (F7_FSUB_S<<25), 0xfe00007f},
+    {RISCV_FMUL_S,           DECODE_R,     OP_FMUL_S | (F7_FMUL_S<<25), 0xfe00007f},
+    {RISCV_FDIV_S,           DECODE_R,     OP_FDIV_S | (F7_FDIV_S<<25), 0xfe00007f},
+    {RISCV_FSQRT_S,          DECODE_R,     OP_FSQRT_S | (RS2_FSQRT_S<<20) | (F7_FSQRT_S<<25), 0xfff0007f},
+    {RISCV_FSGNJ_S,          DECODE_R,     OP_FSGNJ_S | (F3_FSGNJ_S<<12) | (F7_FSGNJ_S<<25), 0xfe00707f},
+    {RISCV_FSGNJN_S,         DECODE_R,     OP_FSGNJN_S | (F3_FSGNJN_S<<12) | (F7_FSGNJN_S<<25), 0xfe00707f},
+    {RISCV_FSGNJX_S,         DECODE_R,     OP_FSGNJX_S | (F3_FSGNJX_S<<12) | (F7_FSGNJX_S<<25), 0xfe00707f},
+    {RISCV_FMIN_S,           DECODE_R,     OP_FMIN_S | (F3_FMIN_S<<12) | (F7_FMIN_S<<25), 0xfe00707f},
+    {RISCV_FMAX_S,           DECODE_R,     OP_FMAX_S | (F3_FMAX_S<<12) | (F7_FMAX_S<<25), 0xfe00707f},
+    {RISCV_FEQ_S,            DECODE_R,     OP_FEQ_S | (F3_FEQ_S<<12) | (F7_FEQ_S<<25), 0xfe00707f},
+    {RISCV_FLT_S,            DECODE_R,     OP_FLT_S | (F3_FLT_S<<12) | (F7_FLT_S<<25), 0xfe00707f},
+    {RISCV_FLE_S,            DECODE_R,     OP_FLE_S | (F3_FLE_S<<12) | (F7_FLE_S<<25), 0xfe00707f},
+    {RISCV_FCLASS_S,         DECODE_R,     OP_FCLASS_S | (F3_FCLASS_S<<12) | (RS2_FCLASS_S<<20) | (F7_FCLASS_S<<25), 0xfff0707f},
+    {RISCV_FCVT_W_S,         DECODE_R,     OP_FCVT_W_S | (RS2_FCVT_W_S<<20) | (F7_FCVT_W_S<<25), 0xfff0007f},
+    {RISCV_FCVT_WU_S,        DECODE_R,     OP_FCVT_WU_S | (RS2_FCVT_WU_S<<20) | (F7_FCVT_WU_S<<25), 0xfff0007f},
+    {RISCV_FCVT_L_S,         DECODE_R,     OP_FCVT_L_S | (RS2_FCVT_L_S<<20) | (F7_FCVT_L_S<<25), 0xfff0007f},
+    {RISCV_FCVT_LU_S,        DECODE_R,     OP_FCVT_LU_S | (RS2_FCVT_LU_S<<20) | (F7_FCVT_LU_S<<25), 0xfff0007f},
+    {RISCV_FCVT_S_W,         DECODE_R,     OP_FCVT_S_W | (RS2_FCVT_S_W<<20) | (F7_FCVT_S_W<<25), 0xfff0007f},
+    {RISCV_FCVT_S_WU,        DECODE_R,     OP_FCVT_S_WU | (RS2_FCVT_S_WU<<20) | (F7_FCVT_S_WU<<25), 0xfff0007f},
+    {RISCV_FCVT_S_L,         DECODE_R,     OP_FCVT_S_L | (RS2_FCVT_S_L<<20) | (F7_FCVT_S_L<<25), 0xfff0007f},
+    {RISCV_FCVT_S_LU,        DECODE_R,     OP_FCVT_S_LU | (RS2_FCVT_S_LU<<20) | (F7_FCVT_S_LU<<25), 0xfff0007f},
+    {RISCV_FMV_X_W,          DECODE_R,     OP_FMV_X_W | (F3_FMV_X_W<<12) | (RS2_FMV_X_W<<20) | (F7_FMV_X_W<<25), 0xfff0707f},
+    {RISCV_FMV_W_X,          DECODE_R,     OP_FMV_W_X | (F3_FMV_W_X<<12) | (RS2_FMV_W_X<<20) | (F7_FMV_W_X<<25), 0xfff0707f},
+    {RISCV_FLD,              DECODE_I,     OP_FLD | (F3_FLD<<12), 0x0000707f},
+    {RISCV_FSD,              DECODE_S,     OP_FSD | (F3_FSD<<12), 0x0000707f},
+    {RISCV_FMADD_D,          DECODE_R4,    OP_FMADD_D | (F7_FMADD_D<<25), 0x0600007f},
+    {RISCV_FMSUB_D,          DECODE_R4,    OP_FMSUB_D | (F7_FMSUB_D<<25), 0x0600007f},
+    {RISCV_FNMSUB_D,         DECODE_R4,    OP_FNMSUB_D | (F7_FNMSUB_D<<25), 0x0600007f},
+    {RISCV_FNMADD_D,         DECODE_R4,    OP_FNMADD_D | (F7_FNMADD_D<<25), 0x0600007f},
+    {RISCV_FADD_D,           DECODE_R,     OP_FADD_D | (F7_FADD_D<<25), 0xfe00007f},
+    {RISCV_FSUB_D,           DECODE_R,     OP_FSUB_D | (F7_FSUB_D<<25), 0xfe00007f},
+    {RISCV_FMUL_D,           DECODE_R,     OP_FMUL_D | (F7_FMUL_D<<25), 0xfe00007f},
+    {RISCV_FDIV_D,           DECODE_R,     OP_FDIV_D | (F7_FDIV_D<<25), 0xfe00007f},
+    {RISCV_FSQRT_D,          DECODE_R,     OP_FSQRT_D | (RS2_FSQRT_D<<20) | (F7_FSQRT_D<<25), 0xfff0007f},
+    {RISCV_FSGNJ_D,          DECODE_R,     OP_FSGNJ_D | (F3_FSGNJ_D<<12) | (F7_FSGNJ_D<<25), 0xfe00707f},
+    {RISCV_FSGNJN_D,         DECODE_R,     OP_FSGNJN_D | (F3_FSGNJN_D<<12) | (F7_FSGNJN_D<<25), 0xfe00707f},
+    {RISCV_FSGNJX_D,         DECODE_R,     OP_FSGNJX_D | (F3_FSGNJX_D<<12) | (F7_FSGNJX_D<<25), 0xfe00707f},
+    {RISCV_FMIN_D,           DECODE_R,     OP_FMIN_D | (F3_FMIN_D<<12) | (F7_FMIN_D<<25), 0xfe00707f},
+    {RISCV_FMAX_D,           DECODE_R,     OP_FMAX_D | (F3_FMAX_D<<12) | (F7_FMAX_D<<25), 0xfe00707f},
+    {RISCV_FEQ_D,            DECODE_R,     OP_FEQ_D | (F3_FEQ_D<<12) | (F7_FEQ_D<<25), 0xfe00707f},
+    {RISCV_FLT_D,            DECODE_R,     OP_FLT_D | (F3_FLT_D<<12) | (F7_FLT_D<<25), 0xfe00707f},
+    {RISCV_FLE_D,            DECODE_R,     OP_FLE_D | (F3_FLE_D<<12) | (F7_FLE_D<<25), 0xfe00707f},
+    {RISCV_FCLASS_D,         DECODE_R,     OP_FCLASS_D | (F3_FCLASS_D<<12) | (RS2_FCLASS_D<<20) | (F7_FCLASS_D<<25), 0xfff0707f},
+    {RISCV_FCVT_W_D,         DECODE_R,     OP_FCVT_W_D | (RS2_FCVT_W_D<<20) | (F7_FCVT_W_D<<25), 0xfff0007f},
+    {RISCV_FCVT_WU_D,        DECODE_R,     OP_FCVT_WU_D | (RS2_FCVT_WU_D<<20) | (F7_FCVT_WU_D<<25), 0xfff0007f},
+    {RISCV_FCVT_L_D,         DECODE_R,     OP_FCVT_L_D | (RS2_FCVT_L_D<<20) | (F7_FCVT_L_D<<25), 0xfff0007f},
+    {RISCV_FCVT_LU_D,        DECODE_R,     OP_FCVT_LU_D | (RS2_FCVT_LU_D<<20) | (F7_FCVT_LU_D<<25), 0xfff0007f},
+    {RISCV_FCVT_D_W,         DECODE_R,     OP_FCVT_D_W | (F3_FCVT_D_W<<12) | (RS2_FCVT_D_W<<20) | (F7_FCVT_D_W<<25), 0xfff0707f},
+    {RISCV_FCVT_D_WU,        DECODE_R,     OP_FCVT_D_WU | (F3_FCVT_D_WU<<12) | (RS2_FCVT_D_WU<<20) | (F7_FCVT_D_WU<<25), 0xfff0707f},
+    {RISCV_FCVT_D_L,         DECODE_R,     OP_FCVT_D_L | (RS2_FCVT_D_L<<20) | (F7_FCVT_D_L<<25), 0xfff0007f},
+    {RISCV_FCVT_D_LU,        DECODE_R,     OP_FCVT_D_LU | (RS2_FCVT_D_LU<<20) | (F7_FCVT_D_LU<<25), 0xfff0007f},
+    {RISCV_FMV_X_D,          DECODE_R,     OP_FMV_X_D | (F3_FMV_X_D<<12) | (RS2_FMV_X_D<<20) | (F7_FMV_X_D<<25), 0xfff0707f},
+    {RISCV_FMV_D_X,          DECODE_R,     OP_FMV_D_X | (F3_FMV_D_X<<12) | (RS2_FMV_D_X<<20) | (F7_FMV_D_X<<25), 0xfff0707f},
+    {RISCV_FCVT_S_D,         DECODE_R,     OP_FCVT_S_D | (RS2_FCVT_S_D<<20) | (F7_FCVT_S_D<<25), 0xfff0007f},
+    {RISCV_FCVT_D_S,         DECODE_R,     OP_FCVT_D_S | (F3_FCVT_D_S<<12) | (RS2_FCVT_D_S<<20) | (F7_FCVT_D_S<<25), 0xfff0707f},
+    {RISCV_VSETVLI,          DECODE_I,     OP_VSETVLI | (F3_VSETVLI<<12), 0x8000707f},
+    {RISCV_VSETIVLI,         DECODE_I,     OP_VSETIVLI | (F3_VSETIVLI<<12) | (0x3<<30), 0xc000707f},
+    {RISCV_VSETVL,           DECODE_R,     OP_VSETVL | (F3_VSETVL<<12) | (F7_VSETVL<<25), 0xfe00707f},
+    {RISCV_VLE8_V,           DECODE_R,     OP_VLE8_V | (F3_VLE8_V<<12) | (RS2_VLE8_V<<20) | (MOP_VLE8_V<<26), 0xfdf0707f},
+    {RISCV_VLE8FF_V,         DECODE_R,     OP_VLE8FF_V | (F3_VLE8FF_V<<12) | (RS2_VLE8FF_V<<20) | (MOP_VLE8FF_V<<26), 0xfdf0707f},
+    {RISCV_VSE8_V,           DECODE_R,     OP_VSE8_V | (F3_VSE8_V<<12) | (RS2_VSE8_V<<20) | (MOP_VSE8_V<<26), 0xfdf0707f},
+    {RISCV_VLSE8_V,          DECODE_R,     OP_VLSE8_V | (F3_VLSE8_V<<12) | (MOP_VLSE8_V<<26), 0xfc00707f},
+    {RISCV_VSSE8_V,          DECODE_R,     OP_VSSE8_V | (F3_VSSE8_V<<12) | (MOP_VSSE8_V<<26), 0xfc00707f},
+    {RISCV_VLUXEI8_V,        DECODE_R,     OP_VLUXEI8_V | (F3_VLUXEI8_V<<12) | (MOP_VLUXEI8_V<<26), 0xfc00707f},
+    {RISCV_VLOXEI8_V,        DECODE_R,     OP_VLOXEI8_V | (F3_VLOXEI8_V<<12) | (MOP_VLOXEI8_V<<26), 0xfc00707f},
+    {RISCV_VSUXEI8_V,        DECODE_R,     OP_VSUXEI8_V | (F3_VSUXEI8_V<<12) | (MOP_VSUXEI8_V<<26), 0xfc00707f},
+    {RISCV_VSOXEI8_V,        DECODE_R,     OP_VSOXEI8_V | (F3_VSOXEI8_V<<12) | (MOP_VSOXEI8_V<<26), 0xfc00707f},
+    {RISCV_VLE16_V,          DECODE_R,     OP_VLE16_V | (F3_VLE16_V<<12) | (RS2_VLE16_V<<20) | (MOP_VLE16_V<<26), 0xfdf0707f},
+    {RISCV_VLE16FF_V,        DECODE_R,     OP_VLE16FF_V | (F3_VLE16FF_V<<12) | (RS2_VLE16FF_V<<20) | (MOP_VLE16FF_V<<26), 0xfdf0707f},
+    {RISCV_VSE16_V,          DECODE_R,     OP_VSE16_V | (F3_VSE16_V<<12) | (RS2_VSE16_V<<20) | (MOP_VSE16_V<<26), 0xfdf0707f},
+    {RISCV_VLSE16_V,         DECODE_R,     OP_VLSE16_V | (F3_VLSE16_V<<12) | (MOP_VLSE16_V<<26), 0xfc00707f},
+    {RISCV_VSSE16_V,         DECODE_R,     OP_VSSE16_V | (F3_VSSE16_V<<12) | (MOP_VSSE16_V<<26), 0xfc00707f},
+    {RISCV_VLUXEI16_V,       DECODE_R,     OP_VLUXEI16_V | (F3_VLUXEI16_V<<12) | (MOP_VLUXEI16_V<<26), 0xfc00707f},
+    {RISCV_VLOXEI16_V,       DECODE_R,     OP_VLOXEI16_V | (F3_VLOXEI16_V<<12) | (MOP_VLOXEI16_V<<26), 0xfc00707f},
+    {RISCV_VSUXEI16_V,       DECODE_R,     OP_VSUXEI16_V | (F3_VSUXEI16_V<<12) | (MOP_VSUXEI16_V<<26), 0xfc00707f},
+    {RISCV_VSOXEI16_V,       DECODE_R,     OP_VSOXEI16_V | (F3_VSOXEI16_V<<12) | (MOP_VSOXEI16_V<<26), 0xfc00707f},
+    {RISCV_VLE32_V,          DECODE_R,     OP_VLE32_V | (F3_VLE32_V<<12) | (RS2_VLE32_V<<20) | (MOP_VLE32_V<<26), 0xfdf0707f},
+    {RISCV_VLE32FF_V,        DECODE_R,     OP_VLE32FF_V | (F3_VLE32FF_V<<12) | (RS2_VLE32FF_V<<20) | (MOP_VLE32FF_V<<26), 0xfdf0707f},
+    {RISCV_VSE32_V,          DECODE_R,     OP_VSE32_V | (F3_VSE32_V<<12) | (RS2_VSE32_V<<20) | (MOP_VSE32_V<<26), 0xfdf0707f},
+    {RISCV_VLSE32_V,         DECODE_R,     OP_VLSE32_V | (F3_VLSE32_V<<12) | (MOP_VLSE32_V<<26), 0xfc00707f},
+    {RISCV_VSSE32_V,         DECODE_R,     OP_VSSE32_V | (F3_VSSE32_V<<12) | (MOP_VSSE32_V<<26), 0xfc00707f},
+    {RISCV_VLUXEI32_V,       DECODE_R,     OP_VLUXEI32_V | (F3_VLUXEI32_V<<12) | (MOP_VLUXEI32_V<<26), 0xfc00707f},
+    {RISCV_VLOXEI32_V,       DECODE_R,     OP_VLOXEI32_V | (F3_VLOXEI32_V<<12) | (MOP_VLOXEI32_V<<26), 0xfc00707f},
+    {RISCV_VSUXEI32_V,       DECODE_R,     OP_VSUXEI32_V | (F3_VSUXEI32_V<<12) | (MOP_VSUXEI32_V<<26), 0xfc00707f},
+    {RISCV_VSOXEI32_V,       DECODE_R,     OP_VSOXEI32_V | (F3_VSOXEI32_V<<12) | (MOP_VSOXEI32_V<<26), 0xfc00707f},
+    {RISCV_VLE64_V,          DECODE_R,     OP_VLE64_V | (F3_VLE64_V<<12) | (RS2_VLE64_V<<20) | (MOP_VLE64_V<<26), 0xfdf0707f},
+    {RISCV_VLE64FF_V,        DECODE_R,     OP_VLE64FF_V | (F3_VLE64FF_V<<12) | (RS2_VLE64FF_V<<20) | (MOP_VLE64FF_V<<26), 0xfdf0707f},
+    {RISCV_VSE64_V,          DECODE_R,     OP_VSE64_V | (F3_VSE64_V<<12) | (RS2_VSE64_V<<20) | (MOP_VSE64_V<<26), 0xfdf0707f},
+    {RISCV_VLSE64_V,         DECODE_R,     OP_VLSE64_V | (F3_VLSE64_V<<12) | (MOP_VLSE64_V<<26), 0xfc00707f},
+    {RISCV_VSSE64_V,         DECODE_R,     OP_VSSE64_V | (F3_VSSE64_V<<12) | (MOP_VSSE64_V<<26), 0xfc00707f},
+    {RISCV_VLUXEI64_V,       DECODE_R,     OP_VLUXEI64_V | (F3_VLUXEI64_V<<12) | (MOP_VLUXEI64_V<<26), 0xfc00707f},
+    {RISCV_VLOXEI64_V,       DECODE_R,     OP_VLOXEI64_V | (F3_VLOXEI64_V<<12) | (MOP_VLOXEI64_V<<26), 0xfc00707f},
+    {RISCV_VSUXEI64_V,       DECODE_R,     OP_VSUXEI64_V | (F3_VSUXEI64_V<<12) | (MOP_VSUXEI64_V<<26), 0xfc00707f},
+    {RISCV_VSOXEI64_V,       DECODE_R,     OP_VSOXEI64_V | (F3_VSOXEI64_V<<12) | (MOP_VSOXEI64_V<<26), 0xfc00707f},
+    {RISCV_VLM_V,            DECODE_R,     OP_VLM_V | (F3_VLM_V<<12) | (RS2_VLM_V<<20) | (((MOP_VLM_V<<1) | 1)<<25), 0xfff0707f},
+    {RISCV_VSM_V,            DECODE_R,     OP_VSM_V | (F3_VSM_V<<12) | (RS2_VSM_V<<20) | (((MOP_VSM_V<<1) | 1)<<25), 0xfff0707f},
+    {RISCV_VADD_VV,          DECODE_R,     OP_VADD_VV | (F3_VADD_VV<<12) | (F6_VADD_VV<<26), 0xfc00707f},
+    {RISCV_VADD_VX,          DECODE_R,     OP_VADD_VX | (F3_VADD_VX<<12) | (F6_VADD_VX<<26), 0xfc00707f},
+    {RISCV_VADD_VI,          DECODE_R,     OP_VADD_VI | (F3_VADD_VI<<12) | (F6_VADD_VI<<26), 0xfc00707f},
+    {RISCV_VSUB_VV,          DECODE_R,     OP_VSUB_VV | (F3_VSUB_VV<<12) | (F6_VSUB_VV<<26), 0xfc00707f},
+    {RISCV_VSUB_VX,          DECODE_R,     OP_VSUB_VX | (F3_VSUB_VX<<12) | (F6_VSUB_VX<<26), 0xfc00707f},
+    {RISCV_VRSUB_VX,         DECODE_R,     OP_VRSUB_VX | (F3_VRSUB_VX<<12) | (F6_VRSUB_VX<<26), 0xfc00707f},
+    {RISCV_VRSUB_VI,         DECODE_R,     OP_VRSUB_VI | (F3_VRSUB_VI<<12) | (F6_VRSUB_VI<<26), 0xfc00707f},
+    {RISCV_VMINU_VV,         DECODE_R,     OP_VMINU_VV | (F3_VMINU_VV<<12) | (F6_VMINU_VV<<26), 0xfc00707f},
+    {RISCV_VMINU_VX,         DECODE_R,     OP_VMINU_VX | (F3_VMINU_VX<<12) | (F6_VMINU_VX<<26), 0xfc00707f},
+    {RISCV_VMIN_VV,          DECODE_R,     OP_VMIN_VV | (F3_VMIN_VV<<12) | (F6_VMIN_VV<<26), 0xfc00707f},
+    {RISCV_VMIN_VX,          DECODE_R,     OP_VMIN_VX | (F3_VMIN_VX<<12) | (F6_VMIN_VX<<26), 0xfc00707f},
+    {RISCV_VMAXU_VV,         DECODE_R,     OP_VMAXU_VV | (F3_VMAXU_VV<<12) | (F6_VMAXU_VV<<26), 0xfc00707f},
+    {RISCV_VMAXU_VX,         DECODE_R,     OP_VMAXU_VX | (F3_VMAXU_VX<<12) | (F6_VMAXU_VX<<26), 0xfc00707f},
+    {RISCV_VMAX_VV,          DECODE_R,     OP_VMAX_VV | (F3_VMAX_VV<<12) | (F6_VMAX_VV<<26), 0xfc00707f},
+    {RISCV_VMAX_VX,          DECODE_R,     OP_VMAX_VX | (F3_VMAX_VX<<12) | (F6_VMAX_VX<<26), 0xfc00707f},
+    {RISCV_VAND_VV,          DECODE_R,     OP_VAND_VV | (F3_VAND_VV<<12) | (F6_VAND_VV<<26), 0xfc00707f},
+    {RISCV_VAND_VX,          DECODE_R,     OP_VAND_VX | (F3_VAND_VX<<12) | (F6_VAND_VX<<26), 0xfc00707f},
+    {RISCV_VAND_VI,          DECODE_R,     OP_VAND_VI | (F3_VAND_VI<<12) | (F6_VAND_VI<<26), 0xfc00707f},
+    {RISCV_VOR_VV,           DECODE_R,     OP_VOR_VV | (F3_VOR_VV<<12) | (F6_VOR_VV<<26), 0xfc00707f},
+    {RISCV_VOR_VX,           DECODE_R,     OP_VOR_VX | (F3_VOR_VX<<12) | (F6_VOR_VX<<26), 0xfc00707f},
+    {RISCV_VOR_VI,           DECODE_R,     OP_VOR_VI | (F3_VOR_VI<<12) | (F6_VOR_VI<<26), 0xfc00707f},
+    {RISCV_VXOR_VV,          DECODE_R,     OP_VXOR_VV | (F3_VXOR_VV<<12) | (F6_VXOR_VV<<26), 0xfc00707f},
+    {RISCV_VXOR_VX,          DECODE_R,     OP_VXOR_VX | (F3_VXOR_VX<<12) | (F6_VXOR_VX<<26), 0xfc00707f},
+    {RISCV_VXOR_VI,          DECODE_R,     OP_VXOR_VI | (F3_VXOR_VI<<12) | (F6_VXOR_VI<<26), 0xfc00707f},
+    {RISCV_VRGATHER_VV,      DECODE_R,     OP_VRGATHER_VV | (F3_VRGATHER_VV<<12) | (F6_VRGATHER_VV<<26), 0xfc00707f},
+    {RISCV_VRGATHER_VX,      DECODE_R,     OP_VRGATHER_VX | (F3_VRGATHER_VX<<12) | (F6_VRGATHER_VX<<26), 0xfc00707f},
+    {RISCV_VRGATHER_VI,      DECODE_R,     OP_VRGATHER_VI | (F3_VRGATHER_VI<<12) | (F6_VRGATHER_VI<<26), 0xfc00707f},
+    {RISCV_VSLIDEUP_VX,      DECODE_R,     OP_VSLIDEUP_VX | (F3_VSLIDEUP_VX<<12) | (F6_VSLIDEUP_VX<<26), 0xfc00707f},
+    {RISCV_VSLIDEUP_VI,      DECODE_R,     OP_VSLIDEUP_VI | (F3_VSLIDEUP_VI<<12) | (F6_VSLIDEUP_VI<<26), 0xfc00707f},
+    {RISCV_VSLIDEDOWN_VX,    DECODE_R,     OP_VSLIDEDOWN_VX | (F3_VSLIDEDOWN_VX<<12) | (F6_VSLIDEDOWN_VX<<26), 0xfc00707f},
+    {RISCV_VSLIDEDOWN_VI,    DECODE_R,     OP_VSLIDEDOWN_VI | (F3_VSLIDEDOWN_VI<<12) | (F6_VSLIDEDOWN_VI<<26), 0xfc00707f},
+    {RISCV_VMSEQ_VV,         DECODE_R,     OP_VMSEQ_VV | (F3_VMSEQ_VV<<12) | (F6_VMSEQ_VV<<26), 0xfc00707f},
+    {RISCV_VMSEQ_VX,         DECODE_R,     OP_VMSEQ_VX | (F3_VMSEQ_VX<<12) | (F6_VMSEQ_VX<<26), 0xfc00707f},
+    {RISCV_VMSEQ_VI,         DECODE_R,     OP_VMSEQ_VI | (F3_VMSEQ_VI<<12) | (F6_VMSEQ_VI<<26), 0xfc00707f},
+    {RISCV_VMSNE_VV,         DECODE_R,     OP_VMSNE_VV | (F3_VMSNE_VV<<12) | (F6_VMSNE_VV<<26), 0xfc00707f},
+    {RISCV_VMSNE_VX,         DECODE_R,     OP_VMSNE_VX | (F3_VMSNE_VX<<12) | (F6_VMSNE_VX<<26), 0xfc00707f},
+    {RISCV_VMSNE_VI,         DECODE_R,     OP_VMSNE_VI | (F3_VMSNE_VI<<12) | (F6_VMSNE_VI<<26), 0xfc00707f},
+    {RISCV_VMSLTU_VV,        DECODE_R,     OP_VMSLTU_VV | (F3_VMSLTU_VV<<12) | (F6_VMSLTU_VV<<26), 0xfc00707f},
+    {RISCV_VMSLTU_VX,        DECODE_R,     OP_VMSLTU_VX | (F3_VMSLTU_VX<<12) | (F6_VMSLTU_VX<<26), 0xfc00707f},
+    {RISCV_VMSLT_VV,         DECODE_R,     OP_VMSLT_VV | (F3_VMSLT_VV<<12) | (F6_VMSLT_VV<<26), 0xfc00707f},
+    {RISCV_VMSLT_VX,         DECODE_R,     OP_VMSLT_VX | (F3_VMSLT_VX<<12) | (F6_VMSLT_VX<<26), 0xfc00707f},
+    {RISCV_VMSLEU_VV,        DECODE_R,     OP_VMSLEU_VV | (F3_VMSLEU_VV<<12) | (F6_VMSLEU_VV<<26), 0xfc00707f},
+    {RISCV_VMSLEU_VX,        DECODE_R,     OP_VMSLEU_VX | (F3_VMSLEU_VX<<12) | (F6_VMSLEU_VX<<26), 0xfc00707f},
+    {RISCV_VMSLEU_VI,        DECODE_R,     OP_VMSLEU_VI | (F3_VMSLEU_VI<<12) | (F6_VMSLEU_VI<<26), 0xfc00707f},
+    {RISCV_VMSLE_VV,         DECODE_R,     OP_VMSLE_VV | (F3_VMSLE_VV<<12) | (F6_VMSLE_VV<<26), 0xfc00707f},
+    {RISCV_VMSLE_VX,         DECODE_R,     OP_VMSLE_VX | (F3_VMSLE_VX<<12) | (F6_VMSLE_VX<<26), 0xfc00707f},
+    {RISCV_VMSLE_VI,         DECODE_R,     OP_VMSLE_VI | (F3_VMSLE_VI<<12) | (F6_VMSLE_VI<<26), 0xfc00707f},
+    {RISCV_VMSGTU_VX,        DECODE_R,     OP_VMSGTU_VX | (F3_VMSGTU_VX<<12) | (F6_VMSGTU_VX<<26), 0xfc00707f},
+    {RISCV_VMSGTU_VI,        DECODE_R,     OP_VMSGTU_VI | (F3_VMSGTU_VI<<12) | (F6_VMSGTU_VI<<26), 0xfc00707f},
+    {RISCV_VMSGT_VX,         DECODE_R,     OP_VMSGT_VX | (F3_VMSGT_VX<<12) | (F6_VMSGT_VX<<26), 0xfc00707f},
+    {RISCV_VMSGT_VI,         DECODE_R,     OP_VMSGT_VI | (F3_VMSGT_VI<<12) | (F6_VMSGT_VI<<26), 0xfc00707f},
+    {RISCV_VSLL_VV,          DECODE_R,     OP_VSLL_VV | (F3_VSLL_VV<<12) | (F6_VSLL_VV<<26), 0xfc00707f},
+    {RISCV_VSLL_VX,          DECODE_R,     OP_VSLL_VX | (F3_VSLL_VX<<12) | (F6_VSLL_VX<<26), 0xfc00707f},
+    {RISCV_VSLL_VI,          DECODE_R,     OP_VSLL_VI | (F3_VSLL_VI<<12) | (F6_VSLL_VI<<26), 0xfc00707f},
+    {RISCV_VSRL_VV,          DECODE_R,     OP_VSRL_VV | (F3_VSRL_VV<<12) | (F6_VSRL_VV<<26), 0xfc00707f},
+    {RISCV_VSRL_VX,          DECODE_R,     OP_VSRL_VX | (F3_VSRL_VX<<12) | (F6_VSRL_VX<<26), 0xfc00707f},
+    {RISCV_VSRL_VI,          DECODE_R,     OP_VSRL_VI | (F3_VSRL_VI<<12) | (F6_VSRL_VI<<26), 0xfc00707f},
+    {RISCV_VSRA_VV,          DECODE_R,     OP_VSRA_VV | (F3_VSRA_VV<<12) | (F6_VSRA_VV<<26), 0xfc00707f},
+    {RISCV_VSRA_VX,          DECODE_R,     OP_VSRA_VX | (F3_VSRA_VX<<12) | (F6_VSRA_VX<<26), 0xfc00707f},
+    {RISCV_VSRA_VI,          DECODE_R,     OP_VSRA_VI | (F3_VSRA_VI<<12) | (F6_VSRA_VI<<26), 0xfc00707f},
+    {RISCV_VNSRL_WV,         DECODE_R,     OP_VNSRL_WV | (F3_VNSRL_WV<<12) | (F6_VNSRL_WV<<26), 0xfc00707f},
+    {RISCV_VNSRL_WX,         DECODE_R,     OP_VNSRL_WX | (F3_VNSRL_WX<<12) | (F6_VNSRL_WX<<26), 0xfc00707f},
+    {RISCV_VNSRL_WI,         DECODE_R,     OP_VNSRL_WI | (F3_VNSRL_WI<<12) | (F6_VNSRL_WI<<26), 0xfc00707f},
+    {RISCV_VNSRA_WV,         DECODE_R,     OP_VNSRA_WV | (F3_VNSRA_WV<<12) | (F6_VNSRA_WV<<26), 0xfc00707f},
+    {RISCV_VNSRA_WX,         DECODE_R,     OP_VNSRA_WX | (F3_VNSRA_WX<<12) | (F6_VNSRA_WX<<26), 0xfc00707f},
+    {RISCV_VNSRA_WI,         DECODE_R,     OP_VNSRA_WI | (F3_VNSRA_WI<<12) | (F6_VNSRA_WI<<26), 0xfc00707f},
+    {RISCV_VMERGE_VVM,       DECODE_R,     OP_VMERGE_VVM | (F3_VMERGE_VVM<<12) | (((F6_VMERGE_VVM<<1) | 0)<<25), 0xfe00707f},
+    {RISCV_VMERGE_VXM,       DECODE_R,     OP_VMERGE_VXM | (F3_VMERGE_VXM<<12) | (((F6_VMERGE_VXM<<1) | 0)<<25), 0xfe00707f},
+    {RISCV_VMERGE_VIM,       DECODE_R,     OP_VMERGE_VIM | (F3_VMERGE_VIM<<12) | (((F6_VMERGE_VIM<<1) | 0)<<25), 0xfe00707f},
+    {RISCV_VMV_V_V,          DECODE_R,     OP_VMV_V_V | (F3_VMV_V_V<<12) | (((F6_VMV_V_V<<1) | 1)<<25), 0xfff0707f},
+    {RISCV_VMV_V_X,          DECODE_R,     OP_VMV_V_X | (F3_VMV_V_X<<12) | (((F6_VMV_V_X<<1) | 1)<<25), 0xfff0707f},
+    {RISCV_VMV_V_I,          DECODE_R,     OP_VMV_V_I | (F3_VMV_V_I<<12) | (((F6_VMV_V_I<<1) | 1)<<25), 0xfff0707f},
+    {RISCV_VDIVU_VV,         DECODE_R,     OP_VDIVU_VV | (F3_VDIVU_VV<<12) | (F6_VDIVU_VV<<26), 0xfc00707f},
+    {RISCV_VDIVU_VX,         DECODE_R,     OP_VDIVU_VX | (F3_VDIVU_VX<<12) | (F6_VDIVU_VX<<26), 0xfc00707f},
+    {RISCV_VDIV_VV,          DECODE_R,     OP_VDIV_VV | (F3_VDIV_VV<<12) | (F6_VDIV_VV<<26), 0xfc00707f},
+    {RISCV_VDIV_VX,          DECODE_R,     OP_VDIV_VX | (F3_VDIV_VX<<12) | (F6_VDIV_VX<<26), 0xfc00707f},
+    {RISCV_VREMU_VV,         DECODE_R,     OP_VREMU_VV | (F3_VREMU_VV<<12) | (F6_VREMU_VV<<26), 0xfc00707f},
+    {RISCV_VREMU_VX,         DECODE_R,     OP_VREMU_VX | (F3_VREMU_VX<<12) | (F6_VREMU_VX<<26), 0xfc00707f},
+    {RISCV_VREM_VV,          DECODE_R,     OP_VREM_VV | (F3_VREM_VV<<12) | (F6_VREM_VV<<26), 0xfc00707f},
+    {RISCV_VREM_VX,          DECODE_R,     OP_VREM_VX | (F3_VREM_VX<<12) | (F6_VREM_VX<<26), 0xfc00707f},
+    {RISCV_VMULHU_VV,        DECODE_R,     OP_VMULHU_VV | (F3_VMULHU_VV<<12) | (F6_VMULHU_VV<<26), 0xfc00707f},
+    {RISCV_VMULHU_VX,        DECODE_R,     OP_VMULHU_VX | (F3_VMULHU_VX<<12) | (F6_VMULHU_VX<<26), 0xfc00707f},
+    {RISCV_VMUL_VV,          DECODE_R,     OP_VMUL_VV | (F3_VMUL_VV<<12) | (F6_VMUL_VV<<26), 0xfc00707f},
+    {RISCV_VMUL_VX,          DECODE_R,     OP_VMUL_VX | (F3_VMUL_VX<<12) | (F6_VMUL_VX<<26), 0xfc00707f},
+    {RISCV_VMULHSU_VV,       DECODE_R,     OP_VMULHSU_VV | (F3_VMULHSU_VV<<12) | (F6_VMULHSU_VV<<26), 0xfc00707f},
+    {RISCV_VMULHSU_VX,       DECODE_R,     OP_VMULHSU_VX | (F3_VMULHSU_VX<<12) | (F6_VMULHSU_VX<<26), 0xfc00707f},
+    {RISCV_VMULH_VV,         DECODE_R,     OP_VMULH_VV | (F3_VMULH_VV<<12) | (F6_VMULH_VV<<26), 0xfc00707f},
+    {RISCV_VMULH_VX,         DECODE_R,     OP_VMULH_VX | (F3_VMULH_VX<<12) | (F6_VMULH_VX<<26), 0xfc00707f},
+    {RISCV_VWADDU_VV,        DECODE_R,     OP_VWADDU_VV | (F3_VWADDU_VV<<12) | (F6_VWADDU_VV<<26), 0xfc00707f},
+    {RISCV_VWADDU_VX,        DECODE_R,     OP_VWADDU_VX | (F3_VWADDU_VX<<12) | (F6_VWADDU_VX<<26), 0xfc00707f},
+    {RISCV_VWADD_VV,         DECODE_R,     OP_VWADD_VV | (F3_VWADD_VV<<12) | (F6_VWADD_VV<<26), 0xfc00707f},
+    {RISCV_VWADD_VX,         DECODE_R,     OP_VWADD_VX | (F3_VWADD_VX<<12) | (F6_VWADD_VX<<26), 0xfc00707f},
+    {RISCV_VWSUBU_VV,        DECODE_R,     OP_VWSUBU_VV | (F3_VWSUBU_VV<<12) | (F6_VWSUBU_VV<<26), 0xfc00707f},
+    {RISCV_VWSUBU_VX,        DECODE_R,     OP_VWSUBU_VX | (F3_VWSUBU_VX<<12) | (F6_VWSUBU_VX<<26), 0xfc00707f},
+    {RISCV_VWSUB_VV,         DECODE_R,     OP_VWSUB_VV | (F3_VWSUB_VV<<12) | (F6_VWSUB_VV<<26), 0xfc00707f},
+    {RISCV_VWSUB_VX,         DECODE_R,     OP_VWSUB_VX | (F3_VWSUB_VX<<12) | (F6_VWSUB_VX<<26), 0xfc00707f},
+    {RISCV_VWMULU_VV,        DECODE_R,     OP_VWMULU_VV | (F3_VWMULU_VV<<12) | (F6_VWMULU_VV<<26), 0xfc00707f},
+    {RISCV_VWMULU_VX,        DECODE_R,     OP_VWMULU_VX | (F3_VWMULU_VX<<12) | (F6_VWMULU_VX<<26), 0xfc00707f},
+    {RISCV_VWMULSU_VV,       DECODE_R,     OP_VWMULSU_VV | (F3_VWMULSU_VV<<12) | (F6_VWMULSU_VV<<26), 0xfc00707f},
+    {RISCV_VWMULSU_VX,       DECODE_R,     OP_VWMULSU_VX | (F3_VWMULSU_VX<<12) | (F6_VWMULSU_VX<<26), 0xfc00707f},
+    {RISCV_VWMUL_VV,         DECODE_R,     OP_VWMUL_VV | (F3_VWMUL_VV<<12) | (F6_VWMUL_VV<<26), 0xfc00707f},
+    {RISCV_VWMUL_VX,         DECODE_R,     OP_VWMUL_VX | (F3_VWMUL_VX<<12) | (F6_VWMUL_VX<<26), 0xfc00707f},
+    {RISCV_VMADD_VV,         DECODE_R,     OP_VMADD_VV | (F3_VMADD_VV<<12) | (F6_VMADD_VV<<26), 0xfc00707f},
+    {RISCV_VMADD_VX,         DECODE_R,     OP_VMADD_VX | (F3_VMADD_VX<<12) | (F6_VMADD_VX<<26), 0xfc00707f},
+    {RISCV_VNMSUB_VV,        DECODE_R,     OP_VNMSUB_VV | (F3_VNMSUB_VV<<12) | (F6_VNMSUB_VV<<26), 0xfc00707f},
+    {RISCV_VNMSUB_VX,        DECODE_R,     OP_VNMSUB_VX | (F3_VNMSUB_VX<<12) | (F6_VNMSUB_VX<<26), 0xfc00707f},
+    {RISCV_VMACC_VV,         DECODE_R,     OP_VMACC_VV | (F3_VMACC_VV<<12) | (F6_VMACC_VV<<26), 0xfc00707f},
+    {RISCV_VMACC_VX,         DECODE_R,     OP_VMACC_VX | (F3_VMACC_VX<<12) | (F6_VMACC_VX<<26), 0xfc00707f},
+    {RISCV_VNMSAC_VV,        DECODE_R,     OP_VNMSAC_VV | (F3_VNMSAC_VV<<12) | (F6_VNMSAC_VV<<26), 0xfc00707f},
+    {RISCV_VNMSAC_VX,        DECODE_R,     OP_VNMSAC_VX | (F3_VNMSAC_VX<<12) | (F6_VNMSAC_VX<<26), 0xfc00707f},
+    {RISCV_VWMACCU_VV,       DECODE_R,     OP_VWMACCU_VV | (F3_VWMACCU_VV<<12) | (F6_VWMACCU_VV<<26), 0xfc00707f},
+    {RISCV_VWMACCU_VX,       DECODE_R,     OP_VWMACCU_VX | (F3_VWMACCU_VX<<12) | (F6_VWMACCU_VX<<26), 0xfc00707f},
+    {RISCV_VWMACC_VV,        DECODE_R,     OP_VWMACC_VV | (F3_VWMACC_VV<<12) | (F6_VWMACC_VV<<26), 0xfc00707f},
+    {RISCV_VWMACC_VX,        DECODE_R,     OP_VWMACC_VX | (F3_VWMACC_VX<<12) | (F6_VWMACC_VX<<26), 0xfc00707f},
+    {RISCV_VREDSUM_VS,       DECODE_R,     OP_VREDSUM_VS | (F3_VREDSUM_VS<<12) | (F6_VREDSUM_VS<<26), 0xfc00707f},
+    {RISCV_VREDAND_VS,       DECODE_R,     OP_VREDAND_VS | (F3_VREDAND_VS<<12) | (F6_VREDAND_VS<<26), 0xfc00707f},
+    {RISCV_VREDOR_VS,        DECODE_R,     OP_VREDOR_VS | (F3_VREDOR_VS<<12) | (F6_VREDOR_VS<<26), 0xfc00707f},
+    {RISCV_VREDXOR_VS,       DECODE_R,     OP_VREDXOR_VS | (F3_VREDXOR_VS<<12) | (F6_VREDXOR_VS<<26), 0xfc00707f},
+    {RISCV_VREDMINU_VS,      DECODE_R,     OP_VREDMINU_VS | (F3_VREDMINU_VS<<12) | (F6_VREDMINU_VS<<26), 0xfc00707f},
+    {RISCV_VREDMIN_VS,       DECODE_R,     OP_VREDMIN_VS | (F3_VREDMIN_VS<<12) | (F6_VREDMIN_VS<<26), 0xfc00707f},
+    {RISCV_VREDMAXU_VS,      DECODE_R,     OP_VREDMAXU_VS | (F3_VREDMAXU_VS<<12) | (F6_VREDMAXU_VS<<26), 0xfc00707f},
+    {RISCV_VREDMAX_VS,       DECODE_R,     OP_VREDMAX_VS | (F3_VREDMAX_VS<<12) | (F6_VREDMAX_VS<<26), 0xfc00707f},
+    {RISCV_VSLIDE1UP_VX,     DECODE_R,     OP_VSLIDE1UP_VX | (F3_VSLIDE1UP_VX<<12) | (F6_VSLIDE1UP_VX<<26), 0xfc00707f},
+    {RISCV_VSLIDE1DOWN_VX,   DECODE_R,     OP_VSLIDE1DOWN_VX | (F3_VSLIDE1DOWN_VX<<12) | (F6_VSLIDE1DOWN_VX<<26), 0xfc00707f},
+    {RISCV_VMV_X_S,          DECODE_R,     OP_VMV_X_S | (F3_VMV_X_S<<12) | (RS1_VMV_X_S<<15) | (((F6_VMV_X_S<<1) | 1)<<25), 0xfe0ff07f},
+    {RISCV_VMV_S_X,          DECODE_R,     OP_VMV_S_X | (F3_VMV_S_X<<12) | (((F6_VMV_S_X<<1) | 1)<<25), 0xfff0707f},
+    {RISCV_VCPOP_M,          DECODE_R,     OP_VCPOP_M | (F3_VCPOP_M<<12) | (RS1_VCPOP_M<<15) | (F6_VCPOP_M<<26), 0xfc0ff07f},
+    {RISCV_VFIRST_M,         DECODE_R,     OP_VFIRST_M | (F3_VFIRST_M<<12) | (RS1_VFIRST_M<<15) | (F6_VFIRST_M<<26), 0xfc0ff07f},
+    {RISCV_VIOTA_M,          DECODE_R,     OP_VIOTA_M | (F3_VIOTA_M<<12) | (RS1_VIOTA_M<<15) | (F6_VIOTA_M<<26), 0xfc0ff07f},
+    {RISCV_VID_V,            DECODE_R,     OP_VID_V | (F3_VID_V<<12) | (RS1_VID_V<<15) | (F6_VID_V<<26), 0xfdfff07f},
+    {RISCV_VMANDN_MM,        DECODE_R,     OP_VMANDN_MM | (F3_VMANDN_MM<<12) | (((F6_VMANDN_MM<<1) | 1)<<25), 0xfe00707f},
+    {RISCV_VMAND_MM,         DECODE_R,     OP_VMAND_MM | (F3_VMAND_MM<<12) | (((F6_VMAND_MM<<1) | 1)<<25), 0xfe00707f},
+    {RISCV_VMOR_MM,          DECODE_R,     OP_VMOR_MM | (F3_VMOR_MM<<12) | (((F6_VMOR_MM<<1) | 1)<<25), 0xfe00707f},
+    {RISCV_VMXOR_MM,         DECODE_R,     OP_VMXOR_MM | (F3_VMXOR_MM<<12) | (((F6_VMXOR_MM<<1) | 1)<<25), 0xfe00707f},
+    {RISCV_VMORN_MM,         DECODE_R,     OP_VMORN_MM | (F3_VMORN_MM<<12) | (((F6_VMORN_MM<<1) | 1)<<25), 0xfe00707f},
+    {RISCV_VMNAND_MM,        DECODE_R,     OP_VMNAND_MM | (F3_VMNAND_MM<<12) | (((F6_VMNAND_MM<<1) | 1)<<25), 0xfe00707f},
+    {RISCV_VMNOR_MM,         DECODE_R,     OP_VMNOR_MM | (F3_VMNOR_MM<<12) | (((F6_VMNOR_MM<<1) | 1)<<25), 0xfe00707f},
+    {RISCV_VMXNOR_MM,        DECODE_R,     OP_VMXNOR_MM | (F3_VMXNOR_MM<<12) | (((F6_VMXNOR_MM<<1) | 1)<<25), 0xfe00707f},
+    {RISCV_VFADD_VV,         DECODE_R,     OP_VFADD_VV | (F3_VFADD_VV<<12) | (F6_VFADD_VV<<26), 0xfc00707f},
+    {RISCV_VFADD_VF,         DECODE_R,     OP_VFADD_VF | (F3_VFADD_VF<<12) | (F6_VFADD_VF<<26), 0xfc00707f},
+    {RISCV_VFSUB_VV,         DECODE_R,     OP_VFSUB_VV | (F3_VFSUB_VV<<12) | (F6_VFSUB_VV<<26), 0xfc00707f},
+    {RISCV_VFSUB_VF,         DECODE_R,     OP_VFSUB_VF | (F3_VFSUB_VF<<12) | (F6_VFSUB_VF<<26), 0xfc00707f},
+    {RISCV_VFRSUB_VF,        DECODE_R,     OP_VFRSUB_VF | (F3_VFRSUB_VF<<12) | (F6_VFRSUB_VF<<26), 0xfc00707f},
+    {RISCV_VFMIN_VV,         DECODE_R,     OP_VFMIN_VV | (F3_VFMIN_VV<<12) | (F6_VFMIN_VV<<26), 0xfc00707f},
+    {RISCV_VFMIN_VF,         DECODE_R,     OP_VFMIN_VF | (F3_VFMIN_VF<<12) | (F6_VFMIN_VF<<26), 0xfc00707f},
+    {RISCV_VFMAX_VV,         DECODE_R,     OP_VFMAX_VV | (F3_VFMAX_VV<<12) | (F6_VFMAX_VV<<26), 0xfc00707f},
+    {RISCV_VFMAX_VF,         DECODE_R,     OP_VFMAX_VF | (F3_VFMAX_VF<<12) | (F6_VFMAX_VF<<26), 0xfc00707f},
+    {RISCV_VFSGNJ_VV,        DECODE_R,     OP_VFSGNJ_VV | (F3_VFSGNJ_VV<<12) | (F6_VFSGNJ_VV<<26), 0xfc00707f},
+    {RISCV_VFSGNJ_VF,        DECODE_R,     OP_VFSGNJ_VF | (F3_VFSGNJ_VF<<12) | (F6_VFSGNJ_VF<<26), 0xfc00707f},
+    {RISCV_VFSGNJN_VV,       DECODE_R,     OP_VFSGNJN_VV | (F3_VFSGNJN_VV<<12) | (F6_VFSGNJN_VV<<26), 0xfc00707f},
+    {RISCV_VFSGNJN_VF,       DECODE_R,     OP_VFSGNJN_VF | (F3_VFSGNJN_VF<<12) | (F6_VFSGNJN_VF<<26), 0xfc00707f},
+    {RISCV_VFSGNJX_VV,       DECODE_R,     OP_VFSGNJX_VV | (F3_VFSGNJX_VV<<12) | (F6_VFSGNJX_VV<<26), 0xfc00707f},
+    {RISCV_VFSGNJX_VF,       DECODE_R,     OP_VFSGNJX_VF | (F3_VFSGNJX_VF<<12) | (F6_VFSGNJX_VF<<26), 0xfc00707f},
+    {RISCV_VFDIV_VV,         DECODE_R,     OP_VFDIV_VV | (F3_VFDIV_VV<<12) | (F6_VFDIV_VV<<26), 0xfc00707f},
+    {RISCV_VFDIV_VF,         DECODE_R,     OP_VFDIV_VF | (F3_VFDIV_VF<<12) | (F6_VFDIV_VF<<26), 0xfc00707f},
+    {RISCV_VFRDIV_VF,        DECODE_R,     OP_VFRDIV_VF | (F3_VFRDIV_VF<<12) | (F6_VFRDIV_VF<<26), 0xfc00707f},
+    {RISCV_VFMUL_VV,         DECODE_R,     OP_VFMUL_VV | (F3_VFMUL_VV<<12) | (F6_VFMUL_VV<<26), 0xfc00707f},
+    {RISCV_VFMUL_VF,         DECODE_R,     OP_VFMUL_VF | (F3_VFMUL_VF<<12) | (F6_VFMUL_VF<<26), 0xfc00707f},
+    {RISCV_VMFEQ_VV,         DECODE_R,     OP_VMFEQ_VV | (F3_VMFEQ_VV<<12) | (F6_VMFEQ_VV<<26), 0xfc00707f},
+    {RISCV_VMFEQ_VF,         DECODE_R,     OP_VMFEQ_VF | (F3_VMFEQ_VF<<12) | (F6_VMFEQ_VF<<26), 0xfc00707f},
+    {RISCV_VMFLE_VV,         DECODE_R,     OP_VMFLE_VV | (F3_VMFLE_VV<<12) | (F6_VMFLE_VV<<26), 0xfc00707f},
+    {RISCV_VMFLE_VF,         DECODE_R,     OP_VMFLE_VF | (F3_VMFLE_VF<<12) | (F6_VMFLE_VF<<26), 0xfc00707f},
+    {RISCV_VMFLT_VV,         DECODE_R,     OP_VMFLT_VV | (F3_VMFLT_VV<<12) | (F6_VMFLT_VV<<26), 0xfc00707f},
+    {RISCV_VMFLT_VF,         DECODE_R,     OP_VMFLT_VF | (F3_VMFLT_VF<<12) | (F6_VMFLT_VF<<26), 0xfc00707f},
+    {RISCV_VMFNE_VV,         DECODE_R,     OP_VMFNE_VV | (F3_VMFNE_VV<<12) | (F6_VMFNE_VV<<26), 0xfc00707f},
+    {RISCV_VMFNE_VF,         DECODE_R,     OP_VMFNE_VF | (F3_VMFNE_VF<<12) | (F6_VMFNE_VF<<26), 0xfc00707f},
+    {RISCV_VMFGT_VF,         DECODE_R,     OP_VMFGT_VF | (F3_VMFGT_VF<<12) | (F6_VMFGT_VF<<26), 0xfc00707f},
+    {RISCV_VMFGE_VF,         DECODE_R,     OP_VMFGE_VF | (F3_VMFGE_VF<<12) | (F6_VMFGE_VF<<26), 0xfc00707f},
+    {RISCV_VFMADD_VV,        DECODE_R,     OP_VFMADD_VV | (F3_VFMADD_VV<<12) | (F6_VFMADD_VV<<26), 0xfc00707f},
+    {RISCV_VFMADD_VF,        DECODE_R,     OP_VFMADD_VF | (F3_VFMADD_VF<<12) | (F6_VFMADD_VF<<26), 0xfc00707f},
+    {RISCV_VFNMADD_VV,       DECODE_R,     OP_VFNMADD_VV | (F3_VFNMADD_VV<<12) | (F6_VFNMADD_VV<<26), 0xfc00707f},
+    {RISCV_VFNMADD_VF,       DECODE_R,     OP_VFNMADD_VF | (F3_VFNMADD_VF<<12) | (F6_VFNMADD_VF<<26), 0xfc00707f},
+    {RISCV_VFMSUB_VV,        DECODE_R,     OP_VFMSUB_VV | (F3_VFMSUB_VV<<12) | (F6_VFMSUB_VV<<26), 0xfc00707f},
+    {RISCV_VFMSUB_VF,        DECODE_R,     OP_VFMSUB_VF | (F3_VFMSUB_VF<<12) | (F6_VFMSUB_VF<<26), 0xfc00707f},
+    {RISCV_VFNMSUB_VV,       DECODE_R,     OP_VFNMSUB_VV | (F3_VFNMSUB_VV<<12) | (F6_VFNMSUB_VV<<26), 0xfc00707f},
+    {RISCV_VFNMSUB_VF,       DECODE_R,     OP_VFNMSUB_VF | (F3_VFNMSUB_VF<<12) | (F6_VFNMSUB_VF<<26), 0xfc00707f},
+    {RISCV_VFMACC_VV,        DECODE_R,     OP_VFMACC_VV | (F3_VFMACC_VV<<12) | (F6_VFMACC_VV<<26), 0xfc00707f},
+    {RISCV_VFMACC_VF,        DECODE_R,     OP_VFMACC_VF | (F3_VFMACC_VF<<12) | (F6_VFMACC_VF<<26), 0xfc00707f},
+    {RISCV_VFNMACC_VV,       DECODE_R,     OP_VFNMACC_VV | (F3_VFNMACC_VV<<12) | (F6_VFNMACC_VV<<26), 0xfc00707f},
+    {RISCV_VFNMACC_VF,       DECODE_R,     OP_VFNMACC_VF | (F3_VFNMACC_VF<<12) | (F6_VFNMACC_VF<<26), 0xfc00707f},
+    {RISCV_VFMSAC_VV,        DECODE_R,     OP_VFMSAC_VV | (F3_VFMSAC_VV<<12) | (F6_VFMSAC_VV<<26), 0xfc00707f},
+    {RISCV_VFMSAC_VF,        DECODE_R,     OP_VFMSAC_VF | (F3_VFMSAC_VF<<12) | (F6_VFMSAC_VF<<26), 0xfc00707f},
+    {RISCV_VFNMSAC_VV,       DECODE_R,     OP_VFNMSAC_VV | (F3_VFNMSAC_VV<<12) | (F6_VFNMSAC_VV<<26), 0xfc00707f},
+    {RISCV_VFNMSAC_VF,       DECODE_R,     OP_VFNMSAC_VF | (F3_VFNMSAC_VF<<12) | (F6_VFNMSAC_VF<<26), 0xfc00707f},
+    {RISCV_VFREDUSUM_VS,     DECODE_R,     OP_VFREDUSUM_VS | (F3_VFREDUSUM_VS<<12) | (F6_VFREDUSUM_VS<<26), 0xfc00707f},
+    {RISCV_VFREDOSUM_VS,     DECODE_R,     OP_VFREDOSUM_VS | (F3_VFREDOSUM_VS<<12) | (F6_VFREDOSUM_VS<<26), 0xfc00707f},
+    {RISCV_VFREDMIN_VS,      DECODE_R,     OP_VFREDMIN_VS | (F3_VFREDMIN_VS<<12) | (F6_VFREDMIN_VS<<26), 0xfc00707f},
+    {RISCV_VFREDMAX_VS,      DECODE_R,     OP_VFREDMAX_VS | (F3_VFREDMAX_VS<<12) | (F6_VFREDMAX_VS<<26), 0xfc00707f},
+    {RISCV_VFSQRT_V,         DECODE_R,     OP_VFSQRT_V | (F3_VFSQRT_V<<12) | (RS1_VFSQRT_V<<15) | (F6_VFSQRT_V<<26), 0xfc0ff07f},
+    {RISCV_VFCVT_XU_F_V,     DECODE_R,     OP_VFCVT_XU_F_V | (F3_VFCVT_XU_F_V<<12) | (RS1_VFCVT_XU_F_V<<15) | (F6_VFCVT_XU_F_V<<26), 0xfc0ff07f},
+    {RISCV_VFCVT_X_F_V,      DECODE_R,     OP_VFCVT_X_F_V | (F3_VFCVT_X_F_V<<12) | (RS1_VFCVT_X_F_V<<15) | (F6_VFCVT_X_F_V<<26), 0xfc0ff07f},
+    {RISCV_VFCVT_F_XU_V,     DECODE_R,     OP_VFCVT_F_XU_V | (F3_VFCVT_F_XU_V<<12) | (RS1_VFCVT_F_XU_V<<15) | (F6_VFCVT_F_XU_V<<26), 0xfc0ff07f},
+    {RISCV_VFCVT_F_X_V,      DECODE_R,     OP_VFCVT_F_X_V | (F3_VFCVT_F_X_V<<12) | (RS1_VFCVT_F_X_V<<15) | (F6_VFCVT_F_X_V<<26), 0xfc0ff07f},
+    {RISCV_VFCVT_RTZ_XU_F_V, DECODE_R,     OP_VFCVT_RTZ_XU_F_V | (F3_VFCVT_RTZ_XU_F_V<<12) | (RS1_VFCVT_RTZ_XU_F_V<<15) | (F6_VFCVT_RTZ_XU_F_V<<26), 0xfc0ff07f},
+    {RISCV_VFCVT_RTZ_X_F_V,  DECODE_R,     OP_VFCVT_RTZ_X_F_V | (F3_VFCVT_RTZ_X_F_V<<12) | (RS1_VFCVT_RTZ_X_F_V<<15) | (F6_VFCVT_RTZ_X_F_V<<26), 0xfc0ff07f},
+    {RISCV_VFMV_F_S,         DECODE_R,     OP_VFMV_F_S | (F3_VFMV_F_S<<12) | (RS1_VFMV_F_S<<15) | (((F6_VFMV_F_S<<1) | 1)<<25), 0xfe0ff07f},
+    {RISCV_VFMV_S_F,         DECODE_R,     OP_VFMV_S_F | (F3_VFMV_S_F<<12) | (((F6_VFMV_S_F<<1) | 1)<<25), 0xfff0707f},
+    {RISCV_VFMV_V_F,         DECODE_R,     OP_VFMV_V_F | (F3_VFMV_V_F<<12) | (((F6_VFMV_V_F<<1) | 1)<<25), 0xfff0707f},
+    {RISCV_VFMERGE_VFM,      DECODE_R,     OP_VFMERGE_VFM | (F3_VFMERGE_VFM<<12) | (((F6_VFMERGE_VFM<<1) | 0)<<25), 0xfe00707f},
+    {RISCV_AMOADD_W,         DECODE_R,     OP_AMOADD_W | (F3_AMOADD_W<<12) | (F7_AMOADD_W<<25), 0xf800707f},
+    {RISCV_LR_W,             DECODE_R,     OP_LR_W | (F3_LR_W<<12) | (F7_LR_W<<25), 0xf9f0707f},
+    {RISCV_SC_W,             DECODE_R,     OP_SC_W | (F3_SC_W<<12) | (F7_SC_W<<25), 0xf800707f},
+    {RISCV_AMOSWAP_W,        DECODE_R,     OP_AMOSWAP_W | (F3_AMOSWAP_W<<12) | (F7_AMOSWAP_W<<25), 0xf800707f},
+    {RISCV_AMOXOR_W,         DECODE_R,     OP_AMOXOR_W | (F3_AMOXOR_W<<12) | (F7_AMOXOR_W<<25), 0xf800707f},
+    {RISCV_AMOAND_W,         DECODE_R,     OP_AMOAND_W | (F3_AMOAND_W<<12) | (F7_AMOAND_W<<25), 0xf800707f},
+    {RISCV_AMOOR_W,          DECODE_R,     OP_AMOOR_W | (F3_AMOOR_W<<12) | (F7_AMOOR_W<<25), 0xf800707f},
+    {RISCV_AMOMIN_W,         DECODE_R,     OP_AMOMIN_W | (F3_AMOMIN_W<<12) | (F7_AMOMIN_W<<25), 0xf800707f},
+    {RISCV_AMOMAX_W,         DECODE_R,     OP_AMOMAX_W | (F3_AMOMAX_W<<12) | (F7_AMOMAX_W<<25), 0xf800707f},
+    {RISCV_AMOMINU_W,        DECODE_R,     OP_AMOMINU_W | (F3_AMOMINU_W<<12) | (F7_AMOMINU_W<<25), 0xf800707f},
+    {RISCV_AMOMAXU_W,        DECODE_R,     OP_AMOMAXU_W | (F3_AMOMAXU_W<<12) | (F7_AMOMAXU_W<<25), 0xf800707f},
+    {RISCV_LR_D,             DECODE_R,     OP_LR_D | (F3_LR_D<<12) | (F7_LR_D<<25), 0xf9f0707f},
+    {RISCV_SC_D,             DECODE_R,     OP_SC_D | (F3_SC_D<<12) | (F7_SC_D<<25), 0xf800707f},
+    {RISCV_AMOSWAP_D,        DECODE_R,     OP_AMOSWAP_D | (F3_AMOSWAP_D<<12) | (F7_AMOSWAP_D<<25), 0xf800707f},
+    {RISCV_AMOADD_D,         DECODE_R,     OP_AMOADD_D | (F3_AMOADD_D<<12) | (F7_AMOADD_D<<25), 0xf800707f},
+    {RISCV_AMOXOR_D,         DECODE_R,     OP_AMOXOR_D | (F3_AMOXOR_D<<12) | (F7_AMOXOR_D<<25), 0xf800707f},
+    {RISCV_AMOAND_D,         DECODE_R,     OP_AMOAND_D | (F3_AMOAND_D<<12) | (F7_AMOAND_D<<25), 0xf800707f},
+    {RISCV_AMOOR_D,          DECODE_R,     OP_AMOOR_D | (F3_AMOOR_D<<12) | (F7_AMOOR_D<<25), 0xf800707f},
+    {RISCV_AMOMIN_D,         DECODE_R,     OP_AMOMIN_D | (F3_AMOMIN_D<<12) | (F7_AMOMIN_D<<25), 0xf800707f},
+    {RISCV_AMOMAX_D,         DECODE_R,     OP_AMOMAX_D | (F3_AMOMAX_D<<12) | (F7_AMOMAX_D<<25), 0xf800707f},
+    {RISCV_AMOMINU_D,        DECODE_R,     OP_AMOMINU_D | (F3_AMOMINU_D<<12) | (F7_AMOMINU_D<<25), 0xf800707f},
+    {RISCV_AMOMAXU_D,        DECODE_R,     OP_AMOMAXU_D | (F3_AMOMAXU_D<<12) | (F7_AMOMAXU_D<<25), 0xf800707f}
+};
+
+#define DECODE_ROWS ((int)(sizeof(decode_table) / sizeof(decode_table[0])))
+
+/* 
+   the rows that can match each opcode, funct3 and bits 31:26, most fixed 
+   bits first. the top six bits split up the fp and vector rows, which 
+   otherwise share a handful of opcodes, so no bucket has more than a few 
+   rows to try. a row goes in every bucket its unfixed bits allow.
+*/
+#define DECODE_BUCKETS 65536
+#define DECODE_KEY(w) (((w) & 0x7f) | ((((w) >> 12) & 0x7) << 7) | (((w) >> 26) << 10))
+
+static uint16_t bucket_start[DECODE_BUCKETS + 1];
+static uint16_t *bucket_rows = NULL;
+
+static int more_fixed_bits(const void *a, const void *b){
+    const decode_row_t *x = &decode_table[*(const uint16_t*)a];
+    const decode_row_t *y = &decode_table[*(const uint16_t*)b];
+    int diff = __builtin_popcount(y->mask) - __builtin_popcount(x->mask);
+    return diff ? diff : (int)(x - y); // table order breaks ties
+}
+
+/* counts the row into each bucket it could match, or on the second pass puts it there */
+static void row_keys(int index, BOOL fill){
+    const decode_row_t *row = &decode_table[index];
+    uint32_t top_mask = (row->mask >> 26) & 0x3f;
+    uint32_t top_match = (row->match >> 26) & top_mask;
+    int funct3, top;
+
+    for (funct3=0;funct3<8;funct3++){
+        if ((row->mask & 0x7000) && (funct3 != (int)((row->match >> 12) & 0x7)))
+            continue;
+        for (top=0;top<64;top++){
+            int key = (row->match & 0x7f) | (funct3 << 7) | (top << 10);
+            if ((top & top_mask) != top_match)
+                continue;
+            if (fill)
+                bucket_rows[bucket_start[key]++] = index;
+            else
+                bucket_start[key + 1]++;
+        }
+    }
+}
+
+static void build_buckets(){
+    uint16_t order[DECODE_ROWS];
+    int key, i;
+
+    for (i=0;i<DECODE_ROWS;i++){
+        order[i] = i;
+        row_keys(i,FALSE);
+    }
+    qsort(order,DECODE_ROWS,sizeof(uint16_t),more_fixed_bits);
+    for (key=0;key<DECODE_BUCKETS;key++)
+        bucket_start[key + 1] += bucket_start[key];
+    bucket_rows = (uint16_t*)malloc(sizeof(uint16_t) * bucket_start[DECODE_BUCKETS]);
+    if (!bucket_rows) yyerror("Unable to allocate memory for the decode table");
+    /* filling moves each start up to the next bucket's, so shift them back after */
+    for (i=0;i<DECODE_ROWS;i++)
+        row_keys(order[i],TRUE);
+    for (key=DECODE_BUCKETS;key>0;key--)
+        bucket_start[key] = bucket_start[key - 1];
+    bucket_start[0] = 0;
+}
+
+static int32_t sign_extend(uint32_t value, int bits){
+    return (int32_t)(value << (32 - bits)) >> (32 - bits);
+}
+
+/* fills in inst from a 32-bit encoding, FALSE if no row matches it */
+static BOOL decode_word(instruction_t *inst, uint32_t w){
+    static BOOL built = FALSE;
+    const decode_row_t *row = NULL;
+    int key = DECODE_KEY(w);
+    int i;
+
+    if (!built){
+        build_buckets();
+        built = TRUE;
+    }
+    for (i=bucket_start[key];i<bucket_start[key + 1];i++){
+        if ((w & decode_table[bucket_rows[i]].mask) == decode_table[bucket_rows[i]].match){
+            row = &decode_table[bucket_rows[i]];
+            break;
+        }
+    }
+    if (!row)
+        return FALSE;
+
+    memset(inst,0,sizeof(instruction_t));
+    inst->inst_id = row->inst_id;
+    inst->opcode = w & 0x7f;
+    inst->funct3 = (w >> 12) & 0x7;
+    switch (row->format){
+        case DECODE_R:
+            inst->rdst = (w >> 7) & 0x1f;
+            inst->rsrc1 = (w >> 15) & 0x1f;
+            inst->rsrc2 = (w >> 20) & 0x1f;
+            inst->funct7 = w >> 25;
+            break;
+        case DECODE_SHIFT:
+            inst->rdst = (w >> 7) & 0x1f;
+            inst->rsrc1 = (w >> 15) & 0x1f;
+            inst->rsrc2 = (w >> 20) & 0x3f;
+            inst->funct7 = (w >> 25) & 0x7e;
+            break;
+        case DECODE_R4:
+            inst->rdst = (w >> 7) & 0x1f;
+            inst->rsrc1 = (w >> 15) & 0x1f;
+            inst->rsrc2 = (w >> 20) & 0x1f;
+            inst->rsrc3 = w >> 27;
+            inst->funct7 = (w >> 25) & 0x3;
+            break;
+        case DECODE_I:
+            inst->rdst = (w >> 7) & 0x1f;
+            inst->rsrc1 = (w >> 15) & 0x1f;
+            inst->imm = sign_extend(w >> 20,12);
+            break;
+        case DECODE_CSR:
+            inst->rdst = (w >> 7) & 0x1f;
+            inst->rsrc1 = (w >> 15) & 0x1f;
+            inst->imm = w >> 20;
+            break;
+        case DECODE_S:
+            inst->rsrc1 = (w >> 15) & 0x1f;
+            inst->rsrc2 = (w >> 20) & 0x1f;
+            inst->imm = sign_extend(((w >> 25) << 5) | ((w >> 7) & 0x1f),12);
+            break;
+        case DECODE_B:
+            /* calculate_offsets() keeps the 13 bit offset, not sign-extended */
+            inst->rsrc1 = (w >> 15) & 0x1f;
+            inst->rsrc2 = (w >> 20) & 0x1f;
+            inst->imm = (((w >> 31) & 0x1) << 12) | (((w >> 7) & 0x1) << 11) | 
+                        (((w >> 25) & 0x3f) << 5) | (((w >> 8) & 0xf) << 1);
+            break;
+        case DECODE_U:
+            inst->rdst = (w >> 7) & 0x1f;
+            inst->imm = w >> 12;
+            break;
+        case DECODE_J:
+            inst->rdst = (w >> 7) & 0x1f;
+            inst->imm = sign_extend((((w >> 31) & 0x1) << 20) | (((w >> 12) & 0xff) << 12) | 
+                                    (((w >> 20) & 0x1) << 11) | (((w >> 21) & 0x3ff) << 1),21);
+            break;
+    }
+    return TRUE;
+}
+
+/* sets the fields of an instruction that compress shrinks to an rvc form */
+static void expand(instruction_t *inst, int inst_id, uint32_t rd, uint32_t rs1, uint32_t rs2, int32_t imm){
+    memset(inst,0,sizeof(instruction_t));
+    inst->inst_id = inst_id;
+    inst->rdst = rd;
+    inst->rsrc1 = rs1;
+    inst->rsrc2 = rs2;
+    inst->imm = imm;
+}
+
+/* 
+   fills in inst with the instruction a 16-bit parcel was compressed from, 
+   FALSE if the parcel is reserved or is not one compress would write. 
+   the expansion is what rvc_form() maps back to the same rvc form, so 
+   sprint_entry() prints it as the parcel.
+*/
+static BOOL decode_half(instruction_t *inst, uint32_t w){
+    static char label[] = ""; // rvc_form() only compresses branches and jumps that had a label
+    uint32_t funct3 = (w >> 13) & 0x7;
+    uint32_t rd = (w >> 7) & 0x1f;      /* also rs1 */
+    uint32_t rs2 = (w >> 2) & 0x1f;
+    uint32_t rd_c = 8 + ((w >> 2) & 0x7);  /* the 3 bit fields name x8-x15 */
+    uint32_t rs1_c = 8 + ((w >> 7) & 0x7);
+    int32_t ci = sign_extend((((w >> 12) & 0x1) << 5) | ((w >> 2) & 0x1f),6);
+    uint32_t shamt = (((w >> 12) & 0x1) << 5) | ((w >> 2) & 0x1f);
+    uint32_t uimm;
+    int32_t offset;
+
+    switch ((w & 0x3) | (funct3 << 2)){
+        /* quadrant 0 */
+        case 0x00:
+            uimm = (((w >> 11) & 0x3) << 4) | (((w >> 7) & 0xf) << 6) | (((w >> 6) & 0x1) << 2) | (((w >> 5) & 0x1) << 3);
+            if (!uimm) return FALSE;
+            expand(inst,RISCV_ADDI,rd_c,2,0,uimm);
+            break;
+        case 0x04:
+            expand(inst,RISCV_FLD,rd_c,rs1_c,0,(((w >> 10) & 0x7) << 3) | (((w >> 5) & 0x3) << 6));
+            break;
+        case 0x08:
+            expand(inst,RISCV_LW,rd_c,rs1_c,0,(((w >> 10) & 0x7) << 3) | (((w >> 6) & 0x1) << 2) | (((w >> 5) & 0x1) << 6));
+            break;
+        case 0x0c:
+            expand(inst,RISCV_LD,rd_c,rs1_c,0,(((w >> 10) & 0x7) << 3) | (((w >> 5) & 0x3) << 6));
+            break;
+        case 0x14:
+            expand(inst,RISCV_FSD,0,rs1_c,rd_c,(((w >> 10) & 0x7) << 3) | (((w >> 5) & 0x3) << 6));
+            break;
+        case 0x18:
+            expand(inst,RISCV_SW,0,rs1_c,rd_c,(((w >> 10) & 0x7) << 3) | (((w >> 6) & 0x1) << 2) | (((w >> 5) & 0x1) << 6));
+            break;
+        case 0x1c:
+            expand(inst,RISCV_SD,0,rs1_c,rd_c,(((w >> 10) & 0x7) << 3) | (((w >> 5) & 0x3) << 6));
+            break;
+        /* quadrant 1 */
+        case 0x01:
+            expand(inst,RISCV_ADDI,rd,rd,0,ci);
+            break;
+        case 0x05:
+            expand(inst,RISCV_ADDIW,rd,rd,0,ci);
+            break;
+        case 0x09:
+            expand(inst,RISCV_ADDI,rd,0,0,ci);
+            break;
+        case 0x0d:
+            if (rd == 2)
+                expand(inst,RISCV_ADDI,2,2,0,sign_extend((((w >> 12) & 0x1) << 9) | (((w >> 6) & 0x1) << 4) | 
+                                                         (((w >> 5) & 0x1) << 6) | (((w >> 3) & 0x3) << 7) | 
+                                                         (((w >> 2) & 0x1) << 5),10));
+            else
+                expand(inst,RISCV_LUI,rd,0,0,ci & 0xfffff);
+            break;
+        case 0x11:
+            switch ((w >> 10) & 0x3){
+                case 0:
+                    expand(inst,RISCV_SRLI,rs1_c,rs1_c,shamt,0);
+                    break;
+                case 1:
+                    expand(inst,RISCV_SRAI,rs1_c,rs1_c,shamt,0);
+                    break;
+                case 2:
+                    expand(inst,RISCV_ANDI,rs1_c,rs1_c,0,ci);
+                    break;
+                default: {
+                    static const int ops[8] = { RISCV_SUB, RISCV_XOR, RISCV_OR, RISCV_AND, RISCV_SUBW, RISCV_ADDW, -1, -1 };
+                    int op = ops[(((w >> 12) & 0x1) << 2) | ((w >> 5) & 0x3)];
+                    if (op < 0) return FALSE;
+                    expand(inst,op,rs1_c,rs1_c,rd_c,0);
+                }
+            }
+            break;
+        case 0x15:
+            offset = sign_extend((((w >> 12) & 0x1) << 11) | (((w >> 11) & 0x1) << 4) | (((w >> 9) & 0x3) << 8) | 
+                                 (((w >> 8) & 0x1) << 10) | (((w >> 7) & 0x1) << 6) | (((w >> 6) & 0x1) << 7) | 
+                                 (((w >> 3) & 0x7) << 1) | (((w >> 2) & 0x1) << 5),12);
+            expand(inst,RISCV_J,0,0,0,offset);
+            inst->target_name = label;
+            break;
+        case 0x19:
+        case 0x1d:
+            offset = sign_extend((((w >> 12) & 0x1) << 8) | (((w >> 10) & 0x3) << 3) | (((w >> 5) & 0x3) << 6) | 
+                                 (((w >> 3) & 0x3) << 1) | (((w >> 2) & 0x1) << 5),9);
+            expand(inst,(funct3 == 6) ? RISCV_BEQ : RISCV_BNE,0,rs1_c,0,offset & 0x1fff);
+            inst->target_name = label;
+            break;
+        /* quadrant 2 */
+        case 0x02:
+            expand(inst,RISCV_SLLI,rd,rd,shamt,0);
+            break;
+        case 0x06:
+            expand(inst,RISCV_FLD,rd,2,0,(((w >> 12) & 0x1) << 5) | (((w >> 5) & 0x3) << 3) | (((w >> 2) & 0x7) << 6));
+            break;
+        case 0x0a:
+            expand(inst,RISCV_LW,rd,2,0,(((w >> 12) & 0x1) << 5) | (((w >> 4) & 0x7) << 2) | (((w >> 2) & 0x3) << 6));
+            break;
+        case 0x0e:
+            expand(inst,RISCV_LD,rd,2,0,(((w >> 12) & 0x1) << 5) | (((w >> 5) & 0x3) << 3) | (((w >> 2) & 0x7) << 6));
+            break;
+        case 0x12:
+            if ((rs2 == 0) && !(((w >> 12) & 0x1) && (rd == 0)))
+                expand(inst,RISCV_JALR,(w >> 12) & 0x1,rd,0,0);
+            else if (((w >> 12) & 0x1) == 0)
+                expand(inst,RISCV_ADD,rd,0,rs2,0);
+            else if ((rd == 0) && (rs2 == 0))
+                expand(inst,RISCV_EBREAK,0,0,0,0);
+            else
+                expand(inst,RISCV_ADD,rd,rd,rs2,0);
+            break;
+        case 0x16:
+            expand(inst,RISCV_FSD,0,2,rs2,(((w >> 10) & 0x7) << 3) | (((w >> 7) & 0x7) << 6));
+            break;
+        case 0x1a:
+            expand(inst,RISCV_SW,0,2,rs2,(((w >> 9) & 0xf) << 2) | (((w >> 7) & 0x3) << 6));
+            break;
+        case 0x1e:
+            expand(inst,RISCV_SD,0,2,rs2,(((w >> 10) & 0x7) << 3) | (((w >> 7) & 0x7) << 6));
+            break;
+        default:
+            return FALSE;
+    }
+    return rvc_form(inst) != RVC_NONE;
+}
+
+/* a run of bytes at an address, one per ELF .text section, .bin file or .txt block */
+typedef struct image_block {
+    uint64_t address;
+    uint64_t size;
+    const uint8_t *bytes;
+    struct image_block *next;
+} image_block_t;
+
+typedef struct {
+    uint64_t value;
+    const char *name;
+} image_symbol_t;
+
+/* the .symtab names of the image being disassembled, by address */
+static image_symbol_t *symbols = NULL;
+static int symbol_count = 0;
+
+static uint64_t words_decoded = 0;
+
+static double seconds_now(){
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC,&now);
+    return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+static uint8_t *read_image(char *file, uint64_t *size){
+    FILE *fp = fopen(file,"rb");
+    uint8_t *bytes;
+    long length;
+
+    if (!fp) yyerror("Unable to open image file");
+    fseek(fp,0,SEEK_END);
+    length = ftell(fp);
+    rewind(fp);
+    bytes = (uint8_t*)malloc(length + 1);
+    if (!bytes) yyerror("Unable to allocate memory for the image file");
+    if (fread(bytes,1,length,fp) != (size_t)length) yyerror("Error reading image file");
+    bytes[length] = 0; // a .txt image is then one string
+    fclose(fp);
+    *size = length;
+    return bytes;
+}
+
+/* links a new block in at tail, which is then moved on to its next */
+static image_block_t *add_block(image_block_t ***tail, uint64_t address, uint64_t size, const uint8_t *bytes){
+    image_block_t *block = (image_block_t*)malloc(sizeof(image_block_t));
+    if (!block) yyerror("Unable to allocate memory for an image block");
+    block->address = address;
+    block->size = size;
+    block->bytes = bytes;
+    block->next = NULL;
+    **tail = block;
+    *tail = &block->next;
+    return block;
+}
+
+static int by_value(const void *a, const void *b){
+    const image_symbol_t *x = (const image_symbol_t*)a;
+    const image_symbol_t *y = (const image_symbol_t*)b;
+    if (x->value != y->value)
+        return (x->value < y->value) ? -1 : 1;
+    return (x->name < y->name) ? -1 : (x->name > y->name); // strtab order, which is symtab order for dt
+}
+
+static void elf_symbols(const uint8_t *bytes, uint64_t size, Elf64_Shdr *symtab, Elf64_Shdr *strtab){
+    const Elf64_Sym *sym = (const Elf64_Sym*)(bytes + symtab->sh_offset);
+    const char *names = (const char*)(bytes + strtab->sh_offset);
+    uint64_t count = symtab->sh_size / sizeof(Elf64_Sym);
+    uint64_t i;
+
+    if ((symtab->sh_offset + symtab->sh_size > size) || (strtab->sh_offset + strtab->sh_size > size))
+        yyerror("ELF symbol table is past the end of the file");
+    symbols = (image_symbol_t*)realloc(symbols,sizeof(image_symbol_t) * (symbol_count + count));
+    if (!symbols && count) yyerror("Unable to allocate memory for the ELF symbol table");
+    for (i=1;i<count;i++){ // entry 0 is the null symbol
+        int type = ELF64_ST_TYPE(sym[i].st_info);
+        if (!sym[i].st_name || (sym[i].st_name >= strtab->sh_size) || (type == STT_SECTION) || (type == STT_FILE))
+            continue;
+        symbols[symbol_count].value = sym[i].st_value;
+        symbols[symbol_count].name = names + sym[i].st_name;
+        symbol_count++;
+    }
+    qsort(symbols,symbol_count,sizeof(image_symbol_t),by_value);
+}
+
+/* 
+   the .text sections, or the executable segments if there are no section 
+   headers. dt's sections and symbols are both at the address plus the 
+   size of the ELF and program headers, so they still line up.
+*/
+static image_block_t *elf_blocks(const uint8_t *bytes, uint64_t size){
+    Elf64_Ehdr *ehdr = (Elf64_Ehdr*)bytes;
+    image_block_t *head = NULL;
+    image_block_t **tail = &head;
+    int i;
+
+    if ((size < sizeof(Elf64_Ehdr)) || (ehdr->e_ident[EI_CLASS] != ELFCLASS64) || 
+        (ehdr->e_ident[EI_DATA] != ELFDATA2LSB) || (ehdr->e_machine != EM_RISCV))
+        yyerror("Only little-endian RV64 ELF files can be disassembled");
+    if (ehdr->e_shoff + (uint64_t)ehdr->e_shnum * sizeof(Elf64_Shdr) > size)
+        yyerror("ELF section headers are past the end of the file");
+    if (ehdr->e_phoff + (uint64_t)ehdr->e_phnum * sizeof(Elf64_Phdr) > size)
+        yyerror("ELF program headers are past the end of the file");
+
+    for (i=0;i<ehdr->e_shnum;i++){
+        Elf64_Shdr *shdr = (Elf64_Shdr*)(bytes + ehdr->e_shoff) + i;
+        if ((shdr->sh_type == SHT_PROGBITS) && (shdr->sh_flags & SHF_EXECINSTR)){
+            if (shdr->sh_offset + shdr->sh_size > size)
+                yyerror("ELF section is past the end of the file");
+            add_block(&tail,shdr->sh_addr,shdr->sh_size,bytes + shdr->sh_offset);
+        }
+        else if ((shdr->sh_type == SHT_SYMTAB) && (shdr->sh_link < ehdr->e_shnum))
+            elf_symbols(bytes,size,shdr,(Elf64_Shdr*)(bytes + ehdr->e_shoff) + shdr->sh_link);
+    }
+    if (head)
+        return head;
+
+    for (i=0;i<ehdr->e_phnum;i++){
+        Elf64_Phdr *phdr = (Elf64_Phdr*)(bytes + ehdr->e_phoff) + i;
+        if ((phdr->p_type == PT_LOAD) && (phdr->p_flags & PF_X)){
+            if (phdr->p_offset + phdr->p_filesz > size)
+                yyerror("ELF segment is past the end of the file");
+            add_block(&tail,phdr->p_vaddr,phdr->p_filesz,bytes + phdr->p_offset);
+        }
+    }
+    return head;
+}
+
+static int hex_digit(char c){
+    if ((c >= '0') && (c <= '9')) return c - '0';
+    if ((c >= 'a') && (c <= 'f')) return c - 'a' + 10;
+    if ((c >= 'A') && (c <= 'F')) return c - 'A' + 10;
+    return -1;
+}
+
+/* a .txt image starts with a 12 digit address and two spaces, like write_text() prints */
+static BOOL is_text_image(const uint8_t *bytes, uint64_t size){
+    int i;
+
+    if (size < 14)
+        return FALSE;
+    for (i=0;i<12;i++){
+        if (hex_digit(bytes[i]) < 0)
+            return FALSE;
+    }
+    return (bytes[12] == ' ') && (bytes[13] == ' ');
+}
+
+/* each run of lines with consecutive addresses, a blank line ends a mem() block */
+static image_block_t *text_blocks(const uint8_t *text, uint64_t size){
+    uint8_t *data = (uint8_t*)malloc(size / 3 + 1); // every byte takes at least "xx "
+    const char *line = (const char*)text;
+    image_block_t *head = NULL;
+    image_block_t **tail = &head;
+    image_block_t *block = NULL;
+    uint64_t used = 0;
+
+    if (!data) yyerror("Unable to allocate memory for the text image");
+    while (*line){
+        char *end = (char*)line;
+        uint64_t address = (hex_digit(*line) < 0) ? 0 : strtoull(line,&end,16); // strtoull() would skip a blank line
+        if ((end == line) || (*end != ' ')){
+            block = NULL;
+        }
+        else {
+            const char *at = end;
+            if (!block || (block->address + block->size != address)){
+                block = add_block(&tail,address,0,data + used);
+            }
+            for (;;){
+                while (*at == ' ')
+                    at++;
+                if ((hex_digit(at[0]) < 0) || (hex_digit(at[1]) < 0))
+                    break;
+                data[used++] = (hex_digit(at[0]) << 4) | hex_digit(at[1]);
+                block->size++;
+                at += 2;
+            }
+        }
+        line = strchr(line,'\n');
+        if (!line)
+            break;
+        line++;
+    }
+    if (!head)
+        free(data);
+    return head;
+}
+
+/* the symbol at exactly this address, or NULL */
+static const char *symbol_at(uint64_t address){
+    int lo = 0;
+    int hi = symbol_count;
+
+    while (lo < hi){
+        int mid = (lo + hi) / 2;
+        if (symbols[mid].value < address)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return ((lo < symbol_count) && (symbols[lo].value == address)) ? symbols[lo].name : NULL;
+}
+
+/* the name of a branch or jump's target, if it has one */
+static const char *target_name(uint64_t address, instruction_t *inst){
+    if (!symbol_count)
+        return NULL;
+    switch (inst->inst_id){
+        case RISCV_JAL:
+        case RISCV_J:
+            return symbol_at(address + (int64_t)inst->imm);
+        case RISCV_BEQ:
+        case RISCV_BNE:
+        case RISCV_BLT:
+        case RISCV_BGE:
+        case RISCV_BLTU:
+        case RISCV_BGEU:
+            return symbol_at(address + (int64_t)sign_extend(inst->imm,13));
+    }
+    return NULL;
+}
+
+/* digits hex digits of value, zero padded, the way %0*x would but without the format parsing */
+static char *put_hex(char *out, uint64_t value, int digits){
+    static const char hex[] = "0123456789abcdef";
+    int i;
+
+    for (i=digits-1;i>=0;i--){
+        out[i] = hex[value & 0xf];
+        value >>= 4;
+    }
+    return out + digits;
+}
+
+/* the -checking inst: line, built by hand since printf() was most of the time */
+static void print_inst(uint64_t address, uint32_t encoding, int size, mem_entry_t *entry){
+    char line[300];
+    char *at = line;
+    const char *name = target_name(address,entry->inst);
+
+    memcpy(at,"inst:\t@0x",9);
+    at = put_hex(at + 9,address,12);
+    memcpy(at,"\t0x",3);
+    at = put_hex(at + 3,encoding,size * 2);
+    *at++ = '\t';
+    sprint_entry(at,entry);
+    at += strlen(at);
+    if (name){
+        fputs(line,stdout);
+        fputs("\t# ",stdout);
+        fputs(name,stdout);
+        at = line;
+    }
+    *at++ = '\n';
+    *at = 0;
+    fputs(line,stdout);
+}
+
+/* 
+   the low two bits of each parcel say whether it is 16 or 32 bits, so a 
+   program that was not compressed decodes the same way. a parcel that 
+   is not an instruction dt writes is printed as data of the same size, 
+   which gets back in step soonest after a string or a table.
+*/
+static void disassemble_block(image_block_t *block){
+    instruction_t inst;
+    mem_entry_t entry;
+    uint64_t at = 0;
+    int next = 0;
+
+    memset(&entry,0,sizeof(mem_entry_t));
+    entry.type = ENTRY_INSTRUCTION;
+    entry.inst = &inst;
+    printf("\nmem() block: 0x%012" PRIx64 ":\n",block->address);
+    while (at < block->size){
+        const uint8_t *b = block->bytes + at;
+        uint64_t address = block->address + at;
+        uint32_t half;
+
+        while ((next < symbol_count) && (symbols[next].value <= address)){
+            if (symbols[next].value == address)
+                printf("label:\t@0x%012" PRIx64 "\t%s\n",address,symbols[next].name);
+            next++;
+        }
+        words_decoded++;
+        if (at + 2 > block->size){
+            printf("bdata:\t@0x%012" PRIx64 "\t0x%" PRIx8 "\n",address,b[0]);
+            at += 1;
+            continue;
+        }
+        half = b[0] | (b[1] << 8);
+        if ((half & 0x3) != 0x3){
+            if (decode_half(&inst,half)){
+                entry.size = 2;
+                print_inst(address,half,2,&entry);
+                at += 2;
+                continue;
+            }
+        }
+        else if (at + 4 <= block->size){
+            uint32_t word = half | (b[2] << 16) | ((uint32_t)b[3] << 24);
+            if (decode_word(&inst,word)){
+                entry.size = 4;
+                print_inst(address,word,4,&entry);
+                at += 4;
+                continue;
+            }
+        }
+        if (((half & 0x3) == 0x3) && (at + 4 <= block->size)){
+            printf("wdata:\t@0x%012" PRIx64 "\t0x%" PRIx32 "\n",address,half | (b[2] << 16) | ((uint32_t)b[3] << 24));
+            at += 4;
+        }
+        else {
+            printf("hdata:\t@0x%012" PRIx64 "\t0x%" PRIx32 "\n",address,half);
+            at += 2;
+        }
+    }
+}
+
+/* disassembles each image to stdout, the speed goes to stderr */
+int disassemble_files(char **files, int count){
+    double start = seconds_now();
+    double elapsed;
+    int i;
+
+    for (i=0;i<count;i++){
+        image_block_t *blocks, *block;
+        const uint8_t *text_data = NULL;
+        uint64_t size;
+        uint8_t *bytes;
+
+        current_file = files[i];
+        yylineno = -1;
+        bytes = read_image(files[i],&size);
+        symbol_count = 0;
+        if ((size >= SELFMAG) && (memcmp(bytes,ELFMAG,SELFMAG) == 0)){
+            printf("\nimage: %s (ELF)\n",files[i]);
+            blocks = elf_blocks(bytes,size);
+        }
+        else if (is_text_image(bytes,size)){
+            printf("\nimage: %s (text)\n",files[i]);
+            blocks = text_blocks(bytes,size);
+            text_data = blocks ? blocks->bytes : NULL;
+        }
+        else {
+            image_block_t **tail = &blocks;
+            uint64_t address;
+            if (size < sizeof(uint64_t))
+                yyerror("Image file is too short to be a .bin file");
+            memcpy(&address,bytes,sizeof(uint64_t));
+            printf("\nimage: %s (bin)\n",files[i]);
+            add_block(&tail,address,size - sizeof(uint64_t),bytes + sizeof(uint64_t));
+        }
+
+        for (block=blocks;block;block=block->next)
+            disassemble_block(block);
+        while (blocks){
+            block = blocks->next;
+            free(blocks);
+            blocks = block;
+        }
+        free((void*)text_data);
+        free(bytes);
+    }
+    free(symbols);
+    symbols = NULL;
+    fflush(stdout);
+
+    elapsed = seconds_now() - start;
+    fprintf(stderr,"\nDisassembly: %" PRIu64 " words in %d image%s\n",words_decoded,count,(count == 1) ? "" : "s");
+    fprintf(stderr,"Disassembly speed: %.1f million words per second (%.3f s)\n",
+            (elapsed > 0) ? words_decoded / elapsed / 1e6 : 0.0,elapsed);
+    return 0;
+}
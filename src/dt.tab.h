@@ -0,0 +1,595 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Skeleton interface for Bison GLR parsers in C
+
+   Copyright (C) 2002-2015, 2018-2021 Free Software Foundation, Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+#ifndef YY_YY_SRC_DT_TAB_H_INCLUDED
+# define YY_YY_SRC_DT_TAB_H_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 0
+#endif
+#if YYDEBUG
+extern int yydebug;
+#endif
+/* "%code requires" blocks.  */
+#line 122 "./src/dt.y"
+
+typedef struct YYLTYPE {
+    int first_line;
+    int first_column;
+    int last_line;
+    int last_column;
+    int instlist;
+    char *file; /* the source file, which an .include changes */
+} YYLTYPE;
+#define YYLTYPE_IS_DECLARED 1
+#define YYLTYPE_IS_TRIVIAL 1
+
+#line 57 "./src/dt.tab.h"
+
+/* Token kinds.  */
+#ifndef YYTOKENTYPE
+# define YYTOKENTYPE
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    INST_LUI = 258,                /* INST_LUI  */
+    INST_AUIPC = 259,              /* INST_AUIPC  */
+    INST_JAL = 260,                /* INST_JAL  */
+    INST_JALR = 261,               /* INST_JALR  */
+    INST_BEQ = 262,                /* INST_BEQ  */
+    INST_BNE = 263,                /* INST_BNE  */
+    INST_BLT = 264,                /* INST_BLT  */
+    INST_BGE = 265,                /* INST_BGE  */
+    INST_BLTU = 266,               /* INST_BLTU  */
+    INST_BGEU = 267,               /* INST_BGEU  */
+    INST_LB = 268,                 /* INST_LB  */
+    INST_LH = 269,                 /* INST_LH  */
+    INST_LW = 270,                 /* INST_LW  */
+    INST_LBU = 271,                /* INST_LBU  */
+    INST_LHU = 272,                /* INST_LHU  */
+    INST_SB = 273,                 /* INST_SB  */
+    INST_SH = 274,                 /* INST_SH  */
+    INST_SW = 275,                 /* INST_SW  */
+    INST_ADDI = 276,               /* INST_ADDI  */
+    INST_SLTI = 277,               /* INST_SLTI  */
+    INST_SLTIU = 278,              /* INST_SLTIU  */
+    INST_XORI = 279,               /* INST_XORI  */
+    INST_ORI = 280,                /* INST_ORI  */
+    INST_ANDI = 281,               /* INST_ANDI  */
+    INST_SLLI = 282,               /* INST_SLLI  */
+    INST_SRLI = 283,               /* INST_SRLI  */
+    INST_SRAI = 284,               /* INST_SRAI  */
+    INST_ADD = 285,                /* INST_ADD  */
+    INST_SUB = 286,                /* INST_SUB  */
+    INST_SLL = 287,                /* INST_SLL  */
+    INST_SLT = 288,                /* INST_SLT  */
+    INST_SLTU = 289,               /* INST_SLTU  */
+    INST_XOR = 290,                /* INST_XOR  */
+    INST_SRL = 291,                /* INST_SRL  */
+    INST_SRA = 292,                /* INST_SRA  */
+    INST_OR = 293,                 /* INST_OR  */
+    INST_AND = 294,                /* INST_AND  */
+    INST_FENCE = 295,              /* INST_FENCE  */
+    INST_FENCE_I = 296,            /* INST_FENCE_I  */
+    INST_ECALL = 297,              /* INST_ECALL  */
+    INST_EBREAK = 298,             /* INST_EBREAK  */
+    INST_CSRRW = 299,              /* INST_CSRRW  */
+    INST_CSRRS = 300,              /* INST_CSRRS  */
+    INST_CSRRC = 301,              /* INST_CSRRC  */
+    INST_CSRRWI = 302,             /* INST_CSRRWI  */
+    INST_CSRRSI = 303,             /* INST_CSRRSI  */
+    INST_CSRRCI = 304,             /* INST_CSRRCI  */
+    INST_CSRR = 305,               /* INST_CSRR  */
+    INST_CSRW = 306,               /* INST_CSRW  */
+    INST_RDCYCLE = 307,            /* INST_RDCYCLE  */
+    INST_RDTIME = 308,             /* INST_RDTIME  */
+    INST_RDINSTRET = 309,          /* INST_RDINSTRET  */
+    INST_J = 310,                  /* INST_J  */
+    INST_JR = 311,                 /* INST_JR  */
+    INST_RET = 312,                /* INST_RET  */
+    INST_NOP = 313,                /* INST_NOP  */
+    INST_MUL = 314,                /* INST_MUL  */
+    INST_DIV = 315,                /* INST_DIV  */
+    INST_LD = 316,                 /* INST_LD  */
+    INST_SD = 317,                 /* INST_SD  */
+    INST_LWU = 318,                /* INST_LWU  */
+    INST_ADDIW = 319,              /* INST_ADDIW  */
+    INST_SLLIW = 320,              /* INST_SLLIW  */
+    INST_SRLIW = 321,              /* INST_SRLIW  */
+    INST_SRAIW = 322,              /* INST_SRAIW  */
+    INST_ADDW = 323,               /* INST_ADDW  */
+    INST_SUBW = 324,               /* INST_SUBW  */
+    INST_SLLW = 325,               /* INST_SLLW  */
+    INST_SRLW = 326,               /* INST_SRLW  */
+    INST_SRAW = 327,               /* INST_SRAW  */
+    INST_MULH = 328,               /* INST_MULH  */
+    INST_MULHSU = 329,             /* INST_MULHSU  */
+    INST_MULHU = 330,              /* INST_MULHU  */
+    INST_DIVU = 331,               /* INST_DIVU  */
+    INST_REM = 332,                /* INST_REM  */
+    INST_REMU = 333,               /* INST_REMU  */
+    INST_MULW = 334,               /* INST_MULW  */
+    INST_DIVW = 335,               /* INST_DIVW  */
+    INST_DIVUW = 336,              /* INST_DIVUW  */
+    INST_REMW = 337,               /* INST_REMW  */
+    INST_REMUW = 338,              /* INST_REMUW  */
+    INST_LR_W = 339,               /* INST_LR_W  */
+    INST_SC_W = 340,               /* INST_SC_W  */
+    INST_AMOSWAP_W = 341,          /* INST_AMOSWAP_W  */
+    INST_AMOADD_W = 342,           /* INST_AMOADD_W  */
+    INST_AMOXOR_W = 343,           /* INST_AMOXOR_W  */
+    INST_AMOAND_W = 344,           /* INST_AMOAND_W  */
+    INST_AMOOR_W = 345,            /* INST_AMOOR_W  */
+    INST_AMOMIN_W = 346,           /* INST_AMOMIN_W  */
+    INST_AMOMAX_W = 347,           /* INST_AMOMAX_W  */
+    INST_AMOMINU_W = 348,          /* INST_AMOMINU_W  */
+    INST_AMOMAXU_W = 349,          /* INST_AMOMAXU_W  */
+    INST_LR_D = 350,               /* INST_LR_D  */
+    INST_SC_D = 351,               /* INST_SC_D  */
+    INST_AMOSWAP_D = 352,          /* INST_AMOSWAP_D  */
+    INST_AMOADD_D = 353,           /* INST_AMOADD_D  */
+    INST_AMOXOR_D = 354,           /* INST_AMOXOR_D  */
+    INST_AMOAND_D = 355,           /* INST_AMOAND_D  */
+    INST_AMOOR_D = 356,            /* INST_AMOOR_D  */
+    INST_AMOMIN_D = 357,           /* INST_AMOMIN_D  */
+    INST_AMOMAX_D = 358,           /* INST_AMOMAX_D  */
+    INST_AMOMINU_D = 359,          /* INST_AMOMINU_D  */
+    INST_AMOMAXU_D = 360,          /* INST_AMOMAXU_D  */
+    INST_FLW = 361,                /* INST_FLW  */
+    INST_FSW = 362,                /* INST_FSW  */
+    INST_FMADD_S = 363,            /* INST_FMADD_S  */
+    INST_FMSUB_S = 364,            /* INST_FMSUB_S  */
+    INST_FNMSUB_S = 365,           /* INST_FNMSUB_S  */
+    INST_FNMADD_S = 366,           /* INST_FNMADD_S  */
+    INST_FADD_S = 367,             /* INST_FADD_S  */
+    INST_FSUB_S = 368,             /* INST_FSUB_S  */
+    INST_FMUL_S = 369,             /* INST_FMUL_S  */
+    INST_FDIV_S = 370,             /* INST_FDIV_S  */
+    INST_FSQRT_S = 371,            /* INST_FSQRT_S  */
+    INST_FSGNJ_S = 372,            /* INST_FSGNJ_S  */
+    INST_FSGNJN_S = 373,           /* INST_FSGNJN_S  */
+    INST_FSGNJX_S = 374,           /* INST_FSGNJX_S  */
+    INST_FMIN_S = 375,             /* INST_FMIN_S  */
+    INST_FMAX_S = 376,             /* INST_FMAX_S  */
+    INST_FEQ_S = 377,              /* INST_FEQ_S  */
+    INST_FLT_S = 378,              /* INST_FLT_S  */
+    INST_FLE_S = 379,              /* INST_FLE_S  */
+    INST_FCLASS_S = 380,           /* INST_FCLASS_S  */
+    INST_FCVT_W_S = 381,           /* INST_FCVT_W_S  */
+    INST_FCVT_WU_S = 382,          /* INST_FCVT_WU_S  */
+    INST_FCVT_L_S = 383,           /* INST_FCVT_L_S  */
+    INST_FCVT_LU_S = 384,          /* INST_FCVT_LU_S  */
+    INST_FCVT_S_W = 385,           /* INST_FCVT_S_W  */
+    INST_FCVT_S_WU = 386,          /* INST_FCVT_S_WU  */
+    INST_FCVT_S_L = 387,           /* INST_FCVT_S_L  */
+    INST_FCVT_S_LU = 388,          /* INST_FCVT_S_LU  */
+    INST_FMV_X_W = 389,            /* INST_FMV_X_W  */
+    INST_FMV_W_X = 390,            /* INST_FMV_W_X  */
+    INST_FLD = 391,                /* INST_FLD  */
+    INST_FSD = 392,                /* INST_FSD  */
+    INST_FMADD_D = 393,            /* INST_FMADD_D  */
+    INST_FMSUB_D = 394,            /* INST_FMSUB_D  */
+    INST_FNMSUB_D = 395,           /* INST_FNMSUB_D  */
+    INST_FNMADD_D = 396,           /* INST_FNMADD_D  */
+    INST_FADD_D = 397,             /* INST_FADD_D  */
+    INST_FSUB_D = 398,             /* INST_FSUB_D  */
+    INST_FMUL_D = 399,             /* INST_FMUL_D  */
+    INST_FDIV_D = 400,             /* INST_FDIV_D  */
+    INST_FSQRT_D = 401,            /* INST_FSQRT_D  */
+    INST_FSGNJ_D = 402,            /* INST_FSGNJ_D  */
+    INST_FSGNJN_D = 403,           /* INST_FSGNJN_D  */
+    INST_FSGNJX_D = 404,           /* INST_FSGNJX_D  */
+    INST_FMIN_D = 405,             /* INST_FMIN_D  */
+    INST_FMAX_D = 406,             /* INST_FMAX_D  */
+    INST_FEQ_D = 407,              /* INST_FEQ_D  */
+    INST_FLT_D = 408,              /* INST_FLT_D  */
+    INST_FLE_D = 409,              /* INST_FLE_D  */
+    INST_FCLASS_D = 410,           /* INST_FCLASS_D  */
+    INST_FCVT_W_D = 411,           /* INST_FCVT_W_D  */
+    INST_FCVT_WU_D = 412,          /* INST_FCVT_WU_D  */
+    INST_FCVT_L_D = 413,           /* INST_FCVT_L_D  */
+    INST_FCVT_LU_D = 414,          /* INST_FCVT_LU_D  */
+    INST_FCVT_D_W = 415,           /* INST_FCVT_D_W  */
+    INST_FCVT_D_WU = 416,          /* INST_FCVT_D_WU  */
+    INST_FCVT_D_L = 417,           /* INST_FCVT_D_L  */
+    INST_FCVT_D_LU = 418,          /* INST_FCVT_D_LU  */
+    INST_FMV_X_D = 419,            /* INST_FMV_X_D  */
+    INST_FMV_D_X = 420,            /* INST_FMV_D_X  */
+    INST_FCVT_S_D = 421,           /* INST_FCVT_S_D  */
+    INST_FCVT_D_S = 422,           /* INST_FCVT_D_S  */
+    INST_FMV_S = 423,              /* INST_FMV_S  */
+    INST_FNEG_S = 424,             /* INST_FNEG_S  */
+    INST_FABS_S = 425,             /* INST_FABS_S  */
+    INST_FMV_D = 426,              /* INST_FMV_D  */
+    INST_FNEG_D = 427,             /* INST_FNEG_D  */
+    INST_FABS_D = 428,             /* INST_FABS_D  */
+    INST_FRCSR = 429,              /* INST_FRCSR  */
+    INST_FSCSR = 430,              /* INST_FSCSR  */
+    INST_FRRM = 431,               /* INST_FRRM  */
+    INST_FSRM = 432,               /* INST_FSRM  */
+    INST_FRFLAGS = 433,            /* INST_FRFLAGS  */
+    INST_FSFLAGS = 434,            /* INST_FSFLAGS  */
+    INST_VSETVLI = 435,            /* INST_VSETVLI  */
+    INST_VSETIVLI = 436,           /* INST_VSETIVLI  */
+    INST_VSETVL = 437,             /* INST_VSETVL  */
+    INST_VLE8_V = 438,             /* INST_VLE8_V  */
+    INST_VLE8FF_V = 439,           /* INST_VLE8FF_V  */
+    INST_VSE8_V = 440,             /* INST_VSE8_V  */
+    INST_VLSE8_V = 441,            /* INST_VLSE8_V  */
+    INST_VSSE8_V = 442,            /* INST_VSSE8_V  */
+    INST_VLUXEI8_V = 443,          /* INST_VLUXEI8_V  */
+    INST_VLOXEI8_V = 444,          /* INST_VLOXEI8_V  */
+    INST_VSUXEI8_V = 445,          /* INST_VSUXEI8_V  */
+    INST_VSOXEI8_V = 446,          /* INST_VSOXEI8_V  */
+    INST_VLE16_V = 447,            /* INST_VLE16_V  */
+    INST_VLE16FF_V = 448,          /* INST_VLE16FF_V  */
+    INST_VSE16_V = 449,            /* INST_VSE16_V  */
+    INST_VLSE16_V = 450,           /* INST_VLSE16_V  */
+    INST_VSSE16_V = 451,           /* INST_VSSE16_V  */
+    INST_VLUXEI16_V = 452,         /* INST_VLUXEI16_V  */
+    INST_VLOXEI16_V = 453,         /* INST_VLOXEI16_V  */
+    INST_VSUXEI16_V = 454,         /* INST_VSUXEI16_V  */
+    INST_VSOXEI16_V = 455,         /* INST_VSOXEI16_V  */
+    INST_VLE32_V = 456,            /* INST_VLE32_V  */
+    INST_VLE32FF_V = 457,          /* INST_VLE32FF_V  */
+    INST_VSE32_V = 458,            /* INST_VSE32_V  */
+    INST_VLSE32_V = 459,           /* INST_VLSE32_V  */
+    INST_VSSE32_V = 460,           /* INST_VSSE32_V  */
+    INST_VLUXEI32_V = 461,         /* INST_VLUXEI32_V  */
+    INST_VLOXEI32_V = 462,         /* INST_VLOXEI32_V  */
+    INST_VSUXEI32_V = 463,         /* INST_VSUXEI32_V  */
+    INST_VSOXEI32_V = 464,         /* INST_VSOXEI32_V  */
+    INST_VLE64_V = 465,            /* INST_VLE64_V  */
+    INST_VLE64FF_V = 466,          /* INST_VLE64FF_V  */
+    INST_VSE64_V = 467,            /* INST_VSE64_V  */
+    INST_VLSE64_V = 468,           /* INST_VLSE64_V  */
+    INST_VSSE64_V = 469,           /* INST_VSSE64_V  */
+    INST_VLUXEI64_V = 470,         /* INST_VLUXEI64_V  */
+    INST_VLOXEI64_V = 471,         /* INST_VLOXEI64_V  */
+    INST_VSUXEI64_V = 472,         /* INST_VSUXEI64_V  */
+    INST_VSOXEI64_V = 473,         /* INST_VSOXEI64_V  */
+    INST_VLM_V = 474,              /* INST_VLM_V  */
+    INST_VSM_V = 475,              /* INST_VSM_V  */
+    INST_VADD_VV = 476,            /* INST_VADD_VV  */
+    INST_VADD_VX = 477,            /* INST_VADD_VX  */
+    INST_VADD_VI = 478,            /* INST_VADD_VI  */
+    INST_VSUB_VV = 479,            /* INST_VSUB_VV  */
+    INST_VSUB_VX = 480,            /* INST_VSUB_VX  */
+    INST_VRSUB_VX = 481,           /* INST_VRSUB_VX  */
+    INST_VRSUB_VI = 482,           /* INST_VRSUB_VI  */
+    INST_VMINU_VV = 483,           /* INST_VMINU_VV  */
+    INST_VMINU_VX = 484,           /* INST_VMINU_VX  */
+    INST_VMIN_VV = 485,            /* INST_VMIN_VV  */
+    INST_VMIN_VX = 486,            /* INST_VMIN_VX  */
+    INST_VMAXU_VV = 487,           /* INST_VMAXU_VV  */
+    INST_VMAXU_VX = 488,           /* INST_VMAXU_VX  */
+    INST_VMAX_VV = 489,            /* INST_VMAX_VV  */
+    INST_VMAX_VX = 490,            /* INST_VMAX_VX  */
+    INST_VAND_VV = 491,            /* INST_VAND_VV  */
+    INST_VAND_VX = 492,            /* INST_VAND_VX  */
+    INST_VAND_VI = 493,            /* INST_VAND_VI  */
+    INST_VOR_VV = 494,             /* INST_VOR_VV  */
+    INST_VOR_VX = 495,             /* INST_VOR_VX  */
+    INST_VOR_VI = 496,             /* INST_VOR_VI  */
+    INST_VXOR_VV = 497,            /* INST_VXOR_VV  */
+    INST_VXOR_VX = 498,            /* INST_VXOR_VX  */
+    INST_VXOR_VI = 499,            /* INST_VXOR_VI  */
+    INST_VRGATHER_VV = 500,        /* INST_VRGATHER_VV  */
+    INST_VRGATHER_VX = 501,        /* INST_VRGATHER_VX  */
+    INST_VRGATHER_VI = 502,        /* INST_VRGATHER_VI  */
+    INST_VSLIDEUP_VX = 503,        /* INST_VSLIDEUP_VX  */
+    INST_VSLIDEUP_VI = 504,        /* INST_VSLIDEUP_VI  */
+    INST_VSLIDEDOWN_VX = 505,      /* INST_VSLIDEDOWN_VX  */
+    INST_VSLIDEDOWN_VI = 506,      /* INST_VSLIDEDOWN_VI  */
+    INST_VMSEQ_VV = 507,           /* INST_VMSEQ_VV  */
+    INST_VMSEQ_VX = 508,           /* INST_VMSEQ_VX  */
+    INST_VMSEQ_VI = 509,           /* INST_VMSEQ_VI  */
+    INST_VMSNE_VV = 510,           /* INST_VMSNE_VV  */
+    INST_VMSNE_VX = 511,           /* INST_VMSNE_VX  */
+    INST_VMSNE_VI = 512,           /* INST_VMSNE_VI  */
+    INST_VMSLTU_VV = 513,          /* INST_VMSLTU_VV  */
+    INST_VMSLTU_VX = 514,          /* INST_VMSLTU_VX  */
+    INST_VMSLT_VV = 515,           /* INST_VMSLT_VV  */
+    INST_VMSLT_VX = 516,           /* INST_VMSLT_VX  */
+    INST_VMSLEU_VV = 517,          /* INST_VMSLEU_VV  */
+    INST_VMSLEU_VX = 518,          /* INST_VMSLEU_VX  */
+    INST_VMSLEU_VI = 519,          /* INST_VMSLEU_VI  */
+    INST_VMSLE_VV = 520,           /* INST_VMSLE_VV  */
+    INST_VMSLE_VX = 521,           /* INST_VMSLE_VX  */
+    INST_VMSLE_VI = 522,           /* INST_VMSLE_VI  */
+    INST_VMSGTU_VX = 523,          /* INST_VMSGTU_VX  */
+    INST_VMSGTU_VI = 524,          /* INST_VMSGTU_VI  */
+    INST_VMSGT_VX = 525,           /* INST_VMSGT_VX  */
+    INST_VMSGT_VI = 526,           /* INST_VMSGT_VI  */
+    INST_VSLL_VV = 527,            /* INST_VSLL_VV  */
+    INST_VSLL_VX = 528,            /* INST_VSLL_VX  */
+    INST_VSLL_VI = 529,            /* INST_VSLL_VI  */
+    INST_VSRL_VV = 530,            /* INST_VSRL_VV  */
+    INST_VSRL_VX = 531,            /* INST_VSRL_VX  */
+    INST_VSRL_VI = 532,            /* INST_VSRL_VI  */
+    INST_VSRA_VV = 533,            /* INST_VSRA_VV  */
+    INST_VSRA_VX = 534,            /* INST_VSRA_VX  */
+    INST_VSRA_VI = 535,            /* INST_VSRA_VI  */
+    INST_VNSRL_WV = 536,           /* INST_VNSRL_WV  */
+    INST_VNSRL_WX = 537,           /* INST_VNSRL_WX  */
+    INST_VNSRL_WI = 538,           /* INST_VNSRL_WI  */
+    INST_VNSRA_WV = 539,           /* INST_VNSRA_WV  */
+    INST_VNSRA_WX = 540,           /* INST_VNSRA_WX  */
+    INST_VNSRA_WI = 541,           /* INST_VNSRA_WI  */
+    INST_VMERGE_VVM = 542,         /* INST_VMERGE_VVM  */
+    INST_VMERGE_VXM = 543,         /* INST_VMERGE_VXM  */
+    INST_VMERGE_VIM = 544,         /* INST_VMERGE_VIM  */
+    INST_VMV_V_V = 545,            /* INST_VMV_V_V  */
+    INST_VMV_V_X = 546,            /* INST_VMV_V_X  */
+    INST_VMV_V_I = 547,            /* INST_VMV_V_I  */
+    INST_VDIVU_VV = 548,           /* INST_VDIVU_VV  */
+    INST_VDIVU_VX = 549,           /* INST_VDIVU_VX  */
+    INST_VDIV_VV = 550,            /* INST_VDIV_VV  */
+    INST_VDIV_VX = 551,            /* INST_VDIV_VX  */
+    INST_VREMU_VV = 552,           /* INST_VREMU_VV  */
+    INST_VREMU_VX = 553,           /* INST_VREMU_VX  */
+    INST_VREM_VV = 554,            /* INST_VREM_VV  */
+    INST_VREM_VX = 555,            /* INST_VREM_VX  */
+    INST_VMULHU_VV = 556,          /* INST_VMULHU_VV  */
+    INST_VMULHU_VX = 557,          /* INST_VMULHU_VX  */
+    INST_VMUL_VV = 558,            /* INST_VMUL_VV  */
+    INST_VMUL_VX = 559,            /* INST_VMUL_VX  */
+    INST_VMULHSU_VV = 560,         /* INST_VMULHSU_VV  */
+    INST_VMULHSU_VX = 561,         /* INST_VMULHSU_VX  */
+    INST_VMULH_VV = 562,           /* INST_VMULH_VV  */
+    INST_VMULH_VX = 563,           /* INST_VMULH_VX  */
+    INST_VWADDU_VV = 564,          /* INST_VWADDU_VV  */
+    INST_VWADDU_VX = 565,          /* INST_VWADDU_VX  */
+    INST_VWADD_VV = 566,           /* INST_VWADD_VV  */
+    INST_VWADD_VX = 567,           /* INST_VWADD_VX  */
+    INST_VWSUBU_VV = 568,          /* INST_VWSUBU_VV  */
+    INST_VWSUBU_VX = 569,          /* INST_VWSUBU_VX  */
+    INST_VWSUB_VV = 570,           /* INST_VWSUB_VV  */
+    INST_VWSUB_VX = 571,           /* INST_VWSUB_VX  */
+    INST_VWMULU_VV = 572,          /* INST_VWMULU_VV  */
+    INST_VWMULU_VX = 573,          /* INST_VWMULU_VX  */
+    INST_VWMULSU_VV = 574,         /* INST_VWMULSU_VV  */
+    INST_VWMULSU_VX = 575,         /* INST_VWMULSU_VX  */
+    INST_VWMUL_VV = 576,           /* INST_VWMUL_VV  */
+    INST_VWMUL_VX = 577,           /* INST_VWMUL_VX  */
+    INST_VMADD_VV = 578,           /* INST_VMADD_VV  */
+    INST_VMADD_VX = 579,           /* INST_VMADD_VX  */
+    INST_VNMSUB_VV = 580,          /* INST_VNMSUB_VV  */
+    INST_VNMSUB_VX = 581,          /* INST_VNMSUB_VX  */
+    INST_VMACC_VV = 582,           /* INST_VMACC_VV  */
+    INST_VMACC_VX = 583,           /* INST_VMACC_VX  */
+    INST_VNMSAC_VV = 584,          /* INST_VNMSAC_VV  */
+    INST_VNMSAC_VX = 585,          /* INST_VNMSAC_VX  */
+    INST_VWMACCU_VV = 586,         /* INST_VWMACCU_VV  */
+    INST_VWMACCU_VX = 587,         /* INST_VWMACCU_VX  */
+    INST_VWMACC_VV = 588,          /* INST_VWMACC_VV  */
+    INST_VWMACC_VX = 589,          /* INST_VWMACC_VX  */
+    INST_VREDSUM_VS = 590,         /* INST_VREDSUM_VS  */
+    INST_VREDAND_VS = 591,         /* INST_VREDAND_VS  */
+    INST_VREDOR_VS = 592,          /* INST_VREDOR_VS  */
+    INST_VREDXOR_VS = 593,         /* INST_VREDXOR_VS  */
+    INST_VREDMINU_VS = 594,        /* INST_VREDMINU_VS  */
+    INST_VREDMIN_VS = 595,         /* INST_VREDMIN_VS  */
+    INST_VREDMAXU_VS = 596,        /* INST_VREDMAXU_VS  */
+    INST_VREDMAX_VS = 597,         /* INST_VREDMAX_VS  */
+    INST_VSLIDE1UP_VX = 598,       /* INST_VSLIDE1UP_VX  */
+    INST_VSLIDE1DOWN_VX = 599,     /* INST_VSLIDE1DOWN_VX  */
+    INST_VMV_X_S = 600,            /* INST_VMV_X_S  */
+    INST_VMV_S_X = 601,            /* INST_VMV_S_X  */
+    INST_VCPOP_M = 602,            /* INST_VCPOP_M  */
+    INST_VFIRST_M = 603,           /* INST_VFIRST_M  */
+    INST_VIOTA_M = 604,            /* INST_VIOTA_M  */
+    INST_VID_V = 605,              /* INST_VID_V  */
+    INST_VMANDN_MM = 606,          /* INST_VMANDN_MM  */
+    INST_VMAND_MM = 607,           /* INST_VMAND_MM  */
+    INST_VMOR_MM = 608,            /* INST_VMOR_MM  */
+    INST_VMXOR_MM = 609,           /* INST_VMXOR_MM  */
+    INST_VMORN_MM = 610,           /* INST_VMORN_MM  */
+    INST_VMNAND_MM = 611,          /* INST_VMNAND_MM  */
+    INST_VMNOR_MM = 612,           /* INST_VMNOR_MM  */
+    INST_VMXNOR_MM = 613,          /* INST_VMXNOR_MM  */
+    INST_VFADD_VV = 614,           /* INST_VFADD_VV  */
+    INST_VFADD_VF = 615,           /* INST_VFADD_VF  */
+    INST_VFSUB_VV = 616,           /* INST_VFSUB_VV  */
+    INST_VFSUB_VF = 617,           /* INST_VFSUB_VF  */
+    INST_VFRSUB_VF = 618,          /* INST_VFRSUB_VF  */
+    INST_VFMIN_VV = 619,           /* INST_VFMIN_VV  */
+    INST_VFMIN_VF = 620,           /* INST_VFMIN_VF  */
+    INST_VFMAX_VV = 621,           /* INST_VFMAX_VV  */
+    INST_VFMAX_VF = 622,           /* INST_VFMAX_VF  */
+    INST_VFSGNJ_VV = 623,          /* INST_VFSGNJ_VV  */
+    INST_VFSGNJ_VF = 624,          /* INST_VFSGNJ_VF  */
+    INST_VFSGNJN_VV = 625,         /* INST_VFSGNJN_VV  */
+    INST_VFSGNJN_VF = 626,         /* INST_VFSGNJN_VF  */
+    INST_VFSGNJX_VV = 627,         /* INST_VFSGNJX_VV  */
+    INST_VFSGNJX_VF = 628,         /* INST_VFSGNJX_VF  */
+    INST_VFDIV_VV = 629,           /* INST_VFDIV_VV  */
+    INST_VFDIV_VF = 630,           /* INST_VFDIV_VF  */
+    INST_VFRDIV_VF = 631,          /* INST_VFRDIV_VF  */
+    INST_VFMUL_VV = 632,           /* INST_VFMUL_VV  */
+    INST_VFMUL_VF = 633,           /* INST_VFMUL_VF  */
+    INST_VMFEQ_VV = 634,           /* INST_VMFEQ_VV  */
+    INST_VMFEQ_VF = 635,           /* INST_VMFEQ_VF  */
+    INST_VMFLE_VV = 636,           /* INST_VMFLE_VV  */
+    INST_VMFLE_VF = 637,           /* INST_VMFLE_VF  */
+    INST_VMFLT_VV = 638,           /* INST_VMFLT_VV  */
+    INST_VMFLT_VF = 639,           /* INST_VMFLT_VF  */
+    INST_VMFNE_VV = 640,           /* INST_VMFNE_VV  */
+    INST_VMFNE_VF = 641,           /* INST_VMFNE_VF  */
+    INST_VMFGT_VF = 642,           /* INST_VMFGT_VF  */
+    INST_VMFGE_VF = 643,           /* INST_VMFGE_VF  */
+    INST_VFMADD_VV = 644,          /* INST_VFMADD_VV  */
+    INST_VFMADD_VF = 645,          /* INST_VFMADD_VF  */
+    INST_VFNMADD_VV = 646,         /* INST_VFNMADD_VV  */
+    INST_VFNMADD_VF = 647,         /* INST_VFNMADD_VF  */
+    INST_VFMSUB_VV = 648,          /* INST_VFMSUB_VV  */
+    INST_VFMSUB_VF = 649,          /* INST_VFMSUB_VF  */
+    INST_VFNMSUB_VV = 650,         /* INST_VFNMSUB_VV  */
+    INST_VFNMSUB_VF = 651,         /* INST_VFNMSUB_VF  */
+    INST_VFMACC_VV = 652,          /* INST_VFMACC_VV  */
+    INST_VFMACC_VF = 653,          /* INST_VFMACC_VF  */
+    INST_VFNMACC_VV = 654,         /* INST_VFNMACC_VV  */
+    INST_VFNMACC_VF = 655,         /* INST_VFNMACC_VF  */
+    INST_VFMSAC_VV = 656,          /* INST_VFMSAC_VV  */
+    INST_VFMSAC_VF = 657,          /* INST_VFMSAC_VF  */
+    INST_VFNMSAC_VV = 658,         /* INST_VFNMSAC_VV  */
+    INST_VFNMSAC_VF = 659,         /* INST_VFNMSAC_VF  */
+    INST_VFREDUSUM_VS = 660,       /* INST_VFREDUSUM_VS  */
+    INST_VFREDOSUM_VS = 661,       /* INST_VFREDOSUM_VS  */
+    INST_VFREDMIN_VS = 662,        /* INST_VFREDMIN_VS  */
+    INST_VFREDMAX_VS = 663,        /* INST_VFREDMAX_VS  */
+    INST_VFSQRT_V = 664,           /* INST_VFSQRT_V  */
+    INST_VFCVT_XU_F_V = 665,       /* INST_VFCVT_XU_F_V  */
+    INST_VFCVT_X_F_V = 666,        /* INST_VFCVT_X_F_V  */
+    INST_VFCVT_F_XU_V = 667,       /* INST_VFCVT_F_XU_V  */
+    INST_VFCVT_F_X_V = 668,        /* INST_VFCVT_F_X_V  */
+    INST_VFCVT_RTZ_XU_F_V = 669,   /* INST_VFCVT_RTZ_XU_F_V  */
+    INST_VFCVT_RTZ_X_F_V = 670,    /* INST_VFCVT_RTZ_X_F_V  */
+    INST_VFMV_F_S = 671,           /* INST_VFMV_F_S  */
+    INST_VFMV_S_F = 672,           /* INST_VFMV_S_F  */
+    INST_VFMV_V_F = 673,           /* INST_VFMV_V_F  */
+    INST_VFMERGE_VFM = 674,        /* INST_VFMERGE_VFM  */
+    MEMBLOCK = 675,                /* MEMBLOCK  */
+    IFBLOCK = 676,                 /* IFBLOCK  */
+    ELSEBLOCK = 677,               /* ELSEBLOCK  */
+    WHILEBLOCK = 678,              /* WHILEBLOCK  */
+    DOBLOCK = 679,                 /* DOBLOCK  */
+    UNTILBLOCK = 680,              /* UNTILBLOCK  */
+    STRIPMINEBLOCK = 681,          /* STRIPMINEBLOCK  */
+    MACROBLOCK = 682,              /* MACROBLOCK  */
+    IFDIR = 683,                   /* IFDIR  */
+    IFDEFDIR = 684,                /* IFDEFDIR  */
+    IFNDEFDIR = 685,               /* IFNDEFDIR  */
+    ELSEDIR = 686,                 /* ELSEDIR  */
+    ENDIFDIR = 687,                /* ENDIFDIR  */
+    INCLUDEDIR = 688,              /* INCLUDEDIR  */
+    PLUS = 689,                    /* PLUS  */
+    MINUS = 690,                   /* MINUS  */
+    MULTIPLY = 691,                /* MULTIPLY  */
+    DIVIDE = 692,                  /* DIVIDE  */
+    AND = 693,                     /* AND  */
+    OR = 694,                      /* OR  */
+    NOT = 695,                     /* NOT  */
+    XOR = 696,                     /* XOR  */
+    LSHIFT = 697,                  /* LSHIFT  */
+    RSHIFT = 698,                  /* RSHIFT  */
+    ADDRESSOF = 699,               /* ADDRESSOF  */
+    LT = 700,                      /* LT  */
+    GT = 701,                      /* GT  */
+    LTE = 702,                     /* LTE  */
+    GTE = 703,                     /* GTE  */
+    EQ = 704,                      /* EQ  */
+    NEQ = 705,                     /* NEQ  */
+    ASSIGN = 706,                  /* ASSIGN  */
+    LBRACKET = 707,                /* LBRACKET  */
+    RBRACKET = 708,                /* RBRACKET  */
+    LBRACE = 709,                  /* LBRACE  */
+    RBRACE = 710,                  /* RBRACE  */
+    LPAREN = 711,                  /* LPAREN  */
+    RPAREN = 712,                  /* RPAREN  */
+    COLON = 713,                   /* COLON  */
+    BYTEFILL = 714,                /* BYTEFILL  */
+    HALFFILL = 715,                /* HALFFILL  */
+    WORDFILL = 716,                /* WORDFILL  */
+    LONGFILL = 717,                /* LONGFILL  */
+    FLOATFILL = 718,               /* FLOATFILL  */
+    DOUBLEFILL = 719,              /* DOUBLEFILL  */
+    STRINGZFILL = 720,             /* STRINGZFILL  */
+    INCBINFILL = 721,              /* INCBINFILL  */
+    RUNFILL = 722,                 /* RUNFILL  */
+    ZEROFILL = 723,                /* ZEROFILL  */
+    CHASEFILL = 724,               /* CHASEFILL  */
+    RANDOMFILL = 725,              /* RANDOMFILL  */
+    IOTAFILL = 726,                /* IOTAFILL  */
+    UNKNOWN = 727,                 /* UNKNOWN  */
+    LABEL = 728,                   /* LABEL  */
+    FLABEL = 729,                  /* FLABEL  */
+    IREG = 730,                    /* IREG  */
+    FREG = 731,                    /* FREG  */
+    VREG = 732,                    /* VREG  */
+    VMASK = 733,                   /* VMASK  */
+    PCREG = 734,                   /* PCREG  */
+    HARTSREG = 735,                /* HARTSREG  */
+    IIMM = 736,                    /* IIMM  */
+    ROUNDMODE = 737,               /* ROUNDMODE  */
+    VSEW = 738,                    /* VSEW  */
+    VLMUL = 739,                   /* VLMUL  */
+    VTAIL = 740,                   /* VTAIL  */
+    VMASKPOL = 741,                /* VMASKPOL  */
+    FIMM = 742,                    /* FIMM  */
+    STRING = 743                   /* STRING  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
+#endif
+
+/* Value type.  */
+#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
+union YYSTYPE
+{
+#line 137 "./src/dt.y"
+
+    char *string;
+    int64_t ivalue;
+    double fvalue;
+    void *mentry;
+
+#line 569 "./src/dt.tab.h"
+
+};
+typedef union YYSTYPE YYSTYPE;
+# define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
+#endif
+
+/* Location type.  */
+#if ! defined YYLTYPE && ! defined YYLTYPE_IS_DECLARED
+typedef struct YYLTYPE YYLTYPE;
+struct YYLTYPE
+{
+  int first_line;
+  int first_column;
+  int last_line;
+  int last_column;
+};
+# define YYLTYPE_IS_DECLARED 1
+# define YYLTYPE_IS_TRIVIAL 1
+#endif
+
+
+extern YYSTYPE yylval;
+extern YYLTYPE yylloc;
+int yyparse (void);
+
+#endif /* !YY_YY_SRC_DT_TAB_H_INCLUDED  */
@@ -36,6 +36,9 @@
  */
 
 %glr-parser
+/* a lone barrier followed by a label, or "var name" -- the two parses are 
+   both kept and the predicates on those rules drop the wrong one */
+%expect 1
 
 %{
 #include <stdlib.h>
@@ -43,23 +46,98 @@
 #include <stdint.h>
 #include <inttypes.h>
 #include <string.h>
+#include <strings.h>
 #include "riscvarch.h"
+#include "alloc.h"
+#include "analyze.h"
 #include "mem.h"
 #include "pc.h"
+#include "imm.h"
 #include "inst.h"
+#include "gen.h"
+#include "lines.h"
+#include "compress.h"
+#include "relax.h"
+#include "sim.h"
+#include "stats.h"
+#include "opt.h"
 #include "output.h"
+#include "perf.h"
+#include "hart.h"
+#include "atomic.h"
+#include "define.h"
+#include "include.h"
+#include "stream.h"
+#include "disasm.h"
+#include "macro.h"
 #include "symtab.h"
 #include "util.h"
 
 
+/* statement names like lock and perf are labels to the scanner, so a 
+   label can still be called that. The shape of the statement picks the 
+   rule, and its action checks the name against the ones it can be. */
+static void unknown_statement(char *name, const char *expected){
+    char buff[200];
+    snprintf(buff,sizeof(buff),"Unknown statement \"%s\", expected %s",name,expected);
+    yyerror(buff);
+}
+
 /* set to 1 to trace the parser when you run dt on a program */
 #define YYDEBUG 0
+
+/* bison's default, plus a note of where the rule starts. This runs right 
+   before every action, deferred GLR actions included, so whatever the 
+   action builds is stamped with the file, line and column its rule 
+   starts at. An instlist spans the statements before it, so a rule that 
+   starts with one is stamped from the symbol after it instead. */
+#define YYLLOC_DEFAULT(Current, Rhs, N)                                     \
+    do {                                                                    \
+        int first = 1;                                                      \
+        if (N){                                                             \
+            (Current).first_line = YYRHSLOC(Rhs, 1).first_line;             \
+            (Current).first_column = YYRHSLOC(Rhs, 1).first_column;         \
+            (Current).last_line = YYRHSLOC(Rhs, N).last_line;               \
+            (Current).last_column = YYRHSLOC(Rhs, N).last_column;           \
+            (Current).instlist = YYRHSLOC(Rhs, 1).instlist;                 \
+            (Current).file = YYRHSLOC(Rhs, N).file;                         \
+            if (YYRHSLOC(Rhs, 1).instlist && (N > 1))                       \
+                first = 2;                                                  \
+        }                                                                   \
+        else {                                                              \
+            (Current).first_line = (Current).last_line = YYRHSLOC(Rhs, 0).last_line;       \
+            (Current).first_column = (Current).last_column = YYRHSLOC(Rhs, 0).last_column; \
+            (Current).instlist = 0;                                         \
+            (Current).file = YYRHSLOC(Rhs, 0).file;                         \
+            first = 0;                                                      \
+        }                                                                   \
+        current_loc.line = YYRHSLOC(Rhs, first).first_line;                 \
+        current_loc.column = YYRHSLOC(Rhs, first).first_column;             \
+        if (YYRHSLOC(Rhs, first).file)                                      \
+            current_loc.file = YYRHSLOC(Rhs, first).file;                   \
+    } while (0)
 %}
 
+/* bison's location, with a flag for instlists and the file */
+%code requires {
+typedef struct YYLTYPE {
+    int first_line;
+    int first_column;
+    int last_line;
+    int last_column;
+    int instlist;
+    char *file; /* the source file, which an .include changes */
+} YYLTYPE;
+#define YYLTYPE_IS_DECLARED 1
+#define YYLTYPE_IS_TRIVIAL 1
+}
+
+%locations
+
 %union {
     char *string;
     int64_t ivalue;
-    float fvalue;
+    double fvalue;
     void *mentry;
 }
 
@@ -110,14 +188,381 @@
 %token INST_CSRRWI
 %token INST_CSRRSI
 %token INST_CSRRCI
+%token INST_CSRR
+%token INST_CSRW
+%token INST_RDCYCLE
+%token INST_RDTIME
+%token INST_RDINSTRET
 %token INST_J
 %token INST_JR
 %token INST_RET
 %token INST_NOP
 %token INST_MUL
 %token INST_DIV
+%token INST_LD
+%token INST_SD
+%token INST_LWU
+%token INST_ADDIW
+%token INST_SLLIW
+%token INST_SRLIW
+%token INST_SRAIW
+%token INST_ADDW
+%token INST_SUBW
+%token INST_SLLW
+%token INST_SRLW
+%token INST_SRAW
+%token INST_MULH
+%token INST_MULHSU
+%token INST_MULHU
+%token INST_DIVU
+%token INST_REM
+%token INST_REMU
+%token INST_MULW
+%token INST_DIVW
+%token INST_DIVUW
+%token INST_REMW
+%token INST_REMUW
+%token <ivalue> INST_LR_W
+%token <ivalue> INST_SC_W
+%token <ivalue> INST_AMOSWAP_W
+%token <ivalue> INST_AMOADD_W
+%token <ivalue> INST_AMOXOR_W
+%token <ivalue> INST_AMOAND_W
+%token <ivalue> INST_AMOOR_W
+%token <ivalue> INST_AMOMIN_W
+%token <ivalue> INST_AMOMAX_W
+%token <ivalue> INST_AMOMINU_W
+%token <ivalue> INST_AMOMAXU_W
+%token <ivalue> INST_LR_D
+%token <ivalue> INST_SC_D
+%token <ivalue> INST_AMOSWAP_D
+%token <ivalue> INST_AMOADD_D
+%token <ivalue> INST_AMOXOR_D
+%token <ivalue> INST_AMOAND_D
+%token <ivalue> INST_AMOOR_D
+%token <ivalue> INST_AMOMIN_D
+%token <ivalue> INST_AMOMAX_D
+%token <ivalue> INST_AMOMINU_D
+%token <ivalue> INST_AMOMAXU_D
+%token INST_FLW
+%token INST_FSW
+%token INST_FMADD_S
+%token INST_FMSUB_S
+%token INST_FNMSUB_S
+%token INST_FNMADD_S
+%token INST_FADD_S
+%token INST_FSUB_S
+%token INST_FMUL_S
+%token INST_FDIV_S
+%token INST_FSQRT_S
+%token INST_FSGNJ_S
+%token INST_FSGNJN_S
+%token INST_FSGNJX_S
+%token INST_FMIN_S
+%token INST_FMAX_S
+%token INST_FEQ_S
+%token INST_FLT_S
+%token INST_FLE_S
+%token INST_FCLASS_S
+%token INST_FCVT_W_S
+%token INST_FCVT_WU_S
+%token INST_FCVT_L_S
+%token INST_FCVT_LU_S
+%token INST_FCVT_S_W
+%token INST_FCVT_S_WU
+%token INST_FCVT_S_L
+%token INST_FCVT_S_LU
+%token INST_FMV_X_W
+%token INST_FMV_W_X
+%token INST_FLD
+%token INST_FSD
+%token INST_FMADD_D
+%token INST_FMSUB_D
+%token INST_FNMSUB_D
+%token INST_FNMADD_D
+%token INST_FADD_D
+%token INST_FSUB_D
+%token INST_FMUL_D
+%token INST_FDIV_D
+%token INST_FSQRT_D
+%token INST_FSGNJ_D
+%token INST_FSGNJN_D
+%token INST_FSGNJX_D
+%token INST_FMIN_D
+%token INST_FMAX_D
+%token INST_FEQ_D
+%token INST_FLT_D
+%token INST_FLE_D
+%token INST_FCLASS_D
+%token INST_FCVT_W_D
+%token INST_FCVT_WU_D
+%token INST_FCVT_L_D
+%token INST_FCVT_LU_D
+%token INST_FCVT_D_W
+%token INST_FCVT_D_WU
+%token INST_FCVT_D_L
+%token INST_FCVT_D_LU
+%token INST_FMV_X_D
+%token INST_FMV_D_X
+%token INST_FCVT_S_D
+%token INST_FCVT_D_S
+%token INST_FMV_S
+%token INST_FNEG_S
+%token INST_FABS_S
+%token INST_FMV_D
+%token INST_FNEG_D
+%token INST_FABS_D
+%token INST_FRCSR
+%token INST_FSCSR
+%token INST_FRRM
+%token INST_FSRM
+%token INST_FRFLAGS
+%token INST_FSFLAGS
+%token INST_VSETVLI
+%token INST_VSETIVLI
+%token INST_VSETVL
+%token INST_VLE8_V
+%token INST_VLE8FF_V
+%token INST_VSE8_V
+%token INST_VLSE8_V
+%token INST_VSSE8_V
+%token INST_VLUXEI8_V
+%token INST_VLOXEI8_V
+%token INST_VSUXEI8_V
+%token INST_VSOXEI8_V
+%token INST_VLE16_V
+%token INST_VLE16FF_V
+%token INST_VSE16_V
+%token INST_VLSE16_V
+%token INST_VSSE16_V
+%token INST_VLUXEI16_V
+%token INST_VLOXEI16_V
+%token INST_VSUXEI16_V
+%token INST_VSOXEI16_V
+%token INST_VLE32_V
+%token INST_VLE32FF_V
+%token INST_VSE32_V
+%token INST_VLSE32_V
+%token INST_VSSE32_V
+%token INST_VLUXEI32_V
+%token INST_VLOXEI32_V
+%token INST_VSUXEI32_V
+%token INST_VSOXEI32_V
+%token INST_VLE64_V
+%token INST_VLE64FF_V
+%token INST_VSE64_V
+%token INST_VLSE64_V
+%token INST_VSSE64_V
+%token INST_VLUXEI64_V
+%token INST_VLOXEI64_V
+%token INST_VSUXEI64_V
+%token INST_VSOXEI64_V
+%token INST_VLM_V
+%token INST_VSM_V
+%token INST_VADD_VV
+%token INST_VADD_VX
+%token INST_VADD_VI
+%token INST_VSUB_VV
+%token INST_VSUB_VX
+%token INST_VRSUB_VX
+%token INST_VRSUB_VI
+%token INST_VMINU_VV
+%token INST_VMINU_VX
+%token INST_VMIN_VV
+%token INST_VMIN_VX
+%token INST_VMAXU_VV
+%token INST_VMAXU_VX
+%token INST_VMAX_VV
+%token INST_VMAX_VX
+%token INST_VAND_VV
+%token INST_VAND_VX
+%token INST_VAND_VI
+%token INST_VOR_VV
+%token INST_VOR_VX
+%token INST_VOR_VI
+%token INST_VXOR_VV
+%token INST_VXOR_VX
+%token INST_VXOR_VI
+%token INST_VRGATHER_VV
+%token INST_VRGATHER_VX
+%token INST_VRGATHER_VI
+%token INST_VSLIDEUP_VX
+%token INST_VSLIDEUP_VI
+%token INST_VSLIDEDOWN_VX
+%token INST_VSLIDEDOWN_VI
+%token INST_VMSEQ_VV
+%token INST_VMSEQ_VX
+%token INST_VMSEQ_VI
+%token INST_VMSNE_VV
+%token INST_VMSNE_VX
+%token INST_VMSNE_VI
+%token INST_VMSLTU_VV
+%token INST_VMSLTU_VX
+%token INST_VMSLT_VV
+%token INST_VMSLT_VX
+%token INST_VMSLEU_VV
+%token INST_VMSLEU_VX
+%token INST_VMSLEU_VI
+%token INST_VMSLE_VV
+%token INST_VMSLE_VX
+%token INST_VMSLE_VI
+%token INST_VMSGTU_VX
+%token INST_VMSGTU_VI
+%token INST_VMSGT_VX
+%token INST_VMSGT_VI
+%token INST_VSLL_VV
+%token INST_VSLL_VX
+%token INST_VSLL_VI
+%token INST_VSRL_VV
+%token INST_VSRL_VX
+%token INST_VSRL_VI
+%token INST_VSRA_VV
+%token INST_VSRA_VX
+%token INST_VSRA_VI
+%token INST_VNSRL_WV
+%token INST_VNSRL_WX
+%token INST_VNSRL_WI
+%token INST_VNSRA_WV
+%token INST_VNSRA_WX
+%token INST_VNSRA_WI
+%token INST_VMERGE_VVM
+%token INST_VMERGE_VXM
+%token INST_VMERGE_VIM
+%token INST_VMV_V_V
+%token INST_VMV_V_X
+%token INST_VMV_V_I
+%token INST_VDIVU_VV
+%token INST_VDIVU_VX
+%token INST_VDIV_VV
+%token INST_VDIV_VX
+%token INST_VREMU_VV
+%token INST_VREMU_VX
+%token INST_VREM_VV
+%token INST_VREM_VX
+%token INST_VMULHU_VV
+%token INST_VMULHU_VX
+%token INST_VMUL_VV
+%token INST_VMUL_VX
+%token INST_VMULHSU_VV
+%token INST_VMULHSU_VX
+%token INST_VMULH_VV
+%token INST_VMULH_VX
+%token INST_VWADDU_VV
+%token INST_VWADDU_VX
+%token INST_VWADD_VV
+%token INST_VWADD_VX
+%token INST_VWSUBU_VV
+%token INST_VWSUBU_VX
+%token INST_VWSUB_VV
+%token INST_VWSUB_VX
+%token INST_VWMULU_VV
+%token INST_VWMULU_VX
+%token INST_VWMULSU_VV
+%token INST_VWMULSU_VX
+%token INST_VWMUL_VV
+%token INST_VWMUL_VX
+%token INST_VMADD_VV
+%token INST_VMADD_VX
+%token INST_VNMSUB_VV
+%token INST_VNMSUB_VX
+%token INST_VMACC_VV
+%token INST_VMACC_VX
+%token INST_VNMSAC_VV
+%token INST_VNMSAC_VX
+%token INST_VWMACCU_VV
+%token INST_VWMACCU_VX
+%token INST_VWMACC_VV
+%token INST_VWMACC_VX
+%token INST_VREDSUM_VS
+%token INST_VREDAND_VS
+%token INST_VREDOR_VS
+%token INST_VREDXOR_VS
+%token INST_VREDMINU_VS
+%token INST_VREDMIN_VS
+%token INST_VREDMAXU_VS
+%token INST_VREDMAX_VS
+%token INST_VSLIDE1UP_VX
+%token INST_VSLIDE1DOWN_VX
+%token INST_VMV_X_S
+%token INST_VMV_S_X
+%token INST_VCPOP_M
+%token INST_VFIRST_M
+%token INST_VIOTA_M
+%token INST_VID_V
+%token INST_VMANDN_MM
+%token INST_VMAND_MM
+%token INST_VMOR_MM
+%token INST_VMXOR_MM
+%token INST_VMORN_MM
+%token INST_VMNAND_MM
+%token INST_VMNOR_MM
+%token INST_VMXNOR_MM
+%token INST_VFADD_VV
+%token INST_VFADD_VF
+%token INST_VFSUB_VV
+%token INST_VFSUB_VF
+%token INST_VFRSUB_VF
+%token INST_VFMIN_VV
+%token INST_VFMIN_VF
+%token INST_VFMAX_VV
+%token INST_VFMAX_VF
+%token INST_VFSGNJ_VV
+%token INST_VFSGNJ_VF
+%token INST_VFSGNJN_VV
+%token INST_VFSGNJN_VF
+%token INST_VFSGNJX_VV
+%token INST_VFSGNJX_VF
+%token INST_VFDIV_VV
+%token INST_VFDIV_VF
+%token INST_VFRDIV_VF
+%token INST_VFMUL_VV
+%token INST_VFMUL_VF
+%token INST_VMFEQ_VV
+%token INST_VMFEQ_VF
+%token INST_VMFLE_VV
+%token INST_VMFLE_VF
+%token INST_VMFLT_VV
+%token INST_VMFLT_VF
+%token INST_VMFNE_VV
+%token INST_VMFNE_VF
+%token INST_VMFGT_VF
+%token INST_VMFGE_VF
+%token INST_VFMADD_VV
+%token INST_VFMADD_VF
+%token INST_VFNMADD_VV
+%token INST_VFNMADD_VF
+%token INST_VFMSUB_VV
+%token INST_VFMSUB_VF
+%token INST_VFNMSUB_VV
+%token INST_VFNMSUB_VF
+%token INST_VFMACC_VV
+%token INST_VFMACC_VF
+%token INST_VFNMACC_VV
+%token INST_VFNMACC_VF
+%token INST_VFMSAC_VV
+%token INST_VFMSAC_VF
+%token INST_VFNMSAC_VV
+%token INST_VFNMSAC_VF
+%token INST_VFREDUSUM_VS
+%token INST_VFREDOSUM_VS
+%token INST_VFREDMIN_VS
+%token INST_VFREDMAX_VS
+%token INST_VFSQRT_V
+%token INST_VFCVT_XU_F_V
+%token INST_VFCVT_X_F_V
+%token INST_VFCVT_F_XU_V
+%token INST_VFCVT_F_X_V
+%token INST_VFCVT_RTZ_XU_F_V
+%token INST_VFCVT_RTZ_X_F_V
+%token INST_VFMV_F_S
+%token INST_VFMV_S_F
+%token INST_VFMV_V_F
+%token INST_VFMERGE_VFM
 
-%token MEMBLOCK IFBLOCK ELSEBLOCK WHILEBLOCK DOBLOCK UNTILBLOCK
+%token MEMBLOCK IFBLOCK ELSEBLOCK WHILEBLOCK DOBLOCK UNTILBLOCK STRIPMINEBLOCK
+%token MACROBLOCK /* consumed by yylex() in macro.c, never reaches the grammar */
+%token IFDIR IFDEFDIR IFNDEFDIR ELSEDIR ENDIFDIR /* ditto */
+%token INCLUDEDIR /* ditto */
 
 %token PLUS MINUS MULTIPLY DIVIDE
 %token AND OR NOT XOR
@@ -134,30 +579,47 @@
 %token BYTEFILL HALFFILL WORDFILL LONGFILL
 %token FLOATFILL DOUBLEFILL
 %token STRINGZFILL
+%token INCBINFILL
+%token RUNFILL
+%token ZEROFILL
+%token CHASEFILL
+%token RANDOMFILL
+%token IOTAFILL
 
 %token UNKNOWN
 
-%token <string> LABEL
+%token <string> LABEL FLABEL
 
-%token <ivalue> IREG FREG
-%token PCREG
+%token <ivalue> IREG FREG VREG
+%token VMASK
+%token PCREG HARTSREG
 
 %token <ivalue> IIMM 
+%token <ivalue> ROUNDMODE
+%token <ivalue> VSEW VLMUL VTAIL VMASKPOL
 %token <fvalue> FIMM 
 %token <string> STRING
 
-%type <ivalue> validireg validfreg
-%type <mentry> instlist fill inst definition memblock 
+%type <ivalue> validireg validfreg frm csr amoaddr
+%type <ivalue> validvreg vtype vlmul vtail vmaskpol vmask
+%type <mentry> instlist fill inst definition memblock ilist flist
+%type <fvalue> fnum 
 
 %%
 
 /* add the memblocks to a list of instlists */
 program: memblock           {
-                                add_memblock((mem_entry_t*)$1);
+                                if (streaming())
+                                    stream_memblock((mem_entry_t*)$1);
+                                else
+                                    add_memblock((mem_entry_t*)$1);
                                 /*dump_instlist($1);*/
                             }
     | program memblock      {
-                                add_memblock((mem_entry_t*)$2);
+                                if (streaming())
+                                    stream_memblock((mem_entry_t*)$2);
+                                else
+                                    add_memblock((mem_entry_t*)$2);
                                 /*dump_instlist($2);*/
                             }
     | program PCREG ASSIGN IIMM {
@@ -166,51 +628,34 @@ program: memblock           {
     | PCREG ASSIGN IIMM     {
                                 set_pc($3);
                             }
+    /* tested */
+    | program HARTSREG ASSIGN IIMM {
+                                set_harts($4);
+                            }
+    | HARTSREG ASSIGN IIMM  {
+                                set_harts($3);
+                            }
     ;
 
 memblock: MEMBLOCK LPAREN IIMM RPAREN LBRACE instlist RBRACE { /* at this point, all instructions/etc can get an address */
-                                uint64_t current_address = $3;
-                                mem_entry_t *list = (mem_entry_t*) $6;
-                                mem_entry_t * working = list;
-                                while (working){
-                                    /* correct for alignment, depending on data type */
-                                    if (((working->type == ENTRY_LDATA) || 
-                                       (working->type == ENTRY_DDATA)) && 
-                                       (current_address & 0x7)){ // 8 byte types
-                                        while (current_address & 0x7)
-                                            current_address++;
-                                    }
-                                    else if (((working->type == ENTRY_INSTRUCTION) || 
-                                            (working->type == ENTRY_WDATA) || 
-                                            (working->type == ENTRY_FDATA)) && 
-                                            (current_address & 0x3)){ // 4 byte types
-                                        while (current_address & 0x3)
-                                            current_address++;
-                                    }
-                                    else if ((working->type == ENTRY_HDATA) && 
-                                            (current_address & 0x1)){ // 2 byte types
-                                        while (current_address & 0x1)
-                                            current_address++;
-                                    }
-                                    // 1 byte types (byte, string) do not need alignment
-
-                                    // now save the finalized address, and update the symbol table
-                                    working->address = current_address;
-                                    if (working->name && (working->type != ENTRY_DEFINITION)){
-                                        /* update symbol table w/ the new address */
-                                        symtab_update(working->name,working->address);
-                                    }
-                                    current_address += working->size;
-                                    working = working->next;
-                                }
+                                mem_entry_t *list = flush_literal_pool((mem_entry_t*) $6);
+                                list = flush_perf_tables(list);
+                                list = flush_atomic_objects(list);
+                                list = flush_hart_areas(list);
+                                layout_memblock(list,$3);
                                 $$=list;
                             }
     ;
 
-instlist:                   {$$=NULL;}
+instlist:                   {$$=NULL; @$.instlist = 1;}
     | instlist inst         {$$=(void*)append_inst((mem_entry_t*)$1,(mem_entry_t*)$2);}
     | instlist definition   {$$=(void*)append_inst((mem_entry_t*)$1,(mem_entry_t*)$2);}
     | instlist fill         {$$=(void*)append_inst((mem_entry_t*)$1,(mem_entry_t*)$2);}
+    /* tested */
+    | instlist LABEL LABEL %?{ strcasecmp($2,"var") == 0 } {
+                                new_var($3); /* a register for it is picked by allocate_vars() */
+                                $$=$1;
+                            }
     | instlist IFBLOCK LPAREN validireg RPAREN LBRACE instlist RBRACE {
                                 mem_entry_t *top_node;
                                 mem_entry_t *branch;
@@ -821,6 +1266,167 @@ instlist:                   {$$=NULL;}
                                 top_node = append_inst(top_node,branch);
                                 $$=(void*)top_node;
                             }
+    /* tested */
+    | instlist LABEL LPAREN LABEL RPAREN LBRACE instlist RBRACE {
+                                /* counters are read around the body, the deltas go in a table named $4 */
+                                /* or only hart $4 runs the body, $4 can only be all */
+                                mem_entry_t *entry = NULL;
+                                if (strcasecmp($2,"perf") == 0)
+                                    entry = perf_region($4,(mem_entry_t*)$7);
+                                else if (strcasecmp($2,"hart") == 0){
+                                    if (strcmp($4,"all"))
+                                        yyerror("hart blocks take a hart number or all");
+                                    entry = hart_region(HART_ALL,(mem_entry_t*)$7);
+                                }
+                                else
+                                    unknown_statement($2,"perf or hart");
+                                $$=(void*)append_inst((mem_entry_t*)$1,entry);
+                            }
+    /* tested */
+    | instlist LABEL LPAREN IIMM IIMM RPAREN LBRACE instlist RBRACE {
+                                /* the body runs $4 + $5 times, the last $5 are sampled */
+                                mem_entry_t *entry = NULL;
+                                if (strcasecmp($2,"bench") == 0)
+                                    entry = bench_region($4,$5,(mem_entry_t*)$8);
+                                else
+                                    unknown_statement($2,"bench");
+                                $$=(void*)append_inst((mem_entry_t*)$1,entry);
+                            }
+    /* tested */
+    | instlist LABEL LPAREN IIMM RPAREN LBRACE instlist RBRACE {
+                                /* only hart $4 runs the body */
+                                mem_entry_t *entry = NULL;
+                                if (strcasecmp($2,"hart") == 0)
+                                    entry = hart_region($4,(mem_entry_t*)$7);
+                                else
+                                    unknown_statement($2,"hart");
+                                $$=(void*)append_inst((mem_entry_t*)$1,entry);
+                            }
+    /* tested */
+    | instlist LABEL %?{ strcasecmp($2,"barrier") == 0 } {
+                                /* a name on its own is only barrier, the predicate 
+                                   picks between this and "var name" when a label follows */
+                                $$=(void*)append_inst((mem_entry_t*)$1,hart_barrier());
+                            }
+    /* tested */
+    | instlist LABEL LPAREN LABEL IIMM RPAREN {
+                                /* a barrier of its own, for $5 harts */
+                                mem_entry_t *entry = NULL;
+                                if (strcasecmp($2,"barrier") == 0)
+                                    entry = named_barrier($4,$5);
+                                else
+                                    unknown_statement($2,"barrier");
+                                $$=(void*)append_inst((mem_entry_t*)$1,entry);
+                            }
+    /* tested */
+    | instlist LABEL LPAREN LABEL validireg RPAREN {
+                                if (strcasecmp($2,"atomic_add") != 0)
+                                    unknown_statement($2,"atomic_add");
+                                $$=(void*)append_inst((mem_entry_t*)$1,atomic_add($4,$5));
+                            }
+    /* tested */
+    | instlist LABEL LPAREN LABEL RPAREN {
+                                mem_entry_t *entry = NULL;
+                                if (strcasecmp($2,"lock") == 0)
+                                    entry = lock_acquire($4);
+                                else if (strcasecmp($2,"unlock") == 0)
+                                    entry = lock_release($4);
+                                else
+                                    unknown_statement($2,"lock or unlock");
+                                $$=(void*)append_inst((mem_entry_t*)$1,entry);
+                            }
+    /* tested */
+    | instlist STRIPMINEBLOCK LPAREN validireg validireg vtype RPAREN LBRACE instlist RBRACE {
+                                mem_entry_t *top_node;
+                                mem_entry_t *setvl;
+                                mem_entry_t *decrement;
+                                mem_entry_t *bottom_branch;
+                                /* $4 is the remaining element count, $5 gets vl on each trip */
+                                if (($4 == 0) || ($5 == 0) || ($4 == $5))
+                                    yyerror("stripmine needs two different registers, neither of them $zero, "
+                                            "for the element count and vl");
+                                /* generate the vsetvli at the top of the loop */
+                                setvl = new_instruction(OP_VSETVLI);
+                                setvl->inst->inst_id=RISCV_VSETVLI;
+                                setvl->inst->funct3=F3_VSETVLI;
+                                setvl->inst->rdst=$5;
+                                setvl->inst->rsrc1=$4;
+                                setvl->inst->imm=$6;
+                                setvl->status = ENTRY_COMPLETE;
+                                /* name the vsetvli so the bottom branch can target it */
+                                setvl->name = internal_name();
+                                symtab_new(setvl->name,SYMTAB_MEM);
+                                /* generate the decrement of the element count by vl */
+                                decrement = new_instruction(OP_SUB);
+                                decrement->inst->inst_id=RISCV_SUB;
+                                decrement->inst->funct3=F3_SUB;
+                                decrement->inst->funct7=F7_SUB;
+                                decrement->inst->rdst=$4;
+                                decrement->inst->rsrc1=$4;
+                                decrement->inst->rsrc2=$5;
+                                decrement->status = ENTRY_COMPLETE;
+                                /* generate branch back to the vsetvli while elements remain */
+                                bottom_branch = new_instruction(OP_BNE); 
+                                bottom_branch->inst->inst_id=RISCV_BNE;
+                                bottom_branch->inst->funct3=F3_BNE;
+                                bottom_branch->inst->rsrc1=$4; 
+                                bottom_branch->inst->rsrc2=0; // compare to $r0
+                                bottom_branch->inst->target_name = strdup(setvl->name);
+                                /* link the vsetvli to the end of the first instlist */
+                                top_node = append_inst((mem_entry_t*)$1,setvl);
+                                /* link the second instlist (loop body) to the vsetvli */
+                                top_node = append_inst(top_node,(mem_entry_t*)$9);
+                                /* link the decrement and bottom branch to the end of the loop body */
+                                top_node = append_inst(top_node,decrement);
+                                top_node = append_inst(top_node,bottom_branch);
+                                $$=(void*)top_node;
+                            }
+    /* tested */
+    | instlist LABEL COLON STRIPMINEBLOCK LPAREN validireg validireg vtype RPAREN LBRACE instlist RBRACE {
+                                mem_entry_t *top_node;
+                                mem_entry_t *setvl;
+                                mem_entry_t *decrement;
+                                mem_entry_t *bottom_branch;
+                                /* $6 is the remaining element count, $7 gets vl on each trip */
+                                if (($6 == 0) || ($7 == 0) || ($6 == $7))
+                                    yyerror("stripmine needs two different registers, neither of them $zero, "
+                                            "for the element count and vl");
+                                /* generate the vsetvli at the top of the loop */
+                                setvl = new_instruction(OP_VSETVLI);
+                                setvl->inst->inst_id=RISCV_VSETVLI;
+                                setvl->inst->funct3=F3_VSETVLI;
+                                setvl->inst->rdst=$7;
+                                setvl->inst->rsrc1=$6;
+                                setvl->inst->imm=$8;
+                                setvl->status = ENTRY_COMPLETE;
+                                /* the label names the vsetvli, which the bottom branch targets */
+                                setvl->name = strdup($2);
+                                symtab_new(setvl->name,SYMTAB_MEM);
+                                /* generate the decrement of the element count by vl */
+                                decrement = new_instruction(OP_SUB);
+                                decrement->inst->inst_id=RISCV_SUB;
+                                decrement->inst->funct3=F3_SUB;
+                                decrement->inst->funct7=F7_SUB;
+                                decrement->inst->rdst=$6;
+                                decrement->inst->rsrc1=$6;
+                                decrement->inst->rsrc2=$7;
+                                decrement->status = ENTRY_COMPLETE;
+                                /* generate branch back to the vsetvli while elements remain */
+                                bottom_branch = new_instruction(OP_BNE); 
+                                bottom_branch->inst->inst_id=RISCV_BNE;
+                                bottom_branch->inst->funct3=F3_BNE;
+                                bottom_branch->inst->rsrc1=$6; 
+                                bottom_branch->inst->rsrc2=0; // compare to $r0
+                                bottom_branch->inst->target_name = strdup(setvl->name);
+                                /* link the vsetvli to the end of the first instlist */
+                                top_node = append_inst((mem_entry_t*)$1,setvl);
+                                /* link the second instlist (loop body) to the vsetvli */
+                                top_node = append_inst(top_node,(mem_entry_t*)$11);
+                                /* link the decrement and bottom branch to the end of the loop body */
+                                top_node = append_inst(top_node,decrement);
+                                top_node = append_inst(top_node,bottom_branch);
+                                $$=(void*)top_node;
+                            }
     ;
 
 /* TODO check the ranges for immediates and offsets */
@@ -840,9 +1446,9 @@ inst: INST_LUI validireg IIMM {
                                 mem_entry_t *top;
                                 mem_entry_t *upper_entry=new_instruction(OP_LUI); 
                                 upper_entry->inst->inst_id=RISCV_LUI;
-                                mem_entry_t *lower_entry=new_instruction(OP_ORI);
-                                lower_entry->inst->inst_id=RISCV_ORI;
-                                lower_entry->inst->funct3 = F3_ORI;
+                                mem_entry_t *lower_entry=new_instruction(OP_ADDIW);
+                                lower_entry->inst->inst_id=RISCV_ADDIW;
+                                lower_entry->inst->funct3 = F3_ADDIW;
                                 upper_entry->inst->rdst=$1;
                                 upper_entry->inst->target_name = strdup($4);
                                 lower_entry->inst->rdst=$1;
@@ -851,38 +1457,10 @@ inst: INST_LUI validireg IIMM {
                                 top = append_inst(upper_entry,lower_entry);
                                 $$=(void*)top;
                             }
-    /* TODO support for 64 bit instructions*/
+    /* tested */
     | validireg ASSIGN IIMM {
-                                mem_entry_t *entry=NULL; 
-                                if ($3 & 0xfffff000){
-                                    /* upper two bytes */
-                                    entry=new_instruction(OP_LUI);
-                                    entry->inst->inst_id=RISCV_LUI;
-                                    entry->inst->rdst=$1;
-                                    entry->inst->imm=($3>>12); 
-                                    entry->status = ENTRY_COMPLETE;
-                                    if ($3 & 0x00000fff){ /* only do lower two bytes if needed */
-                                        mem_entry_t *entry2=new_instruction(OP_ORI);
-                                        entry2->inst->inst_id=RISCV_ORI;
-                                        entry2->inst->funct3 = F3_ORI;
-                                        entry2->inst->rdst=$1;
-                                        entry2->inst->rsrc1=$1;
-                                        entry2->inst->imm=($3&0xfff);
-                                        entry2->status = ENTRY_COMPLETE;
-                                        entry=append_inst(entry,entry2);
-                                    }
-                                }
-                                else{
-                                    /* only an ORI */
-                                    entry=new_instruction(OP_ORI);
-                                    entry->inst->inst_id=RISCV_ORI;
-                                    entry->inst->funct3 = F3_ORI;
-                                    entry->inst->rdst=$1;
-                                    entry->inst->rsrc1=0; /* just addi to $r0 */
-                                    entry->inst->imm=$3;
-                                    entry->status = ENTRY_COMPLETE;
-                                }
-                                $$=(void*)entry;
+                                /* shortest lui/addiw/slli sequence, or a literal pool load */
+                                $$=(void*)load_immediate($1,$3);
                             }
     /* tested */
     | INST_AUIPC validireg IIMM {
@@ -1140,6 +1718,39 @@ inst: INST_LUI validireg IIMM {
                                 entry->status = ENTRY_COMPLETE; 
                                 $$=(void*)entry;
                             }
+    /* tested */
+    | INST_LD validireg IIMM LBRACKET validireg RBRACKET {
+                                mem_entry_t *entry=new_instruction(OP_LD); 
+                                entry->inst->inst_id=RISCV_LD;
+                                entry->inst->rdst=$2; 
+                                entry->inst->funct3=F3_LD;
+                                entry->inst->rsrc1=$5; 
+                                entry->inst->imm=$3; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_LWU validireg IIMM LBRACKET validireg RBRACKET {
+                                mem_entry_t *entry=new_instruction(OP_LWU); 
+                                entry->inst->inst_id=RISCV_LWU;
+                                entry->inst->rdst=$2; 
+                                entry->inst->funct3=F3_LWU;
+                                entry->inst->rsrc1=$5; 
+                                entry->inst->imm=$3; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_SD validireg IIMM LBRACKET validireg RBRACKET {
+                                mem_entry_t *entry=new_instruction(OP_SD);
+                                entry->inst->inst_id=RISCV_SD;
+                                entry->inst->funct3=F3_SD;
+                                entry->inst->rsrc1=$5; 
+                                entry->inst->rsrc2=$2; 
+                                entry->inst->imm=$3; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
     /* TODO */
     | validireg ASSIGN validireg {
                                 mem_entry_t *entry=new_instruction(OP_ADDI); 
@@ -1417,7 +2028,7 @@ inst: INST_LUI validireg IIMM {
                                 entry->inst->rsrc1=$3; 
                                 entry->inst->funct3=F3_SLLI; 
                                 entry->inst->funct7=F7_SLLI;
-                                entry->inst->rsrc2=$4; //shamt 
+                                entry->inst->rsrc2=check_shamt($4,6); //shamt 
                                 entry->status = ENTRY_COMPLETE; 
                                 $$=(void*)entry;
                             }
@@ -1429,7 +2040,7 @@ inst: INST_LUI validireg IIMM {
                                 entry->inst->rsrc1=$3; 
                                 entry->inst->funct3=F3_SLLI; 
                                 entry->inst->funct7=F7_SLLI;
-                                entry->inst->rsrc2=$5; //shamt 
+                                entry->inst->rsrc2=check_shamt($5,6); //shamt 
                                 entry->status = ENTRY_COMPLETE; 
                                 $$=(void*)entry;
                             }
@@ -1441,7 +2052,7 @@ inst: INST_LUI validireg IIMM {
                                 entry->inst->rsrc1=$3; 
                                 entry->inst->funct3=F3_SRLI; 
                                 entry->inst->funct7=F7_SRLI;
-                                entry->inst->rsrc2=$4; //shamt
+                                entry->inst->rsrc2=check_shamt($4,6); //shamt
                                 entry->status = ENTRY_COMPLETE; 
                                 $$=(void*)entry;
                             }
@@ -1453,7 +2064,7 @@ inst: INST_LUI validireg IIMM {
                                 entry->inst->rsrc1=$3;
                                 entry->inst->funct3=F3_SRLI; 
                                 entry->inst->funct7=F7_SRLI; 
-                                entry->inst->rsrc2=$5; //shamt
+                                entry->inst->rsrc2=check_shamt($5,6); //shamt
                                 entry->status = ENTRY_COMPLETE; 
                                 $$=(void*)entry;
                             }
@@ -1465,7 +2076,7 @@ inst: INST_LUI validireg IIMM {
                                 entry->inst->rsrc1=$3; 
                                 entry->inst->funct3=F3_SRAI; 
                                 entry->inst->funct7=F7_SRAI;
-                                entry->inst->rsrc2=$4; //shamt
+                                entry->inst->rsrc2=check_shamt($4,6); //shamt
                                 entry->status = ENTRY_COMPLETE; 
                                 $$=(void*)entry;
                             }
@@ -1572,261 +2183,4820 @@ inst: INST_LUI validireg IIMM {
                                 $$=(void*)entry;
                             }
     /* tested */
-    | INST_SLL validireg validireg validireg {
-                                mem_entry_t *entry=new_instruction(OP_SLL); 
-                                entry->inst->inst_id=RISCV_SLL;
+    | INST_ADDIW validireg validireg IIMM {
+                                mem_entry_t *entry=new_instruction(OP_ADDIW);
+                                entry->inst->inst_id=RISCV_ADDIW;
+                                entry->inst->funct3=F3_ADDIW;
                                 entry->inst->rdst=$2; 
                                 entry->inst->rsrc1=$3; 
-                                entry->inst->funct3=F3_SLL; 
-                                entry->inst->funct7=F7_SLL;
-                                entry->inst->rsrc2=$4; 
+                                entry->inst->imm=$4; 
                                 entry->status = ENTRY_COMPLETE; 
                                 $$=(void*)entry;
                             }
     /* tested */
-    | INST_SLT validireg validireg validireg {
-                                mem_entry_t *entry=new_instruction(OP_SLT); 
-                                entry->inst->inst_id=RISCV_SLT;
+    | INST_SLLIW validireg validireg IIMM {
+                                mem_entry_t *entry=new_instruction(OP_SLLIW); 
+                                entry->inst->inst_id=RISCV_SLLIW;
                                 entry->inst->rdst=$2; 
                                 entry->inst->rsrc1=$3; 
-                                entry->inst->funct3=F3_SLT; 
-                                entry->inst->funct7=F7_SLT;
-                                entry->inst->rsrc2=$4; 
+                                entry->inst->funct3=F3_SLLIW; 
+                                entry->inst->funct7=F7_SLLIW;
+                                entry->inst->rsrc2=check_shamt($4,5); //shamt
                                 entry->status = ENTRY_COMPLETE; 
                                 $$=(void*)entry;
                             }
     /* tested */
-    | validireg ASSIGN validireg LT validireg {
-                                mem_entry_t *entry=new_instruction(OP_SLT); 
-                                entry->inst->inst_id=RISCV_SLT;
-                                entry->inst->rdst=$1; 
+    | INST_SRLIW validireg validireg IIMM {
+                                mem_entry_t *entry=new_instruction(OP_SRLIW); 
+                                entry->inst->inst_id=RISCV_SRLIW;
+                                entry->inst->rdst=$2; 
                                 entry->inst->rsrc1=$3; 
-                                entry->inst->funct3=F3_SLT;
-                                entry->inst->funct7=F7_SLT;
-                                entry->inst->rsrc2=$5; 
+                                entry->inst->funct3=F3_SRLIW; 
+                                entry->inst->funct7=F7_SRLIW;
+                                entry->inst->rsrc2=check_shamt($4,5); //shamt
                                 entry->status = ENTRY_COMPLETE; 
                                 $$=(void*)entry;
                             }
     /* tested */
-    | INST_SLTU validireg validireg validireg {
-                                mem_entry_t *entry=new_instruction(OP_SLTU); 
-                                entry->inst->inst_id=RISCV_SLTU;
+    | INST_SRAIW validireg validireg IIMM {
+                                mem_entry_t *entry=new_instruction(OP_SRAIW); 
+                                entry->inst->inst_id=RISCV_SRAIW;
                                 entry->inst->rdst=$2; 
                                 entry->inst->rsrc1=$3; 
-                                entry->inst->funct3=F3_SLTU; 
-                                entry->inst->funct7=F7_SLTU;
-                                entry->inst->rsrc2=$4; 
+                                entry->inst->funct3=F3_SRAIW; 
+                                entry->inst->funct7=F7_SRAIW;
+                                entry->inst->rsrc2=check_shamt($4,5); //shamt
                                 entry->status = ENTRY_COMPLETE; 
                                 $$=(void*)entry;
                             }
     /* tested */
-    | INST_XOR validireg validireg validireg {
-                                mem_entry_t *entry=new_instruction(OP_XOR); 
-                                entry->inst->inst_id=RISCV_XOR;
+    | INST_ADDW validireg validireg validireg {
+                                mem_entry_t *entry=new_instruction(OP_ADDW); 
+                                entry->inst->inst_id=RISCV_ADDW;
                                 entry->inst->rdst=$2; 
                                 entry->inst->rsrc1=$3; 
-                                entry->inst->funct3=F3_XOR; 
-                                entry->inst->funct7=F7_XOR;
+                                entry->inst->funct3=F3_ADDW; 
+                                entry->inst->funct7=F7_ADDW;
                                 entry->inst->rsrc2=$4; 
                                 entry->status = ENTRY_COMPLETE; 
                                 $$=(void*)entry;
                             }
     /* tested */
-    | validireg ASSIGN validireg XOR validireg {
-                                mem_entry_t *entry=new_instruction(OP_XOR); 
-                                entry->inst->inst_id=RISCV_XOR;
-                                entry->inst->rdst=$1; 
+    | INST_SUBW validireg validireg validireg {
+                                mem_entry_t *entry=new_instruction(OP_SUBW); 
+                                entry->inst->inst_id=RISCV_SUBW;
+                                entry->inst->rdst=$2; 
                                 entry->inst->rsrc1=$3; 
-                                entry->inst->funct3=F3_XOR; 
-                                entry->inst->funct7=F7_XOR;
-                                entry->inst->rsrc2=$5; 
+                                entry->inst->funct3=F3_SUBW; 
+                                entry->inst->funct7=F7_SUBW;
+                                entry->inst->rsrc2=$4; 
                                 entry->status = ENTRY_COMPLETE; 
                                 $$=(void*)entry;
                             }
     /* tested */
-    | INST_SRL validireg validireg validireg {
-                                mem_entry_t *entry=new_instruction(OP_SRL); 
-                                entry->inst->inst_id=RISCV_SRL;
+    | INST_SLLW validireg validireg validireg {
+                                mem_entry_t *entry=new_instruction(OP_SLLW); 
+                                entry->inst->inst_id=RISCV_SLLW;
                                 entry->inst->rdst=$2; 
                                 entry->inst->rsrc1=$3; 
-                                entry->inst->funct3=F3_SRL; 
-                                entry->inst->funct7=F7_SRL;
+                                entry->inst->funct3=F3_SLLW; 
+                                entry->inst->funct7=F7_SLLW;
                                 entry->inst->rsrc2=$4; 
                                 entry->status = ENTRY_COMPLETE; 
                                 $$=(void*)entry;
                             }
     /* tested */
-    | INST_SRA validireg validireg validireg {
-                                mem_entry_t *entry=new_instruction(OP_SRA); 
-                                entry->inst->inst_id=RISCV_SRA;
+    | INST_SRLW validireg validireg validireg {
+                                mem_entry_t *entry=new_instruction(OP_SRLW); 
+                                entry->inst->inst_id=RISCV_SRLW;
                                 entry->inst->rdst=$2; 
                                 entry->inst->rsrc1=$3; 
-                                entry->inst->funct3=F3_SRA; 
-                                entry->inst->funct7=F7_SRA;
+                                entry->inst->funct3=F3_SRLW; 
+                                entry->inst->funct7=F7_SRLW;
                                 entry->inst->rsrc2=$4; 
                                 entry->status = ENTRY_COMPLETE; 
                                 $$=(void*)entry;
                             }
     /* tested */
-    | INST_OR validireg validireg validireg {
-                                mem_entry_t *entry=new_instruction(OP_OR); 
-                                entry->inst->inst_id=RISCV_OR;
+    | INST_SRAW validireg validireg validireg {
+                                mem_entry_t *entry=new_instruction(OP_SRAW); 
+                                entry->inst->inst_id=RISCV_SRAW;
                                 entry->inst->rdst=$2; 
                                 entry->inst->rsrc1=$3; 
-                                entry->inst->funct3=F3_OR; 
-                                entry->inst->funct7=F7_OR;
+                                entry->inst->funct3=F3_SRAW; 
+                                entry->inst->funct7=F7_SRAW;
                                 entry->inst->rsrc2=$4; 
                                 entry->status = ENTRY_COMPLETE; 
                                 $$=(void*)entry;
                             }
     /* tested */
-    | validireg ASSIGN validireg OR validireg {
-                                mem_entry_t *entry=new_instruction(OP_OR); 
-                                entry->inst->inst_id=RISCV_OR;
-                                entry->inst->rdst=$1; 
+    | INST_MULH validireg validireg validireg {
+                                mem_entry_t *entry=new_instruction(OP_MULH); 
+                                entry->inst->inst_id=RISCV_MULH;
+                                entry->inst->rdst=$2; 
                                 entry->inst->rsrc1=$3; 
-                                entry->inst->funct3=F3_OR; 
-                                entry->inst->funct7=F7_OR;
-                                entry->inst->rsrc2=$5; 
+                                entry->inst->funct3=F3_MULH; 
+                                entry->inst->funct7=F7_MULH;
+                                entry->inst->rsrc2=$4; 
                                 entry->status = ENTRY_COMPLETE; 
                                 $$=(void*)entry;
                             }
     /* tested */
-    | INST_AND validireg validireg validireg {
-                                mem_entry_t *entry=new_instruction(OP_AND); 
-                                entry->inst->inst_id=RISCV_AND;
+    | INST_MULHSU validireg validireg validireg {
+                                mem_entry_t *entry=new_instruction(OP_MULHSU); 
+                                entry->inst->inst_id=RISCV_MULHSU;
                                 entry->inst->rdst=$2; 
                                 entry->inst->rsrc1=$3; 
-                                entry->inst->funct3=F3_AND; 
-                                entry->inst->funct7=F7_AND;
+                                entry->inst->funct3=F3_MULHSU; 
+                                entry->inst->funct7=F7_MULHSU;
                                 entry->inst->rsrc2=$4; 
                                 entry->status = ENTRY_COMPLETE; 
                                 $$=(void*)entry;
                             }
     /* tested */
-    | validireg ASSIGN validireg AND validireg {
-                                mem_entry_t *entry=new_instruction(OP_AND); 
-                                entry->inst->inst_id=RISCV_AND;
-                                entry->inst->rdst=$1; 
+    | INST_MULHU validireg validireg validireg {
+                                mem_entry_t *entry=new_instruction(OP_MULHU); 
+                                entry->inst->inst_id=RISCV_MULHU;
+                                entry->inst->rdst=$2; 
                                 entry->inst->rsrc1=$3; 
-                                entry->inst->funct3=F3_AND; 
-                                entry->inst->funct7=F7_AND;
-                                entry->inst->rsrc2=$5; 
+                                entry->inst->funct3=F3_MULHU; 
+                                entry->inst->funct7=F7_MULHU;
+                                entry->inst->rsrc2=$4; 
                                 entry->status = ENTRY_COMPLETE; 
                                 $$=(void*)entry;
                             }
-    | INST_FENCE {
-        mem_entry_t *entry=NULL; 
-        yyerror("fence not yet implemented"); 
-        $$=(void*)entry;
-    }
-    | INST_FENCE_I {
-        mem_entry_t *entry=NULL; 
-        yyerror("fencei not yet implemented"); 
-        $$=(void*)entry;
-    }
     /* tested */
-    | INST_ECALL {
-                                mem_entry_t *entry=new_instruction(OP_ECALL); 
-                                entry->inst->inst_id=RISCV_ECALL;
+    | INST_DIVU validireg validireg validireg {
+                                mem_entry_t *entry=new_instruction(OP_DIVU); 
+                                entry->inst->inst_id=RISCV_DIVU;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=F3_DIVU; 
+                                entry->inst->funct7=F7_DIVU;
+                                entry->inst->rsrc2=$4; 
                                 entry->status = ENTRY_COMPLETE; 
-                                $$=(void*)entry;        
-    }
+                                $$=(void*)entry;
+                            }
     /* tested */
-    | INST_EBREAK {
-                                mem_entry_t *entry=new_instruction(OP_EBREAK); 
-                                entry->inst->inst_id=RISCV_EBREAK;
-                                entry->inst->imm=0x1;
+    | INST_REM validireg validireg validireg {
+                                mem_entry_t *entry=new_instruction(OP_REM); 
+                                entry->inst->inst_id=RISCV_REM;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=F3_REM; 
+                                entry->inst->funct7=F7_REM;
+                                entry->inst->rsrc2=$4; 
                                 entry->status = ENTRY_COMPLETE; 
-                                $$=(void*)entry;        
-    }
-    | INST_CSRRW validireg validireg validireg {
-        mem_entry_t *entry=NULL; 
-        yyerror("csrrw not yet implemented"); 
-        $$=(void*)entry;
-    }
-    | INST_CSRRS validireg validireg validireg {
-        mem_entry_t *entry=NULL; 
-        yyerror("csrrs not yet implemented"); 
-        $$=(void*)entry;
-    }
-    | INST_CSRRC validireg validireg validireg {
-        mem_entry_t *entry=NULL; 
-        yyerror("csrrc not yet implemented"); 
-        $$=(void*)entry;
-    }
-    | INST_CSRRWI validireg validireg IIMM {
-        mem_entry_t *entry=NULL; 
-        yyerror("csrrwi not yet implemented"); 
-        $$=(void*)entry;
-    }
-    | INST_CSRRSI validireg validireg IIMM {
-        mem_entry_t *entry=NULL; 
-        yyerror("csrrsi not yet implemented"); 
-        $$=(void*)entry;
-    }
-    | INST_CSRRCI validireg validireg IIMM {
-        mem_entry_t *entry=NULL; 
-        yyerror("csrrci not yet implemented"); 
-        $$=(void*)entry;
-    }
+                                $$=(void*)entry;
+                            }
     /* tested */
-    | INST_J IIMM             {
-                                mem_entry_t *entry=new_instruction(OP_JAL); 
-                                entry->inst->inst_id=RISCV_J;
-                                entry->inst->rdst=0x0; // always this reg
-                                entry->inst->target_address=$2; 
+    | INST_REMU validireg validireg validireg {
+                                mem_entry_t *entry=new_instruction(OP_REMU); 
+                                entry->inst->inst_id=RISCV_REMU;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=F3_REMU; 
+                                entry->inst->funct7=F7_REMU;
+                                entry->inst->rsrc2=$4; 
                                 entry->status = ENTRY_COMPLETE; 
                                 $$=(void*)entry;
                             }
     /* tested */
-    | INST_J LABEL            {
-                                mem_entry_t *entry=new_instruction(OP_JAL); 
-                                entry->inst->inst_id=RISCV_J;
-                                entry->inst->rdst=0x0; // always this reg
-                                entry->inst->target_name=strdup($2); 
+    | INST_MULW validireg validireg validireg {
+                                mem_entry_t *entry=new_instruction(OP_MULW); 
+                                entry->inst->inst_id=RISCV_MULW;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=F3_MULW; 
+                                entry->inst->funct7=F7_MULW;
+                                entry->inst->rsrc2=$4; 
+                                entry->status = ENTRY_COMPLETE; 
                                 $$=(void*)entry;
                             }
     /* tested */
-    | INST_JR validireg       {
-                                mem_entry_t *entry=new_instruction(OP_JALR);
-                                entry->inst->inst_id=RISCV_JALR;
-                                entry->inst->rdst=0x0;
-                                entry->inst->rsrc1=$2;
-                                entry->inst->imm=0x0;
+    | INST_DIVW validireg validireg validireg {
+                                mem_entry_t *entry=new_instruction(OP_DIVW); 
+                                entry->inst->inst_id=RISCV_DIVW;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=F3_DIVW; 
+                                entry->inst->funct7=F7_DIVW;
+                                entry->inst->rsrc2=$4; 
                                 entry->status = ENTRY_COMPLETE; 
                                 $$=(void*)entry;
-    }
+                            }
     /* tested */
-    | INST_RET {
-                                mem_entry_t *entry=new_instruction(OP_JALR);
-                                entry->inst->inst_id=RISCV_RET;
-                                entry->inst->rdst=0x0;
-                                entry->inst->rsrc1=0x1;
-                                entry->inst->imm=0;
+    | INST_DIVUW validireg validireg validireg {
+                                mem_entry_t *entry=new_instruction(OP_DIVUW); 
+                                entry->inst->inst_id=RISCV_DIVUW;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=F3_DIVUW; 
+                                entry->inst->funct7=F7_DIVUW;
+                                entry->inst->rsrc2=$4; 
                                 entry->status = ENTRY_COMPLETE; 
                                 $$=(void*)entry;
                             }
     /* tested */
-    | INST_NOP {
-                                mem_entry_t *entry=new_instruction(OP_ADDI);
-                                entry->inst->inst_id=RISCV_ADDI;
-                                entry->inst->funct3=F3_ADDI;
-                                entry->inst->rdst=0; 
-                                entry->inst->rsrc1=0; 
-                                entry->inst->imm=0; 
+    | INST_REMW validireg validireg validireg {
+                                mem_entry_t *entry=new_instruction(OP_REMW); 
+                                entry->inst->inst_id=RISCV_REMW;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=F3_REMW; 
+                                entry->inst->funct7=F7_REMW;
+                                entry->inst->rsrc2=$4; 
                                 entry->status = ENTRY_COMPLETE; 
                                 $$=(void*)entry;
                             }
-    ;
-
-validireg : IREG            {
-                                if ($1 > 31) {
-                                    yyerror("Bad int register number");
-                                } 
-                                else {
-                                    $$ = $1;
-                                }
+    /* tested */
+    | INST_REMUW validireg validireg validireg {
+                                mem_entry_t *entry=new_instruction(OP_REMUW); 
+                                entry->inst->inst_id=RISCV_REMUW;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=F3_REMUW; 
+                                entry->inst->funct7=F7_REMUW;
+                                entry->inst->rsrc2=$4; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_LR_W validireg amoaddr {
+                                mem_entry_t *entry=new_instruction(OP_LR_W); 
+                                entry->inst->inst_id=RISCV_LR_W;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=F3_LR_W; 
+                                entry->inst->funct7=F7_LR_W | $1;
+                                entry->inst->rsrc2=0; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_SC_W validireg validireg amoaddr {
+                                mem_entry_t *entry=new_instruction(OP_SC_W); 
+                                entry->inst->inst_id=RISCV_SC_W;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_SC_W; 
+                                entry->inst->funct7=F7_SC_W | $1;
+                                entry->inst->rsrc2=$3; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_AMOSWAP_W validireg validireg amoaddr {
+                                mem_entry_t *entry=new_instruction(OP_AMOSWAP_W); 
+                                entry->inst->inst_id=RISCV_AMOSWAP_W;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_AMOSWAP_W; 
+                                entry->inst->funct7=F7_AMOSWAP_W | $1;
+                                entry->inst->rsrc2=$3; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_AMOADD_W validireg validireg amoaddr {
+                                mem_entry_t *entry=new_instruction(OP_AMOADD_W); 
+                                entry->inst->inst_id=RISCV_AMOADD_W;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_AMOADD_W; 
+                                entry->inst->funct7=F7_AMOADD_W | $1;
+                                entry->inst->rsrc2=$3; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_AMOXOR_W validireg validireg amoaddr {
+                                mem_entry_t *entry=new_instruction(OP_AMOXOR_W); 
+                                entry->inst->inst_id=RISCV_AMOXOR_W;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_AMOXOR_W; 
+                                entry->inst->funct7=F7_AMOXOR_W | $1;
+                                entry->inst->rsrc2=$3; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_AMOAND_W validireg validireg amoaddr {
+                                mem_entry_t *entry=new_instruction(OP_AMOAND_W); 
+                                entry->inst->inst_id=RISCV_AMOAND_W;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_AMOAND_W; 
+                                entry->inst->funct7=F7_AMOAND_W | $1;
+                                entry->inst->rsrc2=$3; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_AMOOR_W validireg validireg amoaddr {
+                                mem_entry_t *entry=new_instruction(OP_AMOOR_W); 
+                                entry->inst->inst_id=RISCV_AMOOR_W;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_AMOOR_W; 
+                                entry->inst->funct7=F7_AMOOR_W | $1;
+                                entry->inst->rsrc2=$3; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_AMOMIN_W validireg validireg amoaddr {
+                                mem_entry_t *entry=new_instruction(OP_AMOMIN_W); 
+                                entry->inst->inst_id=RISCV_AMOMIN_W;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_AMOMIN_W; 
+                                entry->inst->funct7=F7_AMOMIN_W | $1;
+                                entry->inst->rsrc2=$3; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_AMOMAX_W validireg validireg amoaddr {
+                                mem_entry_t *entry=new_instruction(OP_AMOMAX_W); 
+                                entry->inst->inst_id=RISCV_AMOMAX_W;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_AMOMAX_W; 
+                                entry->inst->funct7=F7_AMOMAX_W | $1;
+                                entry->inst->rsrc2=$3; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_AMOMINU_W validireg validireg amoaddr {
+                                mem_entry_t *entry=new_instruction(OP_AMOMINU_W); 
+                                entry->inst->inst_id=RISCV_AMOMINU_W;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_AMOMINU_W; 
+                                entry->inst->funct7=F7_AMOMINU_W | $1;
+                                entry->inst->rsrc2=$3; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_AMOMAXU_W validireg validireg amoaddr {
+                                mem_entry_t *entry=new_instruction(OP_AMOMAXU_W); 
+                                entry->inst->inst_id=RISCV_AMOMAXU_W;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_AMOMAXU_W; 
+                                entry->inst->funct7=F7_AMOMAXU_W | $1;
+                                entry->inst->rsrc2=$3; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_LR_D validireg amoaddr {
+                                mem_entry_t *entry=new_instruction(OP_LR_D); 
+                                entry->inst->inst_id=RISCV_LR_D;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=F3_LR_D; 
+                                entry->inst->funct7=F7_LR_D | $1;
+                                entry->inst->rsrc2=0; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_SC_D validireg validireg amoaddr {
+                                mem_entry_t *entry=new_instruction(OP_SC_D); 
+                                entry->inst->inst_id=RISCV_SC_D;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_SC_D; 
+                                entry->inst->funct7=F7_SC_D | $1;
+                                entry->inst->rsrc2=$3; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_AMOSWAP_D validireg validireg amoaddr {
+                                mem_entry_t *entry=new_instruction(OP_AMOSWAP_D); 
+                                entry->inst->inst_id=RISCV_AMOSWAP_D;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_AMOSWAP_D; 
+                                entry->inst->funct7=F7_AMOSWAP_D | $1;
+                                entry->inst->rsrc2=$3; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_AMOADD_D validireg validireg amoaddr {
+                                mem_entry_t *entry=new_instruction(OP_AMOADD_D); 
+                                entry->inst->inst_id=RISCV_AMOADD_D;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_AMOADD_D; 
+                                entry->inst->funct7=F7_AMOADD_D | $1;
+                                entry->inst->rsrc2=$3; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_AMOXOR_D validireg validireg amoaddr {
+                                mem_entry_t *entry=new_instruction(OP_AMOXOR_D); 
+                                entry->inst->inst_id=RISCV_AMOXOR_D;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_AMOXOR_D; 
+                                entry->inst->funct7=F7_AMOXOR_D | $1;
+                                entry->inst->rsrc2=$3; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_AMOAND_D validireg validireg amoaddr {
+                                mem_entry_t *entry=new_instruction(OP_AMOAND_D); 
+                                entry->inst->inst_id=RISCV_AMOAND_D;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_AMOAND_D; 
+                                entry->inst->funct7=F7_AMOAND_D | $1;
+                                entry->inst->rsrc2=$3; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_AMOOR_D validireg validireg amoaddr {
+                                mem_entry_t *entry=new_instruction(OP_AMOOR_D); 
+                                entry->inst->inst_id=RISCV_AMOOR_D;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_AMOOR_D; 
+                                entry->inst->funct7=F7_AMOOR_D | $1;
+                                entry->inst->rsrc2=$3; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_AMOMIN_D validireg validireg amoaddr {
+                                mem_entry_t *entry=new_instruction(OP_AMOMIN_D); 
+                                entry->inst->inst_id=RISCV_AMOMIN_D;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_AMOMIN_D; 
+                                entry->inst->funct7=F7_AMOMIN_D | $1;
+                                entry->inst->rsrc2=$3; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_AMOMAX_D validireg validireg amoaddr {
+                                mem_entry_t *entry=new_instruction(OP_AMOMAX_D); 
+                                entry->inst->inst_id=RISCV_AMOMAX_D;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_AMOMAX_D; 
+                                entry->inst->funct7=F7_AMOMAX_D | $1;
+                                entry->inst->rsrc2=$3; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_AMOMINU_D validireg validireg amoaddr {
+                                mem_entry_t *entry=new_instruction(OP_AMOMINU_D); 
+                                entry->inst->inst_id=RISCV_AMOMINU_D;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_AMOMINU_D; 
+                                entry->inst->funct7=F7_AMOMINU_D | $1;
+                                entry->inst->rsrc2=$3; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_AMOMAXU_D validireg validireg amoaddr {
+                                mem_entry_t *entry=new_instruction(OP_AMOMAXU_D); 
+                                entry->inst->inst_id=RISCV_AMOMAXU_D;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_AMOMAXU_D; 
+                                entry->inst->funct7=F7_AMOMAXU_D | $1;
+                                entry->inst->rsrc2=$3; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FLW validfreg IIMM LBRACKET validireg RBRACKET {
+                                mem_entry_t *entry=new_instruction(OP_FLW); 
+                                entry->inst->inst_id=RISCV_FLW;
+                                entry->inst->rdst=$2; 
+                                entry->inst->funct3=F3_FLW;
+                                entry->inst->rsrc1=$5; 
+                                entry->inst->imm=$3; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FSW validfreg IIMM LBRACKET validireg RBRACKET {
+                                mem_entry_t *entry=new_instruction(OP_FSW);
+                                entry->inst->inst_id=RISCV_FSW;
+                                entry->inst->funct3=F3_FSW;
+                                entry->inst->rsrc1=$5; 
+                                entry->inst->rsrc2=$2; 
+                                entry->inst->imm=$3; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FMADD_S validfreg validfreg validfreg validfreg frm {
+                                mem_entry_t *entry=new_instruction(OP_FMADD_S); 
+                                entry->inst->inst_id=RISCV_FMADD_S;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->rsrc2=$4; 
+                                entry->inst->rsrc3=$5; 
+                                entry->inst->funct3=$6; 
+                                entry->inst->funct7=F7_FMADD_S;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FMSUB_S validfreg validfreg validfreg validfreg frm {
+                                mem_entry_t *entry=new_instruction(OP_FMSUB_S); 
+                                entry->inst->inst_id=RISCV_FMSUB_S;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->rsrc2=$4; 
+                                entry->inst->rsrc3=$5; 
+                                entry->inst->funct3=$6; 
+                                entry->inst->funct7=F7_FMSUB_S;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FNMSUB_S validfreg validfreg validfreg validfreg frm {
+                                mem_entry_t *entry=new_instruction(OP_FNMSUB_S); 
+                                entry->inst->inst_id=RISCV_FNMSUB_S;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->rsrc2=$4; 
+                                entry->inst->rsrc3=$5; 
+                                entry->inst->funct3=$6; 
+                                entry->inst->funct7=F7_FNMSUB_S;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FNMADD_S validfreg validfreg validfreg validfreg frm {
+                                mem_entry_t *entry=new_instruction(OP_FNMADD_S); 
+                                entry->inst->inst_id=RISCV_FNMADD_S;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->rsrc2=$4; 
+                                entry->inst->rsrc3=$5; 
+                                entry->inst->funct3=$6; 
+                                entry->inst->funct7=F7_FNMADD_S;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FADD_S validfreg validfreg validfreg frm {
+                                mem_entry_t *entry=new_instruction(OP_FADD_S); 
+                                entry->inst->inst_id=RISCV_FADD_S;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=$5; 
+                                entry->inst->funct7=F7_FADD_S;
+                                entry->inst->rsrc2=$4; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FSUB_S validfreg validfreg validfreg frm {
+                                mem_entry_t *entry=new_instruction(OP_FSUB_S); 
+                                entry->inst->inst_id=RISCV_FSUB_S;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=$5; 
+                                entry->inst->funct7=F7_FSUB_S;
+                                entry->inst->rsrc2=$4; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FMUL_S validfreg validfreg validfreg frm {
+                                mem_entry_t *entry=new_instruction(OP_FMUL_S); 
+                                entry->inst->inst_id=RISCV_FMUL_S;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=$5; 
+                                entry->inst->funct7=F7_FMUL_S;
+                                entry->inst->rsrc2=$4; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FDIV_S validfreg validfreg validfreg frm {
+                                mem_entry_t *entry=new_instruction(OP_FDIV_S); 
+                                entry->inst->inst_id=RISCV_FDIV_S;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=$5; 
+                                entry->inst->funct7=F7_FDIV_S;
+                                entry->inst->rsrc2=$4; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FSQRT_S validfreg validfreg frm {
+                                mem_entry_t *entry=new_instruction(OP_FSQRT_S); 
+                                entry->inst->inst_id=RISCV_FSQRT_S;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=$4; 
+                                entry->inst->funct7=F7_FSQRT_S;
+                                entry->inst->rsrc2=RS2_FSQRT_S;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FSGNJ_S validfreg validfreg validfreg {
+                                mem_entry_t *entry=new_instruction(OP_FSGNJ_S); 
+                                entry->inst->inst_id=RISCV_FSGNJ_S;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=F3_FSGNJ_S; 
+                                entry->inst->funct7=F7_FSGNJ_S;
+                                entry->inst->rsrc2=$4; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FSGNJN_S validfreg validfreg validfreg {
+                                mem_entry_t *entry=new_instruction(OP_FSGNJN_S); 
+                                entry->inst->inst_id=RISCV_FSGNJN_S;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=F3_FSGNJN_S; 
+                                entry->inst->funct7=F7_FSGNJN_S;
+                                entry->inst->rsrc2=$4; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FSGNJX_S validfreg validfreg validfreg {
+                                mem_entry_t *entry=new_instruction(OP_FSGNJX_S); 
+                                entry->inst->inst_id=RISCV_FSGNJX_S;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=F3_FSGNJX_S; 
+                                entry->inst->funct7=F7_FSGNJX_S;
+                                entry->inst->rsrc2=$4; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FMIN_S validfreg validfreg validfreg {
+                                mem_entry_t *entry=new_instruction(OP_FMIN_S); 
+                                entry->inst->inst_id=RISCV_FMIN_S;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=F3_FMIN_S; 
+                                entry->inst->funct7=F7_FMIN_S;
+                                entry->inst->rsrc2=$4; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FMAX_S validfreg validfreg validfreg {
+                                mem_entry_t *entry=new_instruction(OP_FMAX_S); 
+                                entry->inst->inst_id=RISCV_FMAX_S;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=F3_FMAX_S; 
+                                entry->inst->funct7=F7_FMAX_S;
+                                entry->inst->rsrc2=$4; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FEQ_S validireg validfreg validfreg {
+                                mem_entry_t *entry=new_instruction(OP_FEQ_S); 
+                                entry->inst->inst_id=RISCV_FEQ_S;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=F3_FEQ_S; 
+                                entry->inst->funct7=F7_FEQ_S;
+                                entry->inst->rsrc2=$4; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FLT_S validireg validfreg validfreg {
+                                mem_entry_t *entry=new_instruction(OP_FLT_S); 
+                                entry->inst->inst_id=RISCV_FLT_S;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=F3_FLT_S; 
+                                entry->inst->funct7=F7_FLT_S;
+                                entry->inst->rsrc2=$4; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FLE_S validireg validfreg validfreg {
+                                mem_entry_t *entry=new_instruction(OP_FLE_S); 
+                                entry->inst->inst_id=RISCV_FLE_S;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=F3_FLE_S; 
+                                entry->inst->funct7=F7_FLE_S;
+                                entry->inst->rsrc2=$4; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FCLASS_S validireg validfreg {
+                                mem_entry_t *entry=new_instruction(OP_FCLASS_S); 
+                                entry->inst->inst_id=RISCV_FCLASS_S;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=F3_FCLASS_S; 
+                                entry->inst->funct7=F7_FCLASS_S;
+                                entry->inst->rsrc2=RS2_FCLASS_S;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FCVT_W_S validireg validfreg frm {
+                                mem_entry_t *entry=new_instruction(OP_FCVT_W_S); 
+                                entry->inst->inst_id=RISCV_FCVT_W_S;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=$4; 
+                                entry->inst->funct7=F7_FCVT_W_S;
+                                entry->inst->rsrc2=RS2_FCVT_W_S;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FCVT_WU_S validireg validfreg frm {
+                                mem_entry_t *entry=new_instruction(OP_FCVT_WU_S); 
+                                entry->inst->inst_id=RISCV_FCVT_WU_S;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=$4; 
+                                entry->inst->funct7=F7_FCVT_WU_S;
+                                entry->inst->rsrc2=RS2_FCVT_WU_S;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FCVT_L_S validireg validfreg frm {
+                                mem_entry_t *entry=new_instruction(OP_FCVT_L_S); 
+                                entry->inst->inst_id=RISCV_FCVT_L_S;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=$4; 
+                                entry->inst->funct7=F7_FCVT_L_S;
+                                entry->inst->rsrc2=RS2_FCVT_L_S;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FCVT_LU_S validireg validfreg frm {
+                                mem_entry_t *entry=new_instruction(OP_FCVT_LU_S); 
+                                entry->inst->inst_id=RISCV_FCVT_LU_S;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=$4; 
+                                entry->inst->funct7=F7_FCVT_LU_S;
+                                entry->inst->rsrc2=RS2_FCVT_LU_S;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FCVT_S_W validfreg validireg frm {
+                                mem_entry_t *entry=new_instruction(OP_FCVT_S_W); 
+                                entry->inst->inst_id=RISCV_FCVT_S_W;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=$4; 
+                                entry->inst->funct7=F7_FCVT_S_W;
+                                entry->inst->rsrc2=RS2_FCVT_S_W;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FCVT_S_WU validfreg validireg frm {
+                                mem_entry_t *entry=new_instruction(OP_FCVT_S_WU); 
+                                entry->inst->inst_id=RISCV_FCVT_S_WU;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=$4; 
+                                entry->inst->funct7=F7_FCVT_S_WU;
+                                entry->inst->rsrc2=RS2_FCVT_S_WU;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FCVT_S_L validfreg validireg frm {
+                                mem_entry_t *entry=new_instruction(OP_FCVT_S_L); 
+                                entry->inst->inst_id=RISCV_FCVT_S_L;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=$4; 
+                                entry->inst->funct7=F7_FCVT_S_L;
+                                entry->inst->rsrc2=RS2_FCVT_S_L;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FCVT_S_LU validfreg validireg frm {
+                                mem_entry_t *entry=new_instruction(OP_FCVT_S_LU); 
+                                entry->inst->inst_id=RISCV_FCVT_S_LU;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=$4; 
+                                entry->inst->funct7=F7_FCVT_S_LU;
+                                entry->inst->rsrc2=RS2_FCVT_S_LU;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FMV_X_W validireg validfreg {
+                                mem_entry_t *entry=new_instruction(OP_FMV_X_W); 
+                                entry->inst->inst_id=RISCV_FMV_X_W;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=F3_FMV_X_W; 
+                                entry->inst->funct7=F7_FMV_X_W;
+                                entry->inst->rsrc2=RS2_FMV_X_W;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FMV_W_X validfreg validireg {
+                                mem_entry_t *entry=new_instruction(OP_FMV_W_X); 
+                                entry->inst->inst_id=RISCV_FMV_W_X;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=F3_FMV_W_X; 
+                                entry->inst->funct7=F7_FMV_W_X;
+                                entry->inst->rsrc2=RS2_FMV_W_X;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FLD validfreg IIMM LBRACKET validireg RBRACKET {
+                                mem_entry_t *entry=new_instruction(OP_FLD); 
+                                entry->inst->inst_id=RISCV_FLD;
+                                entry->inst->rdst=$2; 
+                                entry->inst->funct3=F3_FLD;
+                                entry->inst->rsrc1=$5; 
+                                entry->inst->imm=$3; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FSD validfreg IIMM LBRACKET validireg RBRACKET {
+                                mem_entry_t *entry=new_instruction(OP_FSD);
+                                entry->inst->inst_id=RISCV_FSD;
+                                entry->inst->funct3=F3_FSD;
+                                entry->inst->rsrc1=$5; 
+                                entry->inst->rsrc2=$2; 
+                                entry->inst->imm=$3; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FMADD_D validfreg validfreg validfreg validfreg frm {
+                                mem_entry_t *entry=new_instruction(OP_FMADD_D); 
+                                entry->inst->inst_id=RISCV_FMADD_D;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->rsrc2=$4; 
+                                entry->inst->rsrc3=$5; 
+                                entry->inst->funct3=$6; 
+                                entry->inst->funct7=F7_FMADD_D;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FMSUB_D validfreg validfreg validfreg validfreg frm {
+                                mem_entry_t *entry=new_instruction(OP_FMSUB_D); 
+                                entry->inst->inst_id=RISCV_FMSUB_D;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->rsrc2=$4; 
+                                entry->inst->rsrc3=$5; 
+                                entry->inst->funct3=$6; 
+                                entry->inst->funct7=F7_FMSUB_D;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FNMSUB_D validfreg validfreg validfreg validfreg frm {
+                                mem_entry_t *entry=new_instruction(OP_FNMSUB_D); 
+                                entry->inst->inst_id=RISCV_FNMSUB_D;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->rsrc2=$4; 
+                                entry->inst->rsrc3=$5; 
+                                entry->inst->funct3=$6; 
+                                entry->inst->funct7=F7_FNMSUB_D;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FNMADD_D validfreg validfreg validfreg validfreg frm {
+                                mem_entry_t *entry=new_instruction(OP_FNMADD_D); 
+                                entry->inst->inst_id=RISCV_FNMADD_D;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->rsrc2=$4; 
+                                entry->inst->rsrc3=$5; 
+                                entry->inst->funct3=$6; 
+                                entry->inst->funct7=F7_FNMADD_D;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FADD_D validfreg validfreg validfreg frm {
+                                mem_entry_t *entry=new_instruction(OP_FADD_D); 
+                                entry->inst->inst_id=RISCV_FADD_D;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=$5; 
+                                entry->inst->funct7=F7_FADD_D;
+                                entry->inst->rsrc2=$4; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FSUB_D validfreg validfreg validfreg frm {
+                                mem_entry_t *entry=new_instruction(OP_FSUB_D); 
+                                entry->inst->inst_id=RISCV_FSUB_D;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=$5; 
+                                entry->inst->funct7=F7_FSUB_D;
+                                entry->inst->rsrc2=$4; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FMUL_D validfreg validfreg validfreg frm {
+                                mem_entry_t *entry=new_instruction(OP_FMUL_D); 
+                                entry->inst->inst_id=RISCV_FMUL_D;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=$5; 
+                                entry->inst->funct7=F7_FMUL_D;
+                                entry->inst->rsrc2=$4; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FDIV_D validfreg validfreg validfreg frm {
+                                mem_entry_t *entry=new_instruction(OP_FDIV_D); 
+                                entry->inst->inst_id=RISCV_FDIV_D;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=$5; 
+                                entry->inst->funct7=F7_FDIV_D;
+                                entry->inst->rsrc2=$4; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FSQRT_D validfreg validfreg frm {
+                                mem_entry_t *entry=new_instruction(OP_FSQRT_D); 
+                                entry->inst->inst_id=RISCV_FSQRT_D;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=$4; 
+                                entry->inst->funct7=F7_FSQRT_D;
+                                entry->inst->rsrc2=RS2_FSQRT_D;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FSGNJ_D validfreg validfreg validfreg {
+                                mem_entry_t *entry=new_instruction(OP_FSGNJ_D); 
+                                entry->inst->inst_id=RISCV_FSGNJ_D;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=F3_FSGNJ_D; 
+                                entry->inst->funct7=F7_FSGNJ_D;
+                                entry->inst->rsrc2=$4; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FSGNJN_D validfreg validfreg validfreg {
+                                mem_entry_t *entry=new_instruction(OP_FSGNJN_D); 
+                                entry->inst->inst_id=RISCV_FSGNJN_D;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=F3_FSGNJN_D; 
+                                entry->inst->funct7=F7_FSGNJN_D;
+                                entry->inst->rsrc2=$4; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FSGNJX_D validfreg validfreg validfreg {
+                                mem_entry_t *entry=new_instruction(OP_FSGNJX_D); 
+                                entry->inst->inst_id=RISCV_FSGNJX_D;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=F3_FSGNJX_D; 
+                                entry->inst->funct7=F7_FSGNJX_D;
+                                entry->inst->rsrc2=$4; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FMIN_D validfreg validfreg validfreg {
+                                mem_entry_t *entry=new_instruction(OP_FMIN_D); 
+                                entry->inst->inst_id=RISCV_FMIN_D;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=F3_FMIN_D; 
+                                entry->inst->funct7=F7_FMIN_D;
+                                entry->inst->rsrc2=$4; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FMAX_D validfreg validfreg validfreg {
+                                mem_entry_t *entry=new_instruction(OP_FMAX_D); 
+                                entry->inst->inst_id=RISCV_FMAX_D;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=F3_FMAX_D; 
+                                entry->inst->funct7=F7_FMAX_D;
+                                entry->inst->rsrc2=$4; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FEQ_D validireg validfreg validfreg {
+                                mem_entry_t *entry=new_instruction(OP_FEQ_D); 
+                                entry->inst->inst_id=RISCV_FEQ_D;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=F3_FEQ_D; 
+                                entry->inst->funct7=F7_FEQ_D;
+                                entry->inst->rsrc2=$4; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FLT_D validireg validfreg validfreg {
+                                mem_entry_t *entry=new_instruction(OP_FLT_D); 
+                                entry->inst->inst_id=RISCV_FLT_D;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=F3_FLT_D; 
+                                entry->inst->funct7=F7_FLT_D;
+                                entry->inst->rsrc2=$4; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FLE_D validireg validfreg validfreg {
+                                mem_entry_t *entry=new_instruction(OP_FLE_D); 
+                                entry->inst->inst_id=RISCV_FLE_D;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=F3_FLE_D; 
+                                entry->inst->funct7=F7_FLE_D;
+                                entry->inst->rsrc2=$4; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FCLASS_D validireg validfreg {
+                                mem_entry_t *entry=new_instruction(OP_FCLASS_D); 
+                                entry->inst->inst_id=RISCV_FCLASS_D;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=F3_FCLASS_D; 
+                                entry->inst->funct7=F7_FCLASS_D;
+                                entry->inst->rsrc2=RS2_FCLASS_D;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FCVT_W_D validireg validfreg frm {
+                                mem_entry_t *entry=new_instruction(OP_FCVT_W_D); 
+                                entry->inst->inst_id=RISCV_FCVT_W_D;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=$4; 
+                                entry->inst->funct7=F7_FCVT_W_D;
+                                entry->inst->rsrc2=RS2_FCVT_W_D;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FCVT_WU_D validireg validfreg frm {
+                                mem_entry_t *entry=new_instruction(OP_FCVT_WU_D); 
+                                entry->inst->inst_id=RISCV_FCVT_WU_D;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=$4; 
+                                entry->inst->funct7=F7_FCVT_WU_D;
+                                entry->inst->rsrc2=RS2_FCVT_WU_D;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FCVT_L_D validireg validfreg frm {
+                                mem_entry_t *entry=new_instruction(OP_FCVT_L_D); 
+                                entry->inst->inst_id=RISCV_FCVT_L_D;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=$4; 
+                                entry->inst->funct7=F7_FCVT_L_D;
+                                entry->inst->rsrc2=RS2_FCVT_L_D;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FCVT_LU_D validireg validfreg frm {
+                                mem_entry_t *entry=new_instruction(OP_FCVT_LU_D); 
+                                entry->inst->inst_id=RISCV_FCVT_LU_D;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=$4; 
+                                entry->inst->funct7=F7_FCVT_LU_D;
+                                entry->inst->rsrc2=RS2_FCVT_LU_D;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FCVT_D_W validfreg validireg {
+                                mem_entry_t *entry=new_instruction(OP_FCVT_D_W); 
+                                entry->inst->inst_id=RISCV_FCVT_D_W;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=F3_FCVT_D_W; 
+                                entry->inst->funct7=F7_FCVT_D_W;
+                                entry->inst->rsrc2=RS2_FCVT_D_W;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FCVT_D_WU validfreg validireg {
+                                mem_entry_t *entry=new_instruction(OP_FCVT_D_WU); 
+                                entry->inst->inst_id=RISCV_FCVT_D_WU;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=F3_FCVT_D_WU; 
+                                entry->inst->funct7=F7_FCVT_D_WU;
+                                entry->inst->rsrc2=RS2_FCVT_D_WU;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FCVT_D_L validfreg validireg frm {
+                                mem_entry_t *entry=new_instruction(OP_FCVT_D_L); 
+                                entry->inst->inst_id=RISCV_FCVT_D_L;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=$4; 
+                                entry->inst->funct7=F7_FCVT_D_L;
+                                entry->inst->rsrc2=RS2_FCVT_D_L;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FCVT_D_LU validfreg validireg frm {
+                                mem_entry_t *entry=new_instruction(OP_FCVT_D_LU); 
+                                entry->inst->inst_id=RISCV_FCVT_D_LU;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=$4; 
+                                entry->inst->funct7=F7_FCVT_D_LU;
+                                entry->inst->rsrc2=RS2_FCVT_D_LU;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FMV_X_D validireg validfreg {
+                                mem_entry_t *entry=new_instruction(OP_FMV_X_D); 
+                                entry->inst->inst_id=RISCV_FMV_X_D;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=F3_FMV_X_D; 
+                                entry->inst->funct7=F7_FMV_X_D;
+                                entry->inst->rsrc2=RS2_FMV_X_D;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FMV_D_X validfreg validireg {
+                                mem_entry_t *entry=new_instruction(OP_FMV_D_X); 
+                                entry->inst->inst_id=RISCV_FMV_D_X;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=F3_FMV_D_X; 
+                                entry->inst->funct7=F7_FMV_D_X;
+                                entry->inst->rsrc2=RS2_FMV_D_X;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FCVT_S_D validfreg validfreg frm {
+                                mem_entry_t *entry=new_instruction(OP_FCVT_S_D); 
+                                entry->inst->inst_id=RISCV_FCVT_S_D;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=$4; 
+                                entry->inst->funct7=F7_FCVT_S_D;
+                                entry->inst->rsrc2=RS2_FCVT_S_D;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FCVT_D_S validfreg validfreg {
+                                mem_entry_t *entry=new_instruction(OP_FCVT_D_S); 
+                                entry->inst->inst_id=RISCV_FCVT_D_S;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=F3_FCVT_D_S; 
+                                entry->inst->funct7=F7_FCVT_D_S;
+                                entry->inst->rsrc2=RS2_FCVT_D_S;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FMV_S validfreg validfreg {
+                                mem_entry_t *entry=new_instruction(OP_FSGNJ_S); 
+                                entry->inst->inst_id=RISCV_FSGNJ_S;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=F3_FSGNJ_S; 
+                                entry->inst->funct7=F7_FSGNJ_S;
+                                entry->inst->rsrc2=$3; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FNEG_S validfreg validfreg {
+                                mem_entry_t *entry=new_instruction(OP_FSGNJN_S); 
+                                entry->inst->inst_id=RISCV_FSGNJN_S;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=F3_FSGNJN_S; 
+                                entry->inst->funct7=F7_FSGNJN_S;
+                                entry->inst->rsrc2=$3; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FABS_S validfreg validfreg {
+                                mem_entry_t *entry=new_instruction(OP_FSGNJX_S); 
+                                entry->inst->inst_id=RISCV_FSGNJX_S;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=F3_FSGNJX_S; 
+                                entry->inst->funct7=F7_FSGNJX_S;
+                                entry->inst->rsrc2=$3; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FMV_D validfreg validfreg {
+                                mem_entry_t *entry=new_instruction(OP_FSGNJ_D); 
+                                entry->inst->inst_id=RISCV_FSGNJ_D;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=F3_FSGNJ_D; 
+                                entry->inst->funct7=F7_FSGNJ_D;
+                                entry->inst->rsrc2=$3; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FNEG_D validfreg validfreg {
+                                mem_entry_t *entry=new_instruction(OP_FSGNJN_D); 
+                                entry->inst->inst_id=RISCV_FSGNJN_D;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=F3_FSGNJN_D; 
+                                entry->inst->funct7=F7_FSGNJN_D;
+                                entry->inst->rsrc2=$3; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FABS_D validfreg validfreg {
+                                mem_entry_t *entry=new_instruction(OP_FSGNJX_D); 
+                                entry->inst->inst_id=RISCV_FSGNJX_D;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=F3_FSGNJX_D; 
+                                entry->inst->funct7=F7_FSGNJX_D;
+                                entry->inst->rsrc2=$3; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FRCSR validireg {
+                                mem_entry_t *entry=new_instruction(OP_CSRRS); 
+                                entry->inst->inst_id=RISCV_CSRRS;
+                                entry->inst->rdst=$2; 
+                                entry->inst->funct3=F3_CSRRS;
+                                entry->inst->rsrc1=0; 
+                                entry->inst->imm=CSR_FCSR; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FSCSR validireg {
+                                mem_entry_t *entry=new_instruction(OP_CSRRW); 
+                                entry->inst->inst_id=RISCV_CSRRW;
+                                entry->inst->rdst=0; 
+                                entry->inst->funct3=F3_CSRRW;
+                                entry->inst->rsrc1=$2; 
+                                entry->inst->imm=CSR_FCSR; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FRRM validireg {
+                                mem_entry_t *entry=new_instruction(OP_CSRRS); 
+                                entry->inst->inst_id=RISCV_CSRRS;
+                                entry->inst->rdst=$2; 
+                                entry->inst->funct3=F3_CSRRS;
+                                entry->inst->rsrc1=0; 
+                                entry->inst->imm=CSR_FRM; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FSRM validireg {
+                                mem_entry_t *entry=new_instruction(OP_CSRRW); 
+                                entry->inst->inst_id=RISCV_CSRRW;
+                                entry->inst->rdst=0; 
+                                entry->inst->funct3=F3_CSRRW;
+                                entry->inst->rsrc1=$2; 
+                                entry->inst->imm=CSR_FRM; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FRFLAGS validireg {
+                                mem_entry_t *entry=new_instruction(OP_CSRRS); 
+                                entry->inst->inst_id=RISCV_CSRRS;
+                                entry->inst->rdst=$2; 
+                                entry->inst->funct3=F3_CSRRS;
+                                entry->inst->rsrc1=0; 
+                                entry->inst->imm=CSR_FFLAGS; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FSFLAGS validireg {
+                                mem_entry_t *entry=new_instruction(OP_CSRRW); 
+                                entry->inst->inst_id=RISCV_CSRRW;
+                                entry->inst->rdst=0; 
+                                entry->inst->funct3=F3_CSRRW;
+                                entry->inst->rsrc1=$2; 
+                                entry->inst->imm=CSR_FFLAGS; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* fp register expressions are double precision */
+    /* tested */
+    | validfreg ASSIGN validfreg {
+                                mem_entry_t *entry=new_instruction(OP_FSGNJ_D); 
+                                entry->inst->inst_id=RISCV_FSGNJ_D;
+                                entry->inst->rdst=$1; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=F3_FSGNJ_D; 
+                                entry->inst->funct7=F7_FSGNJ_D;
+                                entry->inst->rsrc2=$3; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | validfreg ASSIGN MINUS validfreg {
+                                mem_entry_t *entry=new_instruction(OP_FSGNJN_D); 
+                                entry->inst->inst_id=RISCV_FSGNJN_D;
+                                entry->inst->rdst=$1; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_FSGNJN_D; 
+                                entry->inst->funct7=F7_FSGNJN_D;
+                                entry->inst->rsrc2=$4; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | validfreg ASSIGN validfreg PLUS validfreg {
+                                mem_entry_t *entry=new_instruction(OP_FADD_D); 
+                                entry->inst->inst_id=RISCV_FADD_D;
+                                entry->inst->rdst=$1; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=FRM_DYN; 
+                                entry->inst->funct7=F7_FADD_D;
+                                entry->inst->rsrc2=$5; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | validfreg ASSIGN validfreg MINUS validfreg {
+                                mem_entry_t *entry=new_instruction(OP_FSUB_D); 
+                                entry->inst->inst_id=RISCV_FSUB_D;
+                                entry->inst->rdst=$1; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=FRM_DYN; 
+                                entry->inst->funct7=F7_FSUB_D;
+                                entry->inst->rsrc2=$5; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | validfreg ASSIGN validfreg MULTIPLY validfreg {
+                                mem_entry_t *entry=new_instruction(OP_FMUL_D); 
+                                entry->inst->inst_id=RISCV_FMUL_D;
+                                entry->inst->rdst=$1; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=FRM_DYN; 
+                                entry->inst->funct7=F7_FMUL_D;
+                                entry->inst->rsrc2=$5; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | validfreg ASSIGN validfreg DIVIDE validfreg {
+                                mem_entry_t *entry=new_instruction(OP_FDIV_D); 
+                                entry->inst->inst_id=RISCV_FDIV_D;
+                                entry->inst->rdst=$1; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=FRM_DYN; 
+                                entry->inst->funct7=F7_FDIV_D;
+                                entry->inst->rsrc2=$5; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | validfreg ASSIGN validfreg MULTIPLY validfreg PLUS validfreg {
+                                mem_entry_t *entry=new_instruction(OP_FMADD_D); 
+                                entry->inst->inst_id=RISCV_FMADD_D;
+                                entry->inst->rdst=$1; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->rsrc2=$5; 
+                                entry->inst->rsrc3=$7; 
+                                entry->inst->funct3=FRM_DYN; 
+                                entry->inst->funct7=F7_FMADD_D;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | validfreg ASSIGN validfreg MULTIPLY validfreg MINUS validfreg {
+                                mem_entry_t *entry=new_instruction(OP_FMSUB_D); 
+                                entry->inst->inst_id=RISCV_FMSUB_D;
+                                entry->inst->rdst=$1; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->rsrc2=$5; 
+                                entry->inst->rsrc3=$7; 
+                                entry->inst->funct3=FRM_DYN; 
+                                entry->inst->funct7=F7_FMSUB_D;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | validfreg ASSIGN validireg {
+                                mem_entry_t *entry=new_instruction(OP_FCVT_D_L); 
+                                entry->inst->inst_id=RISCV_FCVT_D_L;
+                                entry->inst->rdst=$1; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=FRM_DYN; 
+                                entry->inst->funct7=F7_FCVT_D_L;
+                                entry->inst->rsrc2=RS2_FCVT_D_L;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | validireg ASSIGN validfreg {
+                                /* truncates toward zero, like a C cast */
+                                mem_entry_t *entry=new_instruction(OP_FCVT_L_D); 
+                                entry->inst->inst_id=RISCV_FCVT_L_D;
+                                entry->inst->rdst=$1; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=FRM_RTZ; 
+                                entry->inst->funct7=F7_FCVT_L_D;
+                                entry->inst->rsrc2=RS2_FCVT_L_D;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | validireg ASSIGN validfreg LT validfreg {
+                                mem_entry_t *entry=new_instruction(OP_FLT_D); 
+                                entry->inst->inst_id=RISCV_FLT_D;
+                                entry->inst->rdst=$1; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=F3_FLT_D; 
+                                entry->inst->funct7=F7_FLT_D;
+                                entry->inst->rsrc2=$5; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | validireg ASSIGN validfreg GT validfreg {
+                                mem_entry_t *entry=new_instruction(OP_FLT_D); 
+                                entry->inst->inst_id=RISCV_FLT_D;
+                                entry->inst->rdst=$1; 
+                                entry->inst->rsrc1=$5; // swapped operands
+                                entry->inst->funct3=F3_FLT_D; 
+                                entry->inst->funct7=F7_FLT_D;
+                                entry->inst->rsrc2=$3; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | validireg ASSIGN validfreg LTE validfreg {
+                                mem_entry_t *entry=new_instruction(OP_FLE_D); 
+                                entry->inst->inst_id=RISCV_FLE_D;
+                                entry->inst->rdst=$1; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=F3_FLE_D; 
+                                entry->inst->funct7=F7_FLE_D;
+                                entry->inst->rsrc2=$5; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | validireg ASSIGN validfreg GTE validfreg {
+                                mem_entry_t *entry=new_instruction(OP_FLE_D); 
+                                entry->inst->inst_id=RISCV_FLE_D;
+                                entry->inst->rdst=$1; 
+                                entry->inst->rsrc1=$5; // swapped operands
+                                entry->inst->funct3=F3_FLE_D; 
+                                entry->inst->funct7=F7_FLE_D;
+                                entry->inst->rsrc2=$3; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | validireg ASSIGN validfreg EQ validfreg {
+                                mem_entry_t *entry=new_instruction(OP_FEQ_D); 
+                                entry->inst->inst_id=RISCV_FEQ_D;
+                                entry->inst->rdst=$1; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=F3_FEQ_D; 
+                                entry->inst->funct7=F7_FEQ_D;
+                                entry->inst->rsrc2=$5; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_SLL validireg validireg validireg {
+                                mem_entry_t *entry=new_instruction(OP_SLL); 
+                                entry->inst->inst_id=RISCV_SLL;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=F3_SLL; 
+                                entry->inst->funct7=F7_SLL;
+                                entry->inst->rsrc2=$4; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_SLT validireg validireg validireg {
+                                mem_entry_t *entry=new_instruction(OP_SLT); 
+                                entry->inst->inst_id=RISCV_SLT;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=F3_SLT; 
+                                entry->inst->funct7=F7_SLT;
+                                entry->inst->rsrc2=$4; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | validireg ASSIGN validireg LT validireg {
+                                mem_entry_t *entry=new_instruction(OP_SLT); 
+                                entry->inst->inst_id=RISCV_SLT;
+                                entry->inst->rdst=$1; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=F3_SLT;
+                                entry->inst->funct7=F7_SLT;
+                                entry->inst->rsrc2=$5; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_SLTU validireg validireg validireg {
+                                mem_entry_t *entry=new_instruction(OP_SLTU); 
+                                entry->inst->inst_id=RISCV_SLTU;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=F3_SLTU; 
+                                entry->inst->funct7=F7_SLTU;
+                                entry->inst->rsrc2=$4; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_XOR validireg validireg validireg {
+                                mem_entry_t *entry=new_instruction(OP_XOR); 
+                                entry->inst->inst_id=RISCV_XOR;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=F3_XOR; 
+                                entry->inst->funct7=F7_XOR;
+                                entry->inst->rsrc2=$4; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | validireg ASSIGN validireg XOR validireg {
+                                mem_entry_t *entry=new_instruction(OP_XOR); 
+                                entry->inst->inst_id=RISCV_XOR;
+                                entry->inst->rdst=$1; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=F3_XOR; 
+                                entry->inst->funct7=F7_XOR;
+                                entry->inst->rsrc2=$5; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_SRL validireg validireg validireg {
+                                mem_entry_t *entry=new_instruction(OP_SRL); 
+                                entry->inst->inst_id=RISCV_SRL;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=F3_SRL; 
+                                entry->inst->funct7=F7_SRL;
+                                entry->inst->rsrc2=$4; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_SRA validireg validireg validireg {
+                                mem_entry_t *entry=new_instruction(OP_SRA); 
+                                entry->inst->inst_id=RISCV_SRA;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=F3_SRA; 
+                                entry->inst->funct7=F7_SRA;
+                                entry->inst->rsrc2=$4; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_OR validireg validireg validireg {
+                                mem_entry_t *entry=new_instruction(OP_OR); 
+                                entry->inst->inst_id=RISCV_OR;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=F3_OR; 
+                                entry->inst->funct7=F7_OR;
+                                entry->inst->rsrc2=$4; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | validireg ASSIGN validireg OR validireg {
+                                mem_entry_t *entry=new_instruction(OP_OR); 
+                                entry->inst->inst_id=RISCV_OR;
+                                entry->inst->rdst=$1; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=F3_OR; 
+                                entry->inst->funct7=F7_OR;
+                                entry->inst->rsrc2=$5; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_AND validireg validireg validireg {
+                                mem_entry_t *entry=new_instruction(OP_AND); 
+                                entry->inst->inst_id=RISCV_AND;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=F3_AND; 
+                                entry->inst->funct7=F7_AND;
+                                entry->inst->rsrc2=$4; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | validireg ASSIGN validireg AND validireg {
+                                mem_entry_t *entry=new_instruction(OP_AND); 
+                                entry->inst->inst_id=RISCV_AND;
+                                entry->inst->rdst=$1; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=F3_AND; 
+                                entry->inst->funct7=F7_AND;
+                                entry->inst->rsrc2=$5; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_FENCE {
+                                mem_entry_t *entry=new_instruction(OP_FENCE); 
+                                entry->inst->inst_id=RISCV_FENCE;
+                                entry->inst->funct3=F3_FENCE;
+                                entry->inst->imm=FENCE_ALL; // iorw, iorw
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;        
+    }
+    /* tested */
+    | INST_FENCE_I {
+                                mem_entry_t *entry=new_instruction(OP_FENCE_I); 
+                                entry->inst->inst_id=RISCV_FENCE_I;
+                                entry->inst->funct3=F3_FENCE_I;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;        
+    }
+    /* tested */
+    | INST_ECALL {
+                                mem_entry_t *entry=new_instruction(OP_ECALL); 
+                                entry->inst->inst_id=RISCV_ECALL;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;        
+    }
+    /* tested */
+    | INST_EBREAK {
+                                mem_entry_t *entry=new_instruction(OP_EBREAK); 
+                                entry->inst->inst_id=RISCV_EBREAK;
+                                entry->inst->imm=0x1;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;        
+    }
+    /* tested */
+    | INST_CSRRW validireg csr validireg {
+                                mem_entry_t *entry=new_instruction(OP_CSRRW); 
+                                entry->inst->inst_id=RISCV_CSRRW;
+                                entry->inst->rdst=$2; 
+                                entry->inst->funct3=F3_CSRRW;
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->imm=$3; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_CSRRS validireg csr validireg {
+                                mem_entry_t *entry=new_instruction(OP_CSRRS); 
+                                entry->inst->inst_id=RISCV_CSRRS;
+                                entry->inst->rdst=$2; 
+                                entry->inst->funct3=F3_CSRRS;
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->imm=$3; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_CSRRC validireg csr validireg {
+                                mem_entry_t *entry=new_instruction(OP_CSRRC); 
+                                entry->inst->inst_id=RISCV_CSRRC;
+                                entry->inst->rdst=$2; 
+                                entry->inst->funct3=F3_CSRRC;
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->imm=$3; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_CSRRWI validireg csr IIMM {
+                                mem_entry_t *entry=new_instruction(OP_CSRRWI); 
+                                entry->inst->inst_id=RISCV_CSRRWI;
+                                entry->inst->rdst=$2; 
+                                entry->inst->funct3=F3_CSRRWI;
+                                if (($4 < 0) || ($4 > 31))
+                                    yyerror("CSR immediate out of range, must be 0 to 31");
+                                entry->inst->rsrc1=$4; // 5 bit zero-extended immediate
+                                entry->inst->imm=$3; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_CSRRSI validireg csr IIMM {
+                                mem_entry_t *entry=new_instruction(OP_CSRRSI); 
+                                entry->inst->inst_id=RISCV_CSRRSI;
+                                entry->inst->rdst=$2; 
+                                entry->inst->funct3=F3_CSRRSI;
+                                if (($4 < 0) || ($4 > 31))
+                                    yyerror("CSR immediate out of range, must be 0 to 31");
+                                entry->inst->rsrc1=$4; // 5 bit zero-extended immediate
+                                entry->inst->imm=$3; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_CSRRCI validireg csr IIMM {
+                                mem_entry_t *entry=new_instruction(OP_CSRRCI); 
+                                entry->inst->inst_id=RISCV_CSRRCI;
+                                entry->inst->rdst=$2; 
+                                entry->inst->funct3=F3_CSRRCI;
+                                if (($4 < 0) || ($4 > 31))
+                                    yyerror("CSR immediate out of range, must be 0 to 31");
+                                entry->inst->rsrc1=$4; // 5 bit zero-extended immediate
+                                entry->inst->imm=$3; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_CSRR validireg csr {
+                                mem_entry_t *entry=new_instruction(OP_CSRRS); 
+                                entry->inst->inst_id=RISCV_CSRRS;
+                                entry->inst->rdst=$2; 
+                                entry->inst->funct3=F3_CSRRS;
+                                entry->inst->rsrc1=0; 
+                                entry->inst->imm=$3; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_CSRW csr validireg {
+                                mem_entry_t *entry=new_instruction(OP_CSRRW); 
+                                entry->inst->inst_id=RISCV_CSRRW;
+                                entry->inst->rdst=0; 
+                                entry->inst->funct3=F3_CSRRW;
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->imm=$2; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_RDCYCLE validireg {
+                                mem_entry_t *entry=new_instruction(OP_CSRRS); 
+                                entry->inst->inst_id=RISCV_CSRRS;
+                                entry->inst->rdst=$2; 
+                                entry->inst->funct3=F3_CSRRS;
+                                entry->inst->rsrc1=0; 
+                                entry->inst->imm=CSR_CYCLE; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_RDTIME validireg {
+                                mem_entry_t *entry=new_instruction(OP_CSRRS); 
+                                entry->inst->inst_id=RISCV_CSRRS;
+                                entry->inst->rdst=$2; 
+                                entry->inst->funct3=F3_CSRRS;
+                                entry->inst->rsrc1=0; 
+                                entry->inst->imm=CSR_TIME; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_RDINSTRET validireg {
+                                mem_entry_t *entry=new_instruction(OP_CSRRS); 
+                                entry->inst->inst_id=RISCV_CSRRS;
+                                entry->inst->rdst=$2; 
+                                entry->inst->funct3=F3_CSRRS;
+                                entry->inst->rsrc1=0; 
+                                entry->inst->imm=CSR_INSTRET; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_J IIMM             {
+                                mem_entry_t *entry=new_instruction(OP_JAL); 
+                                entry->inst->inst_id=RISCV_J;
+                                entry->inst->rdst=0x0; // always this reg
+                                entry->inst->target_address=$2; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_J LABEL            {
+                                mem_entry_t *entry=new_instruction(OP_JAL); 
+                                entry->inst->inst_id=RISCV_J;
+                                entry->inst->rdst=0x0; // always this reg
+                                entry->inst->target_name=strdup($2); 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_JR validireg       {
+                                mem_entry_t *entry=new_instruction(OP_JALR);
+                                entry->inst->inst_id=RISCV_JALR;
+                                entry->inst->rdst=0x0;
+                                entry->inst->rsrc1=$2;
+                                entry->inst->imm=0x0;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+    }
+    /* tested */
+    | INST_RET {
+                                mem_entry_t *entry=new_instruction(OP_JALR);
+                                entry->inst->inst_id=RISCV_RET;
+                                entry->inst->rdst=0x0;
+                                entry->inst->rsrc1=0x1;
+                                entry->inst->imm=0;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_NOP {
+                                mem_entry_t *entry=new_instruction(OP_ADDI);
+                                entry->inst->inst_id=RISCV_ADDI;
+                                entry->inst->funct3=F3_ADDI;
+                                entry->inst->rdst=0; 
+                                entry->inst->rsrc1=0; 
+                                entry->inst->imm=0; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VSETVLI validireg validireg vtype {
+                                mem_entry_t *entry=new_instruction(OP_VSETVLI); 
+                                entry->inst->inst_id=RISCV_VSETVLI;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->funct3=F3_VSETVLI;
+                                entry->inst->imm=$4; 
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VSETIVLI validireg IIMM vtype {
+                                mem_entry_t *entry=new_instruction(OP_VSETIVLI); 
+                                entry->inst->inst_id=RISCV_VSETIVLI;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=check_vimm($3,FALSE); 
+                                entry->inst->funct3=F3_VSETIVLI;
+                                entry->inst->imm=(int32_t)(0xc00 | $4) - 0x1000; // top two bits set, as a sign-extended 12 bit imm
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VSETVL validireg validireg validireg {
+                                mem_entry_t *entry=new_instruction(OP_VSETVL); 
+                                entry->inst->inst_id=RISCV_VSETVL;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->rsrc2=$4; 
+                                entry->inst->funct3=F3_VSETVL;
+                                entry->inst->funct7=F7_VSETVL;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VLE8_V validvreg LBRACKET validireg RBRACKET vmask {
+                                mem_entry_t *entry=new_instruction(OP_VLE8_V); 
+                                entry->inst->inst_id=RISCV_VLE8_V;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->rsrc2=RS2_VLE8_V;
+                                entry->inst->funct3=F3_VLE8_V; 
+                                entry->inst->funct7=(MOP_VLE8_V<<1) | $6;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VLE8FF_V validvreg LBRACKET validireg RBRACKET vmask {
+                                mem_entry_t *entry=new_instruction(OP_VLE8FF_V); 
+                                entry->inst->inst_id=RISCV_VLE8FF_V;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->rsrc2=RS2_VLE8FF_V;
+                                entry->inst->funct3=F3_VLE8FF_V; 
+                                entry->inst->funct7=(MOP_VLE8FF_V<<1) | $6;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VSE8_V validvreg LBRACKET validireg RBRACKET vmask {
+                                mem_entry_t *entry=new_instruction(OP_VSE8_V); 
+                                entry->inst->inst_id=RISCV_VSE8_V;
+                                entry->inst->rdst=$2; // vs3
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->rsrc2=RS2_VSE8_V;
+                                entry->inst->funct3=F3_VSE8_V; 
+                                entry->inst->funct7=(MOP_VSE8_V<<1) | $6;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VLSE8_V validvreg LBRACKET validireg RBRACKET validireg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VLSE8_V); 
+                                entry->inst->inst_id=RISCV_VLSE8_V;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->rsrc2=$6; 
+                                entry->inst->funct3=F3_VLSE8_V; 
+                                entry->inst->funct7=(MOP_VLSE8_V<<1) | $7;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VSSE8_V validvreg LBRACKET validireg RBRACKET validireg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VSSE8_V); 
+                                entry->inst->inst_id=RISCV_VSSE8_V;
+                                entry->inst->rdst=$2; // vs3
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->rsrc2=$6; 
+                                entry->inst->funct3=F3_VSSE8_V; 
+                                entry->inst->funct7=(MOP_VSSE8_V<<1) | $7;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VLUXEI8_V validvreg LBRACKET validireg RBRACKET validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VLUXEI8_V); 
+                                entry->inst->inst_id=RISCV_VLUXEI8_V;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->rsrc2=$6; 
+                                entry->inst->funct3=F3_VLUXEI8_V; 
+                                entry->inst->funct7=(MOP_VLUXEI8_V<<1) | $7;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VLOXEI8_V validvreg LBRACKET validireg RBRACKET validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VLOXEI8_V); 
+                                entry->inst->inst_id=RISCV_VLOXEI8_V;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->rsrc2=$6; 
+                                entry->inst->funct3=F3_VLOXEI8_V; 
+                                entry->inst->funct7=(MOP_VLOXEI8_V<<1) | $7;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VSUXEI8_V validvreg LBRACKET validireg RBRACKET validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VSUXEI8_V); 
+                                entry->inst->inst_id=RISCV_VSUXEI8_V;
+                                entry->inst->rdst=$2; // vs3
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->rsrc2=$6; 
+                                entry->inst->funct3=F3_VSUXEI8_V; 
+                                entry->inst->funct7=(MOP_VSUXEI8_V<<1) | $7;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VSOXEI8_V validvreg LBRACKET validireg RBRACKET validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VSOXEI8_V); 
+                                entry->inst->inst_id=RISCV_VSOXEI8_V;
+                                entry->inst->rdst=$2; // vs3
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->rsrc2=$6; 
+                                entry->inst->funct3=F3_VSOXEI8_V; 
+                                entry->inst->funct7=(MOP_VSOXEI8_V<<1) | $7;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VLE16_V validvreg LBRACKET validireg RBRACKET vmask {
+                                mem_entry_t *entry=new_instruction(OP_VLE16_V); 
+                                entry->inst->inst_id=RISCV_VLE16_V;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->rsrc2=RS2_VLE16_V;
+                                entry->inst->funct3=F3_VLE16_V; 
+                                entry->inst->funct7=(MOP_VLE16_V<<1) | $6;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VLE16FF_V validvreg LBRACKET validireg RBRACKET vmask {
+                                mem_entry_t *entry=new_instruction(OP_VLE16FF_V); 
+                                entry->inst->inst_id=RISCV_VLE16FF_V;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->rsrc2=RS2_VLE16FF_V;
+                                entry->inst->funct3=F3_VLE16FF_V; 
+                                entry->inst->funct7=(MOP_VLE16FF_V<<1) | $6;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VSE16_V validvreg LBRACKET validireg RBRACKET vmask {
+                                mem_entry_t *entry=new_instruction(OP_VSE16_V); 
+                                entry->inst->inst_id=RISCV_VSE16_V;
+                                entry->inst->rdst=$2; // vs3
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->rsrc2=RS2_VSE16_V;
+                                entry->inst->funct3=F3_VSE16_V; 
+                                entry->inst->funct7=(MOP_VSE16_V<<1) | $6;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VLSE16_V validvreg LBRACKET validireg RBRACKET validireg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VLSE16_V); 
+                                entry->inst->inst_id=RISCV_VLSE16_V;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->rsrc2=$6; 
+                                entry->inst->funct3=F3_VLSE16_V; 
+                                entry->inst->funct7=(MOP_VLSE16_V<<1) | $7;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VSSE16_V validvreg LBRACKET validireg RBRACKET validireg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VSSE16_V); 
+                                entry->inst->inst_id=RISCV_VSSE16_V;
+                                entry->inst->rdst=$2; // vs3
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->rsrc2=$6; 
+                                entry->inst->funct3=F3_VSSE16_V; 
+                                entry->inst->funct7=(MOP_VSSE16_V<<1) | $7;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VLUXEI16_V validvreg LBRACKET validireg RBRACKET validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VLUXEI16_V); 
+                                entry->inst->inst_id=RISCV_VLUXEI16_V;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->rsrc2=$6; 
+                                entry->inst->funct3=F3_VLUXEI16_V; 
+                                entry->inst->funct7=(MOP_VLUXEI16_V<<1) | $7;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VLOXEI16_V validvreg LBRACKET validireg RBRACKET validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VLOXEI16_V); 
+                                entry->inst->inst_id=RISCV_VLOXEI16_V;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->rsrc2=$6; 
+                                entry->inst->funct3=F3_VLOXEI16_V; 
+                                entry->inst->funct7=(MOP_VLOXEI16_V<<1) | $7;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VSUXEI16_V validvreg LBRACKET validireg RBRACKET validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VSUXEI16_V); 
+                                entry->inst->inst_id=RISCV_VSUXEI16_V;
+                                entry->inst->rdst=$2; // vs3
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->rsrc2=$6; 
+                                entry->inst->funct3=F3_VSUXEI16_V; 
+                                entry->inst->funct7=(MOP_VSUXEI16_V<<1) | $7;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VSOXEI16_V validvreg LBRACKET validireg RBRACKET validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VSOXEI16_V); 
+                                entry->inst->inst_id=RISCV_VSOXEI16_V;
+                                entry->inst->rdst=$2; // vs3
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->rsrc2=$6; 
+                                entry->inst->funct3=F3_VSOXEI16_V; 
+                                entry->inst->funct7=(MOP_VSOXEI16_V<<1) | $7;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VLE32_V validvreg LBRACKET validireg RBRACKET vmask {
+                                mem_entry_t *entry=new_instruction(OP_VLE32_V); 
+                                entry->inst->inst_id=RISCV_VLE32_V;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->rsrc2=RS2_VLE32_V;
+                                entry->inst->funct3=F3_VLE32_V; 
+                                entry->inst->funct7=(MOP_VLE32_V<<1) | $6;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VLE32FF_V validvreg LBRACKET validireg RBRACKET vmask {
+                                mem_entry_t *entry=new_instruction(OP_VLE32FF_V); 
+                                entry->inst->inst_id=RISCV_VLE32FF_V;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->rsrc2=RS2_VLE32FF_V;
+                                entry->inst->funct3=F3_VLE32FF_V; 
+                                entry->inst->funct7=(MOP_VLE32FF_V<<1) | $6;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VSE32_V validvreg LBRACKET validireg RBRACKET vmask {
+                                mem_entry_t *entry=new_instruction(OP_VSE32_V); 
+                                entry->inst->inst_id=RISCV_VSE32_V;
+                                entry->inst->rdst=$2; // vs3
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->rsrc2=RS2_VSE32_V;
+                                entry->inst->funct3=F3_VSE32_V; 
+                                entry->inst->funct7=(MOP_VSE32_V<<1) | $6;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VLSE32_V validvreg LBRACKET validireg RBRACKET validireg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VLSE32_V); 
+                                entry->inst->inst_id=RISCV_VLSE32_V;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->rsrc2=$6; 
+                                entry->inst->funct3=F3_VLSE32_V; 
+                                entry->inst->funct7=(MOP_VLSE32_V<<1) | $7;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VSSE32_V validvreg LBRACKET validireg RBRACKET validireg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VSSE32_V); 
+                                entry->inst->inst_id=RISCV_VSSE32_V;
+                                entry->inst->rdst=$2; // vs3
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->rsrc2=$6; 
+                                entry->inst->funct3=F3_VSSE32_V; 
+                                entry->inst->funct7=(MOP_VSSE32_V<<1) | $7;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VLUXEI32_V validvreg LBRACKET validireg RBRACKET validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VLUXEI32_V); 
+                                entry->inst->inst_id=RISCV_VLUXEI32_V;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->rsrc2=$6; 
+                                entry->inst->funct3=F3_VLUXEI32_V; 
+                                entry->inst->funct7=(MOP_VLUXEI32_V<<1) | $7;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VLOXEI32_V validvreg LBRACKET validireg RBRACKET validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VLOXEI32_V); 
+                                entry->inst->inst_id=RISCV_VLOXEI32_V;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->rsrc2=$6; 
+                                entry->inst->funct3=F3_VLOXEI32_V; 
+                                entry->inst->funct7=(MOP_VLOXEI32_V<<1) | $7;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VSUXEI32_V validvreg LBRACKET validireg RBRACKET validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VSUXEI32_V); 
+                                entry->inst->inst_id=RISCV_VSUXEI32_V;
+                                entry->inst->rdst=$2; // vs3
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->rsrc2=$6; 
+                                entry->inst->funct3=F3_VSUXEI32_V; 
+                                entry->inst->funct7=(MOP_VSUXEI32_V<<1) | $7;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VSOXEI32_V validvreg LBRACKET validireg RBRACKET validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VSOXEI32_V); 
+                                entry->inst->inst_id=RISCV_VSOXEI32_V;
+                                entry->inst->rdst=$2; // vs3
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->rsrc2=$6; 
+                                entry->inst->funct3=F3_VSOXEI32_V; 
+                                entry->inst->funct7=(MOP_VSOXEI32_V<<1) | $7;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VLE64_V validvreg LBRACKET validireg RBRACKET vmask {
+                                mem_entry_t *entry=new_instruction(OP_VLE64_V); 
+                                entry->inst->inst_id=RISCV_VLE64_V;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->rsrc2=RS2_VLE64_V;
+                                entry->inst->funct3=F3_VLE64_V; 
+                                entry->inst->funct7=(MOP_VLE64_V<<1) | $6;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VLE64FF_V validvreg LBRACKET validireg RBRACKET vmask {
+                                mem_entry_t *entry=new_instruction(OP_VLE64FF_V); 
+                                entry->inst->inst_id=RISCV_VLE64FF_V;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->rsrc2=RS2_VLE64FF_V;
+                                entry->inst->funct3=F3_VLE64FF_V; 
+                                entry->inst->funct7=(MOP_VLE64FF_V<<1) | $6;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VSE64_V validvreg LBRACKET validireg RBRACKET vmask {
+                                mem_entry_t *entry=new_instruction(OP_VSE64_V); 
+                                entry->inst->inst_id=RISCV_VSE64_V;
+                                entry->inst->rdst=$2; // vs3
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->rsrc2=RS2_VSE64_V;
+                                entry->inst->funct3=F3_VSE64_V; 
+                                entry->inst->funct7=(MOP_VSE64_V<<1) | $6;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VLSE64_V validvreg LBRACKET validireg RBRACKET validireg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VLSE64_V); 
+                                entry->inst->inst_id=RISCV_VLSE64_V;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->rsrc2=$6; 
+                                entry->inst->funct3=F3_VLSE64_V; 
+                                entry->inst->funct7=(MOP_VLSE64_V<<1) | $7;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VSSE64_V validvreg LBRACKET validireg RBRACKET validireg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VSSE64_V); 
+                                entry->inst->inst_id=RISCV_VSSE64_V;
+                                entry->inst->rdst=$2; // vs3
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->rsrc2=$6; 
+                                entry->inst->funct3=F3_VSSE64_V; 
+                                entry->inst->funct7=(MOP_VSSE64_V<<1) | $7;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VLUXEI64_V validvreg LBRACKET validireg RBRACKET validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VLUXEI64_V); 
+                                entry->inst->inst_id=RISCV_VLUXEI64_V;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->rsrc2=$6; 
+                                entry->inst->funct3=F3_VLUXEI64_V; 
+                                entry->inst->funct7=(MOP_VLUXEI64_V<<1) | $7;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VLOXEI64_V validvreg LBRACKET validireg RBRACKET validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VLOXEI64_V); 
+                                entry->inst->inst_id=RISCV_VLOXEI64_V;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->rsrc2=$6; 
+                                entry->inst->funct3=F3_VLOXEI64_V; 
+                                entry->inst->funct7=(MOP_VLOXEI64_V<<1) | $7;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VSUXEI64_V validvreg LBRACKET validireg RBRACKET validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VSUXEI64_V); 
+                                entry->inst->inst_id=RISCV_VSUXEI64_V;
+                                entry->inst->rdst=$2; // vs3
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->rsrc2=$6; 
+                                entry->inst->funct3=F3_VSUXEI64_V; 
+                                entry->inst->funct7=(MOP_VSUXEI64_V<<1) | $7;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VSOXEI64_V validvreg LBRACKET validireg RBRACKET validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VSOXEI64_V); 
+                                entry->inst->inst_id=RISCV_VSOXEI64_V;
+                                entry->inst->rdst=$2; // vs3
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->rsrc2=$6; 
+                                entry->inst->funct3=F3_VSOXEI64_V; 
+                                entry->inst->funct7=(MOP_VSOXEI64_V<<1) | $7;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VLM_V validvreg LBRACKET validireg RBRACKET {
+                                mem_entry_t *entry=new_instruction(OP_VLM_V); 
+                                entry->inst->inst_id=RISCV_VLM_V;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->rsrc2=RS2_VLM_V;
+                                entry->inst->funct3=F3_VLM_V; 
+                                entry->inst->funct7=(MOP_VLM_V<<1) | 1;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VSM_V validvreg LBRACKET validireg RBRACKET {
+                                mem_entry_t *entry=new_instruction(OP_VSM_V); 
+                                entry->inst->inst_id=RISCV_VSM_V;
+                                entry->inst->rdst=$2; // vs3
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->rsrc2=RS2_VSM_V;
+                                entry->inst->funct3=F3_VSM_V; 
+                                entry->inst->funct7=(MOP_VSM_V<<1) | 1;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VADD_VV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VADD_VV); 
+                                entry->inst->inst_id=RISCV_VADD_VV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VADD_VV; 
+                                entry->inst->funct7=(F6_VADD_VV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VADD_VX validvreg validvreg validireg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VADD_VX); 
+                                entry->inst->inst_id=RISCV_VADD_VX;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VADD_VX; 
+                                entry->inst->funct7=(F6_VADD_VX<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VADD_VI validvreg validvreg IIMM vmask {
+                                mem_entry_t *entry=new_instruction(OP_VADD_VI); 
+                                entry->inst->inst_id=RISCV_VADD_VI;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=check_vimm($4,TRUE); 
+                                entry->inst->funct3=F3_VADD_VI; 
+                                entry->inst->funct7=(F6_VADD_VI<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VSUB_VV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VSUB_VV); 
+                                entry->inst->inst_id=RISCV_VSUB_VV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VSUB_VV; 
+                                entry->inst->funct7=(F6_VSUB_VV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VSUB_VX validvreg validvreg validireg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VSUB_VX); 
+                                entry->inst->inst_id=RISCV_VSUB_VX;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VSUB_VX; 
+                                entry->inst->funct7=(F6_VSUB_VX<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VRSUB_VX validvreg validvreg validireg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VRSUB_VX); 
+                                entry->inst->inst_id=RISCV_VRSUB_VX;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VRSUB_VX; 
+                                entry->inst->funct7=(F6_VRSUB_VX<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VRSUB_VI validvreg validvreg IIMM vmask {
+                                mem_entry_t *entry=new_instruction(OP_VRSUB_VI); 
+                                entry->inst->inst_id=RISCV_VRSUB_VI;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=check_vimm($4,TRUE); 
+                                entry->inst->funct3=F3_VRSUB_VI; 
+                                entry->inst->funct7=(F6_VRSUB_VI<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMINU_VV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VMINU_VV); 
+                                entry->inst->inst_id=RISCV_VMINU_VV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VMINU_VV; 
+                                entry->inst->funct7=(F6_VMINU_VV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMINU_VX validvreg validvreg validireg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VMINU_VX); 
+                                entry->inst->inst_id=RISCV_VMINU_VX;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VMINU_VX; 
+                                entry->inst->funct7=(F6_VMINU_VX<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMIN_VV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VMIN_VV); 
+                                entry->inst->inst_id=RISCV_VMIN_VV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VMIN_VV; 
+                                entry->inst->funct7=(F6_VMIN_VV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMIN_VX validvreg validvreg validireg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VMIN_VX); 
+                                entry->inst->inst_id=RISCV_VMIN_VX;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VMIN_VX; 
+                                entry->inst->funct7=(F6_VMIN_VX<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMAXU_VV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VMAXU_VV); 
+                                entry->inst->inst_id=RISCV_VMAXU_VV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VMAXU_VV; 
+                                entry->inst->funct7=(F6_VMAXU_VV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMAXU_VX validvreg validvreg validireg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VMAXU_VX); 
+                                entry->inst->inst_id=RISCV_VMAXU_VX;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VMAXU_VX; 
+                                entry->inst->funct7=(F6_VMAXU_VX<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMAX_VV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VMAX_VV); 
+                                entry->inst->inst_id=RISCV_VMAX_VV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VMAX_VV; 
+                                entry->inst->funct7=(F6_VMAX_VV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMAX_VX validvreg validvreg validireg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VMAX_VX); 
+                                entry->inst->inst_id=RISCV_VMAX_VX;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VMAX_VX; 
+                                entry->inst->funct7=(F6_VMAX_VX<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VAND_VV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VAND_VV); 
+                                entry->inst->inst_id=RISCV_VAND_VV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VAND_VV; 
+                                entry->inst->funct7=(F6_VAND_VV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VAND_VX validvreg validvreg validireg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VAND_VX); 
+                                entry->inst->inst_id=RISCV_VAND_VX;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VAND_VX; 
+                                entry->inst->funct7=(F6_VAND_VX<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VAND_VI validvreg validvreg IIMM vmask {
+                                mem_entry_t *entry=new_instruction(OP_VAND_VI); 
+                                entry->inst->inst_id=RISCV_VAND_VI;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=check_vimm($4,TRUE); 
+                                entry->inst->funct3=F3_VAND_VI; 
+                                entry->inst->funct7=(F6_VAND_VI<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VOR_VV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VOR_VV); 
+                                entry->inst->inst_id=RISCV_VOR_VV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VOR_VV; 
+                                entry->inst->funct7=(F6_VOR_VV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VOR_VX validvreg validvreg validireg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VOR_VX); 
+                                entry->inst->inst_id=RISCV_VOR_VX;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VOR_VX; 
+                                entry->inst->funct7=(F6_VOR_VX<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VOR_VI validvreg validvreg IIMM vmask {
+                                mem_entry_t *entry=new_instruction(OP_VOR_VI); 
+                                entry->inst->inst_id=RISCV_VOR_VI;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=check_vimm($4,TRUE); 
+                                entry->inst->funct3=F3_VOR_VI; 
+                                entry->inst->funct7=(F6_VOR_VI<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VXOR_VV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VXOR_VV); 
+                                entry->inst->inst_id=RISCV_VXOR_VV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VXOR_VV; 
+                                entry->inst->funct7=(F6_VXOR_VV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VXOR_VX validvreg validvreg validireg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VXOR_VX); 
+                                entry->inst->inst_id=RISCV_VXOR_VX;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VXOR_VX; 
+                                entry->inst->funct7=(F6_VXOR_VX<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VXOR_VI validvreg validvreg IIMM vmask {
+                                mem_entry_t *entry=new_instruction(OP_VXOR_VI); 
+                                entry->inst->inst_id=RISCV_VXOR_VI;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=check_vimm($4,TRUE); 
+                                entry->inst->funct3=F3_VXOR_VI; 
+                                entry->inst->funct7=(F6_VXOR_VI<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VRGATHER_VV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VRGATHER_VV); 
+                                entry->inst->inst_id=RISCV_VRGATHER_VV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VRGATHER_VV; 
+                                entry->inst->funct7=(F6_VRGATHER_VV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VRGATHER_VX validvreg validvreg validireg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VRGATHER_VX); 
+                                entry->inst->inst_id=RISCV_VRGATHER_VX;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VRGATHER_VX; 
+                                entry->inst->funct7=(F6_VRGATHER_VX<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VRGATHER_VI validvreg validvreg IIMM vmask {
+                                mem_entry_t *entry=new_instruction(OP_VRGATHER_VI); 
+                                entry->inst->inst_id=RISCV_VRGATHER_VI;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=check_vimm($4,FALSE); 
+                                entry->inst->funct3=F3_VRGATHER_VI; 
+                                entry->inst->funct7=(F6_VRGATHER_VI<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VSLIDEUP_VX validvreg validvreg validireg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VSLIDEUP_VX); 
+                                entry->inst->inst_id=RISCV_VSLIDEUP_VX;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VSLIDEUP_VX; 
+                                entry->inst->funct7=(F6_VSLIDEUP_VX<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VSLIDEUP_VI validvreg validvreg IIMM vmask {
+                                mem_entry_t *entry=new_instruction(OP_VSLIDEUP_VI); 
+                                entry->inst->inst_id=RISCV_VSLIDEUP_VI;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=check_vimm($4,FALSE); 
+                                entry->inst->funct3=F3_VSLIDEUP_VI; 
+                                entry->inst->funct7=(F6_VSLIDEUP_VI<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VSLIDEDOWN_VX validvreg validvreg validireg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VSLIDEDOWN_VX); 
+                                entry->inst->inst_id=RISCV_VSLIDEDOWN_VX;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VSLIDEDOWN_VX; 
+                                entry->inst->funct7=(F6_VSLIDEDOWN_VX<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VSLIDEDOWN_VI validvreg validvreg IIMM vmask {
+                                mem_entry_t *entry=new_instruction(OP_VSLIDEDOWN_VI); 
+                                entry->inst->inst_id=RISCV_VSLIDEDOWN_VI;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=check_vimm($4,FALSE); 
+                                entry->inst->funct3=F3_VSLIDEDOWN_VI; 
+                                entry->inst->funct7=(F6_VSLIDEDOWN_VI<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMSEQ_VV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VMSEQ_VV); 
+                                entry->inst->inst_id=RISCV_VMSEQ_VV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VMSEQ_VV; 
+                                entry->inst->funct7=(F6_VMSEQ_VV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMSEQ_VX validvreg validvreg validireg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VMSEQ_VX); 
+                                entry->inst->inst_id=RISCV_VMSEQ_VX;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VMSEQ_VX; 
+                                entry->inst->funct7=(F6_VMSEQ_VX<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMSEQ_VI validvreg validvreg IIMM vmask {
+                                mem_entry_t *entry=new_instruction(OP_VMSEQ_VI); 
+                                entry->inst->inst_id=RISCV_VMSEQ_VI;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=check_vimm($4,TRUE); 
+                                entry->inst->funct3=F3_VMSEQ_VI; 
+                                entry->inst->funct7=(F6_VMSEQ_VI<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMSNE_VV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VMSNE_VV); 
+                                entry->inst->inst_id=RISCV_VMSNE_VV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VMSNE_VV; 
+                                entry->inst->funct7=(F6_VMSNE_VV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMSNE_VX validvreg validvreg validireg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VMSNE_VX); 
+                                entry->inst->inst_id=RISCV_VMSNE_VX;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VMSNE_VX; 
+                                entry->inst->funct7=(F6_VMSNE_VX<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMSNE_VI validvreg validvreg IIMM vmask {
+                                mem_entry_t *entry=new_instruction(OP_VMSNE_VI); 
+                                entry->inst->inst_id=RISCV_VMSNE_VI;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=check_vimm($4,TRUE); 
+                                entry->inst->funct3=F3_VMSNE_VI; 
+                                entry->inst->funct7=(F6_VMSNE_VI<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMSLTU_VV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VMSLTU_VV); 
+                                entry->inst->inst_id=RISCV_VMSLTU_VV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VMSLTU_VV; 
+                                entry->inst->funct7=(F6_VMSLTU_VV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMSLTU_VX validvreg validvreg validireg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VMSLTU_VX); 
+                                entry->inst->inst_id=RISCV_VMSLTU_VX;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VMSLTU_VX; 
+                                entry->inst->funct7=(F6_VMSLTU_VX<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMSLT_VV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VMSLT_VV); 
+                                entry->inst->inst_id=RISCV_VMSLT_VV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VMSLT_VV; 
+                                entry->inst->funct7=(F6_VMSLT_VV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMSLT_VX validvreg validvreg validireg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VMSLT_VX); 
+                                entry->inst->inst_id=RISCV_VMSLT_VX;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VMSLT_VX; 
+                                entry->inst->funct7=(F6_VMSLT_VX<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMSLEU_VV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VMSLEU_VV); 
+                                entry->inst->inst_id=RISCV_VMSLEU_VV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VMSLEU_VV; 
+                                entry->inst->funct7=(F6_VMSLEU_VV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMSLEU_VX validvreg validvreg validireg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VMSLEU_VX); 
+                                entry->inst->inst_id=RISCV_VMSLEU_VX;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VMSLEU_VX; 
+                                entry->inst->funct7=(F6_VMSLEU_VX<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMSLEU_VI validvreg validvreg IIMM vmask {
+                                mem_entry_t *entry=new_instruction(OP_VMSLEU_VI); 
+                                entry->inst->inst_id=RISCV_VMSLEU_VI;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=check_vimm($4,TRUE); 
+                                entry->inst->funct3=F3_VMSLEU_VI; 
+                                entry->inst->funct7=(F6_VMSLEU_VI<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMSLE_VV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VMSLE_VV); 
+                                entry->inst->inst_id=RISCV_VMSLE_VV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VMSLE_VV; 
+                                entry->inst->funct7=(F6_VMSLE_VV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMSLE_VX validvreg validvreg validireg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VMSLE_VX); 
+                                entry->inst->inst_id=RISCV_VMSLE_VX;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VMSLE_VX; 
+                                entry->inst->funct7=(F6_VMSLE_VX<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMSLE_VI validvreg validvreg IIMM vmask {
+                                mem_entry_t *entry=new_instruction(OP_VMSLE_VI); 
+                                entry->inst->inst_id=RISCV_VMSLE_VI;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=check_vimm($4,TRUE); 
+                                entry->inst->funct3=F3_VMSLE_VI; 
+                                entry->inst->funct7=(F6_VMSLE_VI<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMSGTU_VX validvreg validvreg validireg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VMSGTU_VX); 
+                                entry->inst->inst_id=RISCV_VMSGTU_VX;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VMSGTU_VX; 
+                                entry->inst->funct7=(F6_VMSGTU_VX<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMSGTU_VI validvreg validvreg IIMM vmask {
+                                mem_entry_t *entry=new_instruction(OP_VMSGTU_VI); 
+                                entry->inst->inst_id=RISCV_VMSGTU_VI;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=check_vimm($4,TRUE); 
+                                entry->inst->funct3=F3_VMSGTU_VI; 
+                                entry->inst->funct7=(F6_VMSGTU_VI<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMSGT_VX validvreg validvreg validireg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VMSGT_VX); 
+                                entry->inst->inst_id=RISCV_VMSGT_VX;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VMSGT_VX; 
+                                entry->inst->funct7=(F6_VMSGT_VX<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMSGT_VI validvreg validvreg IIMM vmask {
+                                mem_entry_t *entry=new_instruction(OP_VMSGT_VI); 
+                                entry->inst->inst_id=RISCV_VMSGT_VI;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=check_vimm($4,TRUE); 
+                                entry->inst->funct3=F3_VMSGT_VI; 
+                                entry->inst->funct7=(F6_VMSGT_VI<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VSLL_VV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VSLL_VV); 
+                                entry->inst->inst_id=RISCV_VSLL_VV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VSLL_VV; 
+                                entry->inst->funct7=(F6_VSLL_VV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VSLL_VX validvreg validvreg validireg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VSLL_VX); 
+                                entry->inst->inst_id=RISCV_VSLL_VX;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VSLL_VX; 
+                                entry->inst->funct7=(F6_VSLL_VX<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VSLL_VI validvreg validvreg IIMM vmask {
+                                mem_entry_t *entry=new_instruction(OP_VSLL_VI); 
+                                entry->inst->inst_id=RISCV_VSLL_VI;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=check_vimm($4,FALSE); 
+                                entry->inst->funct3=F3_VSLL_VI; 
+                                entry->inst->funct7=(F6_VSLL_VI<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VSRL_VV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VSRL_VV); 
+                                entry->inst->inst_id=RISCV_VSRL_VV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VSRL_VV; 
+                                entry->inst->funct7=(F6_VSRL_VV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VSRL_VX validvreg validvreg validireg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VSRL_VX); 
+                                entry->inst->inst_id=RISCV_VSRL_VX;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VSRL_VX; 
+                                entry->inst->funct7=(F6_VSRL_VX<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VSRL_VI validvreg validvreg IIMM vmask {
+                                mem_entry_t *entry=new_instruction(OP_VSRL_VI); 
+                                entry->inst->inst_id=RISCV_VSRL_VI;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=check_vimm($4,FALSE); 
+                                entry->inst->funct3=F3_VSRL_VI; 
+                                entry->inst->funct7=(F6_VSRL_VI<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VSRA_VV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VSRA_VV); 
+                                entry->inst->inst_id=RISCV_VSRA_VV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VSRA_VV; 
+                                entry->inst->funct7=(F6_VSRA_VV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VSRA_VX validvreg validvreg validireg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VSRA_VX); 
+                                entry->inst->inst_id=RISCV_VSRA_VX;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VSRA_VX; 
+                                entry->inst->funct7=(F6_VSRA_VX<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VSRA_VI validvreg validvreg IIMM vmask {
+                                mem_entry_t *entry=new_instruction(OP_VSRA_VI); 
+                                entry->inst->inst_id=RISCV_VSRA_VI;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=check_vimm($4,FALSE); 
+                                entry->inst->funct3=F3_VSRA_VI; 
+                                entry->inst->funct7=(F6_VSRA_VI<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VNSRL_WV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VNSRL_WV); 
+                                entry->inst->inst_id=RISCV_VNSRL_WV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VNSRL_WV; 
+                                entry->inst->funct7=(F6_VNSRL_WV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VNSRL_WX validvreg validvreg validireg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VNSRL_WX); 
+                                entry->inst->inst_id=RISCV_VNSRL_WX;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VNSRL_WX; 
+                                entry->inst->funct7=(F6_VNSRL_WX<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VNSRL_WI validvreg validvreg IIMM vmask {
+                                mem_entry_t *entry=new_instruction(OP_VNSRL_WI); 
+                                entry->inst->inst_id=RISCV_VNSRL_WI;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=check_vimm($4,FALSE); 
+                                entry->inst->funct3=F3_VNSRL_WI; 
+                                entry->inst->funct7=(F6_VNSRL_WI<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VNSRA_WV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VNSRA_WV); 
+                                entry->inst->inst_id=RISCV_VNSRA_WV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VNSRA_WV; 
+                                entry->inst->funct7=(F6_VNSRA_WV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VNSRA_WX validvreg validvreg validireg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VNSRA_WX); 
+                                entry->inst->inst_id=RISCV_VNSRA_WX;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VNSRA_WX; 
+                                entry->inst->funct7=(F6_VNSRA_WX<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VNSRA_WI validvreg validvreg IIMM vmask {
+                                mem_entry_t *entry=new_instruction(OP_VNSRA_WI); 
+                                entry->inst->inst_id=RISCV_VNSRA_WI;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=check_vimm($4,FALSE); 
+                                entry->inst->funct3=F3_VNSRA_WI; 
+                                entry->inst->funct7=(F6_VNSRA_WI<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMERGE_VVM validvreg validvreg validvreg validvreg {
+                                mem_entry_t *entry=new_instruction(OP_VMERGE_VVM); 
+                                entry->inst->inst_id=RISCV_VMERGE_VVM;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                if ($5 != 0) yyerror("the merge mask operand must be $v0");
+                                entry->inst->funct3=F3_VMERGE_VVM; 
+                                entry->inst->funct7=(F6_VMERGE_VVM<<1) | 0;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMERGE_VXM validvreg validvreg validireg validvreg {
+                                mem_entry_t *entry=new_instruction(OP_VMERGE_VXM); 
+                                entry->inst->inst_id=RISCV_VMERGE_VXM;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                if ($5 != 0) yyerror("the merge mask operand must be $v0");
+                                entry->inst->funct3=F3_VMERGE_VXM; 
+                                entry->inst->funct7=(F6_VMERGE_VXM<<1) | 0;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMERGE_VIM validvreg validvreg IIMM validvreg {
+                                mem_entry_t *entry=new_instruction(OP_VMERGE_VIM); 
+                                entry->inst->inst_id=RISCV_VMERGE_VIM;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=check_vimm($4,TRUE); 
+                                if ($5 != 0) yyerror("the merge mask operand must be $v0");
+                                entry->inst->funct3=F3_VMERGE_VIM; 
+                                entry->inst->funct7=(F6_VMERGE_VIM<<1) | 0;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMV_V_V validvreg validvreg {
+                                mem_entry_t *entry=new_instruction(OP_VMV_V_V); 
+                                entry->inst->inst_id=RISCV_VMV_V_V;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->rsrc2=0; 
+                                entry->inst->funct3=F3_VMV_V_V; 
+                                entry->inst->funct7=(F6_VMV_V_V<<1) | 1;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMV_V_X validvreg validireg {
+                                mem_entry_t *entry=new_instruction(OP_VMV_V_X); 
+                                entry->inst->inst_id=RISCV_VMV_V_X;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->rsrc2=0; 
+                                entry->inst->funct3=F3_VMV_V_X; 
+                                entry->inst->funct7=(F6_VMV_V_X<<1) | 1;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMV_V_I validvreg IIMM {
+                                mem_entry_t *entry=new_instruction(OP_VMV_V_I); 
+                                entry->inst->inst_id=RISCV_VMV_V_I;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=check_vimm($3,TRUE); 
+                                entry->inst->rsrc2=0; 
+                                entry->inst->funct3=F3_VMV_V_I; 
+                                entry->inst->funct7=(F6_VMV_V_I<<1) | 1;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VDIVU_VV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VDIVU_VV); 
+                                entry->inst->inst_id=RISCV_VDIVU_VV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VDIVU_VV; 
+                                entry->inst->funct7=(F6_VDIVU_VV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VDIVU_VX validvreg validvreg validireg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VDIVU_VX); 
+                                entry->inst->inst_id=RISCV_VDIVU_VX;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VDIVU_VX; 
+                                entry->inst->funct7=(F6_VDIVU_VX<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VDIV_VV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VDIV_VV); 
+                                entry->inst->inst_id=RISCV_VDIV_VV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VDIV_VV; 
+                                entry->inst->funct7=(F6_VDIV_VV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VDIV_VX validvreg validvreg validireg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VDIV_VX); 
+                                entry->inst->inst_id=RISCV_VDIV_VX;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VDIV_VX; 
+                                entry->inst->funct7=(F6_VDIV_VX<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VREMU_VV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VREMU_VV); 
+                                entry->inst->inst_id=RISCV_VREMU_VV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VREMU_VV; 
+                                entry->inst->funct7=(F6_VREMU_VV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VREMU_VX validvreg validvreg validireg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VREMU_VX); 
+                                entry->inst->inst_id=RISCV_VREMU_VX;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VREMU_VX; 
+                                entry->inst->funct7=(F6_VREMU_VX<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VREM_VV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VREM_VV); 
+                                entry->inst->inst_id=RISCV_VREM_VV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VREM_VV; 
+                                entry->inst->funct7=(F6_VREM_VV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VREM_VX validvreg validvreg validireg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VREM_VX); 
+                                entry->inst->inst_id=RISCV_VREM_VX;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VREM_VX; 
+                                entry->inst->funct7=(F6_VREM_VX<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMULHU_VV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VMULHU_VV); 
+                                entry->inst->inst_id=RISCV_VMULHU_VV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VMULHU_VV; 
+                                entry->inst->funct7=(F6_VMULHU_VV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMULHU_VX validvreg validvreg validireg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VMULHU_VX); 
+                                entry->inst->inst_id=RISCV_VMULHU_VX;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VMULHU_VX; 
+                                entry->inst->funct7=(F6_VMULHU_VX<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMUL_VV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VMUL_VV); 
+                                entry->inst->inst_id=RISCV_VMUL_VV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VMUL_VV; 
+                                entry->inst->funct7=(F6_VMUL_VV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMUL_VX validvreg validvreg validireg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VMUL_VX); 
+                                entry->inst->inst_id=RISCV_VMUL_VX;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VMUL_VX; 
+                                entry->inst->funct7=(F6_VMUL_VX<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMULHSU_VV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VMULHSU_VV); 
+                                entry->inst->inst_id=RISCV_VMULHSU_VV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VMULHSU_VV; 
+                                entry->inst->funct7=(F6_VMULHSU_VV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMULHSU_VX validvreg validvreg validireg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VMULHSU_VX); 
+                                entry->inst->inst_id=RISCV_VMULHSU_VX;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VMULHSU_VX; 
+                                entry->inst->funct7=(F6_VMULHSU_VX<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMULH_VV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VMULH_VV); 
+                                entry->inst->inst_id=RISCV_VMULH_VV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VMULH_VV; 
+                                entry->inst->funct7=(F6_VMULH_VV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMULH_VX validvreg validvreg validireg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VMULH_VX); 
+                                entry->inst->inst_id=RISCV_VMULH_VX;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VMULH_VX; 
+                                entry->inst->funct7=(F6_VMULH_VX<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VWADDU_VV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VWADDU_VV); 
+                                entry->inst->inst_id=RISCV_VWADDU_VV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VWADDU_VV; 
+                                entry->inst->funct7=(F6_VWADDU_VV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VWADDU_VX validvreg validvreg validireg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VWADDU_VX); 
+                                entry->inst->inst_id=RISCV_VWADDU_VX;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VWADDU_VX; 
+                                entry->inst->funct7=(F6_VWADDU_VX<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VWADD_VV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VWADD_VV); 
+                                entry->inst->inst_id=RISCV_VWADD_VV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VWADD_VV; 
+                                entry->inst->funct7=(F6_VWADD_VV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VWADD_VX validvreg validvreg validireg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VWADD_VX); 
+                                entry->inst->inst_id=RISCV_VWADD_VX;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VWADD_VX; 
+                                entry->inst->funct7=(F6_VWADD_VX<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VWSUBU_VV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VWSUBU_VV); 
+                                entry->inst->inst_id=RISCV_VWSUBU_VV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VWSUBU_VV; 
+                                entry->inst->funct7=(F6_VWSUBU_VV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VWSUBU_VX validvreg validvreg validireg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VWSUBU_VX); 
+                                entry->inst->inst_id=RISCV_VWSUBU_VX;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VWSUBU_VX; 
+                                entry->inst->funct7=(F6_VWSUBU_VX<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VWSUB_VV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VWSUB_VV); 
+                                entry->inst->inst_id=RISCV_VWSUB_VV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VWSUB_VV; 
+                                entry->inst->funct7=(F6_VWSUB_VV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VWSUB_VX validvreg validvreg validireg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VWSUB_VX); 
+                                entry->inst->inst_id=RISCV_VWSUB_VX;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VWSUB_VX; 
+                                entry->inst->funct7=(F6_VWSUB_VX<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VWMULU_VV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VWMULU_VV); 
+                                entry->inst->inst_id=RISCV_VWMULU_VV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VWMULU_VV; 
+                                entry->inst->funct7=(F6_VWMULU_VV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VWMULU_VX validvreg validvreg validireg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VWMULU_VX); 
+                                entry->inst->inst_id=RISCV_VWMULU_VX;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VWMULU_VX; 
+                                entry->inst->funct7=(F6_VWMULU_VX<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VWMULSU_VV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VWMULSU_VV); 
+                                entry->inst->inst_id=RISCV_VWMULSU_VV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VWMULSU_VV; 
+                                entry->inst->funct7=(F6_VWMULSU_VV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VWMULSU_VX validvreg validvreg validireg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VWMULSU_VX); 
+                                entry->inst->inst_id=RISCV_VWMULSU_VX;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VWMULSU_VX; 
+                                entry->inst->funct7=(F6_VWMULSU_VX<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VWMUL_VV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VWMUL_VV); 
+                                entry->inst->inst_id=RISCV_VWMUL_VV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VWMUL_VV; 
+                                entry->inst->funct7=(F6_VWMUL_VV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VWMUL_VX validvreg validvreg validireg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VWMUL_VX); 
+                                entry->inst->inst_id=RISCV_VWMUL_VX;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VWMUL_VX; 
+                                entry->inst->funct7=(F6_VWMUL_VX<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMADD_VV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VMADD_VV); 
+                                entry->inst->inst_id=RISCV_VMADD_VV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->rsrc2=$4; 
+                                entry->inst->funct3=F3_VMADD_VV; 
+                                entry->inst->funct7=(F6_VMADD_VV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMADD_VX validvreg validireg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VMADD_VX); 
+                                entry->inst->inst_id=RISCV_VMADD_VX;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->rsrc2=$4; 
+                                entry->inst->funct3=F3_VMADD_VX; 
+                                entry->inst->funct7=(F6_VMADD_VX<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VNMSUB_VV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VNMSUB_VV); 
+                                entry->inst->inst_id=RISCV_VNMSUB_VV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->rsrc2=$4; 
+                                entry->inst->funct3=F3_VNMSUB_VV; 
+                                entry->inst->funct7=(F6_VNMSUB_VV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VNMSUB_VX validvreg validireg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VNMSUB_VX); 
+                                entry->inst->inst_id=RISCV_VNMSUB_VX;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->rsrc2=$4; 
+                                entry->inst->funct3=F3_VNMSUB_VX; 
+                                entry->inst->funct7=(F6_VNMSUB_VX<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMACC_VV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VMACC_VV); 
+                                entry->inst->inst_id=RISCV_VMACC_VV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->rsrc2=$4; 
+                                entry->inst->funct3=F3_VMACC_VV; 
+                                entry->inst->funct7=(F6_VMACC_VV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMACC_VX validvreg validireg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VMACC_VX); 
+                                entry->inst->inst_id=RISCV_VMACC_VX;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->rsrc2=$4; 
+                                entry->inst->funct3=F3_VMACC_VX; 
+                                entry->inst->funct7=(F6_VMACC_VX<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VNMSAC_VV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VNMSAC_VV); 
+                                entry->inst->inst_id=RISCV_VNMSAC_VV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->rsrc2=$4; 
+                                entry->inst->funct3=F3_VNMSAC_VV; 
+                                entry->inst->funct7=(F6_VNMSAC_VV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VNMSAC_VX validvreg validireg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VNMSAC_VX); 
+                                entry->inst->inst_id=RISCV_VNMSAC_VX;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->rsrc2=$4; 
+                                entry->inst->funct3=F3_VNMSAC_VX; 
+                                entry->inst->funct7=(F6_VNMSAC_VX<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VWMACCU_VV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VWMACCU_VV); 
+                                entry->inst->inst_id=RISCV_VWMACCU_VV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->rsrc2=$4; 
+                                entry->inst->funct3=F3_VWMACCU_VV; 
+                                entry->inst->funct7=(F6_VWMACCU_VV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VWMACCU_VX validvreg validireg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VWMACCU_VX); 
+                                entry->inst->inst_id=RISCV_VWMACCU_VX;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->rsrc2=$4; 
+                                entry->inst->funct3=F3_VWMACCU_VX; 
+                                entry->inst->funct7=(F6_VWMACCU_VX<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VWMACC_VV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VWMACC_VV); 
+                                entry->inst->inst_id=RISCV_VWMACC_VV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->rsrc2=$4; 
+                                entry->inst->funct3=F3_VWMACC_VV; 
+                                entry->inst->funct7=(F6_VWMACC_VV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VWMACC_VX validvreg validireg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VWMACC_VX); 
+                                entry->inst->inst_id=RISCV_VWMACC_VX;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->rsrc2=$4; 
+                                entry->inst->funct3=F3_VWMACC_VX; 
+                                entry->inst->funct7=(F6_VWMACC_VX<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VREDSUM_VS validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VREDSUM_VS); 
+                                entry->inst->inst_id=RISCV_VREDSUM_VS;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VREDSUM_VS; 
+                                entry->inst->funct7=(F6_VREDSUM_VS<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VREDAND_VS validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VREDAND_VS); 
+                                entry->inst->inst_id=RISCV_VREDAND_VS;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VREDAND_VS; 
+                                entry->inst->funct7=(F6_VREDAND_VS<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VREDOR_VS validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VREDOR_VS); 
+                                entry->inst->inst_id=RISCV_VREDOR_VS;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VREDOR_VS; 
+                                entry->inst->funct7=(F6_VREDOR_VS<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VREDXOR_VS validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VREDXOR_VS); 
+                                entry->inst->inst_id=RISCV_VREDXOR_VS;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VREDXOR_VS; 
+                                entry->inst->funct7=(F6_VREDXOR_VS<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VREDMINU_VS validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VREDMINU_VS); 
+                                entry->inst->inst_id=RISCV_VREDMINU_VS;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VREDMINU_VS; 
+                                entry->inst->funct7=(F6_VREDMINU_VS<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VREDMIN_VS validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VREDMIN_VS); 
+                                entry->inst->inst_id=RISCV_VREDMIN_VS;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VREDMIN_VS; 
+                                entry->inst->funct7=(F6_VREDMIN_VS<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VREDMAXU_VS validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VREDMAXU_VS); 
+                                entry->inst->inst_id=RISCV_VREDMAXU_VS;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VREDMAXU_VS; 
+                                entry->inst->funct7=(F6_VREDMAXU_VS<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VREDMAX_VS validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VREDMAX_VS); 
+                                entry->inst->inst_id=RISCV_VREDMAX_VS;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VREDMAX_VS; 
+                                entry->inst->funct7=(F6_VREDMAX_VS<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VSLIDE1UP_VX validvreg validvreg validireg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VSLIDE1UP_VX); 
+                                entry->inst->inst_id=RISCV_VSLIDE1UP_VX;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VSLIDE1UP_VX; 
+                                entry->inst->funct7=(F6_VSLIDE1UP_VX<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VSLIDE1DOWN_VX validvreg validvreg validireg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VSLIDE1DOWN_VX); 
+                                entry->inst->inst_id=RISCV_VSLIDE1DOWN_VX;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VSLIDE1DOWN_VX; 
+                                entry->inst->funct7=(F6_VSLIDE1DOWN_VX<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMV_X_S validireg validvreg {
+                                mem_entry_t *entry=new_instruction(OP_VMV_X_S); 
+                                entry->inst->inst_id=RISCV_VMV_X_S;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=RS1_VMV_X_S;
+                                entry->inst->funct3=F3_VMV_X_S; 
+                                entry->inst->funct7=(F6_VMV_X_S<<1) | 1;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMV_S_X validvreg validireg {
+                                mem_entry_t *entry=new_instruction(OP_VMV_S_X); 
+                                entry->inst->inst_id=RISCV_VMV_S_X;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->rsrc2=0; 
+                                entry->inst->funct3=F3_VMV_S_X; 
+                                entry->inst->funct7=(F6_VMV_S_X<<1) | 1;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VCPOP_M validireg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VCPOP_M); 
+                                entry->inst->inst_id=RISCV_VCPOP_M;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=RS1_VCPOP_M;
+                                entry->inst->funct3=F3_VCPOP_M; 
+                                entry->inst->funct7=(F6_VCPOP_M<<1) | $4;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VFIRST_M validireg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VFIRST_M); 
+                                entry->inst->inst_id=RISCV_VFIRST_M;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=RS1_VFIRST_M;
+                                entry->inst->funct3=F3_VFIRST_M; 
+                                entry->inst->funct7=(F6_VFIRST_M<<1) | $4;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VIOTA_M validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VIOTA_M); 
+                                entry->inst->inst_id=RISCV_VIOTA_M;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=RS1_VIOTA_M;
+                                entry->inst->funct3=F3_VIOTA_M; 
+                                entry->inst->funct7=(F6_VIOTA_M<<1) | $4;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VID_V validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VID_V); 
+                                entry->inst->inst_id=RISCV_VID_V;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=0; 
+                                entry->inst->rsrc1=RS1_VID_V;
+                                entry->inst->funct3=F3_VID_V; 
+                                entry->inst->funct7=(F6_VID_V<<1) | $3;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMANDN_MM validvreg validvreg validvreg {
+                                mem_entry_t *entry=new_instruction(OP_VMANDN_MM); 
+                                entry->inst->inst_id=RISCV_VMANDN_MM;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VMANDN_MM; 
+                                entry->inst->funct7=(F6_VMANDN_MM<<1) | 1;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMAND_MM validvreg validvreg validvreg {
+                                mem_entry_t *entry=new_instruction(OP_VMAND_MM); 
+                                entry->inst->inst_id=RISCV_VMAND_MM;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VMAND_MM; 
+                                entry->inst->funct7=(F6_VMAND_MM<<1) | 1;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMOR_MM validvreg validvreg validvreg {
+                                mem_entry_t *entry=new_instruction(OP_VMOR_MM); 
+                                entry->inst->inst_id=RISCV_VMOR_MM;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VMOR_MM; 
+                                entry->inst->funct7=(F6_VMOR_MM<<1) | 1;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMXOR_MM validvreg validvreg validvreg {
+                                mem_entry_t *entry=new_instruction(OP_VMXOR_MM); 
+                                entry->inst->inst_id=RISCV_VMXOR_MM;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VMXOR_MM; 
+                                entry->inst->funct7=(F6_VMXOR_MM<<1) | 1;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMORN_MM validvreg validvreg validvreg {
+                                mem_entry_t *entry=new_instruction(OP_VMORN_MM); 
+                                entry->inst->inst_id=RISCV_VMORN_MM;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VMORN_MM; 
+                                entry->inst->funct7=(F6_VMORN_MM<<1) | 1;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMNAND_MM validvreg validvreg validvreg {
+                                mem_entry_t *entry=new_instruction(OP_VMNAND_MM); 
+                                entry->inst->inst_id=RISCV_VMNAND_MM;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VMNAND_MM; 
+                                entry->inst->funct7=(F6_VMNAND_MM<<1) | 1;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMNOR_MM validvreg validvreg validvreg {
+                                mem_entry_t *entry=new_instruction(OP_VMNOR_MM); 
+                                entry->inst->inst_id=RISCV_VMNOR_MM;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VMNOR_MM; 
+                                entry->inst->funct7=(F6_VMNOR_MM<<1) | 1;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMXNOR_MM validvreg validvreg validvreg {
+                                mem_entry_t *entry=new_instruction(OP_VMXNOR_MM); 
+                                entry->inst->inst_id=RISCV_VMXNOR_MM;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VMXNOR_MM; 
+                                entry->inst->funct7=(F6_VMXNOR_MM<<1) | 1;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VFADD_VV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VFADD_VV); 
+                                entry->inst->inst_id=RISCV_VFADD_VV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VFADD_VV; 
+                                entry->inst->funct7=(F6_VFADD_VV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VFADD_VF validvreg validvreg validfreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VFADD_VF); 
+                                entry->inst->inst_id=RISCV_VFADD_VF;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VFADD_VF; 
+                                entry->inst->funct7=(F6_VFADD_VF<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VFSUB_VV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VFSUB_VV); 
+                                entry->inst->inst_id=RISCV_VFSUB_VV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VFSUB_VV; 
+                                entry->inst->funct7=(F6_VFSUB_VV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VFSUB_VF validvreg validvreg validfreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VFSUB_VF); 
+                                entry->inst->inst_id=RISCV_VFSUB_VF;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VFSUB_VF; 
+                                entry->inst->funct7=(F6_VFSUB_VF<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VFRSUB_VF validvreg validvreg validfreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VFRSUB_VF); 
+                                entry->inst->inst_id=RISCV_VFRSUB_VF;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VFRSUB_VF; 
+                                entry->inst->funct7=(F6_VFRSUB_VF<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VFMIN_VV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VFMIN_VV); 
+                                entry->inst->inst_id=RISCV_VFMIN_VV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VFMIN_VV; 
+                                entry->inst->funct7=(F6_VFMIN_VV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VFMIN_VF validvreg validvreg validfreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VFMIN_VF); 
+                                entry->inst->inst_id=RISCV_VFMIN_VF;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VFMIN_VF; 
+                                entry->inst->funct7=(F6_VFMIN_VF<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VFMAX_VV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VFMAX_VV); 
+                                entry->inst->inst_id=RISCV_VFMAX_VV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VFMAX_VV; 
+                                entry->inst->funct7=(F6_VFMAX_VV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VFMAX_VF validvreg validvreg validfreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VFMAX_VF); 
+                                entry->inst->inst_id=RISCV_VFMAX_VF;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VFMAX_VF; 
+                                entry->inst->funct7=(F6_VFMAX_VF<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VFSGNJ_VV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VFSGNJ_VV); 
+                                entry->inst->inst_id=RISCV_VFSGNJ_VV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VFSGNJ_VV; 
+                                entry->inst->funct7=(F6_VFSGNJ_VV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VFSGNJ_VF validvreg validvreg validfreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VFSGNJ_VF); 
+                                entry->inst->inst_id=RISCV_VFSGNJ_VF;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VFSGNJ_VF; 
+                                entry->inst->funct7=(F6_VFSGNJ_VF<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VFSGNJN_VV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VFSGNJN_VV); 
+                                entry->inst->inst_id=RISCV_VFSGNJN_VV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VFSGNJN_VV; 
+                                entry->inst->funct7=(F6_VFSGNJN_VV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VFSGNJN_VF validvreg validvreg validfreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VFSGNJN_VF); 
+                                entry->inst->inst_id=RISCV_VFSGNJN_VF;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VFSGNJN_VF; 
+                                entry->inst->funct7=(F6_VFSGNJN_VF<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VFSGNJX_VV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VFSGNJX_VV); 
+                                entry->inst->inst_id=RISCV_VFSGNJX_VV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VFSGNJX_VV; 
+                                entry->inst->funct7=(F6_VFSGNJX_VV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VFSGNJX_VF validvreg validvreg validfreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VFSGNJX_VF); 
+                                entry->inst->inst_id=RISCV_VFSGNJX_VF;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VFSGNJX_VF; 
+                                entry->inst->funct7=(F6_VFSGNJX_VF<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VFDIV_VV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VFDIV_VV); 
+                                entry->inst->inst_id=RISCV_VFDIV_VV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VFDIV_VV; 
+                                entry->inst->funct7=(F6_VFDIV_VV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VFDIV_VF validvreg validvreg validfreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VFDIV_VF); 
+                                entry->inst->inst_id=RISCV_VFDIV_VF;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VFDIV_VF; 
+                                entry->inst->funct7=(F6_VFDIV_VF<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VFRDIV_VF validvreg validvreg validfreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VFRDIV_VF); 
+                                entry->inst->inst_id=RISCV_VFRDIV_VF;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VFRDIV_VF; 
+                                entry->inst->funct7=(F6_VFRDIV_VF<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VFMUL_VV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VFMUL_VV); 
+                                entry->inst->inst_id=RISCV_VFMUL_VV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VFMUL_VV; 
+                                entry->inst->funct7=(F6_VFMUL_VV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VFMUL_VF validvreg validvreg validfreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VFMUL_VF); 
+                                entry->inst->inst_id=RISCV_VFMUL_VF;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VFMUL_VF; 
+                                entry->inst->funct7=(F6_VFMUL_VF<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMFEQ_VV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VMFEQ_VV); 
+                                entry->inst->inst_id=RISCV_VMFEQ_VV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VMFEQ_VV; 
+                                entry->inst->funct7=(F6_VMFEQ_VV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMFEQ_VF validvreg validvreg validfreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VMFEQ_VF); 
+                                entry->inst->inst_id=RISCV_VMFEQ_VF;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VMFEQ_VF; 
+                                entry->inst->funct7=(F6_VMFEQ_VF<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMFLE_VV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VMFLE_VV); 
+                                entry->inst->inst_id=RISCV_VMFLE_VV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VMFLE_VV; 
+                                entry->inst->funct7=(F6_VMFLE_VV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMFLE_VF validvreg validvreg validfreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VMFLE_VF); 
+                                entry->inst->inst_id=RISCV_VMFLE_VF;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VMFLE_VF; 
+                                entry->inst->funct7=(F6_VMFLE_VF<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMFLT_VV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VMFLT_VV); 
+                                entry->inst->inst_id=RISCV_VMFLT_VV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VMFLT_VV; 
+                                entry->inst->funct7=(F6_VMFLT_VV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMFLT_VF validvreg validvreg validfreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VMFLT_VF); 
+                                entry->inst->inst_id=RISCV_VMFLT_VF;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VMFLT_VF; 
+                                entry->inst->funct7=(F6_VMFLT_VF<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMFNE_VV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VMFNE_VV); 
+                                entry->inst->inst_id=RISCV_VMFNE_VV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VMFNE_VV; 
+                                entry->inst->funct7=(F6_VMFNE_VV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMFNE_VF validvreg validvreg validfreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VMFNE_VF); 
+                                entry->inst->inst_id=RISCV_VMFNE_VF;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VMFNE_VF; 
+                                entry->inst->funct7=(F6_VMFNE_VF<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMFGT_VF validvreg validvreg validfreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VMFGT_VF); 
+                                entry->inst->inst_id=RISCV_VMFGT_VF;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VMFGT_VF; 
+                                entry->inst->funct7=(F6_VMFGT_VF<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VMFGE_VF validvreg validvreg validfreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VMFGE_VF); 
+                                entry->inst->inst_id=RISCV_VMFGE_VF;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VMFGE_VF; 
+                                entry->inst->funct7=(F6_VMFGE_VF<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VFMADD_VV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VFMADD_VV); 
+                                entry->inst->inst_id=RISCV_VFMADD_VV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->rsrc2=$4; 
+                                entry->inst->funct3=F3_VFMADD_VV; 
+                                entry->inst->funct7=(F6_VFMADD_VV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VFMADD_VF validvreg validfreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VFMADD_VF); 
+                                entry->inst->inst_id=RISCV_VFMADD_VF;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->rsrc2=$4; 
+                                entry->inst->funct3=F3_VFMADD_VF; 
+                                entry->inst->funct7=(F6_VFMADD_VF<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VFNMADD_VV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VFNMADD_VV); 
+                                entry->inst->inst_id=RISCV_VFNMADD_VV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->rsrc2=$4; 
+                                entry->inst->funct3=F3_VFNMADD_VV; 
+                                entry->inst->funct7=(F6_VFNMADD_VV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VFNMADD_VF validvreg validfreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VFNMADD_VF); 
+                                entry->inst->inst_id=RISCV_VFNMADD_VF;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->rsrc2=$4; 
+                                entry->inst->funct3=F3_VFNMADD_VF; 
+                                entry->inst->funct7=(F6_VFNMADD_VF<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VFMSUB_VV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VFMSUB_VV); 
+                                entry->inst->inst_id=RISCV_VFMSUB_VV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->rsrc2=$4; 
+                                entry->inst->funct3=F3_VFMSUB_VV; 
+                                entry->inst->funct7=(F6_VFMSUB_VV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VFMSUB_VF validvreg validfreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VFMSUB_VF); 
+                                entry->inst->inst_id=RISCV_VFMSUB_VF;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->rsrc2=$4; 
+                                entry->inst->funct3=F3_VFMSUB_VF; 
+                                entry->inst->funct7=(F6_VFMSUB_VF<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VFNMSUB_VV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VFNMSUB_VV); 
+                                entry->inst->inst_id=RISCV_VFNMSUB_VV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->rsrc2=$4; 
+                                entry->inst->funct3=F3_VFNMSUB_VV; 
+                                entry->inst->funct7=(F6_VFNMSUB_VV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VFNMSUB_VF validvreg validfreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VFNMSUB_VF); 
+                                entry->inst->inst_id=RISCV_VFNMSUB_VF;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->rsrc2=$4; 
+                                entry->inst->funct3=F3_VFNMSUB_VF; 
+                                entry->inst->funct7=(F6_VFNMSUB_VF<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VFMACC_VV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VFMACC_VV); 
+                                entry->inst->inst_id=RISCV_VFMACC_VV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->rsrc2=$4; 
+                                entry->inst->funct3=F3_VFMACC_VV; 
+                                entry->inst->funct7=(F6_VFMACC_VV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VFMACC_VF validvreg validfreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VFMACC_VF); 
+                                entry->inst->inst_id=RISCV_VFMACC_VF;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->rsrc2=$4; 
+                                entry->inst->funct3=F3_VFMACC_VF; 
+                                entry->inst->funct7=(F6_VFMACC_VF<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VFNMACC_VV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VFNMACC_VV); 
+                                entry->inst->inst_id=RISCV_VFNMACC_VV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->rsrc2=$4; 
+                                entry->inst->funct3=F3_VFNMACC_VV; 
+                                entry->inst->funct7=(F6_VFNMACC_VV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VFNMACC_VF validvreg validfreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VFNMACC_VF); 
+                                entry->inst->inst_id=RISCV_VFNMACC_VF;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->rsrc2=$4; 
+                                entry->inst->funct3=F3_VFNMACC_VF; 
+                                entry->inst->funct7=(F6_VFNMACC_VF<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VFMSAC_VV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VFMSAC_VV); 
+                                entry->inst->inst_id=RISCV_VFMSAC_VV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->rsrc2=$4; 
+                                entry->inst->funct3=F3_VFMSAC_VV; 
+                                entry->inst->funct7=(F6_VFMSAC_VV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VFMSAC_VF validvreg validfreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VFMSAC_VF); 
+                                entry->inst->inst_id=RISCV_VFMSAC_VF;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->rsrc2=$4; 
+                                entry->inst->funct3=F3_VFMSAC_VF; 
+                                entry->inst->funct7=(F6_VFMSAC_VF<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VFNMSAC_VV validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VFNMSAC_VV); 
+                                entry->inst->inst_id=RISCV_VFNMSAC_VV;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->rsrc2=$4; 
+                                entry->inst->funct3=F3_VFNMSAC_VV; 
+                                entry->inst->funct7=(F6_VFNMSAC_VV<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VFNMSAC_VF validvreg validfreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VFNMSAC_VF); 
+                                entry->inst->inst_id=RISCV_VFNMSAC_VF;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->rsrc2=$4; 
+                                entry->inst->funct3=F3_VFNMSAC_VF; 
+                                entry->inst->funct7=(F6_VFNMSAC_VF<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VFREDUSUM_VS validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VFREDUSUM_VS); 
+                                entry->inst->inst_id=RISCV_VFREDUSUM_VS;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VFREDUSUM_VS; 
+                                entry->inst->funct7=(F6_VFREDUSUM_VS<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VFREDOSUM_VS validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VFREDOSUM_VS); 
+                                entry->inst->inst_id=RISCV_VFREDOSUM_VS;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VFREDOSUM_VS; 
+                                entry->inst->funct7=(F6_VFREDOSUM_VS<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VFREDMIN_VS validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VFREDMIN_VS); 
+                                entry->inst->inst_id=RISCV_VFREDMIN_VS;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VFREDMIN_VS; 
+                                entry->inst->funct7=(F6_VFREDMIN_VS<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VFREDMAX_VS validvreg validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VFREDMAX_VS); 
+                                entry->inst->inst_id=RISCV_VFREDMAX_VS;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                entry->inst->funct3=F3_VFREDMAX_VS; 
+                                entry->inst->funct7=(F6_VFREDMAX_VS<<1) | $5;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VFSQRT_V validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VFSQRT_V); 
+                                entry->inst->inst_id=RISCV_VFSQRT_V;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=RS1_VFSQRT_V;
+                                entry->inst->funct3=F3_VFSQRT_V; 
+                                entry->inst->funct7=(F6_VFSQRT_V<<1) | $4;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VFCVT_XU_F_V validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VFCVT_XU_F_V); 
+                                entry->inst->inst_id=RISCV_VFCVT_XU_F_V;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=RS1_VFCVT_XU_F_V;
+                                entry->inst->funct3=F3_VFCVT_XU_F_V; 
+                                entry->inst->funct7=(F6_VFCVT_XU_F_V<<1) | $4;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VFCVT_X_F_V validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VFCVT_X_F_V); 
+                                entry->inst->inst_id=RISCV_VFCVT_X_F_V;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=RS1_VFCVT_X_F_V;
+                                entry->inst->funct3=F3_VFCVT_X_F_V; 
+                                entry->inst->funct7=(F6_VFCVT_X_F_V<<1) | $4;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VFCVT_F_XU_V validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VFCVT_F_XU_V); 
+                                entry->inst->inst_id=RISCV_VFCVT_F_XU_V;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=RS1_VFCVT_F_XU_V;
+                                entry->inst->funct3=F3_VFCVT_F_XU_V; 
+                                entry->inst->funct7=(F6_VFCVT_F_XU_V<<1) | $4;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VFCVT_F_X_V validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VFCVT_F_X_V); 
+                                entry->inst->inst_id=RISCV_VFCVT_F_X_V;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=RS1_VFCVT_F_X_V;
+                                entry->inst->funct3=F3_VFCVT_F_X_V; 
+                                entry->inst->funct7=(F6_VFCVT_F_X_V<<1) | $4;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VFCVT_RTZ_XU_F_V validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VFCVT_RTZ_XU_F_V); 
+                                entry->inst->inst_id=RISCV_VFCVT_RTZ_XU_F_V;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=RS1_VFCVT_RTZ_XU_F_V;
+                                entry->inst->funct3=F3_VFCVT_RTZ_XU_F_V; 
+                                entry->inst->funct7=(F6_VFCVT_RTZ_XU_F_V<<1) | $4;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VFCVT_RTZ_X_F_V validvreg validvreg vmask {
+                                mem_entry_t *entry=new_instruction(OP_VFCVT_RTZ_X_F_V); 
+                                entry->inst->inst_id=RISCV_VFCVT_RTZ_X_F_V;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=RS1_VFCVT_RTZ_X_F_V;
+                                entry->inst->funct3=F3_VFCVT_RTZ_X_F_V; 
+                                entry->inst->funct7=(F6_VFCVT_RTZ_X_F_V<<1) | $4;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VFMV_F_S validfreg validvreg {
+                                mem_entry_t *entry=new_instruction(OP_VFMV_F_S); 
+                                entry->inst->inst_id=RISCV_VFMV_F_S;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=RS1_VFMV_F_S;
+                                entry->inst->funct3=F3_VFMV_F_S; 
+                                entry->inst->funct7=(F6_VFMV_F_S<<1) | 1;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VFMV_S_F validvreg validfreg {
+                                mem_entry_t *entry=new_instruction(OP_VFMV_S_F); 
+                                entry->inst->inst_id=RISCV_VFMV_S_F;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->rsrc2=0; 
+                                entry->inst->funct3=F3_VFMV_S_F; 
+                                entry->inst->funct7=(F6_VFMV_S_F<<1) | 1;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VFMV_V_F validvreg validfreg {
+                                mem_entry_t *entry=new_instruction(OP_VFMV_V_F); 
+                                entry->inst->inst_id=RISCV_VFMV_V_F;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc1=$3; 
+                                entry->inst->rsrc2=0; 
+                                entry->inst->funct3=F3_VFMV_V_F; 
+                                entry->inst->funct7=(F6_VFMV_V_F<<1) | 1;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    /* tested */
+    | INST_VFMERGE_VFM validvreg validvreg validfreg validvreg {
+                                mem_entry_t *entry=new_instruction(OP_VFMERGE_VFM); 
+                                entry->inst->inst_id=RISCV_VFMERGE_VFM;
+                                entry->inst->rdst=$2; 
+                                entry->inst->rsrc2=$3; 
+                                entry->inst->rsrc1=$4; 
+                                if ($5 != 0) yyerror("the merge mask operand must be $v0");
+                                entry->inst->funct3=F3_VFMERGE_VFM; 
+                                entry->inst->funct7=(F6_VFMERGE_VFM<<1) | 0;
+                                entry->status = ENTRY_COMPLETE; 
+                                $$=(void*)entry;
+                            }
+    ;
+
+validireg : IREG            {
+                                if ($1 > 31) {
+                                    yyerror("Bad int register number");
+                                } 
+                                else {
+                                    $$ = $1;
+                                }
                             }
     | LABEL                 {
                                 if ((symtab_lookup($1)!=-1)&&(symtab_type($1)==SYMTAB_IREG)){
@@ -1843,21 +7013,64 @@ validireg : IREG            {
 
 
 validfreg : FREG            {if ($1 > 31) {yyerror("Bad fp register number");} else {$$ = $1;}}
+    | FLABEL                { /* the lexer only hands out FLABEL for fp register labels */
+                                $$ = symtab_lookup($1);
+                            }
     ;
 
- /*validfreg : FREG            {if ($1 > 31) {yyerror("Bad fp register number");} else {$$ = $1;}}
-    | LABEL                 {
-                                if ((symtab_lookup($1)!=-1)&&(symtab_type($1)==SYMTAB_FREG)){
-                                    $$ = symtab_lookup($1);
-                                }
-                                else{
-                                    char buff[1000];
-                                    sprintf(buff,"Label \"%s\" failed, either the label has not "
-                                                 "been defined, or the label type is not a floating-point register.",$1);
+validvreg : VREG            {if ($1 > 31) {yyerror("Bad vector register number");} else {$$ = $1;}}
+    ;
+
+/* vtype operands: e<sew> [m<lmul>] [ta|tu] [ma|mu], defaulting to m1, tu, mu */
+vtype : VSEW vlmul vtail vmaskpol {$$ = $1 | $2 | $3 | $4;}
+    ;
+
+vlmul :                     {$$ = VLMUL_M1;}
+    | VLMUL                 {$$ = $1;}
+    ;
+
+vtail :                     {$$ = 0;}
+    | VTAIL                 {$$ = $1;}
+    ;
+
+vmaskpol :                  {$$ = 0;}
+    | VMASKPOL              {$$ = $1;}
+    ;
+
+/* optional $v0.t mask operand on vector instructions, this is the vm bit */
+vmask :                     {$$ = 1;}
+    | VMASK                 {$$ = 0;}
+    ;
+
+/* optional rounding mode on fp instructions, defaults to the dynamic mode in fcsr */
+frm :                       {$$ = FRM_DYN;}
+    | ROUNDMODE             {$$ = $1;}
+    ;
+
+/* the address of an lr, sc or amo, which takes no offset but may spell out a zero one */
+amoaddr : LBRACKET validireg RBRACKET {$$ = $2;}
+    | IIMM LBRACKET validireg RBRACKET {
+                                if ($1 != 0)
+                                    yyerror("lr, sc and the amos take no offset, only 0[reg]");
+                                $$ = $3;
+                            }
+    ;
+
+/* a csr by name (cycle, instret, mhpmcounter3, ...) or by number */
+csr : LABEL                 {
+                                $$ = csr_number($1);
+                                if ($$ < 0){
+                                    char buff[100];
+                                    snprintf(buff,sizeof(buff),"Unknown CSR name \"%s\"",$1);
                                     yyerror(buff);
                                 }
                             }
-    ;*/
+    | IIMM                  {
+                                if (($1 < 0) || ($1 > 0xfff))
+                                    yyerror("CSR number out of range, must be 0 to 0xfff");
+                                $$ = $1;
+                            }
+    ;
 
 
 fill : BYTEFILL IIMM        {mem_entry_t *entry = new_mem_entry(ENTRY_BDATA,1); entry->ivalue=$2&0xff; $$=(void*)entry;}
@@ -1866,12 +7079,41 @@ fill : BYTEFILL IIMM        {mem_entry_t *entry = new_mem_entry(ENTRY_BDATA,1);
     | LONGFILL IIMM         {mem_entry_t *entry = new_mem_entry(ENTRY_LDATA,8); entry->ivalue=$2; $$=(void*)entry;}
     | FLOATFILL FIMM        {mem_entry_t *entry = new_mem_entry(ENTRY_FDATA,4); entry->fvalue=(float)$2; $$=(void*)entry;}
     | DOUBLEFILL FIMM       {mem_entry_t *entry = new_mem_entry(ENTRY_DDATA,8); entry->dvalue=$2; $$=(void*)entry;}
+    | FLOATFILL IIMM        {mem_entry_t *entry = new_mem_entry(ENTRY_FDATA,4); entry->fvalue=(float)(int64_t)$2; $$=(void*)entry;}
+    | DOUBLEFILL IIMM       {mem_entry_t *entry = new_mem_entry(ENTRY_DDATA,8); entry->dvalue=(double)(int64_t)$2; $$=(void*)entry;}
     | STRINGZFILL STRING    {
                                 char *buff = parse_string($2);
                                 mem_entry_t *entry = new_mem_entry(ENTRY_SDATA,strlen(buff)+1); 
                                 entry->svalue=buff; 
                                 $$=(void*)entry;
                             }
+    | INCBINFILL STRING     {$$=(void*)new_blob(parse_string($2),0,-1);}
+    | INCBINFILL STRING IIMM {$$=(void*)new_blob(parse_string($2),$3,-1);}
+    | INCBINFILL STRING IIMM IIMM {$$=(void*)new_blob(parse_string($2),$3,$4);}
+    | BYTEFILL ilist        {$$=(void*)new_int_array((value_list_t*)$2,1);}
+    | HALFFILL ilist        {$$=(void*)new_int_array((value_list_t*)$2,2);}
+    | WORDFILL ilist        {$$=(void*)new_int_array((value_list_t*)$2,4);}
+    | LONGFILL ilist        {$$=(void*)new_int_array((value_list_t*)$2,8);}
+    | FLOATFILL flist       {$$=(void*)new_fp_array((value_list_t*)$2,4);}
+    | DOUBLEFILL flist      {$$=(void*)new_fp_array((value_list_t*)$2,8);}
+    | RUNFILL IIMM IIMM IIMM {$$=(void*)new_fill($2,$3,$4);}
+    | ZEROFILL IIMM         {$$=(void*)new_fill($2,1,0);}
+    | CHASEFILL IIMM IIMM IIMM {$$=(void*)new_generated(GEN_CHASE,$2,$3,$4,0,0);}
+    | RANDOMFILL IIMM IIMM IIMM {$$=(void*)new_generated(GEN_RANDOM,$2,$3,$4,0,0);}
+    | IOTAFILL IIMM IIMM IIMM IIMM {$$=(void*)new_generated(GEN_IOTA,$2,$3,0,$4,$5);}
+    ;
+
+/* two or more values -- a single value stays a plain fill entry */
+ilist : IIMM IIMM           {value_list_t *list = new_value_list(); push_ivalue(list,$1); push_ivalue(list,$2); $$=(void*)list;}
+    | ilist IIMM            {push_ivalue((value_list_t*)$1,$2); $$=$1;}
+    ;
+
+flist : fnum fnum           {value_list_t *list = new_value_list(); push_fvalue(list,$1); push_fvalue(list,$2); $$=(void*)list;}
+    | flist fnum            {push_fvalue((value_list_t*)$1,$2); $$=$1;}
+    ;
+
+fnum : FIMM                 {$$=$1;}
+    | IIMM                  {$$=(double)$1;}
     ;
 
 definition : LABEL COLON validireg {
@@ -1886,6 +7128,10 @@ definition : LABEL COLON validireg {
                                 symtab_new($1,SYMTAB_FREG);
                                 symtab_update($1,$3); 
                                 entry->name = strdup($1);
+                                /* the lookahead may already be this name, lexed as a 
+                                   plain LABEL before the definition was in the symtab */
+                                if ((yychar == LABEL) && (strcmp(yylval.string,$1) == 0))
+                                    yychar = FLABEL;
                                 $$=(void*)entry;
                             }
     | LABEL COLON inst      { /* not marked as an ENTRY_DEFINITION -- being an ENTRY_INSTRUCTION over-rides this */
@@ -1904,6 +7150,8 @@ definition : LABEL COLON validireg {
 
 int yydebug = 1;
 extern int yylineno; /* from lexer */
+extern int lex_column; /* from lexer */
+extern char *lex_file; /* from lexer */
 char * current_file;
 
 int main(int argc, char *argv[]){
@@ -1918,6 +7166,17 @@ int main(int argc, char *argv[]){
     BOOL text_mem = FALSE;
     BOOL bin_mem = FALSE;
     BOOL dump_vers = FALSE;
+    BOOL compress = FALSE;
+    BOOL relax = TRUE;
+    BOOL optimize = FALSE;
+    BOOL analyze = FALSE;
+    char *latency_file = NULL;
+    BOOL run = FALSE;
+    BOOL timing = FALSE;
+    BOOL stats = FALSE;
+    BOOL stream = FALSE;
+    BOOL disasm = FALSE;
+    char *trace_file = NULL;
 
 
     for (i=1;i<argc;i++){
@@ -1932,6 +7191,78 @@ int main(int argc, char *argv[]){
                 text_mem = TRUE;
             else if (strcmp(argv[i],"-bin") == 0)
                 bin_mem = TRUE;
+            else if (strcmp(argv[i],"-norelax") == 0)
+                relax = FALSE;
+            else if (strcmp(argv[i],"-O") == 0)
+                optimize = TRUE;
+            else if (strcmp(argv[i],"-analyze") == 0)
+                analyze = TRUE;
+            else if (strcmp(argv[i],"-run") == 0)
+                run = TRUE;
+            else if (strcmp(argv[i],"-time") == 0)
+                timing = TRUE;
+            else if (strcmp(argv[i],"-stats") == 0)
+                stats = TRUE;
+            else if (strcmp(argv[i],"-stream") == 0)
+                stream = TRUE;
+            else if (strcmp(argv[i],"-disasm") == 0)
+                disasm = TRUE;
+            else if (strcmp(argv[i],"-trace-json") == 0){
+                if (((i+1)<argc) && (argv[i+1][0] != '-')){
+                    trace_file = strdup(argv[i+1]);
+                    i++;
+                }
+                else
+                    valid_input = FALSE;
+            }
+            else if (strcmp(argv[i],"-latency") == 0){
+                if (((i+1)<argc) && (argv[i+1][0] != '-')){
+                    latency_file = strdup(argv[i+1]);
+                    i++;
+                }
+                else
+                    valid_input = FALSE;
+            }
+            else if (strcmp(argv[i],"-compress") == 0){
+                compress = TRUE;
+                inst_alignment = 2;
+            }
+            else if (strcmp(argv[i],"-relaxreg") == 0){
+                if (((i+1)<argc) && (atoi(argv[i+1]) > 0) && (atoi(argv[i+1]) < 32)){
+                    set_relax_scratch_reg(atoi(argv[i+1]));
+                    i++;
+                }
+                else
+                    valid_input = FALSE;
+            }
+            else if (strcmp(argv[i],"-litpool") == 0){
+                if (((i+1)<argc) && (atoi(argv[i+1]) > 0)){
+                    set_litpool_threshold(atoi(argv[i+1]));
+                    i++;
+                }
+                else
+                    valid_input = FALSE;
+            }
+            else if (strcmp(argv[i],"-D") == 0){
+                if (((i+1)<argc) && parse_define(argv[i+1]))
+                    i++;
+                else
+                    valid_input = FALSE;
+            }
+            else if (strcmp(argv[i],"-sweep") == 0){
+                if (((i+1)<argc) && parse_sweep(argv[i+1]))
+                    i++;
+                else
+                    valid_input = FALSE;
+            }
+            else if (strcmp(argv[i],"-cache") == 0){
+                if (((i+1)<argc) && (argv[i+1][0] != '-')){
+                    set_include_cache(argv[i+1]);
+                    i++;
+                }
+                else
+                    valid_input = FALSE;
+            }
             else if (strcmp(argv[i],"-out") == 0){
                 user_named_output = TRUE;
                 if (((i+1)<argc) && (argv[i+1][0] != '-')){
@@ -1951,6 +7282,8 @@ int main(int argc, char *argv[]){
     }
 
     if (input_file_count == 0) valid_input = FALSE;
+    if (stream && (dump_debug || elf_mem || text_mem || analyze || run)) valid_input = FALSE;
+    if (stream) bin_mem = FALSE; /* -stream writes the .bin files itself, -bin is allowed but changes nothing */
     if (!user_named_output) file_base = strdup("a");
 
     if (dump_vers){
@@ -1974,57 +7307,209 @@ int main(int argc, char *argv[]){
         fprintf(stderr,"       -bin             Outputs file to a flat memory image, as a\n");
         fprintf(stderr,"                        binary file. The file name will end with a .bin\n");
         fprintf(stderr,"                        extension.\n");
+        fprintf(stderr,"                        -text and -bin also write a .map file giving\n");
+        fprintf(stderr,"                        the source file:line:column of each address.\n");
+        fprintf(stderr,"                        ELF output carries a DWARF line table instead.\n");
+        fprintf(stderr,"       -stream          Writes the .bin files a mem() block at a time,\n");
+        fprintf(stderr,"                        as each is parsed, and patches references to\n");
+        fprintf(stderr,"                        later blocks in at the end, so only one block\n");
+        fprintf(stderr,"                        is ever in memory. Those references are not\n");
+        fprintf(stderr,"                        relaxed, and there is no .map file. Cannot be\n");
+        fprintf(stderr,"                        used with -elf, -text, -checking, -analyze,\n");
+        fprintf(stderr,"                        -run or var.\n");
+        fprintf(stderr,"       -disasm          The input files are ELF, .bin or .txt images\n");
+        fprintf(stderr,"                        instead of dt source. Their instructions are\n");
+        fprintf(stderr,"                        printed the way -checking prints them, with\n");
+        fprintf(stderr,"                        any ELF symbols as labels, and the speed in\n");
+        fprintf(stderr,"                        words per second goes to stderr.\n");
+        fprintf(stderr,"       -litpool <n>     Constants that need more than <n> instructions\n");
+        fprintf(stderr,"                        are loaded from a per mem() block literal pool\n");
+        fprintf(stderr,"                        with auipc+ld instead.\n");
+        fprintf(stderr,"       -compress        Rewrites instructions to their 16-bit RVC forms\n");
+        fprintf(stderr,"                        where possible and reports the size reduction\n");
+        fprintf(stderr,"                        of each mem() block. Branches and jumps with a\n");
+        fprintf(stderr,"                        numeric offset are left alone.\n");
+        fprintf(stderr,"       -norelax         Out of range branches and jumps are errors.\n");
+        fprintf(stderr,"                        By default a branch is inverted around a j, and\n");
+        fprintf(stderr,"                        a jal or j becomes auipc+jalr ($t1 for j).\n");
+        fprintf(stderr,"                        Relaxing a j in a mem() block that also uses\n");
+        fprintf(stderr,"                        $t1 is an error.\n");
+        fprintf(stderr,"       -relaxreg <n>    Relaxes a j through x<n> in place of $t1.\n");
+        fprintf(stderr,"       -O               Peephole optimizes straight-line code: copy\n");
+        fprintf(stderr,"                        propagation, constant folding, and removal of\n");
+        fprintf(stderr,"                        no-op and dead moves. Off by default, so the\n");
+        fprintf(stderr,"                        output matches the source instruction for\n");
+        fprintf(stderr,"                        instruction.\n");
+        fprintf(stderr,"       -analyze         Prints a static throughput report for every\n");
+        fprintf(stderr,"                        loop: dependency chains, port pressure and\n");
+        fprintf(stderr,"                        predicted cycles per iteration.\n");
+        fprintf(stderr,"       -latency <file>  Latencies and ports for -analyze are read from\n");
+        fprintf(stderr,"                        <file> instead of the built-in table.\n");
+        fprintf(stderr,"       -run             Runs the program on the built-in RV64 simulator,\n");
+        fprintf(stderr,"                        after any output files are written, and exits\n");
+        fprintf(stderr,"                        with its exit code. Instructions retired per\n");
+        fprintf(stderr,"                        label and the final registers go to stderr.\n");
+        fprintf(stderr,"       -time            Prints the time taken by each phase, lines and\n");
+        fprintf(stderr,"                        instructions per second, and the peak RSS to\n");
+        fprintf(stderr,"                        stderr.\n");
+        fprintf(stderr,"       -stats           Everything -time prints, plus entries by type,\n");
+        fprintf(stderr,"                        symbol table size and probe counts, bytes\n");
+        fprintf(stderr,"                        allocated and bytes written.\n");
+        fprintf(stderr,"       -trace-json <file>  Writes the -stats data to <file> as a\n");
+        fprintf(stderr,"                        Chrome trace event timeline.\n");
+        fprintf(stderr,"       -cache <dir>     Files read with .include are kept in <dir>\n");
+        fprintf(stderr,"                        already scanned, keyed by a hash of their\n");
+        fprintf(stderr,"                        contents, and later runs read them from there.\n");
+        fprintf(stderr,"       -D <name>=<n>    Defines <name> as the immediate <n>, for use\n");
+        fprintf(stderr,"                        anywhere an immediate can go and in .if\n");
+        fprintf(stderr,"                        conditions. -D <name> alone defines it as 1.\n");
+        fprintf(stderr,"       -sweep <name>=<lo>..<hi>[:x<k>|:+<k>]\n");
+        fprintf(stderr,"                        Assembles one variant for each value of\n");
+        fprintf(stderr,"                        <name> from <lo> to <hi>, multiplying by or\n");
+        fprintf(stderr,"                        adding <k> each time (+1 by default), or for\n");
+        fprintf(stderr,"                        each of <name>=<a>,<b>,... The sources are\n");
+        fprintf(stderr,"                        scanned once. Output names get _<name><value>\n");
+        fprintf(stderr,"                        added, and every combination of several\n");
+        fprintf(stderr,"                        -sweeps is assembled.\n");
         exit(1);
     }
+    else if (disasm){
+        exit(disassemble_files(input_files,input_file_count)); /* images, not source */
+    }
     else {
         srandom(1);
+        if (sweep_count() > 0)
+            file_base = sweep_variants(file_base,input_files,input_file_count); /* only returns in a variant's own process */
+        if (stream)
+            begin_stream(file_base,optimize,compress,relax);
         for (i=0;i<input_file_count;i++){
-            FILE *fd = fopen(input_files[i],"r");
-            if (fd){
+            FILE *fd = NULL;
+            if ((sweep_count() > 0) || (fd = fopen(input_files[i],"r"))){
+                char phase_name[256];
+                snprintf(phase_name,sizeof(phase_name),"parse %s",input_files[i]);
+                phase_begin(phase_name);
                 current_file = input_files[i];
-                yyrestart(fd);
+                current_loc.file = input_files[i];
+                lex_file = input_files[i];
+                if (fd)
+                    yyrestart(fd);
+                else
+                    replay_source(i); /* already scanned onto the tape */
                 yylineno = 1;
-                yyparse();
+                lex_column = 1;
+                /* a failed predicate on a statement name rejects the parse 
+                   without a syntax error report of its own */
+                if (yyparse() != 0)
+                    yyerror("syntax error");
+                phase_end(yylineno - 1);
             }
             else{
                 fprintf(stderr,"Could not open source file: %s\n",input_files[i]);
                 exit(1);
             }
-            fclose(fd);
+            if (fd)
+                fclose(fd);
         }
 
         current_file = strdup("<<global>>");
         yylineno = -1;
 
+        if (stream){
+            phase_begin("finish_stream");
+            finish_stream(); /* the blocks are already written, patch in their forward references */
+            phase_end(0);
+        }
+
+        phase_begin("allocate_vars");
+        allocate_vars(); /* before anything else looks at register numbers */
+        phase_end(0);
+        if (optimize){
+            phase_begin("optimize_memblocks");
+            optimize_memblocks(); /* peephole pass over the IR, only when asked for */
+            phase_end(0);
+        }
+        if (compress){
+            phase_begin("compress_memblocks");
+            compress_memblocks(); /* shrink to rvc forms, before anything uses addresses */
+            phase_end(0);
+        }
+        if (relax || compress){
+            phase_begin("relax_memblocks");
+            relax_memblocks(relax); /* re-lay out until every branch and jump reaches its target */
+            phase_end(0);
+        }
+        if (compress && !stream)
+            report_compression(); /* -stream reports each block as it goes */
+        phase_begin("check_mem_bounds");
         check_mem_bounds(); /* makes sure mem() blocks don't have overlapping addresses */
+        phase_end(0);
+        phase_begin("calculate_offsets");
         calculate_offsets(); /* calculate the offset field for any instruction that used a labeled target */
+        phase_end(0);
+        phase_begin("encode_instructions");
         encode_instructions(); /* do the actual encoding of instructions */
+        phase_end(0);
+        phase_begin("resolve_generated_data");
+        resolve_generated_data(); /* .chase and friends, now that their addresses are final */
+        phase_end(0);
 
         if(dump_debug){
             dump_pc();
+            dump_relax_stats();
+            dump_opt_stats();
+            dump_perf_tables();
+            dump_harts();
+            dump_atomic_objects();
+            dump_vars();
             print_memlist_info();
             dump_symtab();
         }
+        if (analyze)
+            analyze_memblocks(latency_file);
         if(elf_mem) {
             char *filename = (char*) malloc(strlen(file_base) + strlen(".out"));
             bzero(filename,sizeof(strlen(file_base) + strlen(".out")));
             strcat(filename,file_base);
             strcat(filename,".out");
+            phase_begin("write_elf");
             write_elf(filename);
+            phase_end(0);
         }
         if(text_mem) {
             char *filename = (char*) malloc(strlen(file_base) + strlen(".txt"));
             bzero(filename,sizeof(strlen(file_base) + strlen(".txt")));
             strcat(filename,file_base);
             strcat(filename,".txt");
+            phase_begin("write_text");
             write_text(filename);
+            phase_end(0);
         }
         if(bin_mem) {
             // only pass the base file name, since binary output 
             // can produce many files, depending on the number of 
             // memblocks
+            phase_begin("write_bin");
             write_bin(file_base);
+            phase_end(0);
+        }
+        if (text_mem || bin_mem) {
+            // the flat images have nowhere to keep a line table, 
+            // so it goes beside them
+            char *filename = (char*) malloc(strlen(file_base) + strlen(".map") + 1);
+            strcpy(filename,file_base);
+            strcat(filename,".map");
+            phase_begin("write_line_map");
+            write_line_map(filename);
+            phase_end(0);
         }
+        if (stats)
+            print_stats();
+        else if (timing)
+            print_phase_times();
+        if (trace_file)
+            write_trace_json(trace_file);
+        if (run)
+            return simulate_memblocks();
     }
 
     return 0;
@@ -2034,3 +7519,11 @@ int yyerror(const char *s){
     fprintf(stderr, "error: %s\n\tfile: %s\n\tline: %d\n", s, current_file, yylineno);
     exit(1);
 }
+
+/* for the passes after parsing, an error at the line an entry came from */
+int yyerror_at(char *file, int line, const char *s){
+    if (file)
+        current_file = file;
+    yylineno = line;
+    return yyerror(s);
+}
@@ -0,0 +1,686 @@
+/* This file is part of the DuctTape (dt) high-level assembler for 
+ * RISC-V. The dt project was written by Justin Severeid and Elliott 
+ * Forbes, University of Wisconsin-La Crosse, copyright 2020-2024.
+ *
+ * DuctTape is free software: you can redistribute it and/or modify 
+ * it under the terms of the GNU General Public License as published 
+ * by the Free Software Foundation, either version 3 of the License, 
+ * or (at your option) any later version.
+ *
+ * DuctTape is distributed in the hope that it will be useful, but 
+ * WITHOUT ANY WARRANTY; without even the implied warranty of 
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU 
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License 
+ * along with DuctTape. If not, see <https://www.gnu.org/licenses/>. 
+ *
+ *
+ *
+ * The dt project can be found at https://cs.uwlax.edu/~eforbes/dt/
+ *
+ * If you use dt in your published research, please consider 
+ * citing the following:
+ *
+ * Severeid, J. and Forbes, E., "dt: A High-level Assembler for RISC-V," 
+ * Proceedings of the 53rd Midwest Instruction and Computing Symposium, 
+ * April 2020. 
+ *
+ * If you found dt helpful, please let us know! Email eforbes@uwlax.edu
+ *
+ * There are bound to be bugs, let us know those too.
+ */
+
+
+
+/*
+ * dt-gen: writes random test programs that dt assembles and -run runs 
+ * to the end. A program is built as dt's own IR, with branches and loops 
+ * lowered the way the grammar lowers if and do-while, and is then either 
+ * printed as dt source or, with -direct, laid out, encoded and written 
+ * without a text step.
+ *
+ * Every program is valid by construction:
+ * - loads and stores mask their address into a .random data area, so 
+ *   they stay in it and are aligned to their size
+ * - each loop counts its own register down from -trip, and no random op 
+ *   writes the counters, the mask or the base of the data area
+ * - forward branches skip straight-line code only, so every label a 
+ *   branch names is at the top level of a loop body or the program
+ * - the program ends with an exit call
+ *
+ * The same settings and seed always give the same program, and the first 
+ * line of the source is the dt-gen command line that writes it again.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <inttypes.h>
+
+#include "riscvarch.h"
+#include "gen.h"
+#include "imm.h"
+#include "inst.h"
+#include "mem.h"
+#include "output.h"
+#include "pc.h"
+#include "perf.h"
+#include "relax.h"
+#include "symtab.h"
+#include "util.h"
+
+#define DTGEN_START 0x10000  /* $pc and the address of the one mem() block */
+#define DTGEN_LOOP_REG 18    // $s2, the outermost loop counter, $s3 the next...
+#define DTGEN_MAX_NEST 7     /* ...up to $s8 */
+#define DTGEN_ADDR_REG 25    // $s9
+#define DTGEN_MASK_REG 26    // $s10, footprint - 8
+#define DTGEN_BASE_REG 27    // $s11, @data
+#define DTGEN_HISTORY 64     /* destinations remembered for -dep */
+#define DTGEN_IF_MAX 8       /* a forward branch skips 1 to 8 ops */
+#define DTGEN_LOOP_MIN 4     /* a loop body is 4 to 32 ops */
+#define DTGEN_LOOP_MAX 32
+
+typedef enum {
+    CLASS_ALU,
+    CLASS_MUL,
+    CLASS_DIV,
+    CLASS_LOAD,
+    CLASS_STORE,
+    CLASS_FP,
+    CLASS_COUNT,
+    CLASS_NONE    /* only made by the lowerings, never drawn */
+} op_class_t;
+
+static const char *class_names[CLASS_COUNT] = {"alu","mul","div","load","store","fp"};
+
+typedef enum {
+    FORM_R,       /* add $x, $x, $x */
+    FORM_I,       /* addi $x, $x, imm */
+    FORM_SHIFT,   /* slli $x, $x, shamt */
+    FORM_U,       /* lui $x, imm */
+    FORM_LOAD,    /* ld $x, imm[$x] */
+    FORM_STORE,   /* sd $x, imm[$x] */
+    FORM_BRANCH,  /* bne $x, $x, name */
+    FORM_FR,      /* fadd.d $f, $f, $f */
+    FORM_FR4,     /* fmadd.d $f, $f, $f, $f */
+    FORM_FLOAD,   /* fld $f, imm[$x] */
+    FORM_FSTORE,  /* fsd $f, imm[$x] */
+    FORM_TO_FP,   /* fcvt.d.l $f, $x */
+    FORM_FROM_FP, /* fcvt.l.d $x, $f */
+    FORM_NONE     /* ecall */
+} form_t;
+
+typedef struct {
+    const char *name;
+    int inst_id;
+    uint32_t opcode;
+    uint32_t funct3;
+    uint32_t funct7;
+    uint32_t rs2;      /* the fixed rs2 field of the fcvts */
+    form_t form;
+    op_class_t class;
+    uint32_t width;    /* the bytes a load or store moves */
+} gen_op_t;
+
+/* the ops dt-gen makes, with the fields the grammar gives them */
+static const gen_op_t ops[] = {
+    {"add",      RISCV_ADD,      OP_ADD,      F3_ADD,   F7_ADD,      0,            FORM_R,       CLASS_ALU,   0},
+    {"sub",      RISCV_SUB,      OP_SUB,      F3_SUB,   F7_SUB,      0,            FORM_R,       CLASS_ALU,   0},
+    {"and",      RISCV_AND,      OP_AND,      F3_AND,   F7_AND,      0,            FORM_R,       CLASS_ALU,   0},
+    {"or",       RISCV_OR,       OP_OR,       F3_OR,    F7_OR,       0,            FORM_R,       CLASS_ALU,   0},
+    {"xor",      RISCV_XOR,      OP_XOR,      F3_XOR,   F7_XOR,      0,            FORM_R,       CLASS_ALU,   0},
+    {"sll",      RISCV_SLL,      OP_SLL,      F3_SLL,   F7_SLL,      0,            FORM_R,       CLASS_ALU,   0},
+    {"srl",      RISCV_SRL,      OP_SRL,      F3_SRL,   F7_SRL,      0,            FORM_R,       CLASS_ALU,   0},
+    {"sra",      RISCV_SRA,      OP_SRA,      F3_SRA,   F7_SRA,      0,            FORM_R,       CLASS_ALU,   0},
+    {"slt",      RISCV_SLT,      OP_SLT,      F3_SLT,   F7_SLT,      0,            FORM_R,       CLASS_ALU,   0},
+    {"sltu",     RISCV_SLTU,     OP_SLTU,     F3_SLTU,  F7_SLTU,     0,            FORM_R,       CLASS_ALU,   0},
+    {"addw",     RISCV_ADDW,     OP_ADDW,     F3_ADDW,  F7_ADDW,     0,            FORM_R,       CLASS_ALU,   0},
+    {"subw",     RISCV_SUBW,     OP_SUBW,     F3_SUBW,  F7_SUBW,     0,            FORM_R,       CLASS_ALU,   0},
+    {"addi",     RISCV_ADDI,     OP_ADDI,     F3_ADDI,  0,           0,            FORM_I,       CLASS_ALU,   0},
+    {"andi",     RISCV_ANDI,     OP_ANDI,     F3_ANDI,  0,           0,            FORM_I,       CLASS_ALU,   0},
+    {"ori",      RISCV_ORI,      OP_ORI,      F3_ORI,   0,           0,            FORM_I,       CLASS_ALU,   0},
+    {"xori",     RISCV_XORI,     OP_XORI,     F3_XORI,  0,           0,            FORM_I,       CLASS_ALU,   0},
+    {"slti",     RISCV_SLTI,     OP_SLTI,     F3_SLTI,  0,           0,            FORM_I,       CLASS_ALU,   0},
+    {"addiw",    RISCV_ADDIW,    OP_ADDIW,    F3_ADDIW, 0,           0,            FORM_I,       CLASS_ALU,   0},
+    {"slli",     RISCV_SLLI,     OP_SLLI,     F3_SLLI,  F7_SLLI,     0,            FORM_SHIFT,   CLASS_ALU,   0},
+    {"srli",     RISCV_SRLI,     OP_SRLI,     F3_SRLI,  F7_SRLI,     0,            FORM_SHIFT,   CLASS_ALU,   0},
+    {"srai",     RISCV_SRAI,     OP_SRAI,     F3_SRAI,  F7_SRAI,     0,            FORM_SHIFT,   CLASS_ALU,   0},
+    {"mul",      RISCV_MUL,      OP_MUL,      F3_MUL,   F7_MUL,      0,            FORM_R,       CLASS_MUL,   0},
+    {"mulh",     RISCV_MULH,     OP_MULH,     F3_MULH,  F7_MULH,     0,            FORM_R,       CLASS_MUL,   0},
+    {"mulhu",    RISCV_MULHU,    OP_MULHU,    F3_MULHU, F7_MULHU,    0,            FORM_R,       CLASS_MUL,   0},
+    {"mulw",     RISCV_MULW,     OP_MULW,     F3_MULW,  F7_MULW,     0,            FORM_R,       CLASS_MUL,   0},
+    {"div",      RISCV_DIV,      OP_DIV,      F3_DIV,   F7_DIV,      0,            FORM_R,       CLASS_DIV,   0},
+    {"divu",     RISCV_DIVU,     OP_DIVU,     F3_DIVU,  F7_DIVU,     0,            FORM_R,       CLASS_DIV,   0},
+    {"rem",      RISCV_REM,      OP_REM,      F3_REM,   F7_REM,      0,            FORM_R,       CLASS_DIV,   0},
+    {"remu",     RISCV_REMU,     OP_REMU,     F3_REMU,  F7_REMU,     0,            FORM_R,       CLASS_DIV,   0},
+    {"divw",     RISCV_DIVW,     OP_DIVW,     F3_DIVW,  F7_DIVW,     0,            FORM_R,       CLASS_DIV,   0},
+    {"remw",     RISCV_REMW,     OP_REMW,     F3_REMW,  F7_REMW,     0,            FORM_R,       CLASS_DIV,   0},
+    {"ld",       RISCV_LD,       OP_LD,       F3_LD,    0,           0,            FORM_LOAD,    CLASS_LOAD,  8},
+    {"lw",       RISCV_LW,       OP_LW,       F3_LW,    0,           0,            FORM_LOAD,    CLASS_LOAD,  4},
+    {"lwu",      RISCV_LWU,      OP_LWU,      F3_LWU,   0,           0,            FORM_LOAD,    CLASS_LOAD,  4},
+    {"lh",       RISCV_LH,       OP_LH,       F3_LH,    0,           0,            FORM_LOAD,    CLASS_LOAD,  2},
+    {"lhu",      RISCV_LHU,      OP_LHU,      F3_LHU,   0,           0,            FORM_LOAD,    CLASS_LOAD,  2},
+    {"lb",       RISCV_LB,       OP_LB,       F3_LB,    0,           0,            FORM_LOAD,    CLASS_LOAD,  1},
+    {"lbu",      RISCV_LBU,      OP_LBU,      F3_LBU,   0,           0,            FORM_LOAD,    CLASS_LOAD,  1},
+    {"fld",      RISCV_FLD,      OP_FLD,      F3_FLD,   0,           0,            FORM_FLOAD,   CLASS_LOAD,  8},
+    {"sd",       RISCV_SD,       OP_SD,       F3_SD,    0,           0,            FORM_STORE,   CLASS_STORE, 8},
+    {"sw",       RISCV_SW,       OP_SW,       F3_SW,    0,           0,            FORM_STORE,   CLASS_STORE, 4},
+    {"sh",       RISCV_SH,       OP_SH,       F3_SH,    0,           0,            FORM_STORE,   CLASS_STORE, 2},
+    {"sb",       RISCV_SB,       OP_SB,       F3_SB,    0,           0,            FORM_STORE,   CLASS_STORE, 1},
+    {"fsd",      RISCV_FSD,      OP_FSD,      F3_FSD,   0,           0,            FORM_FSTORE,  CLASS_STORE, 8},
+    {"fadd.d",   RISCV_FADD_D,   OP_FADD_D,   FRM_DYN,  F7_FADD_D,   0,            FORM_FR,      CLASS_FP,    0},
+    {"fsub.d",   RISCV_FSUB_D,   OP_FSUB_D,   FRM_DYN,  F7_FSUB_D,   0,            FORM_FR,      CLASS_FP,    0},
+    {"fmul.d",   RISCV_FMUL_D,   OP_FMUL_D,   FRM_DYN,  F7_FMUL_D,   0,            FORM_FR,      CLASS_FP,    0},
+    {"fmin.d",   RISCV_FMIN_D,   OP_FMIN_D,   F3_FMIN_D,F7_FMIN_D,   0,            FORM_FR,      CLASS_FP,    0},
+    {"fmax.d",   RISCV_FMAX_D,   OP_FMAX_D,   F3_FMAX_D,F7_FMAX_D,   0,            FORM_FR,      CLASS_FP,    0},
+    {"fmadd.d",  RISCV_FMADD_D,  OP_FMADD_D,  FRM_DYN,  F7_FMADD_D,  0,            FORM_FR4,     CLASS_FP,    0},
+    {"fcvt.d.l", RISCV_FCVT_D_L, OP_FCVT_D_L, FRM_DYN,  F7_FCVT_D_L, RS2_FCVT_D_L, FORM_TO_FP,   CLASS_FP,    0},
+    {"fcvt.l.d", RISCV_FCVT_L_D, OP_FCVT_L_D, FRM_DYN,  F7_FCVT_L_D, RS2_FCVT_L_D, FORM_FROM_FP, CLASS_FP,    0},
+    {"beq",      RISCV_BEQ,      OP_BEQ,      F3_BEQ,   0,           0,            FORM_BRANCH,  CLASS_NONE,  0},
+    {"bne",      RISCV_BNE,      OP_BNE,      F3_BNE,   0,           0,            FORM_BRANCH,  CLASS_NONE,  0},
+    {"blt",      RISCV_BLT,      OP_BLT,      F3_BLT,   0,           0,            FORM_BRANCH,  CLASS_NONE,  0},
+    {"bge",      RISCV_BGE,      OP_BGE,      F3_BGE,   0,           0,            FORM_BRANCH,  CLASS_NONE,  0},
+    {"bltu",     RISCV_BLTU,     OP_BLTU,     F3_BLTU,  0,           0,            FORM_BRANCH,  CLASS_NONE,  0},
+    {"bgeu",     RISCV_BGEU,     OP_BGEU,     F3_BGEU,  0,           0,            FORM_BRANCH,  CLASS_NONE,  0},
+    {"lui",      RISCV_LUI,      OP_LUI,      0,        0,           0,            FORM_U,       CLASS_NONE,  0},
+    {"ecall",    RISCV_ECALL,    OP_ECALL,    F3_ECALL, 0,           0,            FORM_NONE,    CLASS_NONE,  0}
+};
+#define OP_COUNT (sizeof(ops) / sizeof(ops[0]))
+
+/* what random ops read and write: not $zero, $ra, $sp, $gp or $tp, and none of $s2-$s11 */
+static const uint32_t int_pool[] = {5,6,7,8,9,10,11,12,13,14,15,16,17,28,29,30,31};
+#define INT_POOL (sizeof(int_pool) / sizeof(int_pool[0]))
+#define FP_POOL 32
+
+/* the settings, -mix weights default to a hand written test case's */
+static uint64_t seed = 1;
+static uint64_t op_count = 1000;
+static uint64_t mix[CLASS_COUNT] = {8,2,1,3,2,2};
+static uint64_t dep = 4;
+static uint64_t branch_pct = 10;
+static uint64_t loop_pct = 2;
+static uint64_t nest = 2;
+static uint64_t trip = 4;
+static uint64_t footprint = 4096;
+
+static uint64_t state;        /* everything is drawn from one splitmix64 stream */
+static uint64_t mix_total;
+static uint32_t label_count = 0;
+
+/* the last destinations written, for -dep */
+typedef struct {
+    uint32_t regs[DTGEN_HISTORY];
+    uint64_t written;
+} history_t;
+
+static history_t int_history;
+static history_t fp_history;
+
+static const gen_op_t *find_op(int inst_id){
+    uint32_t i;
+    for (i=0;i<OP_COUNT;i++)
+        if (ops[i].inst_id == inst_id)
+            return &ops[i];
+    return NULL;
+}
+
+static mem_entry_t *new_op(const gen_op_t *op, uint32_t rd, uint32_t rs1, uint32_t rs2, int32_t imm){
+    mem_entry_t *entry = new_instruction(op->opcode);
+    entry->inst->inst_id = op->inst_id;
+    entry->inst->funct3 = op->funct3;
+    entry->inst->funct7 = op->funct7;
+    entry->inst->rdst = rd;
+    entry->inst->rsrc1 = rs1;
+    entry->inst->rsrc2 = rs2;
+    entry->inst->imm = imm;
+    entry->status = ENTRY_COMPLETE;
+    return entry;
+}
+
+/* a name for a branch target, in the symbol table like the grammar's */
+static char *new_label(const char *kind){
+    char name[32];
+    snprintf(name,sizeof(name),"%s%u",kind,++label_count);
+    symtab_new(name,SYMTAB_MEM);
+    return strdup(name);
+}
+
+/* a register to read: on average the one written dep ops back, or any of the pool */
+static uint32_t pick_source(history_t *history, BOOL fp){
+    if ((dep > 0) && (history->written > 0)){
+        uint64_t back = 1 + random_below(&state,2*dep - 1);
+        if (back <= history->written)
+            return history->regs[(history->written - back) % DTGEN_HISTORY];
+    }
+    return fp ? random_below(&state,FP_POOL) : int_pool[random_below(&state,INT_POOL)];
+}
+
+/* a register to write, picked after the sources so that a distance of one is the op before */
+static uint32_t pick_dest(history_t *history, BOOL fp){
+    uint32_t reg = fp ? random_below(&state,FP_POOL) : int_pool[random_below(&state,INT_POOL)];
+    history->regs[history->written++ % DTGEN_HISTORY] = reg;
+    return reg;
+}
+
+static int32_t random_imm(){
+    return (int32_t)random_below(&state,4096) - 2048;
+}
+
+/* $s9 = (addr & mask) + @data, a slot of the data area picked by a register */
+static mem_entry_t *data_address(uint32_t addr){
+    mem_entry_t *list = new_op(find_op(RISCV_AND),DTGEN_ADDR_REG,addr,DTGEN_MASK_REG,0);
+    return append_inst(list,gen_add(DTGEN_ADDR_REG,DTGEN_ADDR_REG,DTGEN_BASE_REG));
+}
+
+/* an offset into the 8 byte slot that keeps the access aligned */
+static int32_t slot_offset(const gen_op_t *op){
+    return (int32_t)(random_below(&state,8 / op->width) * op->width);
+}
+
+static mem_entry_t *random_op(){
+    uint64_t pick = random_below(&state,mix_total);
+    const gen_op_t *choices[OP_COUNT];
+    const gen_op_t *op;
+    uint32_t count = 0;
+    mem_entry_t *list;
+    mem_entry_t *entry;
+    uint32_t rs1, rs2, rs3, addr;
+    int class = 0;
+    uint32_t i;
+
+    while (pick >= mix[class])
+        pick -= mix[class++];
+    for (i=0;i<OP_COUNT;i++){
+        if (ops[i].class != (op_class_t)class)
+            continue;
+        if (((ops[i].form == FORM_FLOAD) || (ops[i].form == FORM_FSTORE)) && (mix[CLASS_FP] == 0))
+            continue; /* no floating point at all unless the mix asks for some */
+        choices[count++] = &ops[i];
+    }
+    op = choices[random_below(&state,count)];
+
+    switch (op->form){
+        case FORM_R:
+            rs1 = pick_source(&int_history,FALSE);
+            rs2 = pick_source(&int_history,FALSE);
+            return new_op(op,pick_dest(&int_history,FALSE),rs1,rs2,0);
+        case FORM_I:
+            rs1 = pick_source(&int_history,FALSE);
+            return new_op(op,pick_dest(&int_history,FALSE),rs1,0,random_imm());
+        case FORM_SHIFT:
+            rs1 = pick_source(&int_history,FALSE);
+            return new_op(op,pick_dest(&int_history,FALSE),rs1,random_below(&state,64),0);
+        case FORM_LOAD:
+        case FORM_FLOAD:
+            list = data_address(pick_source(&int_history,FALSE));
+            if (op->form == FORM_LOAD)
+                entry = new_op(op,pick_dest(&int_history,FALSE),DTGEN_ADDR_REG,0,slot_offset(op));
+            else
+                entry = new_op(op,pick_dest(&fp_history,TRUE),DTGEN_ADDR_REG,0,slot_offset(op));
+            return append_inst(list,entry);
+        case FORM_STORE:
+        case FORM_FSTORE:
+            addr = pick_source(&int_history,FALSE);
+            rs2 = (op->form == FORM_STORE) ? pick_source(&int_history,FALSE) : pick_source(&fp_history,TRUE);
+            list = data_address(addr);
+            return append_inst(list,new_op(op,0,DTGEN_ADDR_REG,rs2,slot_offset(op)));
+        case FORM_FR:
+            rs1 = pick_source(&fp_history,TRUE);
+            rs2 = pick_source(&fp_history,TRUE);
+            return new_op(op,pick_dest(&fp_history,TRUE),rs1,rs2,0);
+        case FORM_FR4:
+            rs1 = pick_source(&fp_history,TRUE);
+            rs2 = pick_source(&fp_history,TRUE);
+            rs3 = pick_source(&fp_history,TRUE);
+            entry = new_op(op,pick_dest(&fp_history,TRUE),rs1,rs2,0);
+            entry->inst->rsrc3 = rs3;
+            return entry;
+        case FORM_TO_FP:
+            rs1 = pick_source(&int_history,FALSE);
+            return new_op(op,pick_dest(&fp_history,TRUE),rs1,op->rs2,0);
+        case FORM_FROM_FP:
+            rs1 = pick_source(&fp_history,TRUE);
+            return new_op(op,pick_dest(&int_history,FALSE),rs1,op->rs2,0);
+        default:
+            yyerror("Internal error: dt-gen drew an op it cannot make");
+    }
+    return NULL;
+}
+
+/* if (cond) { ops }, lowered as the grammar does: a branch over the body to a join node */
+static mem_entry_t *forward_branch(uint64_t count){
+    const gen_op_t *op = find_op(RISCV_BEQ + random_below(&state,6)); /* beq to bgeu */
+    uint32_t rs1 = pick_source(&int_history,FALSE);
+    uint32_t rs2 = pick_source(&int_history,FALSE);
+    mem_entry_t *join_node = new_mem_entry(ENTRY_JOIN_NODE,0);
+    mem_entry_t *list;
+
+    join_node->name = new_label("skip");
+    list = gen_branch(op->inst_id,op->opcode,op->funct3,rs1,rs2,join_node->name);
+    while (count--)
+        list = append_inst(list,random_op());
+    return append_inst(list,join_node);
+}
+
+static mem_entry_t *random_ops(uint64_t, uint32_t);
+
+/* the body -trip times, lowered as a do-while on a counter of its own */
+static mem_entry_t *counted_loop(uint64_t count, uint32_t depth){
+    uint32_t counter = DTGEN_LOOP_REG + depth;
+    mem_entry_t *list = gen_imm_op(RISCV_ADDI,OP_ADDI,F3_ADDI,counter,0,trip);
+    mem_entry_t *body = random_ops(count,depth + 1);
+
+    /* the bottom branch targets the first op of the body */
+    if (!body->name)
+        body->name = new_label("loop");
+    list = append_inst(list,body);
+    list = append_inst(list,gen_imm_op(RISCV_ADDI,OP_ADDI,F3_ADDI,counter,counter,-1));
+    return append_inst(list,gen_branch(RISCV_BNE,OP_BNE,F3_BNE,counter,0,body->name));
+}
+
+/* count random ops, some of them inside forward branches and loops */
+static mem_entry_t *random_ops(uint64_t count, uint32_t depth){
+    mem_entry_t *list = NULL;
+    uint64_t size;
+
+    while (count > 0){
+        if ((depth < nest) && (count >= DTGEN_LOOP_MIN) && (random_below(&state,100) < loop_pct)){
+            size = DTGEN_LOOP_MIN + random_below(&state,DTGEN_LOOP_MAX - DTGEN_LOOP_MIN + 1);
+            if (size > count)
+                size = count;
+            list = append_inst(list,counted_loop(size,depth));
+        }
+        else if (random_below(&state,100) < branch_pct){
+            size = 1 + random_below(&state,DTGEN_IF_MAX);
+            if (size > count)
+                size = count;
+            list = append_inst(list,forward_branch(size));
+        }
+        else {
+            size = 1;
+            list = append_inst(list,random_op());
+        }
+        count -= size;
+    }
+    return list;
+}
+
+/* the whole mem() block: set up, the random ops, exit, and the data area */
+static mem_entry_t *random_program(){
+    mem_entry_t *list;
+    mem_entry_t *data;
+    uint32_t i;
+
+    symtab_new("data",SYMTAB_MEM);
+    list = gen_address(DTGEN_BASE_REG,"data");
+    list = append_inst(list,load_immediate(DTGEN_MASK_REG,footprint - 8));
+    for (i=0;i<INT_POOL;i++)
+        list = append_inst(list,gen_imm_op(RISCV_ADDI,OP_ADDI,F3_ADDI,int_pool[i],0,random_imm()));
+    list = append_inst(list,random_ops(op_count,0));
+    list = append_inst(list,gen_imm_op(RISCV_ADDI,OP_ADDI,F3_ADDI,17,0,93)); /* exit($a0) */
+    list = append_inst(list,new_op(find_op(RISCV_ECALL),0,0,0,0));
+    data = new_generated(GEN_RANDOM,footprint / 8,8,seed,0,0);
+    data->name = strdup("data");
+    list = append_inst(list,data);
+    layout_memblock(list,DTGEN_START);
+    return list;
+}
+
+/* the settings, as the dt-gen flags that make the same program */
+static void sprint_settings(char *buff, size_t size){
+    size_t used;
+    int i;
+
+    used = snprintf(buff,size,"-seed %" PRIu64 " -n %" PRIu64 " -mix ",seed,op_count);
+    for (i=0;i<CLASS_COUNT;i++)
+        used += snprintf(buff + used,size - used,"%s%s=%" PRIu64,i ? "," : "",class_names[i],mix[i]);
+    snprintf(buff + used,size - used," -dep %" PRIu64 " -branch %" PRIu64 " -loop %" PRIu64 " -nest %" PRIu64 " -trip %" PRIu64 " -footprint %" PRIu64,
+        dep,branch_pct,loop_pct,nest,trip,footprint);
+}
+
+static void write_inst(FILE *out, mem_entry_t *entry){
+    instruction_t *inst = entry->inst;
+    const gen_op_t *op = find_op(inst->inst_id);
+
+    switch (op->form){
+        case FORM_R:
+            fprintf(out,"    %s $x%u, $x%u, $x%u\n",op->name,inst->rdst,inst->rsrc1,inst->rsrc2);
+            break;
+        case FORM_I:
+            fprintf(out,"    %s $x%u, $x%u, %d\n",op->name,inst->rdst,inst->rsrc1,inst->imm);
+            break;
+        case FORM_SHIFT:
+            fprintf(out,"    %s $x%u, $x%u, %u\n",op->name,inst->rdst,inst->rsrc1,inst->rsrc2);
+            break;
+        case FORM_U:
+            fprintf(out,"    %s $x%u, %d\n",op->name,inst->rdst,inst->imm);
+            break;
+        case FORM_LOAD:
+            fprintf(out,"    %s $x%u, %d[$x%u]\n",op->name,inst->rdst,inst->imm,inst->rsrc1);
+            break;
+        case FORM_STORE:
+            fprintf(out,"    %s $x%u, %d[$x%u]\n",op->name,inst->rsrc2,inst->imm,inst->rsrc1);
+            break;
+        case FORM_BRANCH:
+            fprintf(out,"    %s $x%u, $x%u, %s\n",op->name,inst->rsrc1,inst->rsrc2,inst->target_name);
+            break;
+        case FORM_FR:
+            fprintf(out,"    %s $f%u, $f%u, $f%u\n",op->name,inst->rdst,inst->rsrc1,inst->rsrc2);
+            break;
+        case FORM_FR4:
+            fprintf(out,"    %s $f%u, $f%u, $f%u, $f%u\n",op->name,inst->rdst,inst->rsrc1,inst->rsrc2,inst->rsrc3);
+            break;
+        case FORM_FLOAD:
+            fprintf(out,"    %s $f%u, %d[$x%u]\n",op->name,inst->rdst,inst->imm,inst->rsrc1);
+            break;
+        case FORM_FSTORE:
+            fprintf(out,"    %s $f%u, %d[$x%u]\n",op->name,inst->rsrc2,inst->imm,inst->rsrc1);
+            break;
+        case FORM_TO_FP:
+            fprintf(out,"    %s $f%u, $x%u\n",op->name,inst->rdst,inst->rsrc1);
+            break;
+        case FORM_FROM_FP:
+            fprintf(out,"    %s $x%u, $f%u\n",op->name,inst->rdst,inst->rsrc1);
+            break;
+        case FORM_NONE:
+            fprintf(out,"    %s\n",op->name);
+            break;
+    }
+}
+
+/* the IR as dt source, which dt parses back into the same IR */
+static void write_source(FILE *out, mem_entry_t *list){
+    char settings[512];
+    mem_entry_t *working;
+
+    sprint_settings(settings,sizeof(settings));
+    fprintf(out,"# dt-gen %s\n\n",settings);
+    fprintf(out,"$pc = 0x%x\n\nmem (0x%x) {\n",DTGEN_START,DTGEN_START);
+    for (working = list; working; working = working->next){
+        if (working->name)
+            fprintf(out,"%s:\n",working->name);
+        if (working->type == ENTRY_GEN)
+            fprintf(out,"    .random %u, %u, %" PRIu64 "\n",working->size / working->array->width,working->array->width,working->array->seed);
+        else if (working->type != ENTRY_INSTRUCTION)
+            continue; /* join nodes are only their label */
+        else if ((working->inst->inst_id == RISCV_LUI) && working->inst->target_name){
+            /* gen_address() is the lui and addiw of $x = @name */
+            fprintf(out,"    $x%u = @%s\n",working->inst->rdst,working->inst->target_name);
+            working = working->next;
+        }
+        else
+            write_inst(out,working);
+    }
+    fprintf(out,"}\n");
+}
+
+/* the value of a numeric flag, FALSE if it is missing or not a whole number */
+static BOOL parse_number(char *text, uint64_t *value){
+    char *end;
+    if (!text || (*text < '0') || (*text > '9'))
+        return FALSE;
+    *value = strtoull(text,&end,0);
+    return *end == '\0';
+}
+
+/* -mix alu=8,load=3,...: the classes left out are not drawn */
+static BOOL parse_mix(char *spec){
+    char *copy = strdup(spec);
+    char *item;
+    BOOL valid = TRUE;
+    int i;
+
+    for (i=0;i<CLASS_COUNT;i++)
+        mix[i] = 0;
+    for (item = strtok(copy,","); item && valid; item = strtok(NULL,",")){
+        char *weight = strchr(item,'=');
+        if (weight)
+            *weight++ = '\0';
+        for (i=0;i<CLASS_COUNT;i++)
+            if (strcmp(item,class_names[i]) == 0)
+                break;
+        valid = weight && (i < CLASS_COUNT) && parse_number(weight,&mix[i]);
+    }
+    free(copy);
+    return valid;
+}
+
+int main(int argc, char *argv[]){
+    int i;
+    BOOL valid_input = TRUE;
+    BOOL direct = FALSE;
+    BOOL elf_mem = FALSE;
+    char *file_base = NULL;
+    mem_entry_t *program;
+
+    for (i=1;i<argc;i++){
+        char *value = ((i+1) < argc) ? argv[i+1] : NULL;
+        if (strcmp(argv[i],"-direct") == 0)
+            direct = TRUE;
+        else if (strcmp(argv[i],"-elf") == 0)
+            elf_mem = TRUE;
+        else if (strcmp(argv[i],"-out") == 0){
+            if (value && (value[0] != '-')){
+                file_base = strdup(value);
+                i++;
+            }
+            else
+                valid_input = FALSE;
+        }
+        else if (strcmp(argv[i],"-mix") == 0){
+            if (value && parse_mix(value))
+                i++;
+            else
+                valid_input = FALSE;
+        }
+        else if (((strcmp(argv[i],"-seed") == 0) && parse_number(value,&seed)) ||
+                 ((strcmp(argv[i],"-n") == 0) && parse_number(value,&op_count)) ||
+                 ((strcmp(argv[i],"-dep") == 0) && parse_number(value,&dep)) ||
+                 ((strcmp(argv[i],"-branch") == 0) && parse_number(value,&branch_pct)) ||
+                 ((strcmp(argv[i],"-loop") == 0) && parse_number(value,&loop_pct)) ||
+                 ((strcmp(argv[i],"-nest") == 0) && parse_number(value,&nest)) ||
+                 ((strcmp(argv[i],"-trip") == 0) && parse_number(value,&trip)) ||
+                 ((strcmp(argv[i],"-footprint") == 0) && parse_number(value,&footprint)))
+            i++;
+        else
+            valid_input = FALSE;
+    }
+
+    mix_total = 0;
+    for (i=0;i<CLASS_COUNT;i++)
+        mix_total += mix[i];
+    if (mix_total == 0) valid_input = FALSE;
+    if (dep > DTGEN_HISTORY / 2) valid_input = FALSE;
+    if ((branch_pct > 100) || (loop_pct > 100)) valid_input = FALSE;
+    if (nest > DTGEN_MAX_NEST) valid_input = FALSE;
+    if ((trip < 1) || (trip > 2047)) valid_input = FALSE;
+    if ((footprint < 64) || (footprint > (1ull << 30)) || (footprint & (footprint - 1))) valid_input = FALSE;
+    if (elf_mem && !direct) valid_input = FALSE;
+
+    if (!valid_input){
+        fprintf(stderr,"usage: %s [flags]\n\n",argv[0]);
+        fprintf(stderr,"       Writes a random dt program that assembles and runs to its\n");
+        fprintf(stderr,"       exit call, to stdout or to <outfile>.dt.\n\n");
+        fprintf(stderr,"       -seed <n>        The program is the same for the same seed and\n");
+        fprintf(stderr,"                        flags. The default is 1.\n");
+        fprintf(stderr,"       -n <n>           Random ops to make, 1000 by default. Loads and\n");
+        fprintf(stderr,"                        stores are one op of three instructions.\n");
+        fprintf(stderr,"       -mix <class=weight,...>\n");
+        fprintf(stderr,"                        How often each class of op is drawn, from alu,\n");
+        fprintf(stderr,"                        mul, div, load, store and fp. Classes left out\n");
+        fprintf(stderr,"                        are not drawn. The default is\n");
+        fprintf(stderr,"                        alu=8,mul=2,div=1,load=3,store=2,fp=2.\n");
+        fprintf(stderr,"       -dep <n>         Sources are the destination of the op <n> back\n");
+        fprintf(stderr,"                        on average, 4 by default, at most 32. With 0\n");
+        fprintf(stderr,"                        every source is picked at random.\n");
+        fprintf(stderr,"       -branch <pct>    The percentage of ops that start a forward\n");
+        fprintf(stderr,"                        branch over the next 1 to 8 ops, 10 by default.\n");
+        fprintf(stderr,"       -loop <pct>      The percentage of ops that start a loop of 4 to\n");
+        fprintf(stderr,"                        32 ops, 2 by default.\n");
+        fprintf(stderr,"       -nest <n>        Loops nest at most <n> deep, 2 by default, at\n");
+        fprintf(stderr,"                        most 7. With 0 there are no loops.\n");
+        fprintf(stderr,"       -trip <n>        Every loop runs <n> times, 4 by default.\n");
+        fprintf(stderr,"       -footprint <n>   Bytes of data that loads and stores touch, a\n");
+        fprintf(stderr,"                        power of two from 64, 4096 by default.\n");
+        fprintf(stderr,"       -out <outfile>   Write <outfile>.dt rather than stdout.\n");
+        fprintf(stderr,"       -direct          Skip the source: lay out, encode and write the\n");
+        fprintf(stderr,"                        program as dt -bin would, to <outfile>-0.bin,\n");
+        fprintf(stderr,"                        with <outfile> \"a\" if -out is not used.\n");
+        fprintf(stderr,"       -elf             With -direct, also write <outfile>.out.\n");
+        exit(1);
+    }
+
+    state = seed;
+    program = random_program();
+
+    if (!direct){
+        FILE *out = stdout;
+        if (file_base){
+            char *filename = (char*) malloc(strlen(file_base) + strlen(".dt") + 1);
+            strcpy(filename,file_base);
+            strcat(filename,".dt");
+            if (!(out = fopen(filename,"w"))){
+                fprintf(stderr,"Could not open output file: %s\n",filename);
+                exit(1);
+            }
+        }
+        write_source(out,program);
+        if (out != stdout)
+            fclose(out);
+        return 0;
+    }
+
+    /* the passes dt runs on a parsed program, less the ones these programs never need */
+    if (!file_base)
+        file_base = strdup("a");
+    set_pc(DTGEN_START);
+    add_memblock(program);
+    relax_memblocks(TRUE);
+    check_mem_bounds();
+    calculate_offsets();
+    encode_instructions();
+    resolve_generated_data();
+    write_bin(file_base);
+    if (elf_mem){
+        char *filename = (char*) malloc(strlen(file_base) + strlen(".out") + 1);
+        strcpy(filename,file_base);
+        strcat(filename,".out");
+        write_elf(filename);
+    }
+    return 0;
+}
+
+
+int yyerror(const char *s){
+    fprintf(stderr, "error: %s\n\tfile: dt-gen\n", s);
+    exit(1);
+}
+
+/* there is no source file to point at here */
+int yyerror_at(char *file, int line, const char *s){
+    (void)file;
+    (void)line;
+    return yyerror(s);
+}
@@ -0,0 +1,164 @@
+/* This file is part of the DuctTape (dt) high-level assembler for 
+ * RISC-V. The dt project was written by Justin Severeid and Elliott 
+ * Forbes, University of Wisconsin-La Crosse, copyright 2020-2024.
+ *
+ * DuctTape is free software: you can redistribute it and/or modify 
+ * it under the terms of the GNU General Public License as published 
+ * by the Free Software Foundation, either version 3 of the License, 
+ * or (at your option) any later version.
+ *
+ * DuctTape is distributed in the hope that it will be useful, but 
+ * WITHOUT ANY WARRANTY; without even the implied warranty of 
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU 
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License 
+ * along with DuctTape. If not, see <https://www.gnu.org/licenses/>. 
+ *
+ *
+ *
+ * The dt project can be found at https://cs.uwlax.edu/~eforbes/dt/
+ *
+ * If you use dt in your published research, please consider 
+ * citing the following:
+ *
+ * Severeid, J. and Forbes, E., "dt: A High-level Assembler for RISC-V," 
+ * Proceedings of the 53rd Midwest Instruction and Computing Symposium, 
+ * April 2020. 
+ *
+ * If you found dt helpful, please let us know! Email eforbes@uwlax.edu
+ *
+ * There are bound to be bugs, let us know those too.
+ */
+
+
+
+/*
+ * generated data sets for memory latency and bandwidth kernels: 
+ * .chase N, stride, seed    a random single cycle of 8 byte pointers
+ * .random N, size, seed     N random elements
+ * .iota N, size, start, step  start, start+step, start+2*step, ...
+ * The IR only keeps the parameters. The bytes are made once every 
+ * address is final, since a .chase points at its own slots.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <elf.h>
+
+#include "gen.h"
+#include "mem.h"
+#include "util.h"
+
+/* pointers are runtime addresses, the same offset the address-of operator adds */
+#define GEN_LOAD_BIAS (sizeof(Elf64_Ehdr) + sizeof(Elf64_Phdr))
+
+mem_entry_t * new_generated(gen_t generator, int64_t count, int64_t width, int64_t seed, int64_t start, int64_t step){
+    mem_entry_t *new_entry;
+
+    if (count < 0)
+        yyerror("Generated data count must not be negative");
+    if (generator == GEN_CHASE){
+        if ((width < 8) || (width & 0x7))
+            yyerror(".chase stride must be a multiple of 8 bytes");
+    }
+    else if ((width != 1) && (width != 2) && (width != 4) && (width != 8))
+        yyerror("Generated data size must be 1, 2, 4 or 8");
+    /* divide rather than multiply, count * width can wrap past zero */
+    if ((uint64_t)count > UINT32_MAX / (uint64_t)width)
+        yyerror("Generated data is larger than 4 GB");
+
+    new_entry = new_array_entry(ENTRY_GEN,count,width);
+    new_entry->array->generator = generator;
+    new_entry->array->align = (generator == GEN_CHASE) ? 8 : width;
+    new_entry->array->seed = seed;
+    new_entry->array->start = start;
+    new_entry->array->step = step;
+    return new_entry;
+}
+
+/* splitmix64, small and good enough for test data, and the same everywhere */
+uint64_t next_random(uint64_t *state){
+    uint64_t z = (*state += 0x9e3779b97f4a7c15ull);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+}
+
+/* uniform in [0, bound) */
+uint64_t random_below(uint64_t *state, uint64_t bound){
+    return (uint64_t)(((unsigned __int128)next_random(state) * bound) >> 64);
+}
+
+static void put_element(uint8_t *dst, uint64_t value, uint32_t width){
+    uint32_t i;
+    for (i=0;i<width;i++)
+        dst[i] = (value >> (8*i)) & 0xff;
+}
+
+/* Sattolo's shuffle, so following the pointers from any slot visits every slot */
+static void generate_chase(mem_entry_t *entry, uint8_t *bytes, uint64_t count){
+    data_array_t *array = entry->array;
+    uint64_t state = array->seed;
+    uint64_t *next;
+    uint64_t i;
+
+    if (count == 0)
+        return;
+    next = (uint64_t*)malloc(sizeof(uint64_t) * count);
+    if (!next) yyerror("Unable to allocate memory for .chase");
+    for (i=0;i<count;i++)
+        next[i] = i;
+    for (i=count-1;i>0;i--){
+        uint64_t j = random_below(&state,i);
+        uint64_t swap = next[i];
+        next[i] = next[j];
+        next[j] = swap;
+    }
+    for (i=0;i<count;i++)
+        put_element(bytes + i*array->width,entry->address + GEN_LOAD_BIAS + next[i]*array->width,8);
+    free(next);
+}
+
+static void generate(mem_entry_t *entry){
+    data_array_t *array = entry->array;
+    uint64_t count = entry->size / array->width;
+    uint64_t state = array->seed;
+    uint64_t i;
+
+    array->bytes = (uint8_t*)calloc(entry->size ? entry->size : 1,1);
+    if (!array->bytes) yyerror("Unable to allocate memory for generated data");
+    mem_alloc_bytes += entry->size;
+
+    switch (array->generator){
+        case GEN_CHASE:
+            generate_chase(entry,array->bytes,count);
+            break;
+        case GEN_RANDOM:
+            for (i=0;i<count;i++)
+                put_element(array->bytes + i*array->width,next_random(&state),array->width);
+            break;
+        case GEN_IOTA:
+            for (i=0;i<count;i++)
+                put_element(array->bytes + i*array->width,array->start + (int64_t)i*array->step,array->width);
+            break;
+        default:
+            yyerror("Invalid generator for generated data");
+    }
+}
+
+/* after layout -- every generated set gets its bytes, like a data list */
+void resolve_generated_data(){
+    memblock_list_t *list;
+    mem_entry_t *working;
+
+    for (list=block_list;list;list=list->next){
+        for (working=list->head;working;working=working->next){
+            if ((working->type == ENTRY_GEN) && !working->array->bytes)
+                generate(working);
+        }
+    }
+}
@@ -0,0 +1,219 @@
+/* This file is part of the DuctTape (dt) high-level assembler for 
+ * RISC-V. The dt project was written by Justin Severeid and Elliott 
+ * Forbes, University of Wisconsin-La Crosse, copyright 2020-2024.
+ *
+ * DuctTape is free software: you can redistribute it and/or modify 
+ * it under the terms of the GNU General Public License as published 
+ * by the Free Software Foundation, either version 3 of the License, 
+ * or (at your option) any later version.
+ *
+ * DuctTape is distributed in the hope that it will be useful, but 
+ * WITHOUT ANY WARRANTY; without even the implied warranty of 
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU 
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License 
+ * along with DuctTape. If not, see <https://www.gnu.org/licenses/>. 
+ *
+ *
+ *
+ * The dt project can be found at https://cs.uwlax.edu/~eforbes/dt/
+ *
+ * If you use dt in your published research, please consider 
+ * citing the following:
+ *
+ * Severeid, J. and Forbes, E., "dt: A High-level Assembler for RISC-V," 
+ * Proceedings of the 53rd Midwest Instruction and Computing Symposium, 
+ * April 2020. 
+ *
+ * If you found dt helpful, please let us know! Email eforbes@uwlax.edu
+ *
+ * There are bound to be bugs, let us know those too.
+ */
+
+
+/*
+ * hart (N) { ... } and hart (all) { ... } blocks, for programs that run 
+ * on every hart of a multi-core machine at once. $harts = N says how 
+ * many harts there are. The first mem() block with a hart block or a 
+ * barrier in it gets a startup stub in front of everything else, so it 
+ * should be the block $pc points at. The stub reads mhartid, parks any 
+ * hart past the last one, points $sp at the top of the hart's own stack 
+ * and $tp at the hart's own data slice, both carved out of areas laid 
+ * out at the end of that block.
+ *
+ * Every hart runs the same code, and a hart (N) block is skipped by all 
+ * the harts but N, so hart blocks and barriers can be strung together 
+ * into the phases of an N-core kernel. hart (all) runs on every hart.
+ *
+ * barrier waits until every hart has reached it, it is the same 
+ * sense-reversing barrier as barrier (name, N) with the count set to 
+ * $harts.
+ *
+ * As with the perf regions, $t4-$t6 are clobbered.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <inttypes.h>
+
+#include "riscvarch.h"
+#include "hart.h"
+#include "atomic.h"
+#include "perf.h"
+#include "inst.h"
+#include "mem.h"
+#include "symtab.h"
+#include "util.h"
+
+#define HART_ADDR_REG 29 // $t4
+#define HART_REG_A 30    // $t5
+#define HART_ID_REG 31   // $t6
+
+#define HART_SP 2        // $sp
+#define HART_TP 4        // $tp
+
+#define HART_STACK_BITS 12 /* a 4KiB stack each */
+#define HART_DATA_BITS 12  /* and a 4KiB data slice */
+
+#define HART_STACKS "__hart_stacks"
+#define HART_DATA "__hart_data"
+#define HART_BARRIER "__hart_barrier"
+#define HART_START "__hart_start"
+
+int64_t harts = 1;
+
+static BOOL hart_code_seen = FALSE; /* a hart block or barrier since the last mem() block */
+static BOOL stub_placed = FALSE;
+static mem_entry_t *stub = NULL;
+static mem_entry_t *stacks = NULL;
+static mem_entry_t *data = NULL;
+static mem_entry_t *barrier = NULL;
+
+void set_harts(int64_t count){
+    if ((count < 1) || (count > HART_MAX)){
+        char buff[100];
+        sprintf(buff,"$harts must be 1 to %d",HART_MAX);
+        yyerror(buff);
+    }
+    if (hart_code_seen || stub_placed)
+        yyerror("$harts must be set before the first hart block or barrier");
+    harts = count;
+}
+
+static mem_entry_t *new_join_node(){
+    mem_entry_t *join_node = new_mem_entry(ENTRY_JOIN_NODE,0);
+    join_node->name = internal_name();
+    symtab_new(join_node->name,SYMTAB_MEM);
+    return join_node;
+}
+
+static mem_entry_t *gen_jump(char *target){
+    mem_entry_t *entry = new_instruction(OP_JAL);
+    entry->inst->inst_id = RISCV_J;
+    entry->inst->rdst = 0;
+    entry->inst->target_name = strdup(target);
+    return entry;
+}
+
+/* the stub, which runs before anything else in its block */
+static mem_entry_t *gen_stub(){
+    mem_entry_t *park = new_join_node();
+    mem_entry_t *go = new_join_node();
+    mem_entry_t *list = gen_csr_read(HART_ID_REG,CSR_MHARTID);
+
+    list->name = strdup(HART_START);
+    symtab_new(list->name,SYMTAB_MEM);
+
+    /* harts the program was not built for go no further */
+    list = append_inst(list,gen_imm_op(RISCV_ADDI,OP_ADDI,F3_ADDI,HART_REG_A,0,harts));
+    list = append_inst(list,gen_branch(RISCV_BLTU,OP_BLTU,F3_BLTU,HART_ID_REG,HART_REG_A,go->name));
+    list = append_inst(list,park);
+    list = append_inst(list,gen_jump(park->name));
+    list = append_inst(list,go);
+
+    /* $sp = the top of stack id, rounded down to 16 bytes */
+    list = append_inst(list,gen_imm_op(RISCV_ADDI,OP_ADDI,F3_ADDI,HART_REG_A,HART_ID_REG,1));
+    list = append_inst(list,gen_slli(HART_REG_A,HART_REG_A,HART_STACK_BITS));
+    list = append_inst(list,gen_address(HART_ADDR_REG,HART_STACKS));
+    list = append_inst(list,gen_add(HART_SP,HART_ADDR_REG,HART_REG_A));
+    list = append_inst(list,gen_imm_op(RISCV_ANDI,OP_ANDI,F3_ANDI,HART_SP,HART_SP,-16));
+
+    /* $tp = data slice id */
+    list = append_inst(list,gen_slli(HART_REG_A,HART_ID_REG,HART_DATA_BITS));
+    list = append_inst(list,gen_address(HART_ADDR_REG,HART_DATA));
+    list = append_inst(list,gen_add(HART_TP,HART_ADDR_REG,HART_REG_A));
+    return list;
+}
+
+mem_entry_t *hart_region(int64_t hart, mem_entry_t *body){
+    mem_entry_t *skip;
+    mem_entry_t *list;
+
+    hart_code_seen = TRUE;
+    if (hart == HART_ALL)
+        return body;
+    if ((hart < 0) || (hart >= harts)){
+        char buff[100];
+        sprintf(buff,"hart %" PRId64 " is out of range, $harts is %" PRId64,hart,harts);
+        yyerror(buff);
+    }
+
+    /* every other hart skips the body */
+    skip = new_join_node();
+    list = gen_csr_read(HART_ID_REG,CSR_MHARTID);
+    list = append_inst(list,gen_imm_op(RISCV_ADDI,OP_ADDI,F3_ADDI,HART_REG_A,0,hart));
+    list = append_inst(list,gen_branch(RISCV_BNE,OP_BNE,F3_BNE,HART_ID_REG,HART_REG_A,skip->name));
+    list = append_inst(list,body);
+    list = append_inst(list,skip);
+    return list;
+}
+
+/* the sense-reversing barrier from atomic.c, for every hart */
+mem_entry_t *hart_barrier(){
+    hart_code_seen = TRUE;
+    return sense_barrier(HART_BARRIER,harts);
+}
+
+/* a zeroed area, named */
+static mem_entry_t *new_area(char *name, uint64_t size){
+    mem_entry_t *area = new_fill(size/8,8,0);
+    area->name = strdup(name);
+    symtab_new(area->name,SYMTAB_MEM);
+    return area;
+}
+
+/* 
+   puts the stub in front of the first block with hart code in it, and 
+   the stacks, data slices and barrier at its end
+*/
+mem_entry_t *flush_hart_areas(mem_entry_t *list){
+    if (!hart_code_seen || stub_placed){
+        hart_code_seen = FALSE;
+        return list;
+    }
+    hart_code_seen = FALSE;
+    stub_placed = TRUE;
+
+    stacks = new_area(HART_STACKS,(uint64_t)harts << HART_STACK_BITS);
+    data = new_area(HART_DATA,(uint64_t)harts << HART_DATA_BITS);
+    barrier = new_area(HART_BARRIER,2*ATOMIC_LINE);
+    stub = gen_stub();
+    list = append_inst(stub,list);
+    list = append_inst(list,stacks);
+    list = append_inst(list,data);
+    return append_inst(list,barrier);
+}
+
+void dump_harts(){
+    if (!stub_placed)
+        return;
+    printf("\nHarts: %" PRId64 ", each with a %d byte stack and a %d byte data slice\n",
+           harts,1 << HART_STACK_BITS,1 << HART_DATA_BITS);
+    printf("stub:\t%s\t@0x%012" PRIx64 "\n",stub->name,stub->address);
+    printf("stacks:\t%s\t@0x%012" PRIx64 "\t%" PRIu32 " bytes\n",stacks->name,stacks->address,stacks->size);
+    printf("data:\t%s\t@0x%012" PRIx64 "\t%" PRIu32 " bytes\n",data->name,data->address,data->size);
+    printf("barrier:\t%s\t@0x%012" PRIx64 "\t%" PRIu32 " bytes\n",barrier->name,barrier->address,barrier->size);
+}
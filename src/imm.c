@@ -0,0 +1,269 @@
+/* This file is part of the DuctTape (dt) high-level assembler for 
+ * RISC-V. The dt project was written by Justin Severeid and Elliott 
+ * Forbes, University of Wisconsin-La Crosse, copyright 2020-2024.
+ *
+ * DuctTape is free software: you can redistribute it and/or modify 
+ * it under the terms of the GNU General Public License as published 
+ * by the Free Software Foundation, either version 3 of the License, 
+ * or (at your option) any later version.
+ *
+ * DuctTape is distributed in the hope that it will be useful, but 
+ * WITHOUT ANY WARRANTY; without even the implied warranty of 
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU 
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License 
+ * along with DuctTape. If not, see <https://www.gnu.org/licenses/>. 
+ *
+ *
+ *
+ * The dt project can be found at https://cs.uwlax.edu/~eforbes/dt/
+ *
+ * If you use dt in your published research, please consider 
+ * citing the following:
+ *
+ * Severeid, J. and Forbes, E., "dt: A High-level Assembler for RISC-V," 
+ * Proceedings of the 53rd Midwest Instruction and Computing Symposium, 
+ * April 2020. 
+ *
+ * If you found dt helpful, please let us know! Email eforbes@uwlax.edu
+ *
+ * There are bound to be bugs, let us know those too.
+ */
+
+/*
+ * functions to materialize integer constants into registers -- picks 
+ * the shortest addi / lui+addiw / shifted sequence it can find, and 
+ * falls back to a per-memblock literal pool for the long ones
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <inttypes.h>
+
+#include "riscvarch.h"
+#include "imm.h"
+#include "inst.h"
+#include "mem.h"
+#include "symtab.h"
+#include "util.h"
+
+/* the longest sequence is lui, addiw and three slli/addi pairs */
+#define MAX_IMM_SEQ 8
+
+typedef struct {
+    int inst_id;
+    int32_t imm;
+} imm_op_t;
+
+typedef struct {
+    int len;
+    imm_op_t ops[MAX_IMM_SEQ];
+} imm_seq_t;
+
+/* sequences longer than this many instructions go to the literal 
+   pool instead, zero means never use the pool */
+static int litpool_threshold = 0;
+
+/* pool entries waiting for the end of the current mem() block */
+static mem_entry_t *pending_pool = NULL;
+
+void set_litpool_threshold(int threshold){
+    litpool_threshold = threshold;
+}
+
+static int64_t sign_extend(uint64_t value, int bits){
+    uint64_t sign = (uint64_t)1 << (bits-1);
+    value &= (sign << 1) - 1;
+    return (int64_t)((value ^ sign) - sign);
+}
+
+static int trailing_zeros(uint64_t value){
+    return value ? __builtin_ctzll(value) : 64;
+}
+
+static int leading_zeros(uint64_t value){
+    return value ? __builtin_clzll(value) : 64;
+}
+
+static void push_op(imm_seq_t *seq, int inst_id, int32_t imm){
+    if (seq->len >= MAX_IMM_SEQ){
+        yyerror("Internal error: constant materialization sequence too long");
+    }
+    seq->ops[seq->len].inst_id = inst_id;
+    seq->ops[seq->len].imm = imm;
+    seq->len++;
+}
+
+/* recursive part of the search: peel off the low 12 bits, shift out 
+   the trailing zeros and materialize whatever is left */
+static void generate_seq(int64_t value, imm_seq_t *seq){
+    if (fits_signed(value, 32)){
+        int64_t hi20 = ((value + 0x800) >> 12) & 0xfffff;
+        int64_t lo12 = sign_extend(value, 12);
+        if (hi20)
+            push_op(seq, RISCV_LUI, (int32_t)hi20);
+        if (lo12 || !hi20)
+            push_op(seq, hi20 ? RISCV_ADDIW : RISCV_ADDI, (int32_t)lo12);
+        return;
+    }
+
+    int64_t lo12 = sign_extend(value, 12);
+    int shift = 0;
+    value = (int64_t)((uint64_t)value - (uint64_t)lo12);
+    if (!fits_signed(value, 32)){
+        shift = trailing_zeros(value);
+        value = value >> shift;
+        /* trade 12 bits of the shift for a lui if that is all it takes */
+        if ((shift > 12) && !fits_signed(value, 12) && fits_signed((int64_t)((uint64_t)value << 12), 32)){
+            shift -= 12;
+            value = (int64_t)((uint64_t)value << 12);
+        }
+    }
+
+    generate_seq(value, seq);
+    if (shift)
+        push_op(seq, RISCV_SLLI, shift);
+    if (lo12)
+        push_op(seq, RISCV_ADDI, (int32_t)lo12);
+}
+
+/* tries a couple of alternative decompositions and keeps the shortest */
+static void shortest_seq(int64_t value, imm_seq_t *best){
+    imm_seq_t tmp;
+
+    best->len = 0;
+    generate_seq(value, best);
+
+    /* a constant with trailing zeros can be built without them and shifted left */
+    if (((value & 0xfff) != 0) && ((value & 1) == 0) && (best->len >= 2)){
+        int tz = trailing_zeros(value);
+        tmp.len = 0;
+        generate_seq(value >> tz, &tmp);
+        if (tmp.len + 1 < best->len){
+            push_op(&tmp, RISCV_SLLI, tz);
+            *best = tmp;
+        }
+    }
+
+    /* a positive constant with leading zeros can be built shifted up and 
+       shifted back down, filling the vacated bits with ones or zeros */
+    if ((value > 0) && (best->len > 2)){
+        int lz = leading_zeros(value);
+        uint64_t shifted = ((uint64_t)value << lz) | (((uint64_t)1 << lz) - 1);
+        tmp.len = 0;
+        generate_seq((int64_t)shifted, &tmp);
+        if (tmp.len + 1 < best->len){
+            push_op(&tmp, RISCV_SRLI, lz);
+            *best = tmp;
+        }
+
+        shifted &= ~(((uint64_t)1 << lz) - 1);
+        tmp.len = 0;
+        generate_seq((int64_t)shifted, &tmp);
+        if (tmp.len + 1 < best->len){
+            push_op(&tmp, RISCV_SRLI, lz);
+            *best = tmp;
+        }
+    }
+}
+
+static mem_entry_t *new_imm_inst(imm_op_t *op, uint32_t rd, uint32_t rs){
+    mem_entry_t *entry = NULL;
+    switch (op->inst_id){
+        case RISCV_LUI:
+            entry = new_instruction(OP_LUI);
+            entry->inst->imm = op->imm;
+            break;
+        case RISCV_ADDI:
+            entry = new_instruction(OP_ADDI);
+            entry->inst->funct3 = F3_ADDI;
+            entry->inst->rsrc1 = rs;
+            entry->inst->imm = op->imm;
+            break;
+        case RISCV_ADDIW:
+            entry = new_instruction(OP_ADDIW);
+            entry->inst->funct3 = F3_ADDIW;
+            entry->inst->rsrc1 = rs;
+            entry->inst->imm = op->imm;
+            break;
+        case RISCV_SLLI:
+            entry = new_instruction(OP_SLLI);
+            entry->inst->funct3 = F3_SLLI;
+            entry->inst->funct7 = F7_SLLI;
+            entry->inst->rsrc1 = rs;
+            entry->inst->rsrc2 = op->imm; //shamt
+            break;
+        case RISCV_SRLI:
+            entry = new_instruction(OP_SRLI);
+            entry->inst->funct3 = F3_SRLI;
+            entry->inst->funct7 = F7_SRLI;
+            entry->inst->rsrc1 = rs;
+            entry->inst->rsrc2 = op->imm; //shamt
+            break;
+        default:
+            yyerror("Internal error: unexpected instruction in constant materialization");
+    }
+    entry->inst->inst_id = op->inst_id;
+    entry->inst->rdst = rd;
+    entry->status = ENTRY_COMPLETE;
+    return entry;
+}
+
+/* returns the name of the pool slot holding value, adding one if needed */
+static char *literal_pool_slot(int64_t value){
+    mem_entry_t *working = pending_pool;
+    while (working){
+        if (working->ivalue == (uint64_t)value)
+            return working->name;
+        working = working->next;
+    }
+
+    mem_entry_t *entry = new_mem_entry(ENTRY_LDATA,8);
+    entry->ivalue = value;
+    entry->name = internal_name();
+    symtab_new(entry->name,SYMTAB_MEM);
+    pending_pool = append_inst(pending_pool,entry);
+    return entry->name;
+}
+
+/* generates the instructions for reg = imm */
+mem_entry_t *load_immediate(uint32_t rd, int64_t value){
+    imm_seq_t seq;
+    mem_entry_t *list = NULL;
+
+    shortest_seq(value, &seq);
+
+    if ((litpool_threshold > 0) && (seq.len > litpool_threshold)){
+        /* auipc+ld, offsets get filled in by calculate_offsets() */
+        char *slot = literal_pool_slot(value);
+        mem_entry_t *upper = new_instruction(OP_AUIPC);
+        upper->inst->inst_id = RISCV_AUIPC;
+        upper->inst->rdst = rd;
+        upper->inst->target_name = strdup(slot);
+        mem_entry_t *lower = new_instruction(OP_LD);
+        lower->inst->inst_id = RISCV_LD;
+        lower->inst->funct3 = F3_LD;
+        lower->inst->rdst = rd;
+        lower->inst->rsrc1 = rd;
+        lower->inst->target_name = strdup(slot);
+        return append_inst(upper,lower);
+    }
+
+    for (int i = 0; i < seq.len; i++){
+        /* only the first instruction of a sequence reads $zero */
+        list = append_inst(list, new_imm_inst(&seq.ops[i], rd, (i == 0) ? 0 : rd));
+    }
+    return list;
+}
+
+/* appends the pending literal pool to the end of a mem() block */
+mem_entry_t *flush_literal_pool(mem_entry_t *list){
+    mem_entry_t *pool = pending_pool;
+    pending_pool = NULL;
+    if (pool)
+        return append_inst(list,pool);
+    return list;
+}
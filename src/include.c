@@ -0,0 +1,388 @@
+/* This file is part of the DuctTape (dt) high-level assembler for 
+ * RISC-V. The dt project was written by Justin Severeid and Elliott 
+ * Forbes, University of Wisconsin-La Crosse, copyright 2020-2024.
+ *
+ * DuctTape is free software: you can redistribute it and/or modify 
+ * it under the terms of the GNU General Public License as published 
+ * by the Free Software Foundation, either version 3 of the License, 
+ * or (at your option) any later version.
+ *
+ * DuctTape is distributed in the hope that it will be useful, but 
+ * WITHOUT ANY WARRANTY; without even the implied warranty of 
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU 
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License 
+ * along with DuctTape. If not, see <https://www.gnu.org/licenses/>. 
+ *
+ *
+ *
+ * The dt project can be found at https://cs.uwlax.edu/~eforbes/dt/
+ *
+ * If you use dt in your published research, please consider 
+ * citing the following:
+ *
+ * Severeid, J. and Forbes, E., "dt: A High-level Assembler for RISC-V," 
+ * Proceedings of the 53rd Midwest Instruction and Computing Symposium, 
+ * April 2020. 
+ *
+ * If you found dt helpful, please let us know! Email eforbes@uwlax.edu
+ *
+ * There are bound to be bugs, let us know those too.
+ */
+
+
+
+/*
+ * where the parser's tokens come from -- the scanner, -sweep's tape and 
+ * .include
+ *
+ * .include "file" reads another source file in place of the directive, 
+ * at the top level or in a mem() block, but not in a macro body. A 
+ * relative name is tried as given, then beside the file with the 
+ * .include in it, the same as .incbin.
+ *
+ * With -cache <dir> an included file is only scanned the first time. 
+ * Its tokens are written to <dir>, in a file named for a hash of its 
+ * contents, and later runs read them back from there. Editing the file 
+ * changes the hash, so a stale entry is never used. The hash also 
+ * covers when this file and the scanner were compiled, as the token 
+ * numbers can change with every build of the parser and what a word 
+ * scans as with every build of the scanner. An entry is written under 
+ * a temporary name and renamed into place, so any number of dt runs can 
+ * share one cache.
+ *
+ * The cache stops at tokens. What an included file parses to depends 
+ * on what came before it -- register labels, vars, macros and -D values 
+ * -- so it goes through the parser every time. All the cache saves is 
+ * the scanner, make cachebench times how much that is.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include "include.h"
+#include "macro.h"
+#include "symtab.h"
+#include "util.h"
+#include "dt.tab.h"
+
+typedef struct {
+    int token;
+    YYSTYPE value;
+    YYLTYPE loc;
+    int line;
+} tape_token_t;
+
+typedef struct {
+    tape_token_t *tokens;
+    int count;
+    int capacity;
+} tape_t;
+
+typedef struct {
+    tape_t tape;
+    int pos;
+    char *outer_file; /* where to go back to once the tape runs out */
+    int outer_line;
+} include_frame_t;
+
+#define CACHE_MAGIC "dttokens"
+
+static tape_t sweep_tape = {NULL, 0, 0};
+static int *sweep_files = NULL; /* where each source file starts on the tape */
+static int sweep_file_count = 0;
+static int sweep_pos = -1;      /* -1 reads from the scanner instead */
+static include_frame_t include_stack[INCLUDE_MAX_DEPTH];
+static int include_depth = 0;
+static tape_t *recording = NULL; /* the tape scan_text() is filling */
+static char *cache_dir = NULL;
+static uint64_t includes_read = 0;
+static uint64_t includes_cached = 0;
+static uint64_t include_token_count = 0;
+
+extern int yylineno;     /* from lexer */
+extern int lex_column;   /* from lexer */
+extern char *lex_file;   /* from lexer */
+extern char *current_file;
+
+/* the token the scanner just returned, onto the end of a tape. Every 
+   name goes down as a LABEL, whether it is an fp register label is 
+   only known once the parser gets to it. */
+static void push_token(tape_t *tape, int token){
+    if (tape->count == tape->capacity){
+        tape->capacity = tape->capacity ? tape->capacity * 2 : 4096;
+        tape->tokens = (tape_token_t*)realloc(tape->tokens,sizeof(tape_token_t)*tape->capacity);
+    }
+    tape->tokens[tape->count].token = (token == FLABEL) ? LABEL : token;
+    tape->tokens[tape->count].value = yylval;
+    tape->tokens[tape->count].loc = yylloc;
+    tape->tokens[tape->count].line = yylineno;
+    tape->count++;
+}
+
+static void record_token(int token){
+    push_token(recording,token);
+}
+
+static int replay_token(tape_token_t *t){
+    yylval = t->value;
+    yylloc = t->loc;
+    yylineno = t->line;
+    if (t->token == LABEL)
+        return (symtab_type(yylval.string) == SYMTAB_FREG) ? FLABEL : LABEL;
+    return t->token;
+}
+
+/* scans a whole source file onto the -sweep tape, up to and including 
+   its end of file token */
+void record_source(FILE *fd, char *file){
+    int token;
+
+    yyrestart(fd);
+    yylineno = 1;
+    lex_column = 1;
+    lex_file = file;
+    sweep_files = (int*)realloc(sweep_files,sizeof(int)*(sweep_file_count+1));
+    sweep_files[sweep_file_count++] = sweep_tape.count;
+    do {
+        token = dt_lex();
+        push_token(&sweep_tape,token);
+    } while (token != 0);
+}
+
+/* the scanner's tokens come from the tape from here on, starting at 
+   the given source file */
+void replay_source(int file){
+    sweep_pos = sweep_files[file];
+}
+
+/* the next token, from the innermost .include, or the tape or the 
+   scanner once every .include has run out */
+int scan_token(){
+    tape_token_t *t;
+
+    while (include_depth > 0){
+        include_frame_t *frame = &include_stack[include_depth-1];
+        t = &frame->tape.tokens[frame->pos];
+        if (t->token != 0){
+            frame->pos++;
+            return replay_token(t);
+        }
+        current_file = frame->outer_file;
+        yylineno = frame->outer_line;
+        free(frame->tape.tokens);
+        include_depth--;
+    }
+    if (sweep_pos < 0)
+        return dt_lex();
+    t = &sweep_tape.tokens[sweep_pos];
+    if (t->token != 0)
+        sweep_pos++;
+    return replay_token(t);
+}
+
+void set_include_cache(char *dir){
+    cache_dir = strdup(dir);
+}
+
+/* FNV-1a, over when this file and the scanner were built and then the text */
+static uint64_t hash_text(char *text, int length){
+    const char *build = __DATE__ " " __TIME__;
+    uint64_t hash = fnv1a(FNV1A_BASIS,build,strlen(build));
+
+    hash = fnv1a(hash,scanner_build,strlen(scanner_build));
+    return fnv1a(hash,text,length);
+}
+
+static char *cache_path(uint64_t hash){
+    char *path = (char*)malloc(strlen(cache_dir) + 32);
+    sprintf(path,"%s/%016" PRIx64 ".tok",cache_dir,hash);
+    return path;
+}
+
+static BOOL has_string(int token){
+    return (token == LABEL) || (token == STRING);
+}
+
+/* the tokens for an included file, if the cache has them */
+static BOOL read_cache(uint64_t hash, char *file, tape_t *tape){
+    char *path = cache_path(hash);
+    FILE *fd = fopen(path,"rb");
+    char magic[8];
+    uint64_t stored_hash, count, i;
+    BOOL ok = FALSE;
+
+    free(path);
+    if (!fd)
+        return FALSE;
+    if ((fread(magic,8,1,fd) != 1) || (memcmp(magic,CACHE_MAGIC,8) != 0) ||
+        (fread(&stored_hash,8,1,fd) != 1) || (stored_hash != hash) ||
+        (fread(&count,8,1,fd) != 1) || (count == 0)){
+        fclose(fd);
+        return FALSE;
+    }
+    tape->tokens = (tape_token_t*)malloc(sizeof(tape_token_t)*count);
+    tape->capacity = count;
+    tape->count = 0;
+    for (i=0;i<count;i++){
+        tape_token_t *t = &tape->tokens[i];
+        int32_t fields[6];
+        uint32_t length;
+
+        if (fread(fields,sizeof(fields),1,fd) != 1)
+            break;
+        t->token = fields[0];
+        t->line = fields[1];
+        t->loc.first_line = fields[2];
+        t->loc.first_column = fields[3];
+        t->loc.last_line = fields[4];
+        t->loc.last_column = fields[5];
+        t->loc.instlist = 0;
+        t->loc.file = file;
+        if (has_string(t->token)){
+            if (fread(&length,4,1,fd) != 1)
+                break;
+            t->value.string = (char*)malloc(length+1);
+            if ((length > 0) && (fread(t->value.string,length,1,fd) != 1))
+                break;
+            t->value.string[length] = '\0';
+        }
+        else if (fread(&t->value.ivalue,8,1,fd) != 1)
+            break;
+        tape->count++;
+    }
+    ok = (tape->count == (int)count) && (tape->tokens[count-1].token == 0);
+    fclose(fd);
+    return ok;
+}
+
+/* writes an included file's tokens to the cache, under a temporary 
+   name first so no other dt run can see half a file */
+static void write_cache(uint64_t hash, tape_t *tape){
+    char *path = cache_path(hash);
+    char *temp = (char*)malloc(strlen(path) + 32);
+    uint64_t count = tape->count;
+    FILE *fd;
+    int i;
+
+    sprintf(temp,"%s.%d",path,(int)getpid());
+    mkdir(cache_dir,0777);
+    fd = fopen(temp,"wb");
+    if (fd){
+        BOOL ok = (fwrite(CACHE_MAGIC,8,1,fd) == 1) && (fwrite(&hash,8,1,fd) == 1) &&
+                  (fwrite(&count,8,1,fd) == 1);
+        for (i=0;ok && (i<tape->count);i++){
+            tape_token_t *t = &tape->tokens[i];
+            int32_t fields[6] = {t->token, t->line, t->loc.first_line, t->loc.first_column,
+                                 t->loc.last_line, t->loc.last_column};
+
+            ok = (fwrite(fields,sizeof(fields),1,fd) == 1);
+            if (ok && has_string(t->token)){
+                uint32_t length = strlen(t->value.string);
+                ok = (fwrite(&length,4,1,fd) == 1) &&
+                     ((length == 0) || (fwrite(t->value.string,length,1,fd) == 1));
+            }
+            else if (ok)
+                ok = (fwrite(&t->value.ivalue,8,1,fd) == 1);
+        }
+        if ((fclose(fd) == 0) && ok)
+            rename(temp,path);
+        else
+            unlink(temp);
+    }
+    /* a cache that can't be written is only slower, not an error */
+    free(temp);
+    free(path);
+}
+
+/* the whole of an included file, tried as given and then beside the 
+   file that includes it. path is set to the name it was found under. */
+static char *read_include(char *name, char **path, int *length){
+    FILE *fd = fopen(name,"rb");
+    char *text;
+    char *slash;
+    long size;
+
+    *path = strdup(name);
+    if (!fd && (name[0] != '/') && current_file && (slash = strrchr(current_file,'/'))){
+        int dir_length = slash - current_file + 1;
+        free(*path);
+        *path = (char*)malloc(dir_length + strlen(name) + 1);
+        memcpy(*path,current_file,dir_length);
+        strcpy(*path + dir_length,name);
+        fd = fopen(*path,"rb");
+    }
+    if (!fd){
+        char buff[300];
+        snprintf(buff,sizeof(buff),"Unable to open .include file \"%s\"",name);
+        yyerror(buff);
+    }
+    fseek(fd,0,SEEK_END);
+    size = ftell(fd);
+    fseek(fd,0,SEEK_SET);
+    text = (char*)malloc(size+1);
+    if ((size > 0) && (fread(text,size,1,fd) != 1))
+        yyerror("Unable to read .include file");
+    text[size] = '\0';
+    fclose(fd);
+    *length = size;
+    return text;
+}
+
+/* .include "file", the directive itself has already been read. Its 
+   tokens go on a tape of their own, which scan_token() reads out ahead 
+   of anything else. */
+void begin_include(){
+    include_frame_t *frame;
+    char *name, *path, *text;
+    int length;
+    uint64_t hash;
+
+    if (scan_token() != STRING)
+        yyerror("Expected a quoted file name after .include.");
+    if (include_depth == INCLUDE_MAX_DEPTH)
+        yyerror(".include is nested too deeply, does a file include itself?");
+    name = parse_string(yylval.string);
+    text = read_include(name,&path,&length);
+    hash = hash_text(text,length);
+
+    frame = &include_stack[include_depth];
+    frame->tape.tokens = NULL;
+    frame->tape.count = 0;
+    frame->tape.capacity = 0;
+    frame->pos = 0;
+    frame->outer_file = current_file;
+    frame->outer_line = yylineno;
+    includes_read++;
+    if (cache_dir && read_cache(hash,path,&frame->tape))
+        includes_cached++;
+    else {
+        free(frame->tape.tokens);
+        frame->tape.tokens = NULL;
+        frame->tape.count = 0;
+        frame->tape.capacity = 0;
+        recording = &frame->tape;
+        scan_text(text,length,path,record_token);
+        if (cache_dir)
+            write_cache(hash,&frame->tape);
+    }
+    include_token_count += frame->tape.count;
+    free(text);
+    free(name);
+
+    current_file = path;
+    include_depth++;
+}
+
+void print_include_stats(){
+    if (includes_read == 0)
+        return;
+    fprintf(stderr,"Includes: %" PRIu64 " files, %" PRIu64 " from the cache, %" PRIu64 " tokens\n",
+            includes_read,includes_cached,include_token_count);
+}
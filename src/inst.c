@@ -46,10 +46,16 @@
 
 #include "riscvarch.h"
 #include "inst.h"
+#include "compress.h"
 #include "mem.h"
 #include "symtab.h"
 #include "util.h"
 
+/* the low 12 bits of value, as the sign-extended immediate of an i-type */
+static int32_t sign_extend_12(int64_t value){
+    return ((int32_t)(value & 0xfff) ^ 0x800) - 0x800;
+}
+
 /* look into this again, this probably needs to get re-coded */
 void calculate_offsets(){
     memblock_list_t *list = block_list;
@@ -58,22 +64,29 @@ void calculate_offsets(){
         mem_entry_t *working = list->head;
         while (working){
             if ((working->type == ENTRY_INSTRUCTION) && (working->status == ENTRY_INCOMPLETE)){
-                char buff[100];
+                char buff[300];
                 int64_t target_address = symtab_lookup(working->inst->target_name);
                 if (target_address < 0){
                     sprintf(buff,"Symbol table lookup failed on label \"%s\" -- name not found.",
                                  working->inst->target_name);
-                    yyerror(buff);
+                    yyerror_at(working->loc.file,working->loc.line,buff);
                 }
                 else if (symtab_type(working->inst->target_name) != SYMTAB_MEM) {
                     sprintf(buff,"Symbol table lookup failed on label \"%s\" --"
                                  " label refers to a register.",
                                  working->inst->target_name);
-                    yyerror(buff);
+                    yyerror_at(working->loc.file,working->loc.line,buff);
                 }
                 else {
                     if (working->inst->inst_id == RISCV_JAL || working->inst->inst_id == RISCV_J){
-                        working->inst->imm = (target_address - working->address);
+                        int64_t offset = target_address - working->address;
+                        if ((offset < -(1 << 20)) || (offset >= (1 << 20))){
+                            sprintf(buff,"Jump to label \"%s\" is out of range (offset %" PRId64 "), "
+                                         "it needs relaxation (do not use -norelax).",
+                                         working->inst->target_name,offset);
+                            yyerror_at(working->loc.file,working->loc.line,buff);
+                        }
+                        working->inst->imm = offset;
                         working->status = ENTRY_COMPLETE;
                     }
                     else if ((working->inst->inst_id == RISCV_BEQ) ||
@@ -82,24 +95,42 @@ void calculate_offsets(){
                              (working->inst->inst_id == RISCV_BGE) ||
                              (working->inst->inst_id == RISCV_BLTU) ||
                              (working->inst->inst_id == RISCV_BGEU)){
-                        working->inst->imm = (target_address - working->address) & 0x1fff;
+                        int64_t offset = target_address - working->address;
+                        if ((offset < -(1 << 12)) || (offset >= (1 << 12))){
+                            sprintf(buff,"Branch to label \"%s\" is out of range (offset %" PRId64 "), "
+                                         "it needs relaxation (do not use -norelax).",
+                                         working->inst->target_name,offset);
+                            yyerror_at(working->loc.file,working->loc.line,buff);
+                        }
+                        working->inst->imm = offset & 0x1fff;
                         working->status = ENTRY_COMPLETE;
                     }
                     else if (working->inst->inst_id == RISCV_LUI){
-                        /* from the address-of operator */
-                        working->inst->imm = (((uint64_t)(target_address+sizeof(Elf64_Ehdr)+sizeof(Elf64_Phdr)) >> 12)) & 0xfffff; // TODO need to fix this header size nonsense
+                        /* from the address-of operator, rounded so the sign-extended addiw lands on the address */
+                        working->inst->imm = (((uint64_t)(target_address+sizeof(Elf64_Ehdr)+sizeof(Elf64_Phdr)+0x800) >> 12)) & 0xfffff; // TODO need to fix this header size nonsense
                         working->status = ENTRY_COMPLETE;
                     }
-                    else if (working->inst->inst_id == RISCV_ORI){
+                    else if (working->inst->inst_id == RISCV_ADDIW){
                         /* from the address-of operator */
-                        working->inst->imm = (target_address+sizeof(Elf64_Ehdr)+sizeof(Elf64_Phdr)) & 0xfff; // TODO need to fix this header size nonsense
+                        working->inst->imm = sign_extend_12(target_address+sizeof(Elf64_Ehdr)+sizeof(Elf64_Phdr)); // TODO need to fix this header size nonsense
+                        working->status = ENTRY_COMPLETE;
+                    }
+                    else if (working->inst->inst_id == RISCV_AUIPC){
+                        /* upper half of a pc-relative pair, e.g. a literal pool load */
+                        working->inst->imm = ((target_address - working->address + 0x800) >> 12) & 0xfffff;
+                        working->status = ENTRY_COMPLETE;
+                    }
+                    else if ((working->inst->inst_id == RISCV_LD) || (working->inst->inst_id == RISCV_JALR)){
+                        /* lower half of a pc-relative pair (literal pool load, relaxed jump), 
+                           relative to the auipc right before it */
+                        working->inst->imm = sign_extend_12(target_address - (working->address - 4));
                         working->status = ENTRY_COMPLETE;
                     }
                     else {
 
                         sprintf(buff,"Unexpected incomplete instruction at address 0x%12" PRIx64 ", id: %d",
                                      working->address, working->inst->inst_id);
-                        yyerror(buff);
+                        yyerror_at(working->loc.file,working->loc.line,buff);
                     }
                 }
             }
@@ -109,13 +140,262 @@ void calculate_offsets(){
     }
 }
 
+/* shift amounts are 6 bits for the 64-bit shifts and 5 bits for the *w shifts */
+uint32_t check_shamt(int64_t shamt, int bits){
+    if ((shamt < 0) || (shamt >= ((int64_t)1 << bits))){
+        char buff[100];
+        sprintf(buff,"Shift amount %" PRId64 " out of range, must be 0 to %d",shamt,(1<<bits)-1);
+        yyerror(buff);
+    }
+    return (uint32_t)shamt;
+}
+
+/* 5 bit vector immediates, signed (-16 to 15) for most ops and unsigned for shifts, slides, etc */
+uint32_t check_vimm(int64_t imm, int is_signed){
+    int64_t lo = is_signed ? -16 : 0;
+    int64_t hi = is_signed ? 15 : 31;
+    if ((imm < lo) || (imm > hi)){
+        char buff[100];
+        sprintf(buff,"Vector immediate %" PRId64 " out of range, must be %" PRId64 " to %" PRId64,imm,lo,hi);
+        yyerror(buff);
+    }
+    return (uint32_t)imm & 0x1f;
+}
+
+/* the csr number for a name like cycle or mhpmcounter4, -1 if there is no such csr */
+int csr_number(char *name){
+    static const struct {
+        const char *name;
+        int number;
+    } csrs[] = {
+        {"fflags",CSR_FFLAGS},
+        {"frm",CSR_FRM},
+        {"fcsr",CSR_FCSR},
+        {"cycle",CSR_CYCLE},
+        {"time",CSR_TIME},
+        {"instret",CSR_INSTRET},
+        {"mcycle",CSR_MCYCLE},
+        {"minstret",CSR_MINSTRET},
+        {"mcountinhibit",CSR_MCOUNTINHIBIT},
+        {"mhartid",CSR_MHARTID},
+        {NULL,0}
+    };
+    static const struct {
+        const char *prefix;
+        int base;
+    } counters[] = {
+        {"hpmcounter",CSR_HPMCOUNTER3},
+        {"mhpmcounter",CSR_MHPMCOUNTER3},
+        {"mhpmevent",CSR_MHPMEVENT3},
+        {NULL,0}
+    };
+    int i;
+
+    for (i=0;csrs[i].name;i++){
+        if (strcmp(name,csrs[i].name) == 0)
+            return csrs[i].number;
+    }
+    for (i=0;counters[i].prefix;i++){
+        size_t length = strlen(counters[i].prefix);
+        if (strncmp(name,counters[i].prefix,length) == 0){
+            char *end;
+            long n = strtol(name+length,&end,10);
+            if ((end != name+length) && (*end == '\0') && (n >= 3) && (n <= 31) &&
+                ((name[length] != '0') || (name[length+1] == '\0')))
+                return counters[i].base + (n - 3);
+        }
+    }
+    return -1;
+}
+
+static BOOL is_vector_mem(instruction_t *inst){
+    return (inst->inst_id >= RISCV_VLE8_V) && (inst->inst_id <= RISCV_VSM_V);
+}
+
+/* x0 is never a real operand, reading it is a constant and writing it does nothing */
+static BOOL is_x0(operand_class_t reg_class, uint32_t *field){
+    return (reg_class == OPERAND_INT) && field && (*field == 0);
+}
+
+static void add_src(operands_t *ops, operand_class_t reg_class, uint32_t *field){
+    if (is_x0(reg_class,field))
+        return;
+    ops->src[ops->src_count].reg_class = reg_class;
+    ops->src[ops->src_count].field = field;
+    ops->src_count++;
+}
+
+static void set_dst(operands_t *ops, operand_class_t reg_class, uint32_t *field){
+    ops->dst.reg_class = reg_class;
+    ops->dst.field = is_x0(reg_class,field) ? NULL : field;
+}
+
+/* the registers an instruction reads and writes, worked out from its major opcode */
+void find_operands(instruction_t *inst, operands_t *ops){
+    uint32_t funct6 = inst->funct7 >> 1;
+    BOOL masked = !(inst->funct7 & 1);
+
+    ops->src_count = 0;
+    ops->dst.reg_class = OPERAND_INT;
+    ops->dst.field = NULL;
+
+    switch(inst->opcode){
+        case 0x37: /* lui */
+        case 0x17: /* auipc */
+        case 0x6f: /* jal */
+            set_dst(ops,OPERAND_INT,&inst->rdst);
+            break;
+        case 0x67: /* jalr */
+        case 0x03: /* loads */
+        case 0x13: /* op-imm, the shamt of a shift is not a register */
+        case 0x1b: /* op-imm-32 */
+            add_src(ops,OPERAND_INT,&inst->rsrc1);
+            set_dst(ops,OPERAND_INT,&inst->rdst);
+            break;
+        case 0x63: /* branches */
+        case 0x23: /* stores */
+            add_src(ops,OPERAND_INT,&inst->rsrc1);
+            add_src(ops,OPERAND_INT,&inst->rsrc2);
+            break;
+        case 0x33: /* op */
+        case 0x3b: /* op-32 */
+        case 0x2f: /* amos */
+            add_src(ops,OPERAND_INT,&inst->rsrc1);
+            add_src(ops,OPERAND_INT,&inst->rsrc2);
+            set_dst(ops,OPERAND_INT,&inst->rdst);
+            break;
+        case 0x73: /* ecall, ebreak and the csr instructions */
+            if ((inst->funct3 >= 1) && (inst->funct3 <= 3))
+                add_src(ops,OPERAND_INT,&inst->rsrc1);
+            if (inst->funct3 != 0)
+                set_dst(ops,OPERAND_INT,&inst->rdst);
+            break;
+        case 0x07: /* fp and vector loads */
+        case 0x27: /* fp and vector stores */
+            add_src(ops,OPERAND_INT,&inst->rsrc1);
+            if (is_vector_mem(inst)){
+                uint32_t mop = (inst->funct7 >> 1) & 0x3;
+                if (mop == 2)
+                    add_src(ops,OPERAND_INT,&inst->rsrc2); /* stride */
+                else if (mop != 0)
+                    add_src(ops,OPERAND_VEC,&inst->rsrc2); /* index vector */
+                if (masked)
+                    add_src(ops,OPERAND_VEC,NULL);
+                if (inst->opcode == 0x27)
+                    add_src(ops,OPERAND_VEC,&inst->rdst); /* vs3 */
+                else
+                    set_dst(ops,OPERAND_VEC,&inst->rdst);
+            }
+            else if (inst->opcode == 0x27)
+                add_src(ops,OPERAND_FP,&inst->rsrc2);
+            else
+                set_dst(ops,OPERAND_FP,&inst->rdst);
+            break;
+        case 0x43: /* fused multiply-adds */
+        case 0x47:
+        case 0x4b:
+        case 0x4f:
+            add_src(ops,OPERAND_FP,&inst->rsrc1);
+            add_src(ops,OPERAND_FP,&inst->rsrc2);
+            add_src(ops,OPERAND_FP,&inst->rsrc3);
+            set_dst(ops,OPERAND_FP,&inst->rdst);
+            break;
+        case 0x53: /* op-fp, the low bits of funct7 are the format */
+            switch(inst->funct7 & ~0x3){
+                case 0x50: /* compares */
+                    add_src(ops,OPERAND_FP,&inst->rsrc1);
+                    add_src(ops,OPERAND_FP,&inst->rsrc2);
+                    set_dst(ops,OPERAND_INT,&inst->rdst);
+                    break;
+                case 0x60: /* fcvt to an integer */
+                case 0x70: /* fmv.x and fclass */
+                    add_src(ops,OPERAND_FP,&inst->rsrc1);
+                    set_dst(ops,OPERAND_INT,&inst->rdst);
+                    break;
+                case 0x68: /* fcvt from an integer */
+                case 0x78: /* fmv from an integer */
+                    add_src(ops,OPERAND_INT,&inst->rsrc1);
+                    set_dst(ops,OPERAND_FP,&inst->rdst);
+                    break;
+                case 0x20: /* fcvt between formats */
+                case 0x2c: /* fsqrt */
+                    add_src(ops,OPERAND_FP,&inst->rsrc1);
+                    set_dst(ops,OPERAND_FP,&inst->rdst);
+                    break;
+                default:
+                    add_src(ops,OPERAND_FP,&inst->rsrc1);
+                    add_src(ops,OPERAND_FP,&inst->rsrc2);
+                    set_dst(ops,OPERAND_FP,&inst->rdst);
+                    break;
+            }
+            break;
+        case 0x57: /* op-v */
+            if (inst->funct3 == 0x7){
+                /* vsetvli and friends, vsetivli has an immediate in rs1 */
+                if (inst->inst_id != RISCV_VSETIVLI)
+                    add_src(ops,OPERAND_INT,&inst->rsrc1);
+                if (inst->inst_id == RISCV_VSETVL)
+                    add_src(ops,OPERAND_INT,&inst->rsrc2);
+                set_dst(ops,OPERAND_INT,&inst->rdst);
+                break;
+            }
+            /* vmv.v.* reads only its scalar or vs1 operand */
+            if (!((funct6 == 0x17) && !masked && ((inst->funct3 == 0x0) || (inst->funct3 == 0x3) || (inst->funct3 == 0x4))))
+                add_src(ops,OPERAND_VEC,&inst->rsrc2);
+            switch(inst->funct3){
+                case 0x0: /* opivv */
+                    add_src(ops,OPERAND_VEC,&inst->rsrc1);
+                    break;
+                case 0x1: /* opfvv */
+                case 0x2: /* opmvv, the unary groups use vs1 to pick the operation */
+                    if ((funct6 != 0x10) && (funct6 != 0x12) && (funct6 != 0x13) && (funct6 != 0x14))
+                        add_src(ops,OPERAND_VEC,&inst->rsrc1);
+                    break;
+                case 0x4: /* opivx */
+                case 0x6: /* opmvx */
+                    add_src(ops,OPERAND_INT,&inst->rsrc1);
+                    break;
+                case 0x5: /* opfvf */
+                    add_src(ops,OPERAND_FP,&inst->rsrc1);
+                    break;
+            }
+            /* the multiply-accumulates also read their destination */
+            if ((((inst->funct3 == 0x2) || (inst->funct3 == 0x6)) &&
+                 ((funct6 == 0x29) || (funct6 == 0x2b) || (funct6 == 0x2d) || (funct6 == 0x2f) || (funct6 >= 0x3c))) ||
+                (((inst->funct3 == 0x1) || (inst->funct3 == 0x5)) &&
+                 (((funct6 >= 0x28) && (funct6 <= 0x2f)) || (funct6 >= 0x3c))))
+                add_src(ops,OPERAND_VEC,&inst->rdst);
+            if (masked)
+                add_src(ops,OPERAND_VEC,NULL);
+            /* vmv.x.s, vcpop and vfirst write an integer, vfmv.f.s a float */
+            if ((funct6 == 0x10) && (inst->funct3 == 0x2))
+                set_dst(ops,OPERAND_INT,&inst->rdst);
+            else if ((funct6 == 0x10) && (inst->funct3 == 0x1))
+                set_dst(ops,OPERAND_FP,&inst->rdst);
+            else
+                set_dst(ops,OPERAND_VEC,&inst->rdst);
+            break;
+        default:
+            break;
+    }
+}
+
+/* the register number of an operand, the implied v0 mask is 0 */
+uint32_t operand_reg(operand_t *operand){
+    return operand->field ? *operand->field : 0;
+}
+
 void encode_instructions(){
     memblock_list_t *list = block_list;
 
     while (list){
         mem_entry_t *working = list->head;
         while (working){
-            if (working->type == ENTRY_INSTRUCTION){
+            if ((working->type == ENTRY_INSTRUCTION) && (working->size == 2)){
+                /* shrunk by the -compress pass */
+                working->encoding = encode_compressed(working->inst);
+            }
+            else if (working->type == ENTRY_INSTRUCTION){
                 working->encoding = encode_instruction(working->inst);
             }
             working = working->next;
@@ -199,6 +479,288 @@ uint32_t encode_instruction(instruction_t *inst){
         case RISCV_ANDI:
             encoding = encode_i_type(inst);
             break;
+        case RISCV_ADDIW:
+            encoding = encode_i_type(inst);
+            break;
+        case RISCV_LD:
+            encoding = encode_i_type(inst);
+            break;
+        case RISCV_SD:
+            encoding = encode_s_type(inst);
+            break;
+        case RISCV_LWU:
+            encoding = encode_i_type(inst);
+            break;
+        case RISCV_SLLIW:
+            encoding = encode_r_type(inst);
+            //rsrc2 is shamt
+            break;
+        case RISCV_SRLIW:
+            encoding = encode_r_type(inst);
+            //rsrc2 is shamt
+            break;
+        case RISCV_SRAIW:
+            encoding = encode_r_type(inst);
+            //rsrc2 is shamt
+            break;
+        case RISCV_ADDW:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_SUBW:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_SLLW:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_SRLW:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_SRAW:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_MULH:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_MULHSU:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_MULHU:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_DIVU:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_REM:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_REMU:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_MULW:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_DIVW:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_DIVUW:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_REMW:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_REMUW:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_LR_W:
+        case RISCV_SC_W:
+        case RISCV_AMOSWAP_W:
+        case RISCV_AMOADD_W:
+        case RISCV_AMOXOR_W:
+        case RISCV_AMOAND_W:
+        case RISCV_AMOOR_W:
+        case RISCV_AMOMIN_W:
+        case RISCV_AMOMAX_W:
+        case RISCV_AMOMINU_W:
+        case RISCV_AMOMAXU_W:
+        case RISCV_LR_D:
+        case RISCV_SC_D:
+        case RISCV_AMOSWAP_D:
+        case RISCV_AMOADD_D:
+        case RISCV_AMOXOR_D:
+        case RISCV_AMOAND_D:
+        case RISCV_AMOOR_D:
+        case RISCV_AMOMIN_D:
+        case RISCV_AMOMAX_D:
+        case RISCV_AMOMINU_D:
+        case RISCV_AMOMAXU_D:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_FLW:
+            encoding = encode_i_type(inst);
+            break;
+        case RISCV_FSW:
+            encoding = encode_s_type(inst);
+            break;
+        case RISCV_FMADD_S:
+            encoding = encode_r4_type(inst);
+            break;
+        case RISCV_FMSUB_S:
+            encoding = encode_r4_type(inst);
+            break;
+        case RISCV_FNMSUB_S:
+            encoding = encode_r4_type(inst);
+            break;
+        case RISCV_FNMADD_S:
+            encoding = encode_r4_type(inst);
+            break;
+        case RISCV_FADD_S:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_FSUB_S:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_FMUL_S:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_FDIV_S:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_FSQRT_S:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_FSGNJ_S:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_FSGNJN_S:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_FSGNJX_S:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_FMIN_S:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_FMAX_S:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_FEQ_S:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_FLT_S:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_FLE_S:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_FCLASS_S:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_FCVT_W_S:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_FCVT_WU_S:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_FCVT_L_S:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_FCVT_LU_S:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_FCVT_S_W:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_FCVT_S_WU:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_FCVT_S_L:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_FCVT_S_LU:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_FMV_X_W:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_FMV_W_X:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_FLD:
+            encoding = encode_i_type(inst);
+            break;
+        case RISCV_FSD:
+            encoding = encode_s_type(inst);
+            break;
+        case RISCV_FMADD_D:
+            encoding = encode_r4_type(inst);
+            break;
+        case RISCV_FMSUB_D:
+            encoding = encode_r4_type(inst);
+            break;
+        case RISCV_FNMSUB_D:
+            encoding = encode_r4_type(inst);
+            break;
+        case RISCV_FNMADD_D:
+            encoding = encode_r4_type(inst);
+            break;
+        case RISCV_FADD_D:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_FSUB_D:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_FMUL_D:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_FDIV_D:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_FSQRT_D:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_FSGNJ_D:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_FSGNJN_D:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_FSGNJX_D:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_FMIN_D:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_FMAX_D:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_FEQ_D:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_FLT_D:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_FLE_D:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_FCLASS_D:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_FCVT_W_D:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_FCVT_WU_D:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_FCVT_L_D:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_FCVT_LU_D:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_FCVT_D_W:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_FCVT_D_WU:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_FCVT_D_L:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_FCVT_D_LU:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_FMV_X_D:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_FMV_D_X:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_FCVT_S_D:
+            encoding = encode_r_type(inst);
+            break;
+        case RISCV_FCVT_D_S:
+            encoding = encode_r_type(inst);
+            break;
         case RISCV_SLLI:
             encoding = encode_r_type(inst);
             //rsrc2 is shamt
@@ -253,6 +815,277 @@ uint32_t encode_instruction(instruction_t *inst){
         case RISCV_EBREAK:
             encoding = encode_i_type(inst);
             break;
+        case RISCV_CSRRW:
+            encoding = encode_i_type(inst);
+            break;
+        case RISCV_CSRRS:
+            encoding = encode_i_type(inst);
+            break;
+        case RISCV_CSRRC:
+            encoding = encode_i_type(inst);
+            break;
+        case RISCV_CSRRWI:
+            encoding = encode_i_type(inst);
+            break;
+        case RISCV_CSRRSI:
+            encoding = encode_i_type(inst);
+            break;
+        case RISCV_CSRRCI:
+            encoding = encode_i_type(inst);
+            break;
+        case RISCV_FENCE:
+            encoding = encode_i_type(inst);
+            break;
+        case RISCV_FENCE_I:
+            encoding = encode_i_type(inst);
+            break;
+        case RISCV_VSETVLI:
+            encoding = encode_i_type(inst);
+            break;
+        case RISCV_VSETIVLI:
+            encoding = encode_i_type(inst);
+            break;
+        /* every other vector instruction has the r-type field layout, funct7 = funct6|vm */
+        case RISCV_VSETVL:
+        case RISCV_VLE8_V:
+        case RISCV_VLE8FF_V:
+        case RISCV_VSE8_V:
+        case RISCV_VLSE8_V:
+        case RISCV_VSSE8_V:
+        case RISCV_VLUXEI8_V:
+        case RISCV_VLOXEI8_V:
+        case RISCV_VSUXEI8_V:
+        case RISCV_VSOXEI8_V:
+        case RISCV_VLE16_V:
+        case RISCV_VLE16FF_V:
+        case RISCV_VSE16_V:
+        case RISCV_VLSE16_V:
+        case RISCV_VSSE16_V:
+        case RISCV_VLUXEI16_V:
+        case RISCV_VLOXEI16_V:
+        case RISCV_VSUXEI16_V:
+        case RISCV_VSOXEI16_V:
+        case RISCV_VLE32_V:
+        case RISCV_VLE32FF_V:
+        case RISCV_VSE32_V:
+        case RISCV_VLSE32_V:
+        case RISCV_VSSE32_V:
+        case RISCV_VLUXEI32_V:
+        case RISCV_VLOXEI32_V:
+        case RISCV_VSUXEI32_V:
+        case RISCV_VSOXEI32_V:
+        case RISCV_VLE64_V:
+        case RISCV_VLE64FF_V:
+        case RISCV_VSE64_V:
+        case RISCV_VLSE64_V:
+        case RISCV_VSSE64_V:
+        case RISCV_VLUXEI64_V:
+        case RISCV_VLOXEI64_V:
+        case RISCV_VSUXEI64_V:
+        case RISCV_VSOXEI64_V:
+        case RISCV_VLM_V:
+        case RISCV_VSM_V:
+        case RISCV_VADD_VV:
+        case RISCV_VADD_VX:
+        case RISCV_VADD_VI:
+        case RISCV_VSUB_VV:
+        case RISCV_VSUB_VX:
+        case RISCV_VRSUB_VX:
+        case RISCV_VRSUB_VI:
+        case RISCV_VMINU_VV:
+        case RISCV_VMINU_VX:
+        case RISCV_VMIN_VV:
+        case RISCV_VMIN_VX:
+        case RISCV_VMAXU_VV:
+        case RISCV_VMAXU_VX:
+        case RISCV_VMAX_VV:
+        case RISCV_VMAX_VX:
+        case RISCV_VAND_VV:
+        case RISCV_VAND_VX:
+        case RISCV_VAND_VI:
+        case RISCV_VOR_VV:
+        case RISCV_VOR_VX:
+        case RISCV_VOR_VI:
+        case RISCV_VXOR_VV:
+        case RISCV_VXOR_VX:
+        case RISCV_VXOR_VI:
+        case RISCV_VRGATHER_VV:
+        case RISCV_VRGATHER_VX:
+        case RISCV_VRGATHER_VI:
+        case RISCV_VSLIDEUP_VX:
+        case RISCV_VSLIDEUP_VI:
+        case RISCV_VSLIDEDOWN_VX:
+        case RISCV_VSLIDEDOWN_VI:
+        case RISCV_VMSEQ_VV:
+        case RISCV_VMSEQ_VX:
+        case RISCV_VMSEQ_VI:
+        case RISCV_VMSNE_VV:
+        case RISCV_VMSNE_VX:
+        case RISCV_VMSNE_VI:
+        case RISCV_VMSLTU_VV:
+        case RISCV_VMSLTU_VX:
+        case RISCV_VMSLT_VV:
+        case RISCV_VMSLT_VX:
+        case RISCV_VMSLEU_VV:
+        case RISCV_VMSLEU_VX:
+        case RISCV_VMSLEU_VI:
+        case RISCV_VMSLE_VV:
+        case RISCV_VMSLE_VX:
+        case RISCV_VMSLE_VI:
+        case RISCV_VMSGTU_VX:
+        case RISCV_VMSGTU_VI:
+        case RISCV_VMSGT_VX:
+        case RISCV_VMSGT_VI:
+        case RISCV_VSLL_VV:
+        case RISCV_VSLL_VX:
+        case RISCV_VSLL_VI:
+        case RISCV_VSRL_VV:
+        case RISCV_VSRL_VX:
+        case RISCV_VSRL_VI:
+        case RISCV_VSRA_VV:
+        case RISCV_VSRA_VX:
+        case RISCV_VSRA_VI:
+        case RISCV_VNSRL_WV:
+        case RISCV_VNSRL_WX:
+        case RISCV_VNSRL_WI:
+        case RISCV_VNSRA_WV:
+        case RISCV_VNSRA_WX:
+        case RISCV_VNSRA_WI:
+        case RISCV_VMERGE_VVM:
+        case RISCV_VMERGE_VXM:
+        case RISCV_VMERGE_VIM:
+        case RISCV_VMV_V_V:
+        case RISCV_VMV_V_X:
+        case RISCV_VMV_V_I:
+        case RISCV_VDIVU_VV:
+        case RISCV_VDIVU_VX:
+        case RISCV_VDIV_VV:
+        case RISCV_VDIV_VX:
+        case RISCV_VREMU_VV:
+        case RISCV_VREMU_VX:
+        case RISCV_VREM_VV:
+        case RISCV_VREM_VX:
+        case RISCV_VMULHU_VV:
+        case RISCV_VMULHU_VX:
+        case RISCV_VMUL_VV:
+        case RISCV_VMUL_VX:
+        case RISCV_VMULHSU_VV:
+        case RISCV_VMULHSU_VX:
+        case RISCV_VMULH_VV:
+        case RISCV_VMULH_VX:
+        case RISCV_VWADDU_VV:
+        case RISCV_VWADDU_VX:
+        case RISCV_VWADD_VV:
+        case RISCV_VWADD_VX:
+        case RISCV_VWSUBU_VV:
+        case RISCV_VWSUBU_VX:
+        case RISCV_VWSUB_VV:
+        case RISCV_VWSUB_VX:
+        case RISCV_VWMULU_VV:
+        case RISCV_VWMULU_VX:
+        case RISCV_VWMULSU_VV:
+        case RISCV_VWMULSU_VX:
+        case RISCV_VWMUL_VV:
+        case RISCV_VWMUL_VX:
+        case RISCV_VMADD_VV:
+        case RISCV_VMADD_VX:
+        case RISCV_VNMSUB_VV:
+        case RISCV_VNMSUB_VX:
+        case RISCV_VMACC_VV:
+        case RISCV_VMACC_VX:
+        case RISCV_VNMSAC_VV:
+        case RISCV_VNMSAC_VX:
+        case RISCV_VWMACCU_VV:
+        case RISCV_VWMACCU_VX:
+        case RISCV_VWMACC_VV:
+        case RISCV_VWMACC_VX:
+        case RISCV_VREDSUM_VS:
+        case RISCV_VREDAND_VS:
+        case RISCV_VREDOR_VS:
+        case RISCV_VREDXOR_VS:
+        case RISCV_VREDMINU_VS:
+        case RISCV_VREDMIN_VS:
+        case RISCV_VREDMAXU_VS:
+        case RISCV_VREDMAX_VS:
+        case RISCV_VSLIDE1UP_VX:
+        case RISCV_VSLIDE1DOWN_VX:
+        case RISCV_VMV_X_S:
+        case RISCV_VMV_S_X:
+        case RISCV_VCPOP_M:
+        case RISCV_VFIRST_M:
+        case RISCV_VIOTA_M:
+        case RISCV_VID_V:
+        case RISCV_VMANDN_MM:
+        case RISCV_VMAND_MM:
+        case RISCV_VMOR_MM:
+        case RISCV_VMXOR_MM:
+        case RISCV_VMORN_MM:
+        case RISCV_VMNAND_MM:
+        case RISCV_VMNOR_MM:
+        case RISCV_VMXNOR_MM:
+        case RISCV_VFADD_VV:
+        case RISCV_VFADD_VF:
+        case RISCV_VFSUB_VV:
+        case RISCV_VFSUB_VF:
+        case RISCV_VFRSUB_VF:
+        case RISCV_VFMIN_VV:
+        case RISCV_VFMIN_VF:
+        case RISCV_VFMAX_VV:
+        case RISCV_VFMAX_VF:
+        case RISCV_VFSGNJ_VV:
+        case RISCV_VFSGNJ_VF:
+        case RISCV_VFSGNJN_VV:
+        case RISCV_VFSGNJN_VF:
+        case RISCV_VFSGNJX_VV:
+        case RISCV_VFSGNJX_VF:
+        case RISCV_VFDIV_VV:
+        case RISCV_VFDIV_VF:
+        case RISCV_VFRDIV_VF:
+        case RISCV_VFMUL_VV:
+        case RISCV_VFMUL_VF:
+        case RISCV_VMFEQ_VV:
+        case RISCV_VMFEQ_VF:
+        case RISCV_VMFLE_VV:
+        case RISCV_VMFLE_VF:
+        case RISCV_VMFLT_VV:
+        case RISCV_VMFLT_VF:
+        case RISCV_VMFNE_VV:
+        case RISCV_VMFNE_VF:
+        case RISCV_VMFGT_VF:
+        case RISCV_VMFGE_VF:
+        case RISCV_VFMADD_VV:
+        case RISCV_VFMADD_VF:
+        case RISCV_VFNMADD_VV:
+        case RISCV_VFNMADD_VF:
+        case RISCV_VFMSUB_VV:
+        case RISCV_VFMSUB_VF:
+        case RISCV_VFNMSUB_VV:
+        case RISCV_VFNMSUB_VF:
+        case RISCV_VFMACC_VV:
+        case RISCV_VFMACC_VF:
+        case RISCV_VFNMACC_VV:
+        case RISCV_VFNMACC_VF:
+        case RISCV_VFMSAC_VV:
+        case RISCV_VFMSAC_VF:
+        case RISCV_VFNMSAC_VV:
+        case RISCV_VFNMSAC_VF:
+        case RISCV_VFREDUSUM_VS:
+        case RISCV_VFREDOSUM_VS:
+        case RISCV_VFREDMIN_VS:
+        case RISCV_VFREDMAX_VS:
+        case RISCV_VFSQRT_V:
+        case RISCV_VFCVT_XU_F_V:
+        case RISCV_VFCVT_X_F_V:
+        case RISCV_VFCVT_F_XU_V:
+        case RISCV_VFCVT_F_X_V:
+        case RISCV_VFCVT_RTZ_XU_F_V:
+        case RISCV_VFCVT_RTZ_X_F_V:
+        case RISCV_VFMV_F_S:
+        case RISCV_VFMV_S_F:
+        case RISCV_VFMV_V_F:
+        case RISCV_VFMERGE_VFM:
+            encoding = encode_r_type(inst);
+            break;
         case RISCV_J:
             encoding = encode_j_type(inst);
             break;
@@ -278,6 +1111,19 @@ uint32_t encode_r_type(instruction_t *inst)
     return encoding;
 }
 
+uint32_t encode_r4_type(instruction_t *inst)
+{
+    uint32_t encoding = 0;
+    encoding |= (inst->opcode);     /* op */
+    encoding |= (inst->rdst<<7);    /* rd */
+    encoding |= (inst->funct3<<12); /* funct3 (rounding mode) */
+    encoding |= (inst->rsrc1<<15);  /* rs1 */
+    encoding |= (inst->rsrc2<<20);  /* rs2 */
+    encoding |= (inst->funct7<<25); /* fmt */
+    encoding |= (inst->rsrc3<<27);  /* rs3 */
+    return encoding;
+}
+
 uint32_t encode_i_type(instruction_t *inst)
 {
     uint32_t encoding = 0;
@@ -56,6 +56,9 @@ typedef struct {
     union {
         uint32_t rsrc2;
     };
+    union {
+        uint32_t rsrc3; /* only the r4-type fused multiply-adds */
+    };
     union {
         int32_t imm;
         int32_t shamt;
@@ -66,11 +69,38 @@ typedef struct {
     };
 } instruction_t;
 
+#define OPERAND_MAX_SRCS 4
+
+typedef enum {
+    OPERAND_INT,
+    OPERAND_FP,
+    OPERAND_VEC
+} operand_class_t;
+
+/* a register an instruction reads or writes, field is the rdst, rsrc1, ... 
+   it is in, or NULL for the v0 mask of a masked vector op */
+typedef struct {
+    operand_class_t reg_class;
+    uint32_t *field;
+} operand_t;
+
+typedef struct {
+    operand_t src[OPERAND_MAX_SRCS];
+    int src_count;
+    operand_t dst; /* dst.field is NULL if it writes no register */
+} operands_t;
+
 void calculate_offsets();
+void find_operands(instruction_t *, operands_t *);
+uint32_t operand_reg(operand_t *);
 uint32_t encode_instruction(instruction_t *);
 void encode_instructions();
+uint32_t check_shamt(int64_t, int);
+uint32_t check_vimm(int64_t, int);
+int csr_number(char *);
 
 uint32_t encode_r_type(instruction_t *);
+uint32_t encode_r4_type(instruction_t *);
 uint32_t encode_i_type(instruction_t *);
 uint32_t encode_s_type(instruction_t *);
 uint32_t encode_b_type(instruction_t *);
@@ -0,0 +1,781 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <ctype.h>
+#include <regex.h>
+int yylineno = 1; char *yytext = NULL; int yyleng = 0; FILE *yyin = NULL;
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include "riscvarch.h"
+#include "symtab.h"
+#include "macro.h"
+#include "dt.tab.h"
+
+/* the parser calls yylex() in macro.c, which expands macros on top of this */
+#define YY_DECL int dt_lex()
+
+/* where every token starts and ends, the parser stamps these on the IR 
+   for the line table. yylineno has already counted the token's own 
+   newlines by the time this runs. */
+int lex_column = 1;
+char *lex_file = NULL; /* the file being scanned, for yylloc */
+
+static void track_location(){
+    int i;
+
+    yylloc.first_line = yylineno;
+    yylloc.first_column = lex_column;
+    for (i=0;i<yyleng;i++){
+        if (yytext[i] == '\n'){
+            yylloc.first_line--;
+            lex_column = 1;
+        }
+        else
+            lex_column++;
+    }
+    yylloc.last_line = yylineno;
+    yylloc.last_column = lex_column - 1;
+    yylloc.instlist = 0;
+    yylloc.file = lex_file;
+}
+
+#define YY_USER_ACTION track_location();
+
+/* different for every build of the scanner, the .include cache keys its 
+   tokens on it */
+const char *scanner_build = __DATE__ " " __TIME__;
+
+/* the aq and rl bits for an lr, sc or amo mnemonic, from its .aq, .rl or .aqrl suffix */
+static int64_t amo_order(const char *text){
+    const char *suffix = strchr(strchr(text,'.') + 1,'.');
+    if (!suffix)
+        return 0;
+    if (strcmp(suffix,".aq") == 0)
+        return F7_AMO_AQ;
+    if (strcmp(suffix,".rl") == 0)
+        return F7_AMO_RL;
+    return F7_AMO_AQ | F7_AMO_RL;
+}
+static char *fl_buf = NULL; static size_t fl_pos = 0, fl_len = 0; static int fl_cond = 0;
+#define INITIAL 0
+#define FRMOPS 1
+#define VTYPEOPS 2
+#define BEGIN fl_cond = 
+static const char *fl_first_pat[] = {NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,"^(l)","^(s)","^(a)","^(a)","^(a)","^(a)","^(a)","^(a)","^(a)","^(a)","^(a)","^(l)","^(s)","^(a)","^(a)","^(a)","^(a)","^(a)","^(a)","^(a)","^(a)","^(a)",NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,"^(\\$)","^(\\$)",NULL,"^(\\$)","^(\\$)","^(\\$)",NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,"^(0)",NULL,"^(\")","^(#)","^([a-z])",NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,"^([ \t])","^([\n\r])",NULL,NULL};
+static unsigned char fl_first[571][256];
+static int *fl_cand[256];
+static const char *fl_span_pat[][2] = {{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{"^[a-z]$","^[a-z0-9_]$"},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{NULL,NULL},{"^[ \t]$","^[ \t]$"},{"^[\n\r]$","^[\n\r]$"},{NULL,NULL},{NULL,NULL}};
+static unsigned char fl_span[571][2][256];
+static const char *fl_lit[] = {"lui","auipc","jal","jalr","beq","bne","blt","bge","bltu","bgeu","lb","lh","lw","lbu","lhu","sb","sh","sw","addi","slti","sltiu","xori","ori","andi","slli","srli","srai","add","sub","sll","slt","sltu","xor","srl","sra","or","and","fence","fence.i","ecall","ebreak","csrrw","csrrs","csrrc","csrrwi","csrrsi","csrrci","csrr","csrw","rdcycle","rdtime","rdinstret","j","jr","ret","nop","mul","div","ld","sd","lwu","addiw","slliw","srliw","sraiw","addw","subw","sllw","srlw","sraw","mulh","mulhsu","mulhu","divu","rem","remu","mulw","divw","divuw","remw","remuw",NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,"flw","fsw","fmadd.s","fmsub.s","fnmsub.s","fnmadd.s","fadd.s","fsub.s","fmul.s","fdiv.s","fsqrt.s","fsgnj.s","fsgnjn.s","fsgnjx.s","fmin.s","fmax.s","feq.s","flt.s","fle.s","fclass.s","fcvt.w.s","fcvt.wu.s","fcvt.l.s","fcvt.lu.s","fcvt.s.w","fcvt.s.wu","fcvt.s.l","fcvt.s.lu","fmv.x.w","fmv.w.x","fld","fsd","fmadd.d","fmsub.d","fnmsub.d","fnmadd.d","fadd.d","fsub.d","fmul.d","fdiv.d","fsqrt.d","fsgnj.d","fsgnjn.d","fsgnjx.d","fmin.d","fmax.d","feq.d","flt.d","fle.d","fclass.d","fcvt.w.d","fcvt.wu.d","fcvt.l.d","fcvt.lu.d","fcvt.d.w","fcvt.d.wu","fcvt.d.l","fcvt.d.lu","fmv.x.d","fmv.d.x","fcvt.s.d","fcvt.d.s","fmv.s","fneg.s","fabs.s","fmv.d","fneg.d","fabs.d","frcsr","fscsr","frrm","fsrm","frflags","fsflags","vsetvli","vsetivli","vsetvl","vle8.v","vle8ff.v","vse8.v","vlse8.v","vsse8.v","vluxei8.v","vloxei8.v","vsuxei8.v","vsoxei8.v","vle16.v","vle16ff.v","vse16.v","vlse16.v","vsse16.v","vluxei16.v","vloxei16.v","vsuxei16.v","vsoxei16.v","vle32.v","vle32ff.v","vse32.v","vlse32.v","vsse32.v","vluxei32.v","vloxei32.v","vsuxei32.v","vsoxei32.v","vle64.v","vle64ff.v","vse64.v","vlse64.v","vsse64.v","vluxei64.v","vloxei64.v","vsuxei64.v","vsoxei64.v","vlm.v","vsm.v","vadd.vv","vadd.vx","vadd.vi","vsub.vv","vsub.vx","vrsub.vx","vrsub.vi","vminu.vv","vminu.vx","vmin.vv","vmin.vx","vmaxu.vv","vmaxu.vx","vmax.vv","vmax.vx","vand.vv","vand.vx","vand.vi","vor.vv","vor.vx","vor.vi","vxor.vv","vxor.vx","vxor.vi","vrgather.vv","vrgather.vx","vrgather.vi","vslideup.vx","vslideup.vi","vslidedown.vx","vslidedown.vi","vmseq.vv","vmseq.vx","vmseq.vi","vmsne.vv","vmsne.vx","vmsne.vi","vmsltu.vv","vmsltu.vx","vmslt.vv","vmslt.vx","vmsleu.vv","vmsleu.vx","vmsleu.vi","vmsle.vv","vmsle.vx","vmsle.vi","vmsgtu.vx","vmsgtu.vi","vmsgt.vx","vmsgt.vi","vsll.vv","vsll.vx","vsll.vi","vsrl.vv","vsrl.vx","vsrl.vi","vsra.vv","vsra.vx","vsra.vi","vnsrl.wv","vnsrl.wx","vnsrl.wi","vnsra.wv","vnsra.wx","vnsra.wi","vmerge.vvm","vmerge.vxm","vmerge.vim","vmv.v.v","vmv.v.x","vmv.v.i","vdivu.vv","vdivu.vx","vdiv.vv","vdiv.vx","vremu.vv","vremu.vx","vrem.vv","vrem.vx","vmulhu.vv","vmulhu.vx","vmul.vv","vmul.vx","vmulhsu.vv","vmulhsu.vx","vmulh.vv","vmulh.vx","vwaddu.vv","vwaddu.vx","vwadd.vv","vwadd.vx","vwsubu.vv","vwsubu.vx","vwsub.vv","vwsub.vx","vwmulu.vv","vwmulu.vx","vwmulsu.vv","vwmulsu.vx","vwmul.vv","vwmul.vx","vmadd.vv","vmadd.vx","vnmsub.vv","vnmsub.vx","vmacc.vv","vmacc.vx","vnmsac.vv","vnmsac.vx","vwmaccu.vv","vwmaccu.vx","vwmacc.vv","vwmacc.vx","vredsum.vs","vredand.vs","vredor.vs","vredxor.vs","vredminu.vs","vredmin.vs","vredmaxu.vs","vredmax.vs","vslide1up.vx","vslide1down.vx","vmv.x.s","vmv.s.x","vcpop.m","vfirst.m","viota.m","vid.v","vmandn.mm","vmand.mm","vmor.mm","vmxor.mm","vmorn.mm","vmnand.mm","vmnor.mm","vmxnor.mm","vfadd.vv","vfadd.vf","vfsub.vv","vfsub.vf","vfrsub.vf","vfmin.vv","vfmin.vf","vfmax.vv","vfmax.vf","vfsgnj.vv","vfsgnj.vf","vfsgnjn.vv","vfsgnjn.vf","vfsgnjx.vv","vfsgnjx.vf","vfdiv.vv","vfdiv.vf","vfrdiv.vf","vfmul.vv","vfmul.vf","vmfeq.vv","vmfeq.vf","vmfle.vv","vmfle.vf","vmflt.vv","vmflt.vf","vmfne.vv","vmfne.vf","vmfgt.vf","vmfge.vf","vfmadd.vv","vfmadd.vf","vfnmadd.vv","vfnmadd.vf","vfmsub.vv","vfmsub.vf","vfnmsub.vv","vfnmsub.vf","vfmacc.vv","vfmacc.vf","vfnmacc.vv","vfnmacc.vf","vfmsac.vv","vfmsac.vf","vfnmsac.vv","vfnmsac.vf","vfredusum.vs","vfredosum.vs","vfredmin.vs","vfredmax.vs","vfsqrt.v","vfcvt.xu.f.v","vfcvt.x.f.v","vfcvt.f.xu.v","vfcvt.f.x.v","vfcvt.rtz.xu.f.v","vfcvt.rtz.x.f.v","vfmv.f.s","vfmv.s.f","vfmv.v.f","vfmerge.vfm","rne","rtz","rdn","rup","rmm","dyn","e8","e16","e32","e64","mf8","mf4","mf2","m1","m2","m4","m8","ta","tu","ma","mu","+","-","*","/","&","|","~","^","<<",">>","@","<",">","<=",">=","==","!=","=","$zero","$ra","$sp","$gp","$tp","$t0","$t1","$t2","$s0","$fp","$s1","$a0","$a1","$a2","$a3","$a4","$a5","$a6","$a7","$s2","$s3","$s4","$s5","$s6","$s7","$s8","$s9","$s10","$s11","$t3","$t4","$t5","$t6","$ft0","$ft1","$ft2","$ft3","$ft4","$ft5","$ft6","$ft7","$fs0","$fs1","$fa0","$fa1","$fa2","$fa3","$fa4","$fa5","$fa6","$fa7","$fs2","$fs3","$fs4","$fs5","$fs6","$fs7","$fs8","$fs9","$fs10","$fs11","$ft8","$ft9","$ft10","$ft11",NULL,NULL,"$v0.t",NULL,NULL,NULL,"mem","if","else","while","do","until","stripmine","macro",NULL,NULL,NULL,NULL,NULL,NULL,"[","]","{","}","(",")",":",".byte",".half",".word",".long",".float",".double",".stringz",".incbin",".fill",".zero",".chase",".random",".iota",".include",".if",".ifdef",".ifndef",".else",".endif",NULL,NULL,",",NULL};
+static const int fl_litlen[] = {3,5,3,4,3,3,3,3,4,4,2,2,2,3,3,2,2,2,4,4,5,4,3,4,4,4,4,3,3,3,3,4,3,3,3,2,3,5,7,5,6,5,5,5,6,6,6,4,4,7,6,9,1,2,3,3,3,3,2,2,3,5,5,5,5,4,4,4,4,4,4,6,5,4,3,4,4,4,5,4,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,3,7,7,8,8,6,6,6,6,7,7,8,8,6,6,5,5,5,8,8,9,8,9,8,9,8,9,7,7,3,3,7,7,8,8,6,6,6,6,7,7,8,8,6,6,5,5,5,8,8,9,8,9,8,9,8,9,7,7,8,8,5,6,6,5,6,6,5,5,4,4,7,7,7,8,6,6,8,6,7,7,9,9,9,9,7,9,7,8,8,10,10,10,10,7,9,7,8,8,10,10,10,10,7,9,7,8,8,10,10,10,10,5,5,7,7,7,7,7,8,8,8,8,7,7,8,8,7,7,7,7,7,6,6,6,7,7,7,11,11,11,11,11,13,13,8,8,8,8,8,8,9,9,8,8,9,9,9,8,8,8,9,9,8,8,7,7,7,7,7,7,7,7,7,8,8,8,8,8,8,10,10,10,7,7,7,8,8,7,7,8,8,7,7,9,9,7,7,10,10,8,8,9,9,8,8,9,9,8,8,9,9,10,10,8,8,8,8,9,9,8,8,9,9,10,10,9,9,10,10,9,10,11,10,11,10,12,14,7,7,7,8,7,5,9,8,7,8,8,9,8,9,8,8,8,8,9,8,8,8,8,9,9,10,10,10,10,8,8,9,8,8,8,8,8,8,8,8,8,8,8,8,9,9,10,10,9,9,10,10,9,9,10,10,9,9,10,10,12,12,11,11,8,12,11,12,11,16,15,8,8,8,11,3,3,3,3,3,3,2,3,3,3,3,3,3,2,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,2,2,1,1,1,2,2,2,2,1,5,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,4,4,3,3,3,3,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,5,5,4,4,5,5,0,0,5,0,0,0,3,2,4,5,2,5,9,5,0,0,0,0,0,0,1,1,1,1,1,1,1,5,5,5,5,6,7,8,7,5,5,6,7,5,8,3,6,7,5,6,0,0,1,0};
+#define YY_START fl_cond
+#define yyterminate() return 0
+static regex_t fl_re[571]; static int fl_init = 0;
+static const char *fl_pat[] = {"^(lui)","^(auipc)","^(jal)","^(jalr)","^(beq)","^(bne)","^(blt)","^(bge)","^(bltu)","^(bgeu)","^(lb)","^(lh)","^(lw)","^(lbu)","^(lhu)","^(sb)","^(sh)","^(sw)","^(addi)","^(slti)","^(sltiu)","^(xori)","^(ori)","^(andi)","^(slli)","^(srli)","^(srai)","^(add)","^(sub)","^(sll)","^(slt)","^(sltu)","^(xor)","^(srl)","^(sra)","^(or)","^(and)","^(fence)","^(fence\\.i)","^(ecall)","^(ebreak)","^(csrrw)","^(csrrs)","^(csrrc)","^(csrrwi)","^(csrrsi)","^(csrrci)","^(csrr)","^(csrw)","^(rdcycle)","^(rdtime)","^(rdinstret)","^(j)","^(jr)","^(ret)","^(nop)","^(mul)","^(div)","^(ld)","^(sd)","^(lwu)","^(addiw)","^(slliw)","^(srliw)","^(sraiw)","^(addw)","^(subw)","^(sllw)","^(srlw)","^(sraw)","^(mulh)","^(mulhsu)","^(mulhu)","^(divu)","^(rem)","^(remu)","^(mulw)","^(divw)","^(divuw)","^(remw)","^(remuw)","^(lr\\.w(\\.aq|\\.rl|\\.aqrl)?)","^(sc\\.w(\\.aq|\\.rl|\\.aqrl)?)","^(amoswap\\.w(\\.aq|\\.rl|\\.aqrl)?)","^(amoadd\\.w(\\.aq|\\.rl|\\.aqrl)?)","^(amoxor\\.w(\\.aq|\\.rl|\\.aqrl)?)","^(amoand\\.w(\\.aq|\\.rl|\\.aqrl)?)","^(amoor\\.w(\\.aq|\\.rl|\\.aqrl)?)","^(amomin\\.w(\\.aq|\\.rl|\\.aqrl)?)","^(amomax\\.w(\\.aq|\\.rl|\\.aqrl)?)","^(amominu\\.w(\\.aq|\\.rl|\\.aqrl)?)","^(amomaxu\\.w(\\.aq|\\.rl|\\.aqrl)?)","^(lr\\.d(\\.aq|\\.rl|\\.aqrl)?)","^(sc\\.d(\\.aq|\\.rl|\\.aqrl)?)","^(amoswap\\.d(\\.aq|\\.rl|\\.aqrl)?)","^(amoadd\\.d(\\.aq|\\.rl|\\.aqrl)?)","^(amoxor\\.d(\\.aq|\\.rl|\\.aqrl)?)","^(amoand\\.d(\\.aq|\\.rl|\\.aqrl)?)","^(amoor\\.d(\\.aq|\\.rl|\\.aqrl)?)","^(amomin\\.d(\\.aq|\\.rl|\\.aqrl)?)","^(amomax\\.d(\\.aq|\\.rl|\\.aqrl)?)","^(amominu\\.d(\\.aq|\\.rl|\\.aqrl)?)","^(amomaxu\\.d(\\.aq|\\.rl|\\.aqrl)?)","^(flw)","^(fsw)","^(fmadd\\.s)","^(fmsub\\.s)","^(fnmsub\\.s)","^(fnmadd\\.s)","^(fadd\\.s)","^(fsub\\.s)","^(fmul\\.s)","^(fdiv\\.s)","^(fsqrt\\.s)","^(fsgnj\\.s)","^(fsgnjn\\.s)","^(fsgnjx\\.s)","^(fmin\\.s)","^(fmax\\.s)","^(feq\\.s)","^(flt\\.s)","^(fle\\.s)","^(fclass\\.s)","^(fcvt\\.w\\.s)","^(fcvt\\.wu\\.s)","^(fcvt\\.l\\.s)","^(fcvt\\.lu\\.s)","^(fcvt\\.s\\.w)","^(fcvt\\.s\\.wu)","^(fcvt\\.s\\.l)","^(fcvt\\.s\\.lu)","^(fmv\\.x\\.w)","^(fmv\\.w\\.x)","^(fld)","^(fsd)","^(fmadd\\.d)","^(fmsub\\.d)","^(fnmsub\\.d)","^(fnmadd\\.d)","^(fadd\\.d)","^(fsub\\.d)","^(fmul\\.d)","^(fdiv\\.d)","^(fsqrt\\.d)","^(fsgnj\\.d)","^(fsgnjn\\.d)","^(fsgnjx\\.d)","^(fmin\\.d)","^(fmax\\.d)","^(feq\\.d)","^(flt\\.d)","^(fle\\.d)","^(fclass\\.d)","^(fcvt\\.w\\.d)","^(fcvt\\.wu\\.d)","^(fcvt\\.l\\.d)","^(fcvt\\.lu\\.d)","^(fcvt\\.d\\.w)","^(fcvt\\.d\\.wu)","^(fcvt\\.d\\.l)","^(fcvt\\.d\\.lu)","^(fmv\\.x\\.d)","^(fmv\\.d\\.x)","^(fcvt\\.s\\.d)","^(fcvt\\.d\\.s)","^(fmv\\.s)","^(fneg\\.s)","^(fabs\\.s)","^(fmv\\.d)","^(fneg\\.d)","^(fabs\\.d)","^(frcsr)","^(fscsr)","^(frrm)","^(fsrm)","^(frflags)","^(fsflags)","^(vsetvli)","^(vsetivli)","^(vsetvl)","^(vle8\\.v)","^(vle8ff\\.v)","^(vse8\\.v)","^(vlse8\\.v)","^(vsse8\\.v)","^(vluxei8\\.v)","^(vloxei8\\.v)","^(vsuxei8\\.v)","^(vsoxei8\\.v)","^(vle16\\.v)","^(vle16ff\\.v)","^(vse16\\.v)","^(vlse16\\.v)","^(vsse16\\.v)","^(vluxei16\\.v)","^(vloxei16\\.v)","^(vsuxei16\\.v)","^(vsoxei16\\.v)","^(vle32\\.v)","^(vle32ff\\.v)","^(vse32\\.v)","^(vlse32\\.v)","^(vsse32\\.v)","^(vluxei32\\.v)","^(vloxei32\\.v)","^(vsuxei32\\.v)","^(vsoxei32\\.v)","^(vle64\\.v)","^(vle64ff\\.v)","^(vse64\\.v)","^(vlse64\\.v)","^(vsse64\\.v)","^(vluxei64\\.v)","^(vloxei64\\.v)","^(vsuxei64\\.v)","^(vsoxei64\\.v)","^(vlm\\.v)","^(vsm\\.v)","^(vadd\\.vv)","^(vadd\\.vx)","^(vadd\\.vi)","^(vsub\\.vv)","^(vsub\\.vx)","^(vrsub\\.vx)","^(vrsub\\.vi)","^(vminu\\.vv)","^(vminu\\.vx)","^(vmin\\.vv)","^(vmin\\.vx)","^(vmaxu\\.vv)","^(vmaxu\\.vx)","^(vmax\\.vv)","^(vmax\\.vx)","^(vand\\.vv)","^(vand\\.vx)","^(vand\\.vi)","^(vor\\.vv)","^(vor\\.vx)","^(vor\\.vi)","^(vxor\\.vv)","^(vxor\\.vx)","^(vxor\\.vi)","^(vrgather\\.vv)","^(vrgather\\.vx)","^(vrgather\\.vi)","^(vslideup\\.vx)","^(vslideup\\.vi)","^(vslidedown\\.vx)","^(vslidedown\\.vi)","^(vmseq\\.vv)","^(vmseq\\.vx)","^(vmseq\\.vi)","^(vmsne\\.vv)","^(vmsne\\.vx)","^(vmsne\\.vi)","^(vmsltu\\.vv)","^(vmsltu\\.vx)","^(vmslt\\.vv)","^(vmslt\\.vx)","^(vmsleu\\.vv)","^(vmsleu\\.vx)","^(vmsleu\\.vi)","^(vmsle\\.vv)","^(vmsle\\.vx)","^(vmsle\\.vi)","^(vmsgtu\\.vx)","^(vmsgtu\\.vi)","^(vmsgt\\.vx)","^(vmsgt\\.vi)","^(vsll\\.vv)","^(vsll\\.vx)","^(vsll\\.vi)","^(vsrl\\.vv)","^(vsrl\\.vx)","^(vsrl\\.vi)","^(vsra\\.vv)","^(vsra\\.vx)","^(vsra\\.vi)","^(vnsrl\\.wv)","^(vnsrl\\.wx)","^(vnsrl\\.wi)","^(vnsra\\.wv)","^(vnsra\\.wx)","^(vnsra\\.wi)","^(vmerge\\.vvm)","^(vmerge\\.vxm)","^(vmerge\\.vim)","^(vmv\\.v\\.v)","^(vmv\\.v\\.x)","^(vmv\\.v\\.i)","^(vdivu\\.vv)","^(vdivu\\.vx)","^(vdiv\\.vv)","^(vdiv\\.vx)","^(vremu\\.vv)","^(vremu\\.vx)","^(vrem\\.vv)","^(vrem\\.vx)","^(vmulhu\\.vv)","^(vmulhu\\.vx)","^(vmul\\.vv)","^(vmul\\.vx)","^(vmulhsu\\.vv)","^(vmulhsu\\.vx)","^(vmulh\\.vv)","^(vmulh\\.vx)","^(vwaddu\\.vv)","^(vwaddu\\.vx)","^(vwadd\\.vv)","^(vwadd\\.vx)","^(vwsubu\\.vv)","^(vwsubu\\.vx)","^(vwsub\\.vv)","^(vwsub\\.vx)","^(vwmulu\\.vv)","^(vwmulu\\.vx)","^(vwmulsu\\.vv)","^(vwmulsu\\.vx)","^(vwmul\\.vv)","^(vwmul\\.vx)","^(vmadd\\.vv)","^(vmadd\\.vx)","^(vnmsub\\.vv)","^(vnmsub\\.vx)","^(vmacc\\.vv)","^(vmacc\\.vx)","^(vnmsac\\.vv)","^(vnmsac\\.vx)","^(vwmaccu\\.vv)","^(vwmaccu\\.vx)","^(vwmacc\\.vv)","^(vwmacc\\.vx)","^(vredsum\\.vs)","^(vredand\\.vs)","^(vredor\\.vs)","^(vredxor\\.vs)","^(vredminu\\.vs)","^(vredmin\\.vs)","^(vredmaxu\\.vs)","^(vredmax\\.vs)","^(vslide1up\\.vx)","^(vslide1down\\.vx)","^(vmv\\.x\\.s)","^(vmv\\.s\\.x)","^(vcpop\\.m)","^(vfirst\\.m)","^(viota\\.m)","^(vid\\.v)","^(vmandn\\.mm)","^(vmand\\.mm)","^(vmor\\.mm)","^(vmxor\\.mm)","^(vmorn\\.mm)","^(vmnand\\.mm)","^(vmnor\\.mm)","^(vmxnor\\.mm)","^(vfadd\\.vv)","^(vfadd\\.vf)","^(vfsub\\.vv)","^(vfsub\\.vf)","^(vfrsub\\.vf)","^(vfmin\\.vv)","^(vfmin\\.vf)","^(vfmax\\.vv)","^(vfmax\\.vf)","^(vfsgnj\\.vv)","^(vfsgnj\\.vf)","^(vfsgnjn\\.vv)","^(vfsgnjn\\.vf)","^(vfsgnjx\\.vv)","^(vfsgnjx\\.vf)","^(vfdiv\\.vv)","^(vfdiv\\.vf)","^(vfrdiv\\.vf)","^(vfmul\\.vv)","^(vfmul\\.vf)","^(vmfeq\\.vv)","^(vmfeq\\.vf)","^(vmfle\\.vv)","^(vmfle\\.vf)","^(vmflt\\.vv)","^(vmflt\\.vf)","^(vmfne\\.vv)","^(vmfne\\.vf)","^(vmfgt\\.vf)","^(vmfge\\.vf)","^(vfmadd\\.vv)","^(vfmadd\\.vf)","^(vfnmadd\\.vv)","^(vfnmadd\\.vf)","^(vfmsub\\.vv)","^(vfmsub\\.vf)","^(vfnmsub\\.vv)","^(vfnmsub\\.vf)","^(vfmacc\\.vv)","^(vfmacc\\.vf)","^(vfnmacc\\.vv)","^(vfnmacc\\.vf)","^(vfmsac\\.vv)","^(vfmsac\\.vf)","^(vfnmsac\\.vv)","^(vfnmsac\\.vf)","^(vfredusum\\.vs)","^(vfredosum\\.vs)","^(vfredmin\\.vs)","^(vfredmax\\.vs)","^(vfsqrt\\.v)","^(vfcvt\\.xu\\.f\\.v)","^(vfcvt\\.x\\.f\\.v)","^(vfcvt\\.f\\.xu\\.v)","^(vfcvt\\.f\\.x\\.v)","^(vfcvt\\.rtz\\.xu\\.f\\.v)","^(vfcvt\\.rtz\\.x\\.f\\.v)","^(vfmv\\.f\\.s)","^(vfmv\\.s\\.f)","^(vfmv\\.v\\.f)","^(vfmerge\\.vfm)","^(rne)","^(rtz)","^(rdn)","^(rup)","^(rmm)","^(dyn)","^(e8)","^(e16)","^(e32)","^(e64)","^(mf8)","^(mf4)","^(mf2)","^(m1)","^(m2)","^(m4)","^(m8)","^(ta)","^(tu)","^(ma)","^(mu)","^(\\+)","^(-)","^(\\*)","^(/)","^(&)","^(\\|)","^(~)","^(\\^)","^(<<)","^(>>)","^(@)","^(<)","^(>)","^(<=)","^(>=)","^(==)","^(!=)","^(=)","^(\\$zero)","^(\\$ra)","^(\\$sp)","^(\\$gp)","^(\\$tp)","^(\\$t0)","^(\\$t1)","^(\\$t2)","^(\\$s0)","^(\\$fp)","^(\\$s1)","^(\\$a0)","^(\\$a1)","^(\\$a2)","^(\\$a3)","^(\\$a4)","^(\\$a5)","^(\\$a6)","^(\\$a7)","^(\\$s2)","^(\\$s3)","^(\\$s4)","^(\\$s5)","^(\\$s6)","^(\\$s7)","^(\\$s8)","^(\\$s9)","^(\\$s10)","^(\\$s11)","^(\\$t3)","^(\\$t4)","^(\\$t5)","^(\\$t6)","^(\\$ft0)","^(\\$ft1)","^(\\$ft2)","^(\\$ft3)","^(\\$ft4)","^(\\$ft5)","^(\\$ft6)","^(\\$ft7)","^(\\$fs0)","^(\\$fs1)","^(\\$fa0)","^(\\$fa1)","^(\\$fa2)","^(\\$fa3)","^(\\$fa4)","^(\\$fa5)","^(\\$fa6)","^(\\$fa7)","^(\\$fs2)","^(\\$fs3)","^(\\$fs4)","^(\\$fs5)","^(\\$fs6)","^(\\$fs7)","^(\\$fs8)","^(\\$fs9)","^(\\$fs10)","^(\\$fs11)","^(\\$ft8)","^(\\$ft9)","^(\\$ft10)","^(\\$ft11)","^(\\$x[0-9]+[ \t]*)","^(\\$f[0-9]+[ \t]*)","^(\\$v0\\.t)","^(\\$v[0-9]+[ \t]*)","^(\\$pc[ \t]*)","^(\\$harts[ \t]*)","^(mem)","^(if)","^(else)","^(while)","^(do)","^(until)","^(stripmine)","^(macro)","^([-+]?[0-9]+)","^(0x[0-9a-f]+)","^([-+]?[0-9]*\\.?[0-9]+([eE][-+]?[0-9]+)?)","^(\".*\")","^(#.*)","^([a-z][a-z0-9_]*)","^(\\[)","^(\\])","^(\\{)","^(\\})","^(\\()","^(\\))","^(:)","^(\\.byte)","^(\\.half)","^(\\.word)","^(\\.long)","^(\\.float)","^(\\.double)","^(\\.stringz)","^(\\.incbin)","^(\\.fill)","^(\\.zero)","^(\\.chase)","^(\\.random)","^(\\.iota)","^(\\.include)","^(\\.if)","^(\\.ifdef)","^(\\.ifndef)","^(\\.else)","^(\\.endif)","^([ \t]+)","^([\n\r]+)","^(,)","^(.)"};
+static const unsigned char fl_act[571][3] = {{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{0,1,0},{0,1,0},{0,1,0},{0,1,0},{0,1,0},{0,1,0},{0,0,1},{0,0,1},{0,0,1},{0,0,1},{0,0,1},{0,0,1},{0,0,1},{0,0,1},{0,0,1},{0,0,1},{0,0,1},{0,0,1},{0,0,1},{0,0,1},{0,0,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1},{1,1,1}};
+#define fl_active(r,c) fl_act[r][c]
+
+static void fl_load(FILE *f){
+    size_t cap = 1<<16; fl_len = 0; free(fl_buf); fl_buf = malloc(cap+1);
+    size_t n; while ((n = fread(fl_buf+fl_len,1,cap-fl_len,f)) > 0){ fl_len += n; if (fl_len == cap){ cap*=2; fl_buf = realloc(fl_buf,cap+1);} }
+    fl_buf[fl_len] = 0; fl_pos = 0;
+}
+void yyrestart(FILE *f){ yyin = f; fl_load(f); fl_cond = 0; }
+typedef struct { char *buf; size_t pos, len; int line; FILE *in; } fl_state_t;
+void *fl_save(void){ fl_state_t *s = malloc(sizeof(*s)); s->buf=fl_buf; s->pos=fl_pos; s->len=fl_len; s->line=yylineno; s->in=yyin; fl_buf=NULL; return s; }
+void fl_restore(void *p){ fl_state_t *s=p; free(fl_buf); fl_buf=s->buf; fl_pos=s->pos; fl_len=s->len; yylineno=s->line; yyin=s->in; free(s); }
+int fl_at_eof(void){ return fl_pos >= fl_len; }
+typedef struct { char *buf; size_t pos, len; } fl_buffer_t;
+typedef fl_buffer_t *YY_BUFFER_STATE;
+static YY_BUFFER_STATE fl_current(void){ if (!fl_buf) return NULL; fl_buffer_t *b = malloc(sizeof(*b)); b->buf=fl_buf; b->pos=fl_pos; b->len=fl_len; return b; }
+#define YY_CURRENT_BUFFER fl_current()
+YY_BUFFER_STATE yy_scan_bytes(const char *t, int n){ fl_buf = malloc(n+1); memcpy(fl_buf,t,n); fl_buf[n]=0; fl_len=n; fl_pos=0; return fl_current(); }
+void yy_switch_to_buffer(YY_BUFFER_STATE b){ fl_buf=b->buf; fl_pos=b->pos; fl_len=b->len; }
+void yy_delete_buffer(YY_BUFFER_STATE b){ free(b); }
+#ifndef YY_DECL
+#define YY_DECL int yylex(void)
+#endif
+YY_DECL{
+    if (!fl_init){
+        for (int i=0;i<(int)(sizeof(fl_pat)/sizeof(fl_pat[0]));i++){
+            if (fl_lit[i]) continue;
+            for (int h=0;h<2;h++){
+                regex_t fr; char one[2] = {0,0};
+                if (!fl_span_pat[i][h] || regcomp(&fr, fl_span_pat[i][h], REG_EXTENDED|REG_ICASE) != 0) continue;
+                for (int c=1;c<256;c++){ one[0]=(char)c; fl_span[i][h][c] = (regexec(&fr,one,0,NULL,0) == 0); }
+                regfree(&fr);
+            }
+            if (fl_first_pat[i]){
+                regex_t fr; char one[2] = {0,0};
+                if (regcomp(&fr, fl_first_pat[i], REG_EXTENDED|REG_ICASE|REG_NEWLINE) == 0){
+                    for (int c=1;c<256;c++){ one[0]=(char)c; fl_first[i][c] = (regexec(&fr,one,0,NULL,0) == 0); }
+                    regfree(&fr);
+                }
+                else
+                    memset(fl_first[i],1,256);
+            }
+            else
+                memset(fl_first[i],1,256);
+            int e = regcomp(&fl_re[i], fl_pat[i], REG_EXTENDED|REG_ICASE|REG_NEWLINE);
+            if (e){ char b[200]; regerror(e,&fl_re[i],b,200); fprintf(stderr,"flexlite: bad regex %d %s: %s\n",i,fl_pat[i],b); exit(2);} }
+        /* per first character, the rules that could match there, in rule order */
+        int n = (int)(sizeof(fl_pat)/sizeof(fl_pat[0]));
+        for (int c=0;c<256;c++){
+            fl_cand[c] = malloc(sizeof(int)*(n+1)); int k = 0;
+            for (int i=0;i<n;i++){
+                if (fl_lit[i] ? (tolower((unsigned char)fl_lit[i][0]) == tolower(c)) : fl_first[i][c]) fl_cand[c][k++] = i;
+            }
+            fl_cand[c][k] = -1;
+        }
+        fl_init = 1;
+    }
+    if (!fl_buf && yyin) fl_load(yyin);
+    static char *tbuf = NULL; static size_t tcap = 0;
+    for (;;){
+        if (!fl_buf || fl_pos >= fl_len) return 0;
+        int best = -1; int blen = 0;
+        /* limit the search window to speed up regexec */
+        size_t win = fl_len - fl_pos; { char *nl = memchr(fl_buf+fl_pos, '\n', win); if (nl) win = (size_t)(nl - (fl_buf+fl_pos)) + 1; }
+        char save = fl_buf[fl_pos+win]; fl_buf[fl_pos+win] = 0;
+        for (int *ci = fl_cand[(unsigned char)fl_buf[fl_pos]]; *ci >= 0; ci++){
+            int i = *ci;
+            if (!fl_active(i, fl_cond)) continue;
+            if (fl_lit[i]){
+                int l = fl_litlen[i];
+                if ((size_t)l <= win && strncasecmp(fl_buf+fl_pos, fl_lit[i], l) == 0 && l > blen){ blen = l; best = i; }
+                continue;
+            }
+            if (!fl_first[i][(unsigned char)fl_buf[fl_pos]]) continue;
+            if (fl_span_pat[i][0]){
+                size_t l = 0;
+                if (fl_span[i][0][(unsigned char)fl_buf[fl_pos]]){
+                    l = 1;
+                    if (fl_span_pat[i][1])
+                        while (l < win && fl_span[i][1][(unsigned char)fl_buf[fl_pos+l]]) l++;
+                }
+                if ((int)l > blen){ blen = (int)l; best = i; }
+                continue;
+            }
+            regmatch_t m;
+            if (regexec(&fl_re[i], fl_buf+fl_pos, 1, &m, 0) == 0 && m.rm_so == 0){
+                int l = m.rm_eo; if (l > blen){ blen = l; best = i; }
+            }
+        }
+        fl_buf[fl_pos+win] = save;
+        if (best < 0){ best = -1; blen = 1; }
+        if ((size_t)blen+1 > tcap){ tcap = blen+64; tbuf = realloc(tbuf,tcap); }
+        memcpy(tbuf, fl_buf+fl_pos, blen); tbuf[blen] = 0; yytext = tbuf; yyleng = blen;
+        fl_pos += blen;
+        for (int i=0;i<blen;i++) if (tbuf[i]=='\n') yylineno++;
+#ifdef YY_USER_ACTION
+        YY_USER_ACTION
+#endif
+        switch (best){
+
+        case 0: {return INST_LUI;} break;
+        case 1: {return INST_AUIPC;} break;
+        case 2: {return INST_JAL;} break;
+        case 3: {return INST_JALR;} break;
+        case 4: {return INST_BEQ;} break;
+        case 5: {return INST_BNE;} break;
+        case 6: {return INST_BLT;} break;
+        case 7: {return INST_BGE;} break;
+        case 8: {return INST_BLTU;} break;
+        case 9: {return INST_BGEU;} break;
+        case 10: {return INST_LB;} break;
+        case 11: {return INST_LH;} break;
+        case 12: {return INST_LW;} break;
+        case 13: {return INST_LBU;} break;
+        case 14: {return INST_LHU;} break;
+        case 15: {return INST_SB;} break;
+        case 16: {return INST_SH;} break;
+        case 17: {return INST_SW;} break;
+        case 18: {return INST_ADDI;} break;
+        case 19: {return INST_SLTI;} break;
+        case 20: {return INST_SLTIU;} break;
+        case 21: {return INST_XORI;} break;
+        case 22: {return INST_ORI;} break;
+        case 23: {return INST_ANDI;} break;
+        case 24: {return INST_SLLI;} break;
+        case 25: {return INST_SRLI;} break;
+        case 26: {return INST_SRAI;} break;
+        case 27: {return INST_ADD;} break;
+        case 28: {return INST_SUB;} break;
+        case 29: {return INST_SLL;} break;
+        case 30: {return INST_SLT;} break;
+        case 31: {return INST_SLTU;} break;
+        case 32: {return INST_XOR;} break;
+        case 33: {return INST_SRL;} break;
+        case 34: {return INST_SRA;} break;
+        case 35: {return INST_OR;} break;
+        case 36: {return INST_AND;} break;
+        case 37: {return INST_FENCE;} break;
+        case 38: {return INST_FENCE_I;} break;
+        case 39: {return INST_ECALL;} break;
+        case 40: {return INST_EBREAK;} break;
+        case 41: {return INST_CSRRW;} break;
+        case 42: {return INST_CSRRS;} break;
+        case 43: {return INST_CSRRC;} break;
+        case 44: {return INST_CSRRWI;} break;
+        case 45: {return INST_CSRRSI;} break;
+        case 46: {return INST_CSRRCI;} break;
+        case 47: {return INST_CSRR;} break;
+        case 48: {return INST_CSRW;} break;
+        case 49: {return INST_RDCYCLE;} break;
+        case 50: {return INST_RDTIME;} break;
+        case 51: {return INST_RDINSTRET;} break;
+        case 52: {return INST_J;} break;
+        case 53: {return INST_JR;} break;
+        case 54: {return INST_RET;} break;
+        case 55: {return INST_NOP;} break;
+        case 56: {return INST_MUL;} break;
+        case 57: {return INST_DIV;} break;
+        case 58: {return INST_LD;} break;
+        case 59: {return INST_SD;} break;
+        case 60: {return INST_LWU;} break;
+        case 61: {return INST_ADDIW;} break;
+        case 62: {return INST_SLLIW;} break;
+        case 63: {return INST_SRLIW;} break;
+        case 64: {return INST_SRAIW;} break;
+        case 65: {return INST_ADDW;} break;
+        case 66: {return INST_SUBW;} break;
+        case 67: {return INST_SLLW;} break;
+        case 68: {return INST_SRLW;} break;
+        case 69: {return INST_SRAW;} break;
+        case 70: {return INST_MULH;} break;
+        case 71: {return INST_MULHSU;} break;
+        case 72: {return INST_MULHU;} break;
+        case 73: {return INST_DIVU;} break;
+        case 74: {return INST_REM;} break;
+        case 75: {return INST_REMU;} break;
+        case 76: {return INST_MULW;} break;
+        case 77: {return INST_DIVW;} break;
+        case 78: {return INST_DIVUW;} break;
+        case 79: {return INST_REMW;} break;
+        case 80: {return INST_REMUW;} break;
+        case 81: {yylval.ivalue = amo_order(yytext); return INST_LR_W;} break;
+        case 82: {yylval.ivalue = amo_order(yytext); return INST_SC_W;} break;
+        case 83: {yylval.ivalue = amo_order(yytext); return INST_AMOSWAP_W;} break;
+        case 84: {yylval.ivalue = amo_order(yytext); return INST_AMOADD_W;} break;
+        case 85: {yylval.ivalue = amo_order(yytext); return INST_AMOXOR_W;} break;
+        case 86: {yylval.ivalue = amo_order(yytext); return INST_AMOAND_W;} break;
+        case 87: {yylval.ivalue = amo_order(yytext); return INST_AMOOR_W;} break;
+        case 88: {yylval.ivalue = amo_order(yytext); return INST_AMOMIN_W;} break;
+        case 89: {yylval.ivalue = amo_order(yytext); return INST_AMOMAX_W;} break;
+        case 90: {yylval.ivalue = amo_order(yytext); return INST_AMOMINU_W;} break;
+        case 91: {yylval.ivalue = amo_order(yytext); return INST_AMOMAXU_W;} break;
+        case 92: {yylval.ivalue = amo_order(yytext); return INST_LR_D;} break;
+        case 93: {yylval.ivalue = amo_order(yytext); return INST_SC_D;} break;
+        case 94: {yylval.ivalue = amo_order(yytext); return INST_AMOSWAP_D;} break;
+        case 95: {yylval.ivalue = amo_order(yytext); return INST_AMOADD_D;} break;
+        case 96: {yylval.ivalue = amo_order(yytext); return INST_AMOXOR_D;} break;
+        case 97: {yylval.ivalue = amo_order(yytext); return INST_AMOAND_D;} break;
+        case 98: {yylval.ivalue = amo_order(yytext); return INST_AMOOR_D;} break;
+        case 99: {yylval.ivalue = amo_order(yytext); return INST_AMOMIN_D;} break;
+        case 100: {yylval.ivalue = amo_order(yytext); return INST_AMOMAX_D;} break;
+        case 101: {yylval.ivalue = amo_order(yytext); return INST_AMOMINU_D;} break;
+        case 102: {yylval.ivalue = amo_order(yytext); return INST_AMOMAXU_D;} break;
+        case 103: {return INST_FLW;} break;
+        case 104: {return INST_FSW;} break;
+        case 105: {BEGIN(FRMOPS); return INST_FMADD_S;} break;
+        case 106: {BEGIN(FRMOPS); return INST_FMSUB_S;} break;
+        case 107: {BEGIN(FRMOPS); return INST_FNMSUB_S;} break;
+        case 108: {BEGIN(FRMOPS); return INST_FNMADD_S;} break;
+        case 109: {BEGIN(FRMOPS); return INST_FADD_S;} break;
+        case 110: {BEGIN(FRMOPS); return INST_FSUB_S;} break;
+        case 111: {BEGIN(FRMOPS); return INST_FMUL_S;} break;
+        case 112: {BEGIN(FRMOPS); return INST_FDIV_S;} break;
+        case 113: {BEGIN(FRMOPS); return INST_FSQRT_S;} break;
+        case 114: {return INST_FSGNJ_S;} break;
+        case 115: {return INST_FSGNJN_S;} break;
+        case 116: {return INST_FSGNJX_S;} break;
+        case 117: {return INST_FMIN_S;} break;
+        case 118: {return INST_FMAX_S;} break;
+        case 119: {return INST_FEQ_S;} break;
+        case 120: {return INST_FLT_S;} break;
+        case 121: {return INST_FLE_S;} break;
+        case 122: {return INST_FCLASS_S;} break;
+        case 123: {BEGIN(FRMOPS); return INST_FCVT_W_S;} break;
+        case 124: {BEGIN(FRMOPS); return INST_FCVT_WU_S;} break;
+        case 125: {BEGIN(FRMOPS); return INST_FCVT_L_S;} break;
+        case 126: {BEGIN(FRMOPS); return INST_FCVT_LU_S;} break;
+        case 127: {BEGIN(FRMOPS); return INST_FCVT_S_W;} break;
+        case 128: {BEGIN(FRMOPS); return INST_FCVT_S_WU;} break;
+        case 129: {BEGIN(FRMOPS); return INST_FCVT_S_L;} break;
+        case 130: {BEGIN(FRMOPS); return INST_FCVT_S_LU;} break;
+        case 131: {return INST_FMV_X_W;} break;
+        case 132: {return INST_FMV_W_X;} break;
+        case 133: {return INST_FLD;} break;
+        case 134: {return INST_FSD;} break;
+        case 135: {BEGIN(FRMOPS); return INST_FMADD_D;} break;
+        case 136: {BEGIN(FRMOPS); return INST_FMSUB_D;} break;
+        case 137: {BEGIN(FRMOPS); return INST_FNMSUB_D;} break;
+        case 138: {BEGIN(FRMOPS); return INST_FNMADD_D;} break;
+        case 139: {BEGIN(FRMOPS); return INST_FADD_D;} break;
+        case 140: {BEGIN(FRMOPS); return INST_FSUB_D;} break;
+        case 141: {BEGIN(FRMOPS); return INST_FMUL_D;} break;
+        case 142: {BEGIN(FRMOPS); return INST_FDIV_D;} break;
+        case 143: {BEGIN(FRMOPS); return INST_FSQRT_D;} break;
+        case 144: {return INST_FSGNJ_D;} break;
+        case 145: {return INST_FSGNJN_D;} break;
+        case 146: {return INST_FSGNJX_D;} break;
+        case 147: {return INST_FMIN_D;} break;
+        case 148: {return INST_FMAX_D;} break;
+        case 149: {return INST_FEQ_D;} break;
+        case 150: {return INST_FLT_D;} break;
+        case 151: {return INST_FLE_D;} break;
+        case 152: {return INST_FCLASS_D;} break;
+        case 153: {BEGIN(FRMOPS); return INST_FCVT_W_D;} break;
+        case 154: {BEGIN(FRMOPS); return INST_FCVT_WU_D;} break;
+        case 155: {BEGIN(FRMOPS); return INST_FCVT_L_D;} break;
+        case 156: {BEGIN(FRMOPS); return INST_FCVT_LU_D;} break;
+        case 157: {return INST_FCVT_D_W;} break;
+        case 158: {return INST_FCVT_D_WU;} break;
+        case 159: {BEGIN(FRMOPS); return INST_FCVT_D_L;} break;
+        case 160: {BEGIN(FRMOPS); return INST_FCVT_D_LU;} break;
+        case 161: {return INST_FMV_X_D;} break;
+        case 162: {return INST_FMV_D_X;} break;
+        case 163: {BEGIN(FRMOPS); return INST_FCVT_S_D;} break;
+        case 164: {return INST_FCVT_D_S;} break;
+        case 165: {return INST_FMV_S;} break;
+        case 166: {return INST_FNEG_S;} break;
+        case 167: {return INST_FABS_S;} break;
+        case 168: {return INST_FMV_D;} break;
+        case 169: {return INST_FNEG_D;} break;
+        case 170: {return INST_FABS_D;} break;
+        case 171: {return INST_FRCSR;} break;
+        case 172: {return INST_FSCSR;} break;
+        case 173: {return INST_FRRM;} break;
+        case 174: {return INST_FSRM;} break;
+        case 175: {return INST_FRFLAGS;} break;
+        case 176: {return INST_FSFLAGS;} break;
+        case 177: {BEGIN(VTYPEOPS); return INST_VSETVLI;} break;
+        case 178: {BEGIN(VTYPEOPS); return INST_VSETIVLI;} break;
+        case 179: {return INST_VSETVL;} break;
+        case 180: {return INST_VLE8_V;} break;
+        case 181: {return INST_VLE8FF_V;} break;
+        case 182: {return INST_VSE8_V;} break;
+        case 183: {return INST_VLSE8_V;} break;
+        case 184: {return INST_VSSE8_V;} break;
+        case 185: {return INST_VLUXEI8_V;} break;
+        case 186: {return INST_VLOXEI8_V;} break;
+        case 187: {return INST_VSUXEI8_V;} break;
+        case 188: {return INST_VSOXEI8_V;} break;
+        case 189: {return INST_VLE16_V;} break;
+        case 190: {return INST_VLE16FF_V;} break;
+        case 191: {return INST_VSE16_V;} break;
+        case 192: {return INST_VLSE16_V;} break;
+        case 193: {return INST_VSSE16_V;} break;
+        case 194: {return INST_VLUXEI16_V;} break;
+        case 195: {return INST_VLOXEI16_V;} break;
+        case 196: {return INST_VSUXEI16_V;} break;
+        case 197: {return INST_VSOXEI16_V;} break;
+        case 198: {return INST_VLE32_V;} break;
+        case 199: {return INST_VLE32FF_V;} break;
+        case 200: {return INST_VSE32_V;} break;
+        case 201: {return INST_VLSE32_V;} break;
+        case 202: {return INST_VSSE32_V;} break;
+        case 203: {return INST_VLUXEI32_V;} break;
+        case 204: {return INST_VLOXEI32_V;} break;
+        case 205: {return INST_VSUXEI32_V;} break;
+        case 206: {return INST_VSOXEI32_V;} break;
+        case 207: {return INST_VLE64_V;} break;
+        case 208: {return INST_VLE64FF_V;} break;
+        case 209: {return INST_VSE64_V;} break;
+        case 210: {return INST_VLSE64_V;} break;
+        case 211: {return INST_VSSE64_V;} break;
+        case 212: {return INST_VLUXEI64_V;} break;
+        case 213: {return INST_VLOXEI64_V;} break;
+        case 214: {return INST_VSUXEI64_V;} break;
+        case 215: {return INST_VSOXEI64_V;} break;
+        case 216: {return INST_VLM_V;} break;
+        case 217: {return INST_VSM_V;} break;
+        case 218: {return INST_VADD_VV;} break;
+        case 219: {return INST_VADD_VX;} break;
+        case 220: {return INST_VADD_VI;} break;
+        case 221: {return INST_VSUB_VV;} break;
+        case 222: {return INST_VSUB_VX;} break;
+        case 223: {return INST_VRSUB_VX;} break;
+        case 224: {return INST_VRSUB_VI;} break;
+        case 225: {return INST_VMINU_VV;} break;
+        case 226: {return INST_VMINU_VX;} break;
+        case 227: {return INST_VMIN_VV;} break;
+        case 228: {return INST_VMIN_VX;} break;
+        case 229: {return INST_VMAXU_VV;} break;
+        case 230: {return INST_VMAXU_VX;} break;
+        case 231: {return INST_VMAX_VV;} break;
+        case 232: {return INST_VMAX_VX;} break;
+        case 233: {return INST_VAND_VV;} break;
+        case 234: {return INST_VAND_VX;} break;
+        case 235: {return INST_VAND_VI;} break;
+        case 236: {return INST_VOR_VV;} break;
+        case 237: {return INST_VOR_VX;} break;
+        case 238: {return INST_VOR_VI;} break;
+        case 239: {return INST_VXOR_VV;} break;
+        case 240: {return INST_VXOR_VX;} break;
+        case 241: {return INST_VXOR_VI;} break;
+        case 242: {return INST_VRGATHER_VV;} break;
+        case 243: {return INST_VRGATHER_VX;} break;
+        case 244: {return INST_VRGATHER_VI;} break;
+        case 245: {return INST_VSLIDEUP_VX;} break;
+        case 246: {return INST_VSLIDEUP_VI;} break;
+        case 247: {return INST_VSLIDEDOWN_VX;} break;
+        case 248: {return INST_VSLIDEDOWN_VI;} break;
+        case 249: {return INST_VMSEQ_VV;} break;
+        case 250: {return INST_VMSEQ_VX;} break;
+        case 251: {return INST_VMSEQ_VI;} break;
+        case 252: {return INST_VMSNE_VV;} break;
+        case 253: {return INST_VMSNE_VX;} break;
+        case 254: {return INST_VMSNE_VI;} break;
+        case 255: {return INST_VMSLTU_VV;} break;
+        case 256: {return INST_VMSLTU_VX;} break;
+        case 257: {return INST_VMSLT_VV;} break;
+        case 258: {return INST_VMSLT_VX;} break;
+        case 259: {return INST_VMSLEU_VV;} break;
+        case 260: {return INST_VMSLEU_VX;} break;
+        case 261: {return INST_VMSLEU_VI;} break;
+        case 262: {return INST_VMSLE_VV;} break;
+        case 263: {return INST_VMSLE_VX;} break;
+        case 264: {return INST_VMSLE_VI;} break;
+        case 265: {return INST_VMSGTU_VX;} break;
+        case 266: {return INST_VMSGTU_VI;} break;
+        case 267: {return INST_VMSGT_VX;} break;
+        case 268: {return INST_VMSGT_VI;} break;
+        case 269: {return INST_VSLL_VV;} break;
+        case 270: {return INST_VSLL_VX;} break;
+        case 271: {return INST_VSLL_VI;} break;
+        case 272: {return INST_VSRL_VV;} break;
+        case 273: {return INST_VSRL_VX;} break;
+        case 274: {return INST_VSRL_VI;} break;
+        case 275: {return INST_VSRA_VV;} break;
+        case 276: {return INST_VSRA_VX;} break;
+        case 277: {return INST_VSRA_VI;} break;
+        case 278: {return INST_VNSRL_WV;} break;
+        case 279: {return INST_VNSRL_WX;} break;
+        case 280: {return INST_VNSRL_WI;} break;
+        case 281: {return INST_VNSRA_WV;} break;
+        case 282: {return INST_VNSRA_WX;} break;
+        case 283: {return INST_VNSRA_WI;} break;
+        case 284: {return INST_VMERGE_VVM;} break;
+        case 285: {return INST_VMERGE_VXM;} break;
+        case 286: {return INST_VMERGE_VIM;} break;
+        case 287: {return INST_VMV_V_V;} break;
+        case 288: {return INST_VMV_V_X;} break;
+        case 289: {return INST_VMV_V_I;} break;
+        case 290: {return INST_VDIVU_VV;} break;
+        case 291: {return INST_VDIVU_VX;} break;
+        case 292: {return INST_VDIV_VV;} break;
+        case 293: {return INST_VDIV_VX;} break;
+        case 294: {return INST_VREMU_VV;} break;
+        case 295: {return INST_VREMU_VX;} break;
+        case 296: {return INST_VREM_VV;} break;
+        case 297: {return INST_VREM_VX;} break;
+        case 298: {return INST_VMULHU_VV;} break;
+        case 299: {return INST_VMULHU_VX;} break;
+        case 300: {return INST_VMUL_VV;} break;
+        case 301: {return INST_VMUL_VX;} break;
+        case 302: {return INST_VMULHSU_VV;} break;
+        case 303: {return INST_VMULHSU_VX;} break;
+        case 304: {return INST_VMULH_VV;} break;
+        case 305: {return INST_VMULH_VX;} break;
+        case 306: {return INST_VWADDU_VV;} break;
+        case 307: {return INST_VWADDU_VX;} break;
+        case 308: {return INST_VWADD_VV;} break;
+        case 309: {return INST_VWADD_VX;} break;
+        case 310: {return INST_VWSUBU_VV;} break;
+        case 311: {return INST_VWSUBU_VX;} break;
+        case 312: {return INST_VWSUB_VV;} break;
+        case 313: {return INST_VWSUB_VX;} break;
+        case 314: {return INST_VWMULU_VV;} break;
+        case 315: {return INST_VWMULU_VX;} break;
+        case 316: {return INST_VWMULSU_VV;} break;
+        case 317: {return INST_VWMULSU_VX;} break;
+        case 318: {return INST_VWMUL_VV;} break;
+        case 319: {return INST_VWMUL_VX;} break;
+        case 320: {return INST_VMADD_VV;} break;
+        case 321: {return INST_VMADD_VX;} break;
+        case 322: {return INST_VNMSUB_VV;} break;
+        case 323: {return INST_VNMSUB_VX;} break;
+        case 324: {return INST_VMACC_VV;} break;
+        case 325: {return INST_VMACC_VX;} break;
+        case 326: {return INST_VNMSAC_VV;} break;
+        case 327: {return INST_VNMSAC_VX;} break;
+        case 328: {return INST_VWMACCU_VV;} break;
+        case 329: {return INST_VWMACCU_VX;} break;
+        case 330: {return INST_VWMACC_VV;} break;
+        case 331: {return INST_VWMACC_VX;} break;
+        case 332: {return INST_VREDSUM_VS;} break;
+        case 333: {return INST_VREDAND_VS;} break;
+        case 334: {return INST_VREDOR_VS;} break;
+        case 335: {return INST_VREDXOR_VS;} break;
+        case 336: {return INST_VREDMINU_VS;} break;
+        case 337: {return INST_VREDMIN_VS;} break;
+        case 338: {return INST_VREDMAXU_VS;} break;
+        case 339: {return INST_VREDMAX_VS;} break;
+        case 340: {return INST_VSLIDE1UP_VX;} break;
+        case 341: {return INST_VSLIDE1DOWN_VX;} break;
+        case 342: {return INST_VMV_X_S;} break;
+        case 343: {return INST_VMV_S_X;} break;
+        case 344: {return INST_VCPOP_M;} break;
+        case 345: {return INST_VFIRST_M;} break;
+        case 346: {return INST_VIOTA_M;} break;
+        case 347: {return INST_VID_V;} break;
+        case 348: {return INST_VMANDN_MM;} break;
+        case 349: {return INST_VMAND_MM;} break;
+        case 350: {return INST_VMOR_MM;} break;
+        case 351: {return INST_VMXOR_MM;} break;
+        case 352: {return INST_VMORN_MM;} break;
+        case 353: {return INST_VMNAND_MM;} break;
+        case 354: {return INST_VMNOR_MM;} break;
+        case 355: {return INST_VMXNOR_MM;} break;
+        case 356: {return INST_VFADD_VV;} break;
+        case 357: {return INST_VFADD_VF;} break;
+        case 358: {return INST_VFSUB_VV;} break;
+        case 359: {return INST_VFSUB_VF;} break;
+        case 360: {return INST_VFRSUB_VF;} break;
+        case 361: {return INST_VFMIN_VV;} break;
+        case 362: {return INST_VFMIN_VF;} break;
+        case 363: {return INST_VFMAX_VV;} break;
+        case 364: {return INST_VFMAX_VF;} break;
+        case 365: {return INST_VFSGNJ_VV;} break;
+        case 366: {return INST_VFSGNJ_VF;} break;
+        case 367: {return INST_VFSGNJN_VV;} break;
+        case 368: {return INST_VFSGNJN_VF;} break;
+        case 369: {return INST_VFSGNJX_VV;} break;
+        case 370: {return INST_VFSGNJX_VF;} break;
+        case 371: {return INST_VFDIV_VV;} break;
+        case 372: {return INST_VFDIV_VF;} break;
+        case 373: {return INST_VFRDIV_VF;} break;
+        case 374: {return INST_VFMUL_VV;} break;
+        case 375: {return INST_VFMUL_VF;} break;
+        case 376: {return INST_VMFEQ_VV;} break;
+        case 377: {return INST_VMFEQ_VF;} break;
+        case 378: {return INST_VMFLE_VV;} break;
+        case 379: {return INST_VMFLE_VF;} break;
+        case 380: {return INST_VMFLT_VV;} break;
+        case 381: {return INST_VMFLT_VF;} break;
+        case 382: {return INST_VMFNE_VV;} break;
+        case 383: {return INST_VMFNE_VF;} break;
+        case 384: {return INST_VMFGT_VF;} break;
+        case 385: {return INST_VMFGE_VF;} break;
+        case 386: {return INST_VFMADD_VV;} break;
+        case 387: {return INST_VFMADD_VF;} break;
+        case 388: {return INST_VFNMADD_VV;} break;
+        case 389: {return INST_VFNMADD_VF;} break;
+        case 390: {return INST_VFMSUB_VV;} break;
+        case 391: {return INST_VFMSUB_VF;} break;
+        case 392: {return INST_VFNMSUB_VV;} break;
+        case 393: {return INST_VFNMSUB_VF;} break;
+        case 394: {return INST_VFMACC_VV;} break;
+        case 395: {return INST_VFMACC_VF;} break;
+        case 396: {return INST_VFNMACC_VV;} break;
+        case 397: {return INST_VFNMACC_VF;} break;
+        case 398: {return INST_VFMSAC_VV;} break;
+        case 399: {return INST_VFMSAC_VF;} break;
+        case 400: {return INST_VFNMSAC_VV;} break;
+        case 401: {return INST_VFNMSAC_VF;} break;
+        case 402: {return INST_VFREDUSUM_VS;} break;
+        case 403: {return INST_VFREDOSUM_VS;} break;
+        case 404: {return INST_VFREDMIN_VS;} break;
+        case 405: {return INST_VFREDMAX_VS;} break;
+        case 406: {return INST_VFSQRT_V;} break;
+        case 407: {return INST_VFCVT_XU_F_V;} break;
+        case 408: {return INST_VFCVT_X_F_V;} break;
+        case 409: {return INST_VFCVT_F_XU_V;} break;
+        case 410: {return INST_VFCVT_F_X_V;} break;
+        case 411: {return INST_VFCVT_RTZ_XU_F_V;} break;
+        case 412: {return INST_VFCVT_RTZ_X_F_V;} break;
+        case 413: {return INST_VFMV_F_S;} break;
+        case 414: {return INST_VFMV_S_F;} break;
+        case 415: {return INST_VFMV_V_F;} break;
+        case 416: {return INST_VFMERGE_VFM;} break;
+        case 417: {yylval.ivalue = FRM_RNE; return ROUNDMODE;} break;
+        case 418: {yylval.ivalue = FRM_RTZ; return ROUNDMODE;} break;
+        case 419: {yylval.ivalue = FRM_RDN; return ROUNDMODE;} break;
+        case 420: {yylval.ivalue = FRM_RUP; return ROUNDMODE;} break;
+        case 421: {yylval.ivalue = FRM_RMM; return ROUNDMODE;} break;
+        case 422: {yylval.ivalue = FRM_DYN; return ROUNDMODE;} break;
+        case 423: {yylval.ivalue = VSEW_E8;   return VSEW;} break;
+        case 424: {yylval.ivalue = VSEW_E16;  return VSEW;} break;
+        case 425: {yylval.ivalue = VSEW_E32;  return VSEW;} break;
+        case 426: {yylval.ivalue = VSEW_E64;  return VSEW;} break;
+        case 427: {yylval.ivalue = VLMUL_MF8; return VLMUL;} break;
+        case 428: {yylval.ivalue = VLMUL_MF4; return VLMUL;} break;
+        case 429: {yylval.ivalue = VLMUL_MF2; return VLMUL;} break;
+        case 430: {yylval.ivalue = VLMUL_M1;  return VLMUL;} break;
+        case 431: {yylval.ivalue = VLMUL_M2;  return VLMUL;} break;
+        case 432: {yylval.ivalue = VLMUL_M4;  return VLMUL;} break;
+        case 433: {yylval.ivalue = VLMUL_M8;  return VLMUL;} break;
+        case 434: {yylval.ivalue = VTYPE_TA;  return VTAIL;} break;
+        case 435: {yylval.ivalue = 0;         return VTAIL;} break;
+        case 436: {yylval.ivalue = VTYPE_MA;  return VMASKPOL;} break;
+        case 437: {yylval.ivalue = 0;         return VMASKPOL;} break;
+        case 438: {return PLUS;} break;
+        case 439: {return MINUS;} break;
+        case 440: {return MULTIPLY;} break;
+        case 441: {return DIVIDE;} break;
+        case 442: {return AND;} break;
+        case 443: {return OR;} break;
+        case 444: {return NOT;} break;
+        case 445: {return XOR;} break;
+        case 446: {return LSHIFT;} break;
+        case 447: {return RSHIFT;} break;
+        case 448: {return ADDRESSOF;} break;
+        case 449: {return LT;} break;
+        case 450: {return GT;} break;
+        case 451: {return LTE;} break;
+        case 452: {return GTE;} break;
+        case 453: {return EQ;} break;
+        case 454: {return NEQ;} break;
+        case 455: {return ASSIGN;} break;
+        case 456: {yylval.ivalue = (int64_t) 0;  return IREG;} break;
+        case 457: {yylval.ivalue = (int64_t) 1;  return IREG;} break;
+        case 458: {yylval.ivalue = (int64_t) 2;  return IREG;} break;
+        case 459: {yylval.ivalue = (int64_t) 3;  return IREG;} break;
+        case 460: {yylval.ivalue = (int64_t) 4;  return IREG;} break;
+        case 461: {yylval.ivalue = (int64_t) 5;  return IREG;} break;
+        case 462: {yylval.ivalue = (int64_t) 6;  return IREG;} break;
+        case 463: {yylval.ivalue = (int64_t) 7;  return IREG;} break;
+        case 464: {yylval.ivalue = (int64_t) 8;  return IREG;} break;
+        case 465: {yylval.ivalue = (int64_t) 8;  return IREG;} break;
+        case 466: {yylval.ivalue = (int64_t) 9;  return IREG;} break;
+        case 467: {yylval.ivalue = (int64_t) 10; return IREG;} break;
+        case 468: {yylval.ivalue = (int64_t) 11; return IREG;} break;
+        case 469: {yylval.ivalue = (int64_t) 12; return IREG;} break;
+        case 470: {yylval.ivalue = (int64_t) 13; return IREG;} break;
+        case 471: {yylval.ivalue = (int64_t) 14; return IREG;} break;
+        case 472: {yylval.ivalue = (int64_t) 15; return IREG;} break;
+        case 473: {yylval.ivalue = (int64_t) 16; return IREG;} break;
+        case 474: {yylval.ivalue = (int64_t) 17; return IREG;} break;
+        case 475: {yylval.ivalue = (int64_t) 18; return IREG;} break;
+        case 476: {yylval.ivalue = (int64_t) 19; return IREG;} break;
+        case 477: {yylval.ivalue = (int64_t) 20; return IREG;} break;
+        case 478: {yylval.ivalue = (int64_t) 21; return IREG;} break;
+        case 479: {yylval.ivalue = (int64_t) 22; return IREG;} break;
+        case 480: {yylval.ivalue = (int64_t) 23; return IREG;} break;
+        case 481: {yylval.ivalue = (int64_t) 24; return IREG;} break;
+        case 482: {yylval.ivalue = (int64_t) 25; return IREG;} break;
+        case 483: {yylval.ivalue = (int64_t) 26; return IREG;} break;
+        case 484: {yylval.ivalue = (int64_t) 27; return IREG;} break;
+        case 485: {yylval.ivalue = (int64_t) 28; return IREG;} break;
+        case 486: {yylval.ivalue = (int64_t) 29; return IREG;} break;
+        case 487: {yylval.ivalue = (int64_t) 30; return IREG;} break;
+        case 488: {yylval.ivalue = (int64_t) 31; return IREG;} break;
+        case 489: {yylval.ivalue = (int64_t) 0;  return FREG;} break;
+        case 490: {yylval.ivalue = (int64_t) 1;  return FREG;} break;
+        case 491: {yylval.ivalue = (int64_t) 2;  return FREG;} break;
+        case 492: {yylval.ivalue = (int64_t) 3;  return FREG;} break;
+        case 493: {yylval.ivalue = (int64_t) 4;  return FREG;} break;
+        case 494: {yylval.ivalue = (int64_t) 5;  return FREG;} break;
+        case 495: {yylval.ivalue = (int64_t) 6;  return FREG;} break;
+        case 496: {yylval.ivalue = (int64_t) 7;  return FREG;} break;
+        case 497: {yylval.ivalue = (int64_t) 8;  return FREG;} break;
+        case 498: {yylval.ivalue = (int64_t) 9;  return FREG;} break;
+        case 499: {yylval.ivalue = (int64_t) 10; return FREG;} break;
+        case 500: {yylval.ivalue = (int64_t) 11; return FREG;} break;
+        case 501: {yylval.ivalue = (int64_t) 12; return FREG;} break;
+        case 502: {yylval.ivalue = (int64_t) 13; return FREG;} break;
+        case 503: {yylval.ivalue = (int64_t) 14; return FREG;} break;
+        case 504: {yylval.ivalue = (int64_t) 15; return FREG;} break;
+        case 505: {yylval.ivalue = (int64_t) 16; return FREG;} break;
+        case 506: {yylval.ivalue = (int64_t) 17; return FREG;} break;
+        case 507: {yylval.ivalue = (int64_t) 18; return FREG;} break;
+        case 508: {yylval.ivalue = (int64_t) 19; return FREG;} break;
+        case 509: {yylval.ivalue = (int64_t) 20; return FREG;} break;
+        case 510: {yylval.ivalue = (int64_t) 21; return FREG;} break;
+        case 511: {yylval.ivalue = (int64_t) 22; return FREG;} break;
+        case 512: {yylval.ivalue = (int64_t) 23; return FREG;} break;
+        case 513: {yylval.ivalue = (int64_t) 24; return FREG;} break;
+        case 514: {yylval.ivalue = (int64_t) 25; return FREG;} break;
+        case 515: {yylval.ivalue = (int64_t) 26; return FREG;} break;
+        case 516: {yylval.ivalue = (int64_t) 27; return FREG;} break;
+        case 517: {yylval.ivalue = (int64_t) 28; return FREG;} break;
+        case 518: {yylval.ivalue = (int64_t) 29; return FREG;} break;
+        case 519: {yylval.ivalue = (int64_t) 30; return FREG;} break;
+        case 520: {yylval.ivalue = (int64_t) 31; return FREG;} break;
+        case 521: {yylval.ivalue = (int64_t) atoi(&yytext[2]); return IREG;} break;
+        case 522: {yylval.ivalue = (int64_t) atoi(&yytext[2]); return FREG;} break;
+        case 523: {return VMASK;} break;
+        case 524: {yylval.ivalue = (int64_t) atoi(&yytext[2]); return VREG;} break;
+        case 525: {return PCREG;} break;
+        case 526: {return HARTSREG;} break;
+        case 527: {return MEMBLOCK;} break;
+        case 528: {return IFBLOCK;} break;
+        case 529: {return ELSEBLOCK;} break;
+        case 530: {return WHILEBLOCK;} break;
+        case 531: {return DOBLOCK;} break;
+        case 532: {return UNTILBLOCK;} break;
+        case 533: {BEGIN(VTYPEOPS); return STRIPMINEBLOCK;} break;
+        case 534: {return MACROBLOCK;} break;
+        case 535: {yylval.ivalue = (int64_t) strtoull(yytext,NULL,10); return IIMM;} break;
+        case 536: {sscanf(yytext,"%" PRIx64,&(yylval.ivalue)); return IIMM;} break;
+        case 537: {yylval.fvalue = strtod(yytext,NULL); return FIMM;} break;
+        case 538: {yylval.string = strndup(&yytext[1],strlen(yytext)-2); return STRING;} break;
+        case 539: ; break;
+        case 540: {yylval.string = strdup(yytext); return (symtab_type(yylval.string) == SYMTAB_FREG) ? FLABEL : LABEL;} break;
+        case 541: {return LBRACKET;} break;
+        case 542: {return RBRACKET;} break;
+        case 543: {return LBRACE;} break;
+        case 544: {return RBRACE;} break;
+        case 545: {return LPAREN;} break;
+        case 546: {BEGIN(INITIAL); return RPAREN;} break;
+        case 547: {return COLON;} break;
+        case 548: {return BYTEFILL;} break;
+        case 549: {return HALFFILL;} break;
+        case 550: {return WORDFILL;} break;
+        case 551: {return LONGFILL;} break;
+        case 552: {return FLOATFILL;} break;
+        case 553: {return DOUBLEFILL;} break;
+        case 554: {return STRINGZFILL;} break;
+        case 555: {return INCBINFILL;} break;
+        case 556: {return RUNFILL;} break;
+        case 557: {return ZEROFILL;} break;
+        case 558: {return CHASEFILL;} break;
+        case 559: {return RANDOMFILL;} break;
+        case 560: {return IOTAFILL;} break;
+        case 561: {return INCLUDEDIR;} break;
+        case 562: {return IFDIR;} break;
+        case 563: {return IFDEFDIR;} break;
+        case 564: {return IFNDEFDIR;} break;
+        case 565: {return ELSEDIR;} break;
+        case 566: {return ENDIFDIR;} break;
+        case 567: ; break;
+        case 568: {BEGIN(INITIAL); /* linefeed -- nothing else to do */} break;
+        case 569: ; break;
+        case 570: {return UNKNOWN;} break;
+        default: break;
+        }
+    }
+}
+
+/* scans the whole of an included file's text in a buffer of its own, 
+   handing every token to the caller, then picks up the file that 
+   included it where it left off */
+void scan_text(char *text, int length, char *file, void (*token_seen)(int)){
+    YY_BUFFER_STATE outer = YY_CURRENT_BUFFER;
+    YY_BUFFER_STATE buffer;
+    int outer_line = yylineno;
+    int outer_column = lex_column;
+    char *outer_file = lex_file;
+    int token;
+
+    buffer = yy_scan_bytes(text,length);
+    yylineno = 1;
+    lex_column = 1;
+    lex_file = file;
+    do {
+        token = dt_lex();
+        token_seen(token);
+    } while (token != 0);
+    yy_delete_buffer(buffer);
+    if (outer)
+        yy_switch_to_buffer(outer);
+    yylineno = outer_line;
+    lex_column = outer_column;
+    lex_file = outer_file;
+}
+
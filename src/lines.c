@@ -0,0 +1,356 @@
+/* This file is part of the DuctTape (dt) high-level assembler for 
+ * RISC-V. The dt project was written by Justin Severeid and Elliott 
+ * Forbes, University of Wisconsin-La Crosse, copyright 2020-2024.
+ *
+ * DuctTape is free software: you can redistribute it and/or modify 
+ * it under the terms of the GNU General Public License as published 
+ * by the Free Software Foundation, either version 3 of the License, 
+ * or (at your option) any later version.
+ *
+ * DuctTape is distributed in the hope that it will be useful, but 
+ * WITHOUT ANY WARRANTY; without even the implied warranty of 
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU 
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License 
+ * along with DuctTape. If not, see <https://www.gnu.org/licenses/>. 
+ *
+ *
+ *
+ * The dt project can be found at https://cs.uwlax.edu/~eforbes/dt/
+ *
+ * If you use dt in your published research, please consider 
+ * citing the following:
+ *
+ * Severeid, J. and Forbes, E., "dt: A High-level Assembler for RISC-V," 
+ * Proceedings of the 53rd Midwest Instruction and Computing Symposium, 
+ * April 2020. 
+ *
+ * If you found dt helpful, please let us know! Email eforbes@uwlax.edu
+ *
+ * There are bound to be bugs, let us know those too.
+ */
+
+
+
+/*
+ * the source line table: which file, line and column each address came 
+ * from. ELF output carries it as a DWARF .debug_line program, with the 
+ * smallest .debug_info and .debug_abbrev that let addr2line, gdb and 
+ * perf find it. The flat -text and -bin images get a plain text map.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <inttypes.h>
+
+#include "lines.h"
+#include "mem.h"
+#include "output.h"
+#include "util.h"
+
+/* the few DWARF constants used here */
+#define DW_TAG_compile_unit     0x11
+#define DW_CHILDREN_no          0x00
+#define DW_AT_name              0x03
+#define DW_AT_stmt_list         0x10
+#define DW_AT_low_pc            0x11
+#define DW_AT_high_pc           0x12
+#define DW_AT_language          0x13
+#define DW_AT_producer          0x25
+#define DW_FORM_addr            0x01
+#define DW_FORM_data2           0x05
+#define DW_FORM_data4           0x06
+#define DW_FORM_string          0x08
+#define DW_LANG_Mips_Assembler  0x8001
+#define DW_LNS_copy             1
+#define DW_LNS_advance_pc       2
+#define DW_LNS_advance_line     3
+#define DW_LNS_set_file         4
+#define DW_LNS_set_column       5
+#define DW_LNE_end_sequence     1
+#define DW_LNE_set_address      2
+
+/* line program parameters, the usual ones */
+#define LINE_BASE   -5
+#define LINE_RANGE  14
+#define OPCODE_BASE 13
+
+static const uint8_t standard_opcode_lengths[OPCODE_BASE-1] = {0,1,1,1,1,0,0,0,1,0,0,1};
+
+typedef struct {
+    uint8_t *data;
+    uint64_t size;
+    uint64_t capacity;
+} bytes_t;
+
+static void put_u8(bytes_t *bytes, uint8_t value){
+    if (bytes->size == bytes->capacity){
+        bytes->capacity = bytes->capacity ? bytes->capacity * 2 : 256;
+        bytes->data = (uint8_t*)realloc(bytes->data,bytes->capacity);
+        if (!bytes->data) yyerror("Unable to allocate memory for the line table");
+    }
+    bytes->data[bytes->size++] = value;
+}
+
+/* little-endian, like everything else dt writes */
+static void put_uint(bytes_t *bytes, uint64_t value, int size){
+    int i;
+    for (i=0;i<size;i++)
+        put_u8(bytes,(value >> (8*i)) & 0xff);
+}
+
+static void put_uleb(bytes_t *bytes, uint64_t value){
+    do {
+        uint8_t byte = value & 0x7f;
+        value >>= 7;
+        put_u8(bytes,value ? (byte | 0x80) : byte);
+    } while (value);
+}
+
+static void put_sleb(bytes_t *bytes, int64_t value){
+    for (;;){
+        uint8_t byte = value & 0x7f;
+        value >>= 7; // arithmetic shift
+        if (((value == 0) && !(byte & 0x40)) || ((value == -1) && (byte & 0x40))){
+            put_u8(bytes,byte);
+            return;
+        }
+        put_u8(bytes,byte | 0x80);
+    }
+}
+
+static void put_string(bytes_t *bytes, const char *s){
+    do {
+        put_u8(bytes,*s);
+    } while (*s++);
+}
+
+static void patch_u32(bytes_t *bytes, uint64_t offset, uint32_t value){
+    int i;
+    for (i=0;i<4;i++)
+        bytes->data[offset+i] = (value >> (8*i)) & 0xff;
+}
+
+/* an entry starts a row when it has bytes and came from somewhere new */
+static BOOL starts_row(mem_entry_t *entry, mem_entry_t *last){
+    if ((entry->size == 0) || !entry->loc.file)
+        return FALSE;
+    if (!last)
+        return TRUE;
+    return (entry->loc.line != last->loc.line) || (entry->loc.column != last->loc.column) ||
+           strcmp(entry->loc.file,last->loc.file);
+}
+
+static uint64_t block_end(memblock_list_t *list){
+    mem_entry_t *working;
+    uint64_t end = list->min_address;
+
+    for (working=list->head;working;working=working->next){
+        if (working->address + working->size > end)
+            end = working->address + working->size;
+    }
+    return end;
+}
+
+static char **files = NULL;
+static int file_count = 0;
+
+/* 1-based, in order of first appearance */
+static int file_index(char *file){
+    int i;
+
+    for (i=0;i<file_count;i++){
+        if (strcmp(files[i],file) == 0)
+            return i+1;
+    }
+    files = (char**)realloc(files,sizeof(char*) * (file_count+1));
+    if (!files) yyerror("Unable to allocate memory for the line table");
+    files[file_count++] = file;
+    return file_count;
+}
+
+/* one sequence per mem() block, every address offset by bias */
+static void line_program(bytes_t *program, uint64_t bias){
+    memblock_list_t *list;
+    mem_entry_t *working;
+
+    for (list=block_list;list;list=list->next){
+        mem_entry_t *last = NULL;
+        uint64_t address = 0;
+        int64_t line = 1;
+        uint32_t column = 0;
+        int file = 1;
+
+        for (working=list->head;working;working=working->next){
+            uint64_t address_delta;
+            int64_t line_delta;
+            int index;
+
+            if (!starts_row(working,last))
+                continue;
+            if (!last){
+                put_u8(program,0);
+                put_uleb(program,9);
+                put_u8(program,DW_LNE_set_address);
+                put_uint(program,working->address + bias,8);
+                address = working->address;
+            }
+            index = file_index(working->loc.file);
+            if (index != file){
+                put_u8(program,DW_LNS_set_file);
+                put_uleb(program,index);
+                file = index;
+            }
+            if (working->loc.column != column){
+                put_u8(program,DW_LNS_set_column);
+                put_uleb(program,working->loc.column);
+                column = working->loc.column;
+            }
+
+            address_delta = working->address - address;
+            line_delta = (int64_t)working->loc.line - line;
+            if ((line_delta >= LINE_BASE) && (line_delta < LINE_BASE + LINE_RANGE) &&
+                ((line_delta - LINE_BASE) + (LINE_RANGE * address_delta) + OPCODE_BASE <= 255)){
+                put_u8(program,(line_delta - LINE_BASE) + (LINE_RANGE * address_delta) + OPCODE_BASE);
+            }
+            else {
+                if (address_delta){
+                    put_u8(program,DW_LNS_advance_pc);
+                    put_uleb(program,address_delta);
+                }
+                if (line_delta){
+                    put_u8(program,DW_LNS_advance_line);
+                    put_sleb(program,line_delta);
+                }
+                put_u8(program,DW_LNS_copy);
+            }
+            address = working->address;
+            line = working->loc.line;
+            last = working;
+        }
+
+        if (last){
+            put_u8(program,DW_LNS_advance_pc);
+            put_uleb(program,block_end(list) - address);
+            put_u8(program,0);
+            put_uleb(program,1);
+            put_u8(program,DW_LNE_end_sequence);
+        }
+    }
+}
+
+void build_dwarf_sections(dwarf_sections_t *sections, uint64_t bias){
+    bytes_t line = {NULL, 0, 0};
+    bytes_t program = {NULL, 0, 0};
+    bytes_t info = {NULL, 0, 0};
+    bytes_t abbrev = {NULL, 0, 0};
+    memblock_list_t *list;
+    uint64_t low_pc = UINT64_MAX;
+    uint64_t high_pc = 0;
+    uint64_t header_start;
+    char producer[64];
+    int i;
+
+    /* the program first, it fills in the file table the header needs */
+    line_program(&program,bias);
+
+    put_uint(&line,0,4);  // unit_length, patched below
+    put_uint(&line,3,2);  // version
+    put_uint(&line,0,4);  // header_length, patched below
+    header_start = line.size;
+    put_u8(&line,1);      // minimum_instruction_length, rvc and data are byte granular
+    put_u8(&line,1);      // default_is_stmt
+    put_u8(&line,(uint8_t)LINE_BASE);
+    put_u8(&line,LINE_RANGE);
+    put_u8(&line,OPCODE_BASE);
+    for (i=0;i<OPCODE_BASE-1;i++)
+        put_u8(&line,standard_opcode_lengths[i]);
+    put_u8(&line,0);      // no include directories, file names are as given to dt
+    for (i=0;i<file_count;i++){
+        put_string(&line,files[i]);
+        put_uleb(&line,0); // directory
+        put_uleb(&line,0); // modification time
+        put_uleb(&line,0); // length
+    }
+    put_u8(&line,0);
+    patch_u32(&line,6,line.size - header_start);
+    for (uint64_t j=0;j<program.size;j++)
+        put_u8(&line,program.data[j]);
+    patch_u32(&line,0,line.size - 4);
+    free(program.data);
+
+    put_uleb(&abbrev,1);
+    put_uleb(&abbrev,DW_TAG_compile_unit);
+    put_u8(&abbrev,DW_CHILDREN_no);
+    put_uleb(&abbrev,DW_AT_name);       put_uleb(&abbrev,DW_FORM_string);
+    put_uleb(&abbrev,DW_AT_producer);   put_uleb(&abbrev,DW_FORM_string);
+    put_uleb(&abbrev,DW_AT_language);   put_uleb(&abbrev,DW_FORM_data2);
+    put_uleb(&abbrev,DW_AT_stmt_list);  put_uleb(&abbrev,DW_FORM_data4);
+    put_uleb(&abbrev,DW_AT_low_pc);     put_uleb(&abbrev,DW_FORM_addr);
+    put_uleb(&abbrev,DW_AT_high_pc);    put_uleb(&abbrev,DW_FORM_addr);
+    put_uleb(&abbrev,0);
+    put_uleb(&abbrev,0);
+    put_uleb(&abbrev,0);
+
+    for (list=block_list;list;list=list->next){
+        if (list->min_address < low_pc)
+            low_pc = list->min_address;
+        if (block_end(list) > high_pc)
+            high_pc = block_end(list);
+    }
+    if (low_pc > high_pc)
+        low_pc = high_pc;
+    snprintf(producer,sizeof(producer),"DuctTape %d.%d.%d",dt_major_vers,dt_minor_vers,dt_patch_vers);
+
+    put_uint(&info,0,4);  // unit_length, patched below
+    put_uint(&info,3,2);  // version
+    put_uint(&info,0,4);  // offset into .debug_abbrev
+    put_u8(&info,8);      // address size
+    put_uleb(&info,1);
+    put_string(&info,file_count ? files[0] : "");
+    put_string(&info,producer);
+    put_uint(&info,DW_LANG_Mips_Assembler,2);
+    put_uint(&info,0,4);  // offset into .debug_line
+    put_uint(&info,low_pc + bias,8);
+    put_uint(&info,high_pc + bias,8);
+    patch_u32(&info,0,info.size - 4);
+
+    sections->line = line.data;
+    sections->line_size = line.size;
+    sections->info = info.data;
+    sections->info_size = info.size;
+    sections->abbrev = abbrev.data;
+    sections->abbrev_size = abbrev.size;
+}
+
+void free_dwarf_sections(dwarf_sections_t *sections){
+    free(sections->line);
+    free(sections->info);
+    free(sections->abbrev);
+}
+
+/* address file:line:column, one row per change, for the flat image outputs */
+void write_line_map(char *file){
+    FILE *fp = fopen(file,"w");
+    memblock_list_t *list;
+    mem_entry_t *working;
+
+    if (!fp) yyerror("Unable to open file for the line map.");
+
+    for (list=block_list;list;list=list->next){
+        mem_entry_t *last = NULL;
+        for (working=list->head;working;working=working->next){
+            if (!starts_row(working,last))
+                continue;
+            fprintf(fp,"%012" PRIx64 "  %s:%" PRIu32 ":%" PRIu32 "\n",
+                working->address,working->loc.file,working->loc.line,working->loc.column);
+            last = working;
+        }
+    }
+
+    output_bytes += ftell(fp);
+    if (fclose(fp) != 0) yyerror("Error closing the line map.");
+}
@@ -0,0 +1,465 @@
+/* This file is part of the DuctTape (dt) high-level assembler for 
+ * RISC-V. The dt project was written by Justin Severeid and Elliott 
+ * Forbes, University of Wisconsin-La Crosse, copyright 2020-2024.
+ *
+ * DuctTape is free software: you can redistribute it and/or modify 
+ * it under the terms of the GNU General Public License as published 
+ * by the Free Software Foundation, either version 3 of the License, 
+ * or (at your option) any later version.
+ *
+ * DuctTape is distributed in the hope that it will be useful, but 
+ * WITHOUT ANY WARRANTY; without even the implied warranty of 
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU 
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License 
+ * along with DuctTape. If not, see <https://www.gnu.org/licenses/>. 
+ *
+ *
+ *
+ * The dt project can be found at https://cs.uwlax.edu/~eforbes/dt/
+ *
+ * If you use dt in your published research, please consider 
+ * citing the following:
+ *
+ * Severeid, J. and Forbes, E., "dt: A High-level Assembler for RISC-V," 
+ * Proceedings of the 53rd Midwest Instruction and Computing Symposium, 
+ * April 2020. 
+ *
+ * If you found dt helpful, please let us know! Email eforbes@uwlax.edu
+ *
+ * There are bound to be bugs, let us know those too.
+ */
+
+
+/*
+ * macro definitions and their expansion
+ *
+ * A definition is recorded as the tokens of its body, and an invocation 
+ * replays those tokens to the parser with the arguments substituted, so 
+ * a macro expands straight into IR through the same grammar rules as 
+ * hand-written code. Labels and vars declared inside the body get a fresh 
+ * name on every expansion.
+ *
+ *     macro bump(ptr, n) {
+ *         again: ptr = ptr + n
+ *         ...
+ *     }
+ *     bump($a0, 8)
+ *
+ * The same token stream carries conditional assembly. .if (cond), 
+ * .ifdef NAME and .ifndef NAME start a conditional, with an optional 
+ * .else and a closing .endif, and the arm not taken is thrown away 
+ * here token by token. A condition is an immediate or a -D name, or 
+ * two of them compared with == != < <= > or >=. -D names themselves 
+ * are turned into immediates here too.
+ *
+ *     .if (UNROLL >= 4)
+ *         ...
+ *     .else
+ *         ...
+ *     .endif
+ *
+ * The tokens underneath all of this come from include.c, which takes 
+ * care of .include and of -sweep's tape.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+#include <stdint.h>
+#include <inttypes.h>
+
+#include "macro.h"
+#include "define.h"
+#include "include.h"
+#include "symtab.h"
+#include "util.h"
+#include "dt.tab.h"
+
+typedef struct {
+    int token;
+    YYSTYPE value;
+    int param; /* index of the parameter this token names, or -1 */
+    int local; /* index of the body label this token names, or -1 */
+} macro_token_t;
+
+typedef struct macro_type {
+    char *name;
+    int nparams;
+    char **params;
+    int nlocals;
+    char **locals;
+    int ntokens;
+    macro_token_t *tokens;
+    struct macro_type *next; /* chain within a hash bucket */
+} macro_t;
+
+typedef struct {
+    macro_t *macro;
+    int pos;
+    macro_token_t args[MACRO_MAX_PARAMS];
+    char **local_names;
+} macro_frame_t;
+
+typedef struct {
+    BOOL taken;   /* one of the arms has been assembled */
+    BOOL in_else;
+} cond_frame_t;
+
+#define MACRO_BUCKETS 1024
+
+static macro_t *macro_buckets[MACRO_BUCKETS];
+static macro_frame_t macro_stack[MACRO_MAX_DEPTH];
+static int macro_depth = 0;
+static int macro_expansions = 0;
+static cond_frame_t cond_stack[COND_MAX_DEPTH];
+static int cond_depth = 0;
+
+static uint32_t macro_hash(char *name){
+    return fnv1a(FNV1A_BASIS,name,strlen(name)) % MACRO_BUCKETS;
+}
+
+static macro_t *find_macro(char *name){
+    macro_t *working = macro_buckets[macro_hash(name)];
+    while (working){
+        if (strcmp(name, working->name) == 0)
+            return working;
+        working = working->next;
+    }
+    return NULL;
+}
+
+static int find_name(char **names, int count, char *name){
+    for (int i = 0; i < count; i++){
+        if (strcmp(names[i], name) == 0)
+            return i;
+    }
+    return -1;
+}
+
+static void macro_error(const char *format, char *name){
+    char buff[200];
+    snprintf(buff,sizeof(buff),format,name);
+    yyerror(buff);
+}
+
+static int is_name(int token){
+    return (token == LABEL) || (token == FLABEL);
+}
+
+/* reads "name(params) { body }" straight from the scanner, the macro 
+   keyword has already been consumed */
+static void define_macro(){
+    macro_t *macro;
+    int token;
+    int capacity = 16;
+    int depth = 1;
+
+    if (!is_name(scan_token()))
+        yyerror("Expected a name after macro.");
+    if (find_macro(yylval.string))
+        macro_error("Duplicate macro definition: %s.",yylval.string);
+    if (symtab_type(yylval.string) != (symtab_type_t)-1)
+        macro_error("Macro name is already a label: %s.",yylval.string);
+
+    macro = (macro_t*)malloc(sizeof(macro_t));
+    macro->name = yylval.string;
+    macro->nparams = 0;
+    macro->params = (char**)malloc(sizeof(char*)*MACRO_MAX_PARAMS);
+    macro->nlocals = 0;
+    macro->locals = NULL;
+    macro->ntokens = 0;
+    macro->tokens = (macro_token_t*)malloc(sizeof(macro_token_t)*capacity);
+
+    if (scan_token() != LPAREN)
+        macro_error("Expected a parameter list after macro %s.",macro->name);
+    while ((token = scan_token()) != RPAREN){
+        if (!is_name(token))
+            macro_error("Macro parameters must be names, in macro %s.",macro->name);
+        if (find_name(macro->params,macro->nparams,yylval.string) >= 0)
+            macro_error("Duplicate macro parameter: %s.",yylval.string);
+        if (macro->nparams == MACRO_MAX_PARAMS)
+            macro_error("Too many parameters for macro %s.",macro->name);
+        macro->params[macro->nparams++] = yylval.string;
+    }
+    if (scan_token() != LBRACE)
+        macro_error("Expected { after the parameters of macro %s.",macro->name);
+
+    /* capture the body, up to the matching brace */
+    for (;;){
+        token = scan_token();
+        if (token == 0)
+            macro_error("Unterminated definition of macro %s.",macro->name);
+        if (token == MACROBLOCK)
+            macro_error("Macros cannot be defined inside macro %s.",macro->name);
+        if (token == LBRACE)
+            depth++;
+        if ((token == RBRACE) && (--depth == 0))
+            break;
+        if (macro->ntokens == capacity){
+            capacity *= 2;
+            macro->tokens = (macro_token_t*)realloc(macro->tokens,sizeof(macro_token_t)*capacity);
+        }
+        macro->tokens[macro->ntokens].token = is_name(token) ? LABEL : token;
+        macro->tokens[macro->ntokens].value = yylval;
+        macro->tokens[macro->ntokens].param = -1;
+        macro->tokens[macro->ntokens].local = -1;
+        macro->ntokens++;
+    }
+
+    /* labels and vars declared in the body are private to each expansion */
+    macro->locals = (char**)malloc(sizeof(char*)*(macro->ntokens+1));
+    for (int i = 0; i < macro->ntokens; i++){
+        macro_token_t *t = &macro->tokens[i];
+        if ((t->token == LABEL) &&
+            (((i+1 < macro->ntokens) && (macro->tokens[i+1].token == COLON)) ||
+             ((i > 0) && (macro->tokens[i-1].token == LABEL) &&
+              (strcasecmp(macro->tokens[i-1].value.string,"var") == 0))) &&
+            (find_name(macro->params,macro->nparams,t->value.string) < 0) &&
+            (find_name(macro->locals,macro->nlocals,t->value.string) < 0))
+            macro->locals[macro->nlocals++] = t->value.string;
+    }
+    for (int i = 0; i < macro->ntokens; i++){
+        macro_token_t *t = &macro->tokens[i];
+        if (t->token == LABEL){
+            t->param = find_name(macro->params,macro->nparams,t->value.string);
+            t->local = find_name(macro->locals,macro->nlocals,t->value.string);
+        }
+    }
+
+    macro->next = macro_buckets[macro_hash(macro->name)];
+    macro_buckets[macro_hash(macro->name)] = macro;
+}
+
+/* the next token from the innermost expansion, or from the scanner once 
+   every expansion has run out */
+static int next_token(YYSTYPE *value){
+    while (macro_depth > 0){
+        macro_frame_t *frame = &macro_stack[macro_depth-1];
+        if (frame->pos < frame->macro->ntokens){
+            macro_token_t *t = &frame->macro->tokens[frame->pos++];
+            if (t->param >= 0){
+                *value = frame->args[t->param].value;
+                return frame->args[t->param].token;
+            }
+            *value = t->value;
+            if (t->local >= 0)
+                value->string = frame->local_names[t->local];
+            if (t->token == LABEL)
+                return (symtab_type(value->string) == SYMTAB_FREG) ? FLABEL : LABEL;
+            return t->token;
+        }
+        /* the parser keeps the names it was handed, only the array goes */
+        free(frame->local_names);
+        frame->local_names = NULL;
+        macro_depth--;
+    }
+    int token = scan_token();
+    *value = yylval;
+    return token;
+}
+
+/* reads the argument list of an invocation and starts replaying the body */
+static void expand_macro(macro_t *macro){
+    macro_frame_t *frame;
+    YYLTYPE invocation = yylloc; /* the body is stamped with the macro name's location */
+    YYSTYPE value;
+    int token;
+    int nargs = 0;
+
+    if (macro_depth == MACRO_MAX_DEPTH)
+        macro_error("Macro %s is nested too deeply, is it recursive?",macro->name);
+    frame = &macro_stack[macro_depth];
+
+    if (next_token(&value) != LPAREN)
+        macro_error("Expected an argument list after macro %s.",macro->name);
+    while ((token = next_token(&value)) != RPAREN){
+        if ((token != IREG) && (token != FREG) && (token != VREG) && (token != IIMM) &&
+            (token != FIMM) && (token != STRING) && !is_name(token))
+            macro_error("Arguments to macro %s must be registers, immediates, strings or names.",macro->name);
+        if (nargs == macro->nparams)
+            macro_error("Too many arguments to macro %s.",macro->name);
+        frame->args[nargs].token = token;
+        frame->args[nargs].value = value;
+        nargs++;
+    }
+    if (nargs != macro->nparams)
+        macro_error("Too few arguments to macro %s.",macro->name);
+
+    /* hygiene -- the expansion number keeps body labels apart, and the 
+       leading underscores keep them apart from anything a user can write */
+    macro_expansions++;
+    frame->local_names = NULL;
+    if (macro->nlocals > 0){
+        frame->local_names = (char**)malloc(sizeof(char*)*macro->nlocals);
+        for (int i = 0; i < macro->nlocals; i++){
+            int length = strlen(macro->name) + strlen(macro->locals[i]) + 32;
+            frame->local_names[i] = (char*)malloc(length);
+            snprintf(frame->local_names[i],length,"__macro%d_%s_%s",
+                     macro_expansions,macro->name,macro->locals[i]);
+        }
+    }
+
+    frame->macro = macro;
+    frame->pos = 0;
+    macro_depth++;
+    yylloc = invocation;
+}
+
+static int is_conditional(int token){
+    return (token == IFDIR) || (token == IFDEFDIR) || (token == IFNDEFDIR);
+}
+
+/* an operand of an .if condition, an immediate or a -D name */
+static int64_t cond_operand(int token, YYSTYPE *value){
+    int64_t result = 0;
+
+    if (is_name(token)){
+        if (!lookup_define(value->string,&result))
+            macro_error("%s in an .if condition has no value, give it one with -D or use .ifdef.",value->string);
+    }
+    else if (token == IIMM)
+        result = value->ivalue;
+    else
+        yyerror("An .if condition can only use immediates and -D names.");
+    return result;
+}
+
+/* (a) or (a op b), the .if keyword has already been consumed */
+static BOOL read_condition(){
+    YYSTYPE value;
+    int64_t left, right;
+    int op;
+
+    if (next_token(&value) != LPAREN)
+        yyerror("Expected ( after .if.");
+    left = cond_operand(next_token(&value),&value);
+    if ((op = next_token(&value)) == RPAREN)
+        return left != 0;
+    right = cond_operand(next_token(&value),&value);
+    if (next_token(&value) != RPAREN)
+        yyerror("Expected ) to close the .if condition.");
+    switch (op){
+        case EQ:  return left == right;
+        case NEQ: return left != right;
+        case LT:  return left < right;
+        case LTE: return left <= right;
+        case GT:  return left > right;
+        case GTE: return left >= right;
+    }
+    yyerror("An .if condition compares with == != < <= > or >=.");
+    return FALSE;
+}
+
+/* throws away tokens up to the .else or .endif that ends an arm that 
+   isn't being assembled, skipping over any .ifs nested in it */
+static void skip_arm(){
+    YYSTYPE value;
+    int token;
+    int depth = 0;
+
+    for (;;){
+        token = next_token(&value);
+        if (token == 0)
+            yyerror("Unterminated .if.");
+        if (is_conditional(token))
+            depth++;
+        else if ((token == ENDIFDIR) && (depth > 0))
+            depth--;
+        else if (token == ENDIFDIR){
+            cond_depth--;
+            return;
+        }
+        else if ((token == ELSEDIR) && (depth == 0)){
+            cond_frame_t *frame = &cond_stack[cond_depth-1];
+            if (frame->in_else)
+                yyerror("Second .else for the same .if.");
+            frame->in_else = TRUE;
+            if (!frame->taken){
+                frame->taken = TRUE;
+                return;
+            }
+        }
+    }
+}
+
+/* .if, .ifdef or .ifndef, and the arm it starts when that isn't taken */
+static void begin_conditional(int token){
+    YYSTYPE value;
+    int64_t ignored;
+    BOOL taken;
+
+    if (cond_depth == COND_MAX_DEPTH)
+        yyerror(".if is nested too deeply.");
+    if (token == IFDIR)
+        taken = read_condition();
+    else {
+        if (!is_name(next_token(&value)))
+            yyerror("Expected a name after .ifdef or .ifndef.");
+        taken = lookup_define(value.string,&ignored);
+        if (token == IFNDEFDIR)
+            taken = !taken;
+    }
+    cond_stack[cond_depth].taken = taken;
+    cond_stack[cond_depth].in_else = FALSE;
+    cond_depth++;
+    if (!taken)
+        skip_arm();
+}
+
+/* the parser's scanner -- definitions are swallowed here and invocations 
+   are replaced by their bodies, the grammar never sees either. Nor does 
+   it see conditional assembly, or a -D name. */
+int yylex(){
+    YYSTYPE value;
+    int token;
+    int64_t constant;
+    macro_t *macro;
+
+    for (;;){
+        token = next_token(&value);
+        if (token == MACROBLOCK){
+            define_macro();
+            continue;
+        }
+        if (is_conditional(token)){
+            begin_conditional(token);
+            continue;
+        }
+        if (token == INCLUDEDIR){
+            if (macro_depth > 0)
+                yyerror(".include cannot be used inside a macro.");
+            begin_include();
+            continue;
+        }
+        if (token == ELSEDIR){
+            if (cond_depth == 0)
+                yyerror(".else without an .if.");
+            if (cond_stack[cond_depth-1].in_else)
+                yyerror("Second .else for the same .if.");
+            cond_stack[cond_depth-1].in_else = TRUE;
+            skip_arm(); /* the arm before it was the one taken */
+            continue;
+        }
+        if (token == ENDIFDIR){
+            if (cond_depth == 0)
+                yyerror(".endif without an .if.");
+            cond_depth--;
+            continue;
+        }
+        if ((token == 0) && (cond_depth > 0))
+            yyerror("Unterminated .if.");
+        if (is_name(token) && lookup_define(value.string,&constant)){
+            value.ivalue = constant;
+            token = IIMM;
+        }
+        if (is_name(token) && (macro = find_macro(value.string))){
+            expand_macro(macro);
+            continue;
+        }
+        yylval = value;
+        return token;
+    }
+}
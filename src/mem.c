@@ -40,22 +40,33 @@
 #include <string.h>
 #include <stdint.h>
 #include <inttypes.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 #include "mem.h"
 #include "inst.h"
+#include "symtab.h"
 #include "util.h"
 
 
+uint64_t mem_alloc_bytes = 0; /* the IR's share of the heap, for -stats */
+srcloc_t current_loc = {NULL, 0, 0}; /* start of the grammar rule being reduced, kept up to date by the parser */
+
 mem_entry_t * new_mem_entry(type_t type, uint32_t size){
     mem_entry_t * new_entry = (mem_entry_t *) malloc(sizeof(mem_entry_t));
+    mem_alloc_bytes += sizeof(mem_entry_t);
     new_entry->status = ENTRY_INCOMPLETE;
     new_entry->type = type;
     new_entry->name = NULL;
     new_entry->address = 0;
     new_entry->size = size;
     new_entry->inst = NULL;
+    new_entry->loc = current_loc;
     new_entry->ivalue = 0;
     new_entry->next = NULL;
+    new_entry->tail = NULL;
 
     return new_entry;
 }
@@ -63,6 +74,7 @@ mem_entry_t * new_mem_entry(type_t type, uint32_t size){
 mem_entry_t * new_instruction(uint32_t opcode){
     instruction_t * new_inst = (instruction_t*)malloc(sizeof(instruction_t));
     mem_entry_t * new_entry = (mem_entry_t*)malloc(sizeof(mem_entry_t));
+    mem_alloc_bytes += sizeof(instruction_t) + sizeof(mem_entry_t);
     new_inst->inst_id = -1;
     new_inst->opcode = opcode;
     new_inst->funct3 = 0;
@@ -70,7 +82,7 @@ mem_entry_t * new_instruction(uint32_t opcode){
     new_inst->rdst = 0;
     new_inst->rsrc1 = 0;
     new_inst->rsrc2 = 0;
-    new_inst->imm = 0;
+    new_inst->target_address = 0; /* clears all of imm's union, not just the low word */
     new_inst->target_name = NULL;
 
     new_entry->status = ENTRY_INCOMPLETE;
@@ -79,23 +91,206 @@ mem_entry_t * new_instruction(uint32_t opcode){
     new_entry->address = 0;
     new_entry->size = 4;
     new_entry->inst = new_inst;
+    new_entry->loc = current_loc;
     new_entry->encoding = 0;
     new_entry->next = NULL;
+    new_entry->tail = NULL;
+
+    return new_entry;
+}
+
+/* a relative .incbin path is tried as given, then beside the source file */
+static int open_incbin(char *file){
+    int fd = open(file, O_RDONLY);
+    char *slash;
+
+    if ((fd < 0) && (file[0] != '/') && current_loc.file && (slash = strrchr(current_loc.file,'/'))){
+        int dir_length = slash - current_loc.file + 1;
+        char *path = (char*)malloc(dir_length + strlen(file) + 1);
+        if (!path) yyerror("Unable to allocate memory for .incbin path");
+        memcpy(path,current_loc.file,dir_length);
+        strcpy(path + dir_length,file);
+        fd = open(path, O_RDONLY);
+        free(path);
+    }
+    return fd;
+}
+
+/* 
+   .incbin "file" [offset [length]] -- one entry for the whole payload, 
+   pointing into a read-only mapping of the file that is never unmapped, 
+   so a multi-MB table costs one mem_entry_t and no parsing. a negative 
+   length means up to the end of the file.
+*/
+mem_entry_t * new_blob(char *file, int64_t offset, int64_t length){
+    mem_entry_t *new_entry = new_mem_entry(ENTRY_BLOB,0);
+    struct stat info;
+    uint8_t *map;
+    int fd;
+
+    if ((fd = open_incbin(file)) < 0)
+        yyerror("Unable to open .incbin file");
+    if (fstat(fd,&info) != 0)
+        yyerror("Unable to read the size of .incbin file");
+    if ((offset < 0) || (offset > info.st_size))
+        yyerror(".incbin offset is past the end of the file");
+    if (length < 0)
+        length = info.st_size - offset;
+    if (length > info.st_size - offset)
+        yyerror(".incbin length is past the end of the file");
+    if (length > UINT32_MAX)
+        yyerror(".incbin payload is larger than 4 GB");
+
+    new_entry->size = length;
+    new_entry->blob = NULL;
+    if (length > 0){
+        /* map from 0, mmap offsets have to be page aligned */
+        map = (uint8_t*)mmap(NULL, offset + length, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (map == MAP_FAILED)
+            yyerror("Unable to map .incbin file");
+        new_entry->blob = map + offset;
+    }
+    close(fd);
+
+    return new_entry;
+}
+
+value_list_t * new_value_list(){
+    value_list_t *list = (value_list_t*)malloc(sizeof(value_list_t));
+    if (!list) yyerror("Unable to allocate memory for a data list");
+    list->count = 0;
+    list->capacity = 0;
+    list->ivalues = NULL;
+    return list;
+}
+
+/* both kinds of value are 8 bytes, so the list grows the same way for either */
+static void grow_value_list(value_list_t *list){
+    if (list->count == list->capacity){
+        list->capacity = list->capacity ? list->capacity * 2 : 16;
+        list->ivalues = (int64_t*)realloc(list->ivalues,sizeof(int64_t) * list->capacity);
+        if (!list->ivalues) yyerror("Unable to allocate memory for a data list");
+    }
+}
+
+void push_ivalue(value_list_t *list, int64_t value){
+    grow_value_list(list);
+    list->ivalues[list->count++] = value;
+}
+
+void push_fvalue(value_list_t *list, double value){
+    grow_value_list(list);
+    list->fvalues[list->count++] = value;
+}
+
+mem_entry_t * new_array_entry(type_t type, uint64_t count, uint32_t width){
+    mem_entry_t *new_entry = new_mem_entry(type,0);
+    data_array_t *array = (data_array_t*)malloc(sizeof(data_array_t));
+    if (!array) yyerror("Unable to allocate memory for a data list");
+
+    /* divide rather than multiply, count * width can wrap past zero */
+    if ((width != 0) && (count > UINT32_MAX / width))
+        yyerror("Data list or fill is larger than 4 GB");
+    array->width = width;
+    array->align = width;
+    array->value = 0;
+    array->bytes = NULL;
+    array->generator = GEN_NONE;
+    new_entry->size = count * width;
+    new_entry->array = array;
+    mem_alloc_bytes += sizeof(data_array_t);
+    return new_entry;
+}
+
+/* .byte/.half/.word/.long with more than one value, packed little-endian */
+mem_entry_t * new_int_array(value_list_t *list, uint32_t width){
+    mem_entry_t *new_entry = new_array_entry(ENTRY_ARRAY,list->count,width);
+    uint8_t *bytes = (uint8_t*)malloc(new_entry->size);
+    uint64_t i;
+    uint32_t j;
+
+    if (!bytes) yyerror("Unable to allocate memory for a data list");
+    for (i=0;i<list->count;i++){
+        for (j=0;j<width;j++)
+            bytes[i*width + j] = (list->ivalues[i] >> (8*j)) & 0xff;
+    }
+    new_entry->array->bytes = bytes;
+    mem_alloc_bytes += new_entry->size;
+
+    free(list->ivalues);
+    free(list);
+    return new_entry;
+}
+
+/* .float/.double with more than one value */
+mem_entry_t * new_fp_array(value_list_t *list, uint32_t width){
+    mem_entry_t *new_entry = new_array_entry(ENTRY_ARRAY,list->count,width);
+    uint8_t *bytes = (uint8_t*)malloc(new_entry->size);
+    uint64_t i;
+
+    if (!bytes) yyerror("Unable to allocate memory for a data list");
+    for (i=0;i<list->count;i++){
+        if (width == sizeof(float)){
+            float value = (float)list->fvalues[i];
+            memcpy(bytes + i*width,&value,width);
+        }
+        else
+            memcpy(bytes + i*width,&(list->fvalues[i]),width);
+    }
+    new_entry->array->bytes = bytes;
+    mem_alloc_bytes += new_entry->size;
+
+    free(list->fvalues);
+    free(list);
+    return new_entry;
+}
+
+/* .fill count, size, value -- nothing is expanded until a writer needs the bytes */
+mem_entry_t * new_fill(int64_t count, int64_t width, int64_t value){
+    mem_entry_t *new_entry;
 
+    if (count < 0)
+        yyerror(".fill count must not be negative");
+    if ((width != 1) && (width != 2) && (width != 4) && (width != 8))
+        yyerror(".fill size must be 1, 2, 4 or 8");
+    new_entry = new_array_entry(ENTRY_FILL,count,width);
+    new_entry->array->value = value;
     return new_entry;
 }
 
+/* the first size bytes of a run, size need not be a whole number of elements */
+void fill_bytes(uint8_t *dst, data_array_t *run, uint64_t size){
+    uint64_t i;
+
+    if ((run->width == 1) || (run->value == 0)){
+        memset(dst,run->value & 0xff,size);
+        return;
+    }
+    for (i=0;(i<run->width) && (i<size);i++)
+        dst[i] = (run->value >> (8*i)) & 0xff;
+    /* then keep doubling what is there, it is always whole elements */
+    while (i < size){
+        uint64_t length = (i < size - i) ? i : size - i;
+        memcpy(dst + i,dst,length);
+        i += length;
+    }
+}
+
 mem_entry_t *append_inst(mem_entry_t *list, mem_entry_t *inst){
     if (list){
-        mem_entry_t *working = list;
-        while (working){
-            if (working->next == NULL){
-                /* found the end of the existing list */
-                working->next = inst;
-                break;
-            }
+        /* start at the last known end of the list, so building a long 
+           instlist one entry at a time stays linear */
+        mem_entry_t *working = list->tail ? list->tail : list;
+        while (working->next)
             working = working->next;
+        /* found the end of the existing list */
+        working->next = inst;
+        if (inst){
+            working = inst->tail ? inst->tail : inst;
+            while (working->next)
+                working = working->next;
         }
+        list->tail = working;
         return list;
     }
     else{
@@ -103,14 +298,64 @@ mem_entry_t *append_inst(mem_entry_t *list, mem_entry_t *inst){
     }
 }
 
+/* instructions are word aligned, or half word aligned when compressing */
+uint32_t inst_alignment = 4;
+
+/* assign the final address of every entry in a mem() block, starting from start */
+void layout_memblock(mem_entry_t *list, uint64_t start){
+    uint64_t current_address = start;
+    mem_entry_t * working = list;
+    while (working){
+        /* correct for alignment, depending on data type */
+        if (((working->type == ENTRY_LDATA) || 
+           (working->type == ENTRY_DDATA)) && 
+           (current_address & 0x7)){ // 8 byte types
+            while (current_address & 0x7)
+                current_address++;
+        }
+        else if ((working->type == ENTRY_INSTRUCTION) && 
+                (current_address & (inst_alignment - 1))){ // 4 byte, or 2 byte if compressing
+            while (current_address & (inst_alignment - 1))
+                current_address++;
+        }
+        else if (((working->type == ENTRY_WDATA) || 
+                (working->type == ENTRY_FDATA)) && 
+                (current_address & 0x3)){ // 4 byte types
+            while (current_address & 0x3)
+                current_address++;
+        }
+        else if ((working->type == ENTRY_HDATA) && 
+                (current_address & 0x1)){ // 2 byte types
+            while (current_address & 0x1)
+                current_address++;
+        }
+        else if (((working->type == ENTRY_ARRAY) || 
+                (working->type == ENTRY_FILL) || 
+                (working->type == ENTRY_GEN)) && 
+                (current_address & (working->array->align - 1))){ // lists, runs and generated sets, usually to their element size
+            while (current_address & (working->array->align - 1))
+                current_address++;
+        }
+        // 1 byte types (byte, string, incbin) do not need alignment
+
+        // now save the finalized address, and update the symbol table
+        working->address = current_address;
+        if (working->name && (working->type != ENTRY_DEFINITION)){
+            /* update symbol table w/ the new address */
+            symtab_update(working->name,working->address);
+        }
+        current_address += working->size;
+        working = working->next;
+    }
+}
+
 memblock_list_t *block_list = NULL;
 
-void add_memblock(mem_entry_t* list){
+/* min and max addresses of a mem() block, from its first and last entries */
+static void set_memblock_bounds(memblock_list_t *block){
     mem_entry_t *working;
-    memblock_list_t *new_node = (memblock_list_t*)malloc(sizeof(memblock_list_t));
+    mem_entry_t *list = block->head;
 
-    new_node->head = list;
-    new_node->next = NULL;
     if (list){
         working = list;
         while (working){
@@ -120,13 +365,13 @@ void add_memblock(mem_entry_t* list){
         }
         if (list->address < working->address){
             /* the typical case where there is at least one instruction or fill in a mem() block */
-            new_node->min_address = list->address;
-            new_node->max_address = (working->address + working->size) - 1;
+            block->min_address = list->address;
+            block->max_address = (working->address + working->size) - 1;
         }
         else if (list->address == working->address){
             /* the rare case that a mem() block has only definitions */
-            new_node->min_address = list->address;
-            new_node->max_address = working->address;
+            block->min_address = list->address;
+            block->max_address = working->address;
         }
         else {
             /* the case where the last element has a lower address than the first 
@@ -138,9 +383,18 @@ void add_memblock(mem_entry_t* list){
     else {
         /* another rare case in which the list was empty -- 
            must be an empty mem() block in the source code */
-        new_node->min_address = 0;
-        new_node->max_address = 0;
+        block->min_address = 0;
+        block->max_address = 0;
     }
+}
+
+void add_memblock(mem_entry_t* list){
+    memblock_list_t *new_node = (memblock_list_t*)malloc(sizeof(memblock_list_t));
+    mem_alloc_bytes += sizeof(memblock_list_t);
+
+    new_node->head = list;
+    new_node->next = NULL;
+    set_memblock_bounds(new_node);
 
     if (block_list){
         memblock_list_t *working_list = block_list;
@@ -156,26 +410,48 @@ void add_memblock(mem_entry_t* list){
     }
 }
 
+/* lay out a mem() block again after some entries changed size */
+void relayout_memblock(memblock_list_t *block){
+    layout_memblock(block->head,block->min_address);
+    set_memblock_bounds(block);
+}
+
+/* gives back an entry once its bytes are written out, for -stream. 
+   names and strings stay, the symbol table may still point at them. */
+void free_mem_entry(mem_entry_t *entry){
+    if (entry->type == ENTRY_INSTRUCTION)
+        free(entry->inst);
+    else if ((entry->type == ENTRY_ARRAY) || (entry->type == ENTRY_FILL) || (entry->type == ENTRY_GEN)){
+        free(entry->array->bytes);
+        free(entry->array);
+    }
+    free(entry);
+}
+
+/* an error if check starts at or below working and runs into it */
+void check_memblock_overlap(memblock_list_t *check, memblock_list_t *working){
+    if ((check != working) && (check->min_address != check->max_address) && (working->min_address != working->max_address)){
+        if (check->min_address <= working->min_address){
+            if (check->max_address >= working->min_address){
+                char buff[200];
+                sprintf(buff,"The memory block starting at address 0x%012" PRIx64 " "
+                             "overlaps the memory block starting at address 0x%012" PRIx64,
+                             check->min_address,working->min_address);
+                yyerror(buff);
+            }
+        }
+    }
+}
+
 void check_mem_bounds(){
     memblock_list_t *check = block_list;
 
     while (check){
         memblock_list_t *working = block_list;
         while (working){
-            if ((check != working) && (check->min_address != check->max_address) && (working->min_address != working->max_address)){
-                if (check->min_address <= working->min_address){
-                    if (check->max_address >= working->min_address){
-                        char buff[200];
-                        sprintf(buff,"The memory block starting at address 0x%012" PRIx64 " "
-                                     "overlaps the memory block starting at address 0x%012" PRIx64,
-                                     check->min_address,working->min_address);
-                        yyerror(buff);
-                    }
-                }
-            }
+            check_memblock_overlap(check,working);
             working = working->next;
         }
         check = check->next;
     }
 }
-
@@ -58,9 +58,49 @@ typedef enum {
     ENTRY_LDATA,
     ENTRY_FDATA,
     ENTRY_DDATA,
-    ENTRY_SDATA
+    ENTRY_SDATA,
+    ENTRY_BLOB,  /* .incbin, bytes straight from a mapped file */
+    ENTRY_ARRAY, /* a list, .word 1, 2, 3 */
+    ENTRY_FILL,  /* a run, .fill count, size, value and .zero n */
+    ENTRY_GEN    /* a generated data set, .chase, .random and .iota */
 } type_t;
 
+typedef enum {
+    GEN_NONE,
+    GEN_CHASE,
+    GEN_RANDOM,
+    GEN_IOTA
+} gen_t;
+
+/* one entry for a whole list, run or generated set of data, aligned once */
+typedef struct {
+    uint32_t width;   /* bytes per element, 1, 2, 4 or 8, or the slot stride of a .chase */
+    uint32_t align;
+    uint64_t value;   /* the repeated element of a run */
+    uint8_t *bytes;   /* the elements of a list, little-endian, and of a generated set once resolved */
+    gen_t generator;
+    uint64_t seed;    /* .chase and .random */
+    int64_t start;    /* .iota */
+    int64_t step;
+} data_array_t;
+
+/* the values of a list directive, as the parser collects them */
+typedef struct {
+    uint64_t count;
+    uint64_t capacity;
+    union {
+        int64_t *ivalues;
+        double  *fvalues;
+    };
+} value_list_t;
+
+/* where an entry came from, for the line table */
+typedef struct {
+    char *file;
+    uint32_t line;
+    uint32_t column;
+} srcloc_t;
+
 typedef struct mem_entry_type {
     status_t status;
     type_t type;
@@ -69,6 +109,7 @@ typedef struct mem_entry_type {
     uint32_t size; /* in bytes -- could be zero for definitions */
 
     instruction_t * inst;
+    srcloc_t loc;
 
     /* value */
     union {
@@ -77,14 +118,27 @@ typedef struct mem_entry_type {
         float    fvalue;
         double   dvalue;
         char    *svalue;
+        const uint8_t *blob;
+        data_array_t *array;
     };
 
     struct mem_entry_type * next;
+    struct mem_entry_type * tail; /* a hint kept on the head of a list, append_inst() walks forward from it */
 } mem_entry_t;
 
 mem_entry_t * new_mem_entry(type_t, uint32_t);
 mem_entry_t * new_instruction(uint32_t);
+mem_entry_t * new_blob(char*, int64_t, int64_t);
+value_list_t * new_value_list();
+void push_ivalue(value_list_t*, int64_t);
+void push_fvalue(value_list_t*, double);
+mem_entry_t * new_int_array(value_list_t*, uint32_t);
+mem_entry_t * new_fp_array(value_list_t*, uint32_t);
+mem_entry_t * new_array_entry(type_t, uint64_t, uint32_t);
+mem_entry_t * new_fill(int64_t, int64_t, int64_t);
+void fill_bytes(uint8_t*, data_array_t*, uint64_t);
 mem_entry_t * append_inst(mem_entry_t*, mem_entry_t*);
+void free_mem_entry(mem_entry_t*);
 
 typedef struct memblock_list_type {
     uint64_t min_address;
@@ -93,9 +147,15 @@ typedef struct memblock_list_type {
     struct memblock_list_type * next;
 } memblock_list_t;
 
+void layout_memblock(mem_entry_t*, uint64_t);
 void add_memblock(mem_entry_t*);
+void relayout_memblock(memblock_list_t*);
+void check_memblock_overlap(memblock_list_t*, memblock_list_t*);
 void check_mem_bounds();
 
 extern  memblock_list_t *block_list;
+extern  uint32_t inst_alignment;
+extern  uint64_t mem_alloc_bytes;
+extern  srcloc_t current_loc;
 
 #endif
@@ -0,0 +1,517 @@
+/* This file is part of the DuctTape (dt) high-level assembler for 
+ * RISC-V. The dt project was written by Justin Severeid and Elliott 
+ * Forbes, University of Wisconsin-La Crosse, copyright 2020-2024.
+ *
+ * DuctTape is free software: you can redistribute it and/or modify 
+ * it under the terms of the GNU General Public License as published 
+ * by the Free Software Foundation, either version 3 of the License, 
+ * or (at your option) any later version.
+ *
+ * DuctTape is distributed in the hope that it will be useful, but 
+ * WITHOUT ANY WARRANTY; without even the implied warranty of 
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU 
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License 
+ * along with DuctTape. If not, see <https://www.gnu.org/licenses/>. 
+ *
+ *
+ *
+ * The dt project can be found at https://cs.uwlax.edu/~eforbes/dt/
+ *
+ * If you use dt in your published research, please consider 
+ * citing the following:
+ *
+ * Severeid, J. and Forbes, E., "dt: A High-level Assembler for RISC-V," 
+ * Proceedings of the 53rd Midwest Instruction and Computing Symposium, 
+ * April 2020. 
+ *
+ * If you found dt helpful, please let us know! Email eforbes@uwlax.edu
+ *
+ * There are bound to be bugs, let us know those too.
+ */
+
+
+/*
+ * -O peephole optimization over the IR: copy propagation, constant 
+ * folding, merging of consecutive immediate ops, and removal of no-op, 
+ * redundant and overwritten register moves. It looks at one straight 
+ * line run of instructions at a time -- a label, a branch, data or any 
+ * instruction it does not understand starts a new run -- so it never 
+ * needs to know what is live across a jump. Only runs with -O, since 
+ * hand-written directed tests have to stay bit-exact.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <inttypes.h>
+
+#include "riscvarch.h"
+#include "opt.h"
+#include "inst.h"
+#include "mem.h"
+#include "symtab.h"
+#include "util.h"
+
+#define NUM_IREGS 32
+#define OPT_DELETED -2 /* inst_id of an entry waiting to be swept out of its list */
+
+static int opt_passes = 0;
+static int opt_removed = 0;    /* no-op and redundant moves */
+static int opt_dead = 0;       /* results overwritten before anything read them */
+static int opt_folded = 0;     /* computed from constants, now an addi rd, $zero, imm */
+static int opt_merged = 0;     /* immediate ops folded into the one before */
+static int opt_propagated = 0; /* sources replaced by the register they were copied from */
+
+typedef enum {
+    OPT_BARRIER, /* not understood -- may read or write any register */
+    OPT_IMM,     /* rd = rs1 op imm */
+    OPT_SHIFT,   /* rd = rs1 op shamt, the shamt lives in rsrc2 */
+    OPT_UPPER,   /* lui */
+    OPT_REG,     /* rd = rs1 op rs2 */
+    OPT_LOAD,    /* rd = mem[rs1 + imm] */
+    OPT_STORE,   /* mem[rs1 + imm] = rs2 */
+    OPT_BRANCH   /* reads rs1 and rs2, then the run ends */
+} opt_class_t;
+
+/* what is known about the registers part way through a run */
+typedef struct {
+    int copy_of[NUM_IREGS];         /* the register this one is a copy of, or -1 */
+    BOOL known[NUM_IREGS];          /* TRUE if value[] holds the register's contents */
+    int64_t value[NUM_IREGS];
+    mem_entry_t *unread[NUM_IREGS]; /* a pure definition nothing has read yet */
+    mem_entry_t *last;              /* the instruction before this one in the run */
+} opt_state_t;
+
+static opt_class_t classify(instruction_t *inst){
+    switch(inst->inst_id){
+        case RISCV_BEQ:
+        case RISCV_BNE:
+        case RISCV_BLT:
+        case RISCV_BGE:
+        case RISCV_BLTU:
+        case RISCV_BGEU:
+            return OPT_BRANCH;
+    }
+    /* the lui/addiw of an address-of and the auipc/ld of a literal pool 
+       get their immediates from calculate_offsets(), leave them alone */
+    if (inst->target_name)
+        return OPT_BARRIER;
+    switch(inst->inst_id){
+        case RISCV_ADDI:
+        case RISCV_SLTI:
+        case RISCV_SLTIU:
+        case RISCV_XORI:
+        case RISCV_ORI:
+        case RISCV_ANDI:
+        case RISCV_ADDIW:
+            return OPT_IMM;
+        case RISCV_SLLI:
+        case RISCV_SRLI:
+        case RISCV_SRAI:
+        case RISCV_SLLIW:
+        case RISCV_SRLIW:
+        case RISCV_SRAIW:
+            return OPT_SHIFT;
+        case RISCV_LUI:
+            return OPT_UPPER;
+        case RISCV_ADD:
+        case RISCV_SUB:
+        case RISCV_SLL:
+        case RISCV_SLT:
+        case RISCV_SLTU:
+        case RISCV_XOR:
+        case RISCV_SRL:
+        case RISCV_SRA:
+        case RISCV_OR:
+        case RISCV_AND:
+        case RISCV_MUL:
+        case RISCV_DIV:
+        case RISCV_ADDW:
+        case RISCV_SUBW:
+        case RISCV_SLLW:
+        case RISCV_SRLW:
+        case RISCV_SRAW:
+        case RISCV_MULH:
+        case RISCV_MULHSU:
+        case RISCV_MULHU:
+        case RISCV_DIVU:
+        case RISCV_REM:
+        case RISCV_REMU:
+        case RISCV_MULW:
+        case RISCV_DIVW:
+        case RISCV_DIVUW:
+        case RISCV_REMW:
+        case RISCV_REMUW:
+            return OPT_REG;
+        case RISCV_LB:
+        case RISCV_LH:
+        case RISCV_LW:
+        case RISCV_LBU:
+        case RISCV_LHU:
+        case RISCV_LWU:
+        case RISCV_LD:
+            return OPT_LOAD;
+        case RISCV_SB:
+        case RISCV_SH:
+        case RISCV_SW:
+        case RISCV_SD:
+            return OPT_STORE;
+        default:
+            return OPT_BARRIER;
+    }
+}
+
+static BOOL is_alu(opt_class_t c){
+    return (c == OPT_IMM) || (c == OPT_SHIFT) || (c == OPT_UPPER) || (c == OPT_REG);
+}
+
+static int64_t sext12(int64_t value){
+    return ((value & 0xfff) ^ 0x800) - 0x800;
+}
+
+static int64_t sext32(uint64_t value){
+    return (int64_t)(int32_t)(uint32_t)value;
+}
+
+static BOOL fits12(int64_t value){
+    return (value >= -2048) && (value < 2048);
+}
+
+/* the value inst computes from sources a and b, FALSE for ops that are not folded */
+static BOOL evaluate(instruction_t *inst, int64_t a, int64_t b, int64_t *result){
+    uint64_t ua = (uint64_t)a;
+    uint64_t ub = (uint64_t)b;
+    int64_t imm = sext12(inst->imm);
+    uint32_t shamt = inst->rsrc2;
+
+    switch(inst->inst_id){
+        case RISCV_ADDI:  *result = (int64_t)(ua + (uint64_t)imm);            break;
+        case RISCV_SLTI:  *result = a < imm;                                  break;
+        case RISCV_SLTIU: *result = ua < (uint64_t)imm;                       break;
+        case RISCV_XORI:  *result = a ^ imm;                                  break;
+        case RISCV_ORI:   *result = a | imm;                                  break;
+        case RISCV_ANDI:  *result = a & imm;                                  break;
+        case RISCV_ADDIW: *result = sext32(ua + (uint64_t)imm);               break;
+        case RISCV_SLLI:  *result = (int64_t)(ua << (shamt & 63));            break;
+        case RISCV_SRLI:  *result = (int64_t)(ua >> (shamt & 63));            break;
+        case RISCV_SRAI:  *result = a >> (shamt & 63);                        break;
+        case RISCV_SLLIW: *result = sext32(ua << (shamt & 31));               break;
+        case RISCV_SRLIW: *result = sext32((uint32_t)ua >> (shamt & 31));     break;
+        case RISCV_SRAIW: *result = (int32_t)ua >> (shamt & 31);              break;
+        case RISCV_LUI:   *result = sext32((uint64_t)(inst->imm & 0xfffff) << 12); break;
+        case RISCV_ADD:   *result = (int64_t)(ua + ub);                       break;
+        case RISCV_SUB:   *result = (int64_t)(ua - ub);                       break;
+        case RISCV_SLL:   *result = (int64_t)(ua << (ub & 63));               break;
+        case RISCV_SLT:   *result = a < b;                                    break;
+        case RISCV_SLTU:  *result = ua < ub;                                  break;
+        case RISCV_XOR:   *result = a ^ b;                                    break;
+        case RISCV_SRL:   *result = (int64_t)(ua >> (ub & 63));               break;
+        case RISCV_SRA:   *result = a >> (ub & 63);                           break;
+        case RISCV_OR:    *result = a | b;                                    break;
+        case RISCV_AND:   *result = a & b;                                    break;
+        case RISCV_MUL:   *result = (int64_t)(ua * ub);                       break;
+        case RISCV_ADDW:  *result = sext32(ua + ub);                          break;
+        case RISCV_SUBW:  *result = sext32(ua - ub);                          break;
+        case RISCV_SLLW:  *result = sext32(ua << (ub & 31));                  break;
+        case RISCV_SRLW:  *result = sext32((uint32_t)ua >> (ub & 31));        break;
+        case RISCV_SRAW:  *result = (int32_t)ua >> (ub & 31);                 break;
+        default:
+            return FALSE;
+    }
+    return TRUE;
+}
+
+/* TRUE if inst only copies one register to rd, *src is set to that register */
+static BOOL is_move(instruction_t *inst, uint32_t *src){
+    switch(inst->inst_id){
+        case RISCV_ADDI:
+            if (sext12(inst->imm) != 0)
+                return FALSE;
+            *src = inst->rsrc1;
+            return TRUE;
+        case RISCV_ADD:
+        case RISCV_OR:
+        case RISCV_XOR:
+            if (inst->rsrc2 == 0){
+                *src = inst->rsrc1;
+                return TRUE;
+            }
+            if (inst->rsrc1 == 0){
+                *src = inst->rsrc2;
+                return TRUE;
+            }
+            return FALSE;
+        case RISCV_SUB:
+            if (inst->rsrc2 != 0)
+                return FALSE;
+            *src = inst->rsrc1;
+            return TRUE;
+    }
+    return FALSE;
+}
+
+/* rewrite inst into addi rd, $zero, value */
+static void load_constant(instruction_t *inst, int64_t value){
+    inst->inst_id = RISCV_ADDI;
+    inst->opcode = OP_ADDI;
+    inst->funct3 = F3_ADDI;
+    inst->funct7 = 0;
+    inst->rsrc1 = 0;
+    inst->rsrc2 = 0;
+    inst->imm = (int32_t)value;
+}
+
+/* folds the immediate op i into p, the op before it, when p's result only feeds i */
+static BOOL merge_imm(instruction_t *p, instruction_t *i){
+    int64_t a = sext12(p->imm);
+    int64_t b = sext12(i->imm);
+    uint32_t shamt = p->rsrc2 + i->rsrc2;
+
+    if ((p->rdst != i->rdst) || (i->rsrc1 != i->rdst))
+        return FALSE;
+
+    if ((p->inst_id == RISCV_ADDI) && (i->inst_id == RISCV_ADDIW) && fits12(a+b)){
+        /* addiw(addi(x,a),b) == addiw(x,a+b), the low word is the same either way */
+        p->inst_id = RISCV_ADDIW;
+        p->opcode = OP_ADDIW;
+        p->funct3 = F3_ADDIW;
+        p->imm = (int32_t)(a+b);
+        return TRUE;
+    }
+    if (p->inst_id != i->inst_id)
+        return FALSE;
+    switch(i->inst_id){
+        case RISCV_ADDI:
+        case RISCV_ADDIW:
+            if (!fits12(a+b))
+                return FALSE;
+            p->imm = (int32_t)(a+b);
+            return TRUE;
+        case RISCV_XORI:
+            p->imm = (int32_t)(a^b);
+            return TRUE;
+        case RISCV_ORI:
+            p->imm = (int32_t)(a|b);
+            return TRUE;
+        case RISCV_ANDI:
+            p->imm = (int32_t)(a&b);
+            return TRUE;
+        case RISCV_SLLI:
+        case RISCV_SRLI:
+            if (shamt > 63)
+                return FALSE;
+            p->rsrc2 = shamt;
+            return TRUE;
+        case RISCV_SRAI:
+            /* shifting the sign in further changes nothing */
+            p->rsrc2 = (shamt > 63) ? 63 : shamt;
+            return TRUE;
+    }
+    return FALSE;
+}
+
+static void delete_entry(mem_entry_t *entry){
+    entry->inst->inst_id = OPT_DELETED;
+}
+
+static void reset_state(opt_state_t *state){
+    for (int r = 0; r < NUM_IREGS; r++){
+        state->copy_of[r] = -1;
+        state->known[r] = FALSE;
+        state->value[r] = 0;
+        state->unread[r] = NULL;
+    }
+    state->known[0] = TRUE; // $zero
+    state->last = NULL;
+}
+
+/* replace a source with $zero or with the register it was copied from */
+static void propagate(opt_state_t *state, uint32_t *reg){
+    if (*reg == 0)
+        return;
+    if (state->known[*reg] && (state->value[*reg] == 0)){
+        *reg = 0;
+        opt_propagated++;
+    }
+    else if (state->copy_of[*reg] >= 0){
+        *reg = state->copy_of[*reg];
+        opt_propagated++;
+    }
+    state->unread[*reg] = NULL;
+}
+
+/* rd gets a new value -- an earlier result nobody read is dead, and 
+   anything that was a copy of rd is not any more */
+static void define(opt_state_t *state, uint32_t rd, mem_entry_t *entry, BOOL pure){
+    if (state->unread[rd]){
+        delete_entry(state->unread[rd]);
+        opt_dead++;
+    }
+    state->unread[rd] = pure ? entry : NULL;
+    state->known[rd] = FALSE;
+    state->copy_of[rd] = -1;
+    for (int r = 0; r < NUM_IREGS; r++){
+        if (state->copy_of[r] == (int)rd)
+            state->copy_of[r] = -1;
+    }
+}
+
+static void optimize_inst(opt_state_t *state, mem_entry_t *entry){
+    instruction_t *inst = entry->inst;
+    opt_class_t c = classify(inst);
+    uint32_t src;
+    int64_t result;
+
+    if (c == OPT_BARRIER){
+        reset_state(state);
+        return;
+    }
+    if (c == OPT_BRANCH){
+        propagate(state,&inst->rsrc1);
+        propagate(state,&inst->rsrc2);
+        reset_state(state);
+        return;
+    }
+    if (is_alu(c) && (inst->rdst == 0)){
+        /* nop, or a hint -- left exactly as written */
+        state->unread[inst->rsrc1] = NULL;
+        if (c == OPT_REG)
+            state->unread[inst->rsrc2] = NULL;
+        state->last = NULL;
+        return;
+    }
+
+    if (c != OPT_UPPER)
+        propagate(state,&inst->rsrc1);
+    if ((c == OPT_REG) || (c == OPT_STORE))
+        propagate(state,&inst->rsrc2);
+
+    if (c == OPT_STORE){
+        state->last = entry;
+        return;
+    }
+    if (c == OPT_LOAD){
+        if (inst->rdst != 0)
+            define(state,inst->rdst,entry,FALSE);
+        state->last = entry;
+        return;
+    }
+
+    /* a move of a register onto itself, or onto a copy of itself */
+    if (is_move(inst,&src) && (src != 0) &&
+        ((src == inst->rdst) || (state->copy_of[inst->rdst] == (int)src))){
+        delete_entry(entry);
+        opt_removed++;
+        return;
+    }
+
+    if (state->known[inst->rsrc1] && ((c != OPT_REG) || state->known[inst->rsrc2]) &&
+        evaluate(inst,state->value[inst->rsrc1],(c == OPT_REG) ? state->value[inst->rsrc2] : 0,&result)){
+        if (state->known[inst->rdst] && (state->value[inst->rdst] == result)){
+            /* the register already holds this value */
+            delete_entry(entry);
+            opt_removed++;
+            return;
+        }
+        if (fits12(result) && !((inst->inst_id == RISCV_ADDI) && (inst->rsrc1 == 0))){
+            load_constant(inst,result);
+            opt_folded++;
+        }
+        define(state,inst->rdst,entry,TRUE);
+        state->known[inst->rdst] = TRUE;
+        state->value[inst->rdst] = result;
+        state->last = entry;
+        return;
+    }
+
+    if (state->last && merge_imm(state->last->inst,inst)){
+        delete_entry(entry);
+        opt_merged++;
+        /* the merged op is the only definition of rd now, and is not a plain copy */
+        state->unread[inst->rdst] = state->last;
+        state->copy_of[inst->rdst] = -1;
+        return;
+    }
+
+    define(state,inst->rdst,entry,TRUE);
+    if (is_move(inst,&src) && (src != 0))
+        state->copy_of[inst->rdst] = src;
+    state->last = entry;
+}
+
+/* drop deleted entries from the list, a deleted entry with a label stays 
+   behind as a join node so the label keeps its address */
+static mem_entry_t *sweep(mem_entry_t *head){
+    mem_entry_t *prev = NULL;
+    mem_entry_t *working = head;
+
+    while (working){
+        mem_entry_t *next = working->next;
+        if ((working->type == ENTRY_INSTRUCTION) && (working->inst->inst_id == OPT_DELETED)){
+            if (working->name){
+                working->type = ENTRY_JOIN_NODE;
+                working->size = 0;
+                working->inst = NULL;
+                prev = working;
+            }
+            else if (prev)
+                prev->next = next;
+            else
+                head = next;
+        }
+        else {
+            prev = working;
+        }
+        working = next;
+    }
+    if (head)
+        head->tail = NULL;
+    return head;
+}
+
+/* one pass over a mem() block, returns the number of changes */
+static int optimize_list(memblock_list_t *block){
+    opt_state_t state;
+    mem_entry_t *working;
+    int before = opt_removed + opt_dead + opt_folded + opt_merged + opt_propagated;
+
+    reset_state(&state);
+    for (working = block->head; working; working = working->next){
+        if (working->type == ENTRY_DEFINITION)
+            continue;
+        /* anything labeled can be jumped to, and data is not code */
+        if (working->name || (working->type != ENTRY_INSTRUCTION))
+            reset_state(&state);
+        if (working->type == ENTRY_INSTRUCTION)
+            optimize_inst(&state,working);
+    }
+    block->head = sweep(block->head);
+
+    return opt_removed + opt_dead + opt_folded + opt_merged + opt_propagated - before;
+}
+
+void optimize_memblocks(){
+    memblock_list_t *list;
+    int changes;
+
+    do {
+        changes = 0;
+        opt_passes++;
+        for (list = block_list; list; list = list->next)
+            changes += optimize_list(list);
+    } while (changes > 0);
+
+    for (list = block_list; list; list = list->next)
+        relayout_memblock(list);
+}
+
+void dump_opt_stats(){
+    if (opt_passes == 0)
+        return;
+    printf("\nPeephole: %d passes, %d moves removed, %d dead results removed, "
+           "%d constants folded, %d immediate ops merged, %d sources propagated\n",
+           opt_passes,opt_removed,opt_dead,opt_folded,opt_merged,opt_propagated);
+}
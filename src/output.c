@@ -40,6 +40,7 @@
 #include <string.h>
 #include <stdint.h>
 #include <inttypes.h>
+#include <errno.h>
 
 #include <elf.h>
 #include <sys/types.h>
@@ -50,140 +51,1271 @@
 #include "riscvarch.h"
 #include "output.h"
 #include "inst.h"
+#include "compress.h"
+#include "lines.h"
 #include "mem.h"
 #include "pc.h"
+#include "perf.h"
 #include "symtab.h"
 #include "util.h"
 
+uint64_t output_bytes = 0; /* everything the writers produced, for -stats */
+
+
+/* the rounding mode suffix for fp instructions, nothing for the default dynamic mode */
+static const char *frm_name(uint32_t rm){
+    switch(rm) {
+        case FRM_RNE: return ", rne";
+        case FRM_RTZ: return ", rtz";
+        case FRM_RDN: return ", rdn";
+        case FRM_RUP: return ", rup";
+        case FRM_RMM: return ", rmm";
+    }
+    return "";
+}
+
+/* the mask operand suffix for vector instructions, vm=0 means masked by v0 */
+static const char *vm_name(uint32_t funct7){
+    return (funct7 & 0x1) ? "" : ", v0.t";
+}
+
+/* sign-extends a 5 bit vector immediate for printing */
+static int vimm_value(uint32_t imm){
+    return ((int)(imm & 0x1f) ^ 0x10) - 0x10;
+}
+
+/* prints a vtype immediate as e<sew>, m<lmul>, t<a|u>, m<a|u> */
+static void sprint_vtype(char *buff, uint32_t vtype){
+    static const char *lmul[] = {"m1","m2","m4","m8","reserved","mf8","mf4","mf2"};
+    sprintf(buff,"e%d, %s, %s, %s",8 << ((vtype >> 3) & 0x7),
+                                   lmul[vtype & 0x7],
+                                   (vtype & VTYPE_TA) ? "ta" : "tu",
+                                   (vtype & VTYPE_MA) ? "ma" : "mu");
+}
+
+/* lr has no rs2, the amos and sc do */
+static void sprint_amo(char *buff, const char *mnemonic, instruction_t *inst){
+    static const char *order[] = {"",".rl",".aq",".aqrl"};
+    const char *suffix = order[inst->funct7 & (F7_AMO_AQ | F7_AMO_RL)];
+    if ((inst->inst_id == RISCV_LR_W) || (inst->inst_id == RISCV_LR_D))
+        sprintf(buff,"%s%s x%d, [x%d]",mnemonic,suffix,inst->rdst,inst->rsrc1);
+    else
+        sprintf(buff,"%s%s x%d, x%d, [x%d]",mnemonic,suffix,inst->rdst,inst->rsrc2,inst->rsrc1);
+}
 
 /* prints the assembly instruction for the -checking flag */
-static void sprint_asm(char *buff, instruction_t *inst){
+void sprint_asm(char *buff, instruction_t *inst){
     switch(inst->inst_id) {
         case RISCV_LUI:
             sprintf(buff,"lui x%d, 0x%x",inst->rdst, inst->imm);
             break;
-        case RISCV_AUIPC:
-            sprintf(buff,"auipc x%d, 0x%x",inst->rdst, inst->imm);
+        case RISCV_AUIPC:
+            sprintf(buff,"auipc x%d, 0x%x",inst->rdst, inst->imm);
+            break;
+        case RISCV_JAL:
+            sprintf(buff,"jal x%d, 0x%012" PRIx64,inst->rdst, inst->target_address);
+            break;
+        case RISCV_JALR:
+            sprintf(buff,"jalr x%d, x%d, 0x%x",inst->rdst,inst->rsrc1, inst->imm);
+            break;
+        case RISCV_BEQ:
+            sprintf(buff,"beq x%d, x%d, 0x%x",inst->rsrc1,inst->rsrc2,inst->imm);
+            break;
+        case RISCV_BNE:
+            sprintf(buff,"bne x%d, x%d, 0x%x",inst->rsrc1,inst->rsrc2,inst->imm);
+            break;
+        case RISCV_BLT:
+            sprintf(buff,"blt x%d, x%d, 0x%x",inst->rsrc1,inst->rsrc2,inst->imm);
+            break;
+        case RISCV_BGE:
+            sprintf(buff,"bge x%d, x%d, 0x%x",inst->rsrc1,inst->rsrc2,inst->imm);
+            break;
+        case RISCV_BLTU:
+            sprintf(buff,"bltu x%d, x%d, 0x%x",inst->rsrc1,inst->rsrc2,inst->imm);
+            break;
+        case RISCV_BGEU:
+            sprintf(buff,"bgeu x%d, x%d, 0x%x",inst->rsrc1,inst->rsrc2,inst->imm);
+            break;
+        case RISCV_LB:
+            sprintf(buff,"lb x%d, %d[x%d]",inst->rdst, inst->imm,inst->rsrc1);
+            break;
+        case RISCV_LH:
+            sprintf(buff,"lh x%d, %d[x%d]",inst->rdst, inst->imm,inst->rsrc1);
+            break;
+        case RISCV_LW:
+            sprintf(buff,"lw x%d, %d[x%d]",inst->rdst, inst->imm,inst->rsrc1);
+            break;
+        case RISCV_LBU:
+            sprintf(buff,"lbu x%d, %d[x%d]",inst->rdst, inst->imm,inst->rsrc1);
+            break;
+        case RISCV_LHU:
+            sprintf(buff,"lhu x%d, %d[x%d]",inst->rdst, inst->imm,inst->rsrc1);
+            break;
+        case RISCV_SB:
+            sprintf(buff,"sb x%d, %d[x%d]",inst->rsrc2, inst->imm,inst->rsrc1);
+            break;
+        case RISCV_SH:
+            sprintf(buff,"sh x%d, %d[x%d]",inst->rsrc2, inst->imm,inst->rsrc1);
+            break;
+        case RISCV_SW:
+            sprintf(buff,"sw x%d, %d[x%d]",inst->rsrc0, inst->imm,inst->rsrc1);
+            break;
+        case RISCV_ADDI:
+            if (inst->rdst == 0 && inst->rsrc1 == 0 && inst->imm == 0)
+                sprintf(buff,"nop");
+            else
+                sprintf(buff,"addi x%d, x%d, 0x%x",inst->rdst,inst->rsrc1,inst->imm);
+            break;
+        case RISCV_SLTI:
+            sprintf(buff,"slti x%d, x%d, 0x%x",inst->rdst,inst->rsrc1,inst->imm);
+            break;
+        case RISCV_SLTIU:
+            sprintf(buff,"sltiu x%d, x%d, 0x%x",inst->rdst,inst->rsrc1,inst->imm);
+            break;
+        case RISCV_XORI:
+            sprintf(buff,"xori x%d, x%d, 0x%x",inst->rdst,inst->rsrc1,inst->imm);
+            break;
+        case RISCV_ORI:
+            sprintf(buff,"ori x%d, x%d, 0x%x",inst->rdst,inst->rsrc1,inst->imm);
+            break;
+        case RISCV_ANDI:
+            sprintf(buff,"andi x%d, x%d, 0x%x",inst->rdst,inst->rsrc1,inst->imm);
+            break;
+        case RISCV_ADDIW:
+            sprintf(buff,"addiw x%d, x%d, 0x%x",inst->rdst,inst->rsrc1,inst->imm);
+            break;
+        case RISCV_LD:
+            sprintf(buff,"ld x%d, %d[x%d]",inst->rdst, inst->imm,inst->rsrc1);
+            break;
+        case RISCV_LWU:
+            sprintf(buff,"lwu x%d, %d[x%d]",inst->rdst, inst->imm,inst->rsrc1);
+            break;
+        case RISCV_SD:
+            sprintf(buff,"sd x%d, %d[x%d]",inst->rsrc2, inst->imm,inst->rsrc1);
+            break;
+        case RISCV_SLLIW:
+            sprintf(buff,"slliw x%d, x%d, 0x%x",inst->rdst,inst->rsrc1,inst->rsrc2);
+            break;
+        case RISCV_SRLIW:
+            sprintf(buff,"srliw x%d, x%d, 0x%x",inst->rdst,inst->rsrc1,inst->rsrc2);
+            break;
+        case RISCV_SRAIW:
+            sprintf(buff,"sraiw x%d, x%d, 0x%x",inst->rdst,inst->rsrc1,inst->rsrc2);
+            break;
+        case RISCV_ADDW:
+            sprintf(buff,"addw x%d, x%d, x%d",inst->rdst,inst->rsrc1,inst->rsrc2);
+            break;
+        case RISCV_SUBW:
+            sprintf(buff,"subw x%d, x%d, x%d",inst->rdst,inst->rsrc1,inst->rsrc2);
+            break;
+        case RISCV_SLLW:
+            sprintf(buff,"sllw x%d, x%d, x%d",inst->rdst,inst->rsrc1,inst->rsrc2);
+            break;
+        case RISCV_SRLW:
+            sprintf(buff,"srlw x%d, x%d, x%d",inst->rdst,inst->rsrc1,inst->rsrc2);
+            break;
+        case RISCV_SRAW:
+            sprintf(buff,"sraw x%d, x%d, x%d",inst->rdst,inst->rsrc1,inst->rsrc2);
+            break;
+        case RISCV_MULH:
+            sprintf(buff,"mulh x%d, x%d, x%d",inst->rdst,inst->rsrc1,inst->rsrc2);
+            break;
+        case RISCV_MULHSU:
+            sprintf(buff,"mulhsu x%d, x%d, x%d",inst->rdst,inst->rsrc1,inst->rsrc2);
+            break;
+        case RISCV_MULHU:
+            sprintf(buff,"mulhu x%d, x%d, x%d",inst->rdst,inst->rsrc1,inst->rsrc2);
+            break;
+        case RISCV_DIVU:
+            sprintf(buff,"divu x%d, x%d, x%d",inst->rdst,inst->rsrc1,inst->rsrc2);
+            break;
+        case RISCV_REM:
+            sprintf(buff,"rem x%d, x%d, x%d",inst->rdst,inst->rsrc1,inst->rsrc2);
+            break;
+        case RISCV_REMU:
+            sprintf(buff,"remu x%d, x%d, x%d",inst->rdst,inst->rsrc1,inst->rsrc2);
+            break;
+        case RISCV_MULW:
+            sprintf(buff,"mulw x%d, x%d, x%d",inst->rdst,inst->rsrc1,inst->rsrc2);
+            break;
+        case RISCV_DIVW:
+            sprintf(buff,"divw x%d, x%d, x%d",inst->rdst,inst->rsrc1,inst->rsrc2);
+            break;
+        case RISCV_DIVUW:
+            sprintf(buff,"divuw x%d, x%d, x%d",inst->rdst,inst->rsrc1,inst->rsrc2);
+            break;
+        case RISCV_REMW:
+            sprintf(buff,"remw x%d, x%d, x%d",inst->rdst,inst->rsrc1,inst->rsrc2);
+            break;
+        case RISCV_REMUW:
+            sprintf(buff,"remuw x%d, x%d, x%d",inst->rdst,inst->rsrc1,inst->rsrc2);
+            break;
+        case RISCV_LR_W:
+            sprint_amo(buff,"lr.w",inst);
+            break;
+        case RISCV_SC_W:
+            sprint_amo(buff,"sc.w",inst);
+            break;
+        case RISCV_AMOSWAP_W:
+            sprint_amo(buff,"amoswap.w",inst);
+            break;
+        case RISCV_AMOADD_W:
+            sprint_amo(buff,"amoadd.w",inst);
+            break;
+        case RISCV_AMOXOR_W:
+            sprint_amo(buff,"amoxor.w",inst);
+            break;
+        case RISCV_AMOAND_W:
+            sprint_amo(buff,"amoand.w",inst);
+            break;
+        case RISCV_AMOOR_W:
+            sprint_amo(buff,"amoor.w",inst);
+            break;
+        case RISCV_AMOMIN_W:
+            sprint_amo(buff,"amomin.w",inst);
+            break;
+        case RISCV_AMOMAX_W:
+            sprint_amo(buff,"amomax.w",inst);
+            break;
+        case RISCV_AMOMINU_W:
+            sprint_amo(buff,"amominu.w",inst);
+            break;
+        case RISCV_AMOMAXU_W:
+            sprint_amo(buff,"amomaxu.w",inst);
+            break;
+        case RISCV_LR_D:
+            sprint_amo(buff,"lr.d",inst);
+            break;
+        case RISCV_SC_D:
+            sprint_amo(buff,"sc.d",inst);
+            break;
+        case RISCV_AMOSWAP_D:
+            sprint_amo(buff,"amoswap.d",inst);
+            break;
+        case RISCV_AMOADD_D:
+            sprint_amo(buff,"amoadd.d",inst);
+            break;
+        case RISCV_AMOXOR_D:
+            sprint_amo(buff,"amoxor.d",inst);
+            break;
+        case RISCV_AMOAND_D:
+            sprint_amo(buff,"amoand.d",inst);
+            break;
+        case RISCV_AMOOR_D:
+            sprint_amo(buff,"amoor.d",inst);
+            break;
+        case RISCV_AMOMIN_D:
+            sprint_amo(buff,"amomin.d",inst);
+            break;
+        case RISCV_AMOMAX_D:
+            sprint_amo(buff,"amomax.d",inst);
+            break;
+        case RISCV_AMOMINU_D:
+            sprint_amo(buff,"amominu.d",inst);
+            break;
+        case RISCV_AMOMAXU_D:
+            sprint_amo(buff,"amomaxu.d",inst);
+            break;
+        case RISCV_FLW:
+            sprintf(buff,"flw f%d, %d[x%d]",inst->rdst, inst->imm,inst->rsrc1);
+            break;
+        case RISCV_FSW:
+            sprintf(buff,"fsw f%d, %d[x%d]",inst->rsrc2, inst->imm,inst->rsrc1);
+            break;
+        case RISCV_FMADD_S:
+            sprintf(buff,"fmadd.s f%d, f%d, f%d, f%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,inst->rsrc3,frm_name(inst->funct3));
+            break;
+        case RISCV_FMSUB_S:
+            sprintf(buff,"fmsub.s f%d, f%d, f%d, f%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,inst->rsrc3,frm_name(inst->funct3));
+            break;
+        case RISCV_FNMSUB_S:
+            sprintf(buff,"fnmsub.s f%d, f%d, f%d, f%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,inst->rsrc3,frm_name(inst->funct3));
+            break;
+        case RISCV_FNMADD_S:
+            sprintf(buff,"fnmadd.s f%d, f%d, f%d, f%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,inst->rsrc3,frm_name(inst->funct3));
+            break;
+        case RISCV_FADD_S:
+            sprintf(buff,"fadd.s f%d, f%d, f%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,frm_name(inst->funct3));
+            break;
+        case RISCV_FSUB_S:
+            sprintf(buff,"fsub.s f%d, f%d, f%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,frm_name(inst->funct3));
+            break;
+        case RISCV_FMUL_S:
+            sprintf(buff,"fmul.s f%d, f%d, f%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,frm_name(inst->funct3));
+            break;
+        case RISCV_FDIV_S:
+            sprintf(buff,"fdiv.s f%d, f%d, f%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,frm_name(inst->funct3));
+            break;
+        case RISCV_FSQRT_S:
+            sprintf(buff,"fsqrt.s f%d, f%d%s",inst->rdst,inst->rsrc1,frm_name(inst->funct3));
+            break;
+        case RISCV_FSGNJ_S:
+            if (inst->rsrc1 == inst->rsrc2)
+                sprintf(buff,"fmv.s f%d, f%d",inst->rdst,inst->rsrc1);
+            else
+                sprintf(buff,"fsgnj.s f%d, f%d, f%d",inst->rdst,inst->rsrc1,inst->rsrc2);
+            break;
+        case RISCV_FSGNJN_S:
+            if (inst->rsrc1 == inst->rsrc2)
+                sprintf(buff,"fneg.s f%d, f%d",inst->rdst,inst->rsrc1);
+            else
+                sprintf(buff,"fsgnjn.s f%d, f%d, f%d",inst->rdst,inst->rsrc1,inst->rsrc2);
+            break;
+        case RISCV_FSGNJX_S:
+            if (inst->rsrc1 == inst->rsrc2)
+                sprintf(buff,"fabs.s f%d, f%d",inst->rdst,inst->rsrc1);
+            else
+                sprintf(buff,"fsgnjx.s f%d, f%d, f%d",inst->rdst,inst->rsrc1,inst->rsrc2);
+            break;
+        case RISCV_FMIN_S:
+            sprintf(buff,"fmin.s f%d, f%d, f%d",inst->rdst,inst->rsrc1,inst->rsrc2);
+            break;
+        case RISCV_FMAX_S:
+            sprintf(buff,"fmax.s f%d, f%d, f%d",inst->rdst,inst->rsrc1,inst->rsrc2);
+            break;
+        case RISCV_FEQ_S:
+            sprintf(buff,"feq.s x%d, f%d, f%d",inst->rdst,inst->rsrc1,inst->rsrc2);
+            break;
+        case RISCV_FLT_S:
+            sprintf(buff,"flt.s x%d, f%d, f%d",inst->rdst,inst->rsrc1,inst->rsrc2);
+            break;
+        case RISCV_FLE_S:
+            sprintf(buff,"fle.s x%d, f%d, f%d",inst->rdst,inst->rsrc1,inst->rsrc2);
+            break;
+        case RISCV_FCLASS_S:
+            sprintf(buff,"fclass.s x%d, f%d",inst->rdst,inst->rsrc1);
+            break;
+        case RISCV_FCVT_W_S:
+            sprintf(buff,"fcvt.w.s x%d, f%d%s",inst->rdst,inst->rsrc1,frm_name(inst->funct3));
+            break;
+        case RISCV_FCVT_WU_S:
+            sprintf(buff,"fcvt.wu.s x%d, f%d%s",inst->rdst,inst->rsrc1,frm_name(inst->funct3));
+            break;
+        case RISCV_FCVT_L_S:
+            sprintf(buff,"fcvt.l.s x%d, f%d%s",inst->rdst,inst->rsrc1,frm_name(inst->funct3));
+            break;
+        case RISCV_FCVT_LU_S:
+            sprintf(buff,"fcvt.lu.s x%d, f%d%s",inst->rdst,inst->rsrc1,frm_name(inst->funct3));
+            break;
+        case RISCV_FCVT_S_W:
+            sprintf(buff,"fcvt.s.w f%d, x%d%s",inst->rdst,inst->rsrc1,frm_name(inst->funct3));
+            break;
+        case RISCV_FCVT_S_WU:
+            sprintf(buff,"fcvt.s.wu f%d, x%d%s",inst->rdst,inst->rsrc1,frm_name(inst->funct3));
+            break;
+        case RISCV_FCVT_S_L:
+            sprintf(buff,"fcvt.s.l f%d, x%d%s",inst->rdst,inst->rsrc1,frm_name(inst->funct3));
+            break;
+        case RISCV_FCVT_S_LU:
+            sprintf(buff,"fcvt.s.lu f%d, x%d%s",inst->rdst,inst->rsrc1,frm_name(inst->funct3));
+            break;
+        case RISCV_FMV_X_W:
+            sprintf(buff,"fmv.x.w x%d, f%d",inst->rdst,inst->rsrc1);
+            break;
+        case RISCV_FMV_W_X:
+            sprintf(buff,"fmv.w.x f%d, x%d",inst->rdst,inst->rsrc1);
+            break;
+        case RISCV_FLD:
+            sprintf(buff,"fld f%d, %d[x%d]",inst->rdst, inst->imm,inst->rsrc1);
+            break;
+        case RISCV_FSD:
+            sprintf(buff,"fsd f%d, %d[x%d]",inst->rsrc2, inst->imm,inst->rsrc1);
+            break;
+        case RISCV_FMADD_D:
+            sprintf(buff,"fmadd.d f%d, f%d, f%d, f%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,inst->rsrc3,frm_name(inst->funct3));
+            break;
+        case RISCV_FMSUB_D:
+            sprintf(buff,"fmsub.d f%d, f%d, f%d, f%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,inst->rsrc3,frm_name(inst->funct3));
+            break;
+        case RISCV_FNMSUB_D:
+            sprintf(buff,"fnmsub.d f%d, f%d, f%d, f%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,inst->rsrc3,frm_name(inst->funct3));
+            break;
+        case RISCV_FNMADD_D:
+            sprintf(buff,"fnmadd.d f%d, f%d, f%d, f%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,inst->rsrc3,frm_name(inst->funct3));
+            break;
+        case RISCV_FADD_D:
+            sprintf(buff,"fadd.d f%d, f%d, f%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,frm_name(inst->funct3));
+            break;
+        case RISCV_FSUB_D:
+            sprintf(buff,"fsub.d f%d, f%d, f%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,frm_name(inst->funct3));
+            break;
+        case RISCV_FMUL_D:
+            sprintf(buff,"fmul.d f%d, f%d, f%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,frm_name(inst->funct3));
+            break;
+        case RISCV_FDIV_D:
+            sprintf(buff,"fdiv.d f%d, f%d, f%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,frm_name(inst->funct3));
+            break;
+        case RISCV_FSQRT_D:
+            sprintf(buff,"fsqrt.d f%d, f%d%s",inst->rdst,inst->rsrc1,frm_name(inst->funct3));
+            break;
+        case RISCV_FSGNJ_D:
+            if (inst->rsrc1 == inst->rsrc2)
+                sprintf(buff,"fmv.d f%d, f%d",inst->rdst,inst->rsrc1);
+            else
+                sprintf(buff,"fsgnj.d f%d, f%d, f%d",inst->rdst,inst->rsrc1,inst->rsrc2);
+            break;
+        case RISCV_FSGNJN_D:
+            if (inst->rsrc1 == inst->rsrc2)
+                sprintf(buff,"fneg.d f%d, f%d",inst->rdst,inst->rsrc1);
+            else
+                sprintf(buff,"fsgnjn.d f%d, f%d, f%d",inst->rdst,inst->rsrc1,inst->rsrc2);
+            break;
+        case RISCV_FSGNJX_D:
+            if (inst->rsrc1 == inst->rsrc2)
+                sprintf(buff,"fabs.d f%d, f%d",inst->rdst,inst->rsrc1);
+            else
+                sprintf(buff,"fsgnjx.d f%d, f%d, f%d",inst->rdst,inst->rsrc1,inst->rsrc2);
+            break;
+        case RISCV_FMIN_D:
+            sprintf(buff,"fmin.d f%d, f%d, f%d",inst->rdst,inst->rsrc1,inst->rsrc2);
+            break;
+        case RISCV_FMAX_D:
+            sprintf(buff,"fmax.d f%d, f%d, f%d",inst->rdst,inst->rsrc1,inst->rsrc2);
+            break;
+        case RISCV_FEQ_D:
+            sprintf(buff,"feq.d x%d, f%d, f%d",inst->rdst,inst->rsrc1,inst->rsrc2);
+            break;
+        case RISCV_FLT_D:
+            sprintf(buff,"flt.d x%d, f%d, f%d",inst->rdst,inst->rsrc1,inst->rsrc2);
+            break;
+        case RISCV_FLE_D:
+            sprintf(buff,"fle.d x%d, f%d, f%d",inst->rdst,inst->rsrc1,inst->rsrc2);
+            break;
+        case RISCV_FCLASS_D:
+            sprintf(buff,"fclass.d x%d, f%d",inst->rdst,inst->rsrc1);
+            break;
+        case RISCV_FCVT_W_D:
+            sprintf(buff,"fcvt.w.d x%d, f%d%s",inst->rdst,inst->rsrc1,frm_name(inst->funct3));
+            break;
+        case RISCV_FCVT_WU_D:
+            sprintf(buff,"fcvt.wu.d x%d, f%d%s",inst->rdst,inst->rsrc1,frm_name(inst->funct3));
+            break;
+        case RISCV_FCVT_L_D:
+            sprintf(buff,"fcvt.l.d x%d, f%d%s",inst->rdst,inst->rsrc1,frm_name(inst->funct3));
+            break;
+        case RISCV_FCVT_LU_D:
+            sprintf(buff,"fcvt.lu.d x%d, f%d%s",inst->rdst,inst->rsrc1,frm_name(inst->funct3));
+            break;
+        case RISCV_FCVT_D_W:
+            sprintf(buff,"fcvt.d.w f%d, x%d",inst->rdst,inst->rsrc1);
+            break;
+        case RISCV_FCVT_D_WU:
+            sprintf(buff,"fcvt.d.wu f%d, x%d",inst->rdst,inst->rsrc1);
+            break;
+        case RISCV_FCVT_D_L:
+            sprintf(buff,"fcvt.d.l f%d, x%d%s",inst->rdst,inst->rsrc1,frm_name(inst->funct3));
+            break;
+        case RISCV_FCVT_D_LU:
+            sprintf(buff,"fcvt.d.lu f%d, x%d%s",inst->rdst,inst->rsrc1,frm_name(inst->funct3));
+            break;
+        case RISCV_FMV_X_D:
+            sprintf(buff,"fmv.x.d x%d, f%d",inst->rdst,inst->rsrc1);
+            break;
+        case RISCV_FMV_D_X:
+            sprintf(buff,"fmv.d.x f%d, x%d",inst->rdst,inst->rsrc1);
+            break;
+        case RISCV_FCVT_S_D:
+            sprintf(buff,"fcvt.s.d f%d, f%d%s",inst->rdst,inst->rsrc1,frm_name(inst->funct3));
+            break;
+        case RISCV_FCVT_D_S:
+            sprintf(buff,"fcvt.d.s f%d, f%d",inst->rdst,inst->rsrc1);
+            break;
+        case RISCV_SLLI:
+            sprintf(buff,"slli x%d, x%d, 0x%x",inst->rdst,inst->rsrc1,inst->rsrc2);
+            break;
+        case RISCV_SRLI:
+            sprintf(buff,"srli x%d, x%d, 0x%x",inst->rdst,inst->rsrc1,inst->rsrc2);
+            break;
+        case RISCV_SRAI:
+            sprintf(buff,"srai x%d, x%d, 0x%x",inst->rdst,inst->rsrc1,inst->rsrc2);
+            break;
+        case RISCV_ADD:
+            sprintf(buff,"add x%d, x%d, x%d",inst->rdst,inst->rsrc1,inst->rsrc2);
+            break;
+        case RISCV_SUB:
+            sprintf(buff,"sub x%d, x%d, x%d",inst->rdst,inst->rsrc1,inst->rsrc2);
+            break;
+        case RISCV_MUL:
+            sprintf(buff,"mul x%d, x%d, x%d",inst->rdst,inst->rsrc1,inst->rsrc2);
+            break;
+        case RISCV_DIV:
+            sprintf(buff,"div x%d, x%d, x%d",inst->rdst,inst->rsrc1,inst->rsrc2);
+            break;
+        case RISCV_SLL:
+            sprintf(buff,"sll x%d, x%d, x%d",inst->rdst,inst->rsrc1,inst->rsrc2);
+            break;
+        case RISCV_SLT:
+            sprintf(buff,"slt x%d, x%d, x%d",inst->rdst,inst->rsrc1,inst->rsrc2);
+            break;
+        case RISCV_SLTU:
+            sprintf(buff,"sltu x%d, x%d, x%d",inst->rdst,inst->rsrc1,inst->rsrc2);
+            break;
+        case RISCV_XOR:
+            sprintf(buff,"xor x%d, x%d, x%d",inst->rdst,inst->rsrc1,inst->rsrc2);
+            break;
+        case RISCV_SRL:
+            sprintf(buff,"srl x%d, x%d, x%d",inst->rdst,inst->rsrc1,inst->rsrc2);
+            break;
+        case RISCV_SRA:
+            sprintf(buff,"sra x%d, x%d, x%d",inst->rdst,inst->rsrc1,inst->rsrc2);
+            break;
+        case RISCV_OR:
+            sprintf(buff,"or x%d, x%d, x%d",inst->rdst,inst->rsrc1,inst->rsrc2);
+            break;
+        case RISCV_AND:
+            sprintf(buff,"and x%d, x%d, x%d",inst->rdst,inst->rsrc1,inst->rsrc2);
+            break;
+        case RISCV_ECALL:
+            sprintf(buff, "ecall");
+            break;
+        case RISCV_EBREAK:
+            sprintf(buff,  "ebreak");
+            break;
+        case RISCV_CSRRW:
+            sprintf(buff,"csrrw x%d, 0x%x, x%d",inst->rdst,inst->imm,inst->rsrc1);
+            break;
+        case RISCV_CSRRS:
+            sprintf(buff,"csrrs x%d, 0x%x, x%d",inst->rdst,inst->imm,inst->rsrc1);
+            break;
+        case RISCV_CSRRC:
+            sprintf(buff,"csrrc x%d, 0x%x, x%d",inst->rdst,inst->imm,inst->rsrc1);
+            break;
+        case RISCV_CSRRWI:
+            sprintf(buff,"csrrwi x%d, 0x%x, %d",inst->rdst,inst->imm,inst->rsrc1);
+            break;
+        case RISCV_CSRRSI:
+            sprintf(buff,"csrrsi x%d, 0x%x, %d",inst->rdst,inst->imm,inst->rsrc1);
+            break;
+        case RISCV_CSRRCI:
+            sprintf(buff,"csrrci x%d, 0x%x, %d",inst->rdst,inst->imm,inst->rsrc1);
+            break;
+        case RISCV_FENCE:
+            sprintf(buff,"fence");
+            break;
+        case RISCV_FENCE_I:
+            sprintf(buff,"fence.i");
+            break;
+        case RISCV_VSETVLI:
+            sprintf(buff,"vsetvli x%d, x%d, ",inst->rdst,inst->rsrc1);
+            sprint_vtype(buff+strlen(buff),inst->imm & 0x7ff);
+            break;
+        case RISCV_VSETIVLI:
+            sprintf(buff,"vsetivli x%d, %d, ",inst->rdst,inst->rsrc1);
+            sprint_vtype(buff+strlen(buff),inst->imm & 0x3ff);
+            break;
+        case RISCV_VSETVL:
+            sprintf(buff,"vsetvl x%d, x%d, x%d",inst->rdst,inst->rsrc1,inst->rsrc2);
+            break;
+        case RISCV_VLE8_V:
+            sprintf(buff,"vle8.v v%d, [x%d]%s",inst->rdst,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VLE8FF_V:
+            sprintf(buff,"vle8ff.v v%d, [x%d]%s",inst->rdst,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VSE8_V:
+            sprintf(buff,"vse8.v v%d, [x%d]%s",inst->rdst,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VLSE8_V:
+            sprintf(buff,"vlse8.v v%d, [x%d], x%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,vm_name(inst->funct7));
+            break;
+        case RISCV_VSSE8_V:
+            sprintf(buff,"vsse8.v v%d, [x%d], x%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,vm_name(inst->funct7));
+            break;
+        case RISCV_VLUXEI8_V:
+            sprintf(buff,"vluxei8.v v%d, [x%d], v%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,vm_name(inst->funct7));
+            break;
+        case RISCV_VLOXEI8_V:
+            sprintf(buff,"vloxei8.v v%d, [x%d], v%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,vm_name(inst->funct7));
+            break;
+        case RISCV_VSUXEI8_V:
+            sprintf(buff,"vsuxei8.v v%d, [x%d], v%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,vm_name(inst->funct7));
+            break;
+        case RISCV_VSOXEI8_V:
+            sprintf(buff,"vsoxei8.v v%d, [x%d], v%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,vm_name(inst->funct7));
+            break;
+        case RISCV_VLE16_V:
+            sprintf(buff,"vle16.v v%d, [x%d]%s",inst->rdst,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VLE16FF_V:
+            sprintf(buff,"vle16ff.v v%d, [x%d]%s",inst->rdst,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VSE16_V:
+            sprintf(buff,"vse16.v v%d, [x%d]%s",inst->rdst,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VLSE16_V:
+            sprintf(buff,"vlse16.v v%d, [x%d], x%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,vm_name(inst->funct7));
+            break;
+        case RISCV_VSSE16_V:
+            sprintf(buff,"vsse16.v v%d, [x%d], x%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,vm_name(inst->funct7));
+            break;
+        case RISCV_VLUXEI16_V:
+            sprintf(buff,"vluxei16.v v%d, [x%d], v%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,vm_name(inst->funct7));
+            break;
+        case RISCV_VLOXEI16_V:
+            sprintf(buff,"vloxei16.v v%d, [x%d], v%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,vm_name(inst->funct7));
+            break;
+        case RISCV_VSUXEI16_V:
+            sprintf(buff,"vsuxei16.v v%d, [x%d], v%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,vm_name(inst->funct7));
+            break;
+        case RISCV_VSOXEI16_V:
+            sprintf(buff,"vsoxei16.v v%d, [x%d], v%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,vm_name(inst->funct7));
+            break;
+        case RISCV_VLE32_V:
+            sprintf(buff,"vle32.v v%d, [x%d]%s",inst->rdst,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VLE32FF_V:
+            sprintf(buff,"vle32ff.v v%d, [x%d]%s",inst->rdst,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VSE32_V:
+            sprintf(buff,"vse32.v v%d, [x%d]%s",inst->rdst,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VLSE32_V:
+            sprintf(buff,"vlse32.v v%d, [x%d], x%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,vm_name(inst->funct7));
+            break;
+        case RISCV_VSSE32_V:
+            sprintf(buff,"vsse32.v v%d, [x%d], x%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,vm_name(inst->funct7));
+            break;
+        case RISCV_VLUXEI32_V:
+            sprintf(buff,"vluxei32.v v%d, [x%d], v%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,vm_name(inst->funct7));
+            break;
+        case RISCV_VLOXEI32_V:
+            sprintf(buff,"vloxei32.v v%d, [x%d], v%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,vm_name(inst->funct7));
+            break;
+        case RISCV_VSUXEI32_V:
+            sprintf(buff,"vsuxei32.v v%d, [x%d], v%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,vm_name(inst->funct7));
+            break;
+        case RISCV_VSOXEI32_V:
+            sprintf(buff,"vsoxei32.v v%d, [x%d], v%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,vm_name(inst->funct7));
+            break;
+        case RISCV_VLE64_V:
+            sprintf(buff,"vle64.v v%d, [x%d]%s",inst->rdst,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VLE64FF_V:
+            sprintf(buff,"vle64ff.v v%d, [x%d]%s",inst->rdst,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VSE64_V:
+            sprintf(buff,"vse64.v v%d, [x%d]%s",inst->rdst,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VLSE64_V:
+            sprintf(buff,"vlse64.v v%d, [x%d], x%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,vm_name(inst->funct7));
+            break;
+        case RISCV_VSSE64_V:
+            sprintf(buff,"vsse64.v v%d, [x%d], x%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,vm_name(inst->funct7));
+            break;
+        case RISCV_VLUXEI64_V:
+            sprintf(buff,"vluxei64.v v%d, [x%d], v%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,vm_name(inst->funct7));
+            break;
+        case RISCV_VLOXEI64_V:
+            sprintf(buff,"vloxei64.v v%d, [x%d], v%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,vm_name(inst->funct7));
+            break;
+        case RISCV_VSUXEI64_V:
+            sprintf(buff,"vsuxei64.v v%d, [x%d], v%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,vm_name(inst->funct7));
+            break;
+        case RISCV_VSOXEI64_V:
+            sprintf(buff,"vsoxei64.v v%d, [x%d], v%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,vm_name(inst->funct7));
+            break;
+        case RISCV_VLM_V:
+            sprintf(buff,"vlm.v v%d, [x%d]",inst->rdst,inst->rsrc1);
+            break;
+        case RISCV_VSM_V:
+            sprintf(buff,"vsm.v v%d, [x%d]",inst->rdst,inst->rsrc1);
+            break;
+        case RISCV_VADD_VV:
+            sprintf(buff,"vadd.vv v%d, v%d, v%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VADD_VX:
+            sprintf(buff,"vadd.vx v%d, v%d, x%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VADD_VI:
+            sprintf(buff,"vadd.vi v%d, v%d, %d%s",inst->rdst,inst->rsrc2,vimm_value(inst->rsrc1),vm_name(inst->funct7));
+            break;
+        case RISCV_VSUB_VV:
+            sprintf(buff,"vsub.vv v%d, v%d, v%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VSUB_VX:
+            sprintf(buff,"vsub.vx v%d, v%d, x%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VRSUB_VX:
+            sprintf(buff,"vrsub.vx v%d, v%d, x%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VRSUB_VI:
+            sprintf(buff,"vrsub.vi v%d, v%d, %d%s",inst->rdst,inst->rsrc2,vimm_value(inst->rsrc1),vm_name(inst->funct7));
+            break;
+        case RISCV_VMINU_VV:
+            sprintf(buff,"vminu.vv v%d, v%d, v%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VMINU_VX:
+            sprintf(buff,"vminu.vx v%d, v%d, x%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VMIN_VV:
+            sprintf(buff,"vmin.vv v%d, v%d, v%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VMIN_VX:
+            sprintf(buff,"vmin.vx v%d, v%d, x%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VMAXU_VV:
+            sprintf(buff,"vmaxu.vv v%d, v%d, v%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VMAXU_VX:
+            sprintf(buff,"vmaxu.vx v%d, v%d, x%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VMAX_VV:
+            sprintf(buff,"vmax.vv v%d, v%d, v%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VMAX_VX:
+            sprintf(buff,"vmax.vx v%d, v%d, x%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VAND_VV:
+            sprintf(buff,"vand.vv v%d, v%d, v%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VAND_VX:
+            sprintf(buff,"vand.vx v%d, v%d, x%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VAND_VI:
+            sprintf(buff,"vand.vi v%d, v%d, %d%s",inst->rdst,inst->rsrc2,vimm_value(inst->rsrc1),vm_name(inst->funct7));
+            break;
+        case RISCV_VOR_VV:
+            sprintf(buff,"vor.vv v%d, v%d, v%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VOR_VX:
+            sprintf(buff,"vor.vx v%d, v%d, x%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VOR_VI:
+            sprintf(buff,"vor.vi v%d, v%d, %d%s",inst->rdst,inst->rsrc2,vimm_value(inst->rsrc1),vm_name(inst->funct7));
+            break;
+        case RISCV_VXOR_VV:
+            sprintf(buff,"vxor.vv v%d, v%d, v%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VXOR_VX:
+            sprintf(buff,"vxor.vx v%d, v%d, x%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VXOR_VI:
+            sprintf(buff,"vxor.vi v%d, v%d, %d%s",inst->rdst,inst->rsrc2,vimm_value(inst->rsrc1),vm_name(inst->funct7));
+            break;
+        case RISCV_VRGATHER_VV:
+            sprintf(buff,"vrgather.vv v%d, v%d, v%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VRGATHER_VX:
+            sprintf(buff,"vrgather.vx v%d, v%d, x%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VRGATHER_VI:
+            sprintf(buff,"vrgather.vi v%d, v%d, %d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VSLIDEUP_VX:
+            sprintf(buff,"vslideup.vx v%d, v%d, x%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VSLIDEUP_VI:
+            sprintf(buff,"vslideup.vi v%d, v%d, %d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VSLIDEDOWN_VX:
+            sprintf(buff,"vslidedown.vx v%d, v%d, x%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VSLIDEDOWN_VI:
+            sprintf(buff,"vslidedown.vi v%d, v%d, %d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VMSEQ_VV:
+            sprintf(buff,"vmseq.vv v%d, v%d, v%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VMSEQ_VX:
+            sprintf(buff,"vmseq.vx v%d, v%d, x%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VMSEQ_VI:
+            sprintf(buff,"vmseq.vi v%d, v%d, %d%s",inst->rdst,inst->rsrc2,vimm_value(inst->rsrc1),vm_name(inst->funct7));
+            break;
+        case RISCV_VMSNE_VV:
+            sprintf(buff,"vmsne.vv v%d, v%d, v%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VMSNE_VX:
+            sprintf(buff,"vmsne.vx v%d, v%d, x%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VMSNE_VI:
+            sprintf(buff,"vmsne.vi v%d, v%d, %d%s",inst->rdst,inst->rsrc2,vimm_value(inst->rsrc1),vm_name(inst->funct7));
+            break;
+        case RISCV_VMSLTU_VV:
+            sprintf(buff,"vmsltu.vv v%d, v%d, v%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VMSLTU_VX:
+            sprintf(buff,"vmsltu.vx v%d, v%d, x%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VMSLT_VV:
+            sprintf(buff,"vmslt.vv v%d, v%d, v%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VMSLT_VX:
+            sprintf(buff,"vmslt.vx v%d, v%d, x%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VMSLEU_VV:
+            sprintf(buff,"vmsleu.vv v%d, v%d, v%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VMSLEU_VX:
+            sprintf(buff,"vmsleu.vx v%d, v%d, x%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VMSLEU_VI:
+            sprintf(buff,"vmsleu.vi v%d, v%d, %d%s",inst->rdst,inst->rsrc2,vimm_value(inst->rsrc1),vm_name(inst->funct7));
+            break;
+        case RISCV_VMSLE_VV:
+            sprintf(buff,"vmsle.vv v%d, v%d, v%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VMSLE_VX:
+            sprintf(buff,"vmsle.vx v%d, v%d, x%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VMSLE_VI:
+            sprintf(buff,"vmsle.vi v%d, v%d, %d%s",inst->rdst,inst->rsrc2,vimm_value(inst->rsrc1),vm_name(inst->funct7));
+            break;
+        case RISCV_VMSGTU_VX:
+            sprintf(buff,"vmsgtu.vx v%d, v%d, x%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VMSGTU_VI:
+            sprintf(buff,"vmsgtu.vi v%d, v%d, %d%s",inst->rdst,inst->rsrc2,vimm_value(inst->rsrc1),vm_name(inst->funct7));
+            break;
+        case RISCV_VMSGT_VX:
+            sprintf(buff,"vmsgt.vx v%d, v%d, x%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VMSGT_VI:
+            sprintf(buff,"vmsgt.vi v%d, v%d, %d%s",inst->rdst,inst->rsrc2,vimm_value(inst->rsrc1),vm_name(inst->funct7));
+            break;
+        case RISCV_VSLL_VV:
+            sprintf(buff,"vsll.vv v%d, v%d, v%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VSLL_VX:
+            sprintf(buff,"vsll.vx v%d, v%d, x%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VSLL_VI:
+            sprintf(buff,"vsll.vi v%d, v%d, %d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VSRL_VV:
+            sprintf(buff,"vsrl.vv v%d, v%d, v%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VSRL_VX:
+            sprintf(buff,"vsrl.vx v%d, v%d, x%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VSRL_VI:
+            sprintf(buff,"vsrl.vi v%d, v%d, %d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VSRA_VV:
+            sprintf(buff,"vsra.vv v%d, v%d, v%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VSRA_VX:
+            sprintf(buff,"vsra.vx v%d, v%d, x%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VSRA_VI:
+            sprintf(buff,"vsra.vi v%d, v%d, %d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VNSRL_WV:
+            sprintf(buff,"vnsrl.wv v%d, v%d, v%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VNSRL_WX:
+            sprintf(buff,"vnsrl.wx v%d, v%d, x%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VNSRL_WI:
+            sprintf(buff,"vnsrl.wi v%d, v%d, %d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VNSRA_WV:
+            sprintf(buff,"vnsra.wv v%d, v%d, v%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VNSRA_WX:
+            sprintf(buff,"vnsra.wx v%d, v%d, x%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VNSRA_WI:
+            sprintf(buff,"vnsra.wi v%d, v%d, %d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VMERGE_VVM:
+            sprintf(buff,"vmerge.vvm v%d, v%d, v%d, v0",inst->rdst,inst->rsrc2,inst->rsrc1);
+            break;
+        case RISCV_VMERGE_VXM:
+            sprintf(buff,"vmerge.vxm v%d, v%d, x%d, v0",inst->rdst,inst->rsrc2,inst->rsrc1);
+            break;
+        case RISCV_VMERGE_VIM:
+            sprintf(buff,"vmerge.vim v%d, v%d, %d, v0",inst->rdst,inst->rsrc2,vimm_value(inst->rsrc1));
+            break;
+        case RISCV_VMV_V_V:
+            sprintf(buff,"vmv.v.v v%d, v%d",inst->rdst,inst->rsrc1);
+            break;
+        case RISCV_VMV_V_X:
+            sprintf(buff,"vmv.v.x v%d, x%d",inst->rdst,inst->rsrc1);
+            break;
+        case RISCV_VMV_V_I:
+            sprintf(buff,"vmv.v.i v%d, %d",inst->rdst,vimm_value(inst->rsrc1));
+            break;
+        case RISCV_VDIVU_VV:
+            sprintf(buff,"vdivu.vv v%d, v%d, v%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VDIVU_VX:
+            sprintf(buff,"vdivu.vx v%d, v%d, x%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VDIV_VV:
+            sprintf(buff,"vdiv.vv v%d, v%d, v%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VDIV_VX:
+            sprintf(buff,"vdiv.vx v%d, v%d, x%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VREMU_VV:
+            sprintf(buff,"vremu.vv v%d, v%d, v%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VREMU_VX:
+            sprintf(buff,"vremu.vx v%d, v%d, x%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VREM_VV:
+            sprintf(buff,"vrem.vv v%d, v%d, v%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VREM_VX:
+            sprintf(buff,"vrem.vx v%d, v%d, x%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VMULHU_VV:
+            sprintf(buff,"vmulhu.vv v%d, v%d, v%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VMULHU_VX:
+            sprintf(buff,"vmulhu.vx v%d, v%d, x%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VMUL_VV:
+            sprintf(buff,"vmul.vv v%d, v%d, v%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VMUL_VX:
+            sprintf(buff,"vmul.vx v%d, v%d, x%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VMULHSU_VV:
+            sprintf(buff,"vmulhsu.vv v%d, v%d, v%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VMULHSU_VX:
+            sprintf(buff,"vmulhsu.vx v%d, v%d, x%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VMULH_VV:
+            sprintf(buff,"vmulh.vv v%d, v%d, v%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VMULH_VX:
+            sprintf(buff,"vmulh.vx v%d, v%d, x%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VWADDU_VV:
+            sprintf(buff,"vwaddu.vv v%d, v%d, v%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VWADDU_VX:
+            sprintf(buff,"vwaddu.vx v%d, v%d, x%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VWADD_VV:
+            sprintf(buff,"vwadd.vv v%d, v%d, v%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VWADD_VX:
+            sprintf(buff,"vwadd.vx v%d, v%d, x%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VWSUBU_VV:
+            sprintf(buff,"vwsubu.vv v%d, v%d, v%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VWSUBU_VX:
+            sprintf(buff,"vwsubu.vx v%d, v%d, x%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VWSUB_VV:
+            sprintf(buff,"vwsub.vv v%d, v%d, v%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VWSUB_VX:
+            sprintf(buff,"vwsub.vx v%d, v%d, x%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VWMULU_VV:
+            sprintf(buff,"vwmulu.vv v%d, v%d, v%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VWMULU_VX:
+            sprintf(buff,"vwmulu.vx v%d, v%d, x%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VWMULSU_VV:
+            sprintf(buff,"vwmulsu.vv v%d, v%d, v%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VWMULSU_VX:
+            sprintf(buff,"vwmulsu.vx v%d, v%d, x%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VWMUL_VV:
+            sprintf(buff,"vwmul.vv v%d, v%d, v%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VWMUL_VX:
+            sprintf(buff,"vwmul.vx v%d, v%d, x%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VMADD_VV:
+            sprintf(buff,"vmadd.vv v%d, v%d, v%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,vm_name(inst->funct7));
+            break;
+        case RISCV_VMADD_VX:
+            sprintf(buff,"vmadd.vx v%d, x%d, v%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,vm_name(inst->funct7));
+            break;
+        case RISCV_VNMSUB_VV:
+            sprintf(buff,"vnmsub.vv v%d, v%d, v%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,vm_name(inst->funct7));
+            break;
+        case RISCV_VNMSUB_VX:
+            sprintf(buff,"vnmsub.vx v%d, x%d, v%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,vm_name(inst->funct7));
+            break;
+        case RISCV_VMACC_VV:
+            sprintf(buff,"vmacc.vv v%d, v%d, v%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,vm_name(inst->funct7));
+            break;
+        case RISCV_VMACC_VX:
+            sprintf(buff,"vmacc.vx v%d, x%d, v%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,vm_name(inst->funct7));
+            break;
+        case RISCV_VNMSAC_VV:
+            sprintf(buff,"vnmsac.vv v%d, v%d, v%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,vm_name(inst->funct7));
+            break;
+        case RISCV_VNMSAC_VX:
+            sprintf(buff,"vnmsac.vx v%d, x%d, v%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,vm_name(inst->funct7));
+            break;
+        case RISCV_VWMACCU_VV:
+            sprintf(buff,"vwmaccu.vv v%d, v%d, v%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,vm_name(inst->funct7));
+            break;
+        case RISCV_VWMACCU_VX:
+            sprintf(buff,"vwmaccu.vx v%d, x%d, v%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,vm_name(inst->funct7));
+            break;
+        case RISCV_VWMACC_VV:
+            sprintf(buff,"vwmacc.vv v%d, v%d, v%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,vm_name(inst->funct7));
+            break;
+        case RISCV_VWMACC_VX:
+            sprintf(buff,"vwmacc.vx v%d, x%d, v%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,vm_name(inst->funct7));
+            break;
+        case RISCV_VREDSUM_VS:
+            sprintf(buff,"vredsum.vs v%d, v%d, v%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VREDAND_VS:
+            sprintf(buff,"vredand.vs v%d, v%d, v%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VREDOR_VS:
+            sprintf(buff,"vredor.vs v%d, v%d, v%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VREDXOR_VS:
+            sprintf(buff,"vredxor.vs v%d, v%d, v%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VREDMINU_VS:
+            sprintf(buff,"vredminu.vs v%d, v%d, v%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VREDMIN_VS:
+            sprintf(buff,"vredmin.vs v%d, v%d, v%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VREDMAXU_VS:
+            sprintf(buff,"vredmaxu.vs v%d, v%d, v%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VREDMAX_VS:
+            sprintf(buff,"vredmax.vs v%d, v%d, v%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VSLIDE1UP_VX:
+            sprintf(buff,"vslide1up.vx v%d, v%d, x%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VSLIDE1DOWN_VX:
+            sprintf(buff,"vslide1down.vx v%d, v%d, x%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VMV_X_S:
+            sprintf(buff,"vmv.x.s x%d, v%d",inst->rdst,inst->rsrc2);
+            break;
+        case RISCV_VMV_S_X:
+            sprintf(buff,"vmv.s.x v%d, x%d",inst->rdst,inst->rsrc1);
+            break;
+        case RISCV_VCPOP_M:
+            sprintf(buff,"vcpop.m x%d, v%d%s",inst->rdst,inst->rsrc2,vm_name(inst->funct7));
+            break;
+        case RISCV_VFIRST_M:
+            sprintf(buff,"vfirst.m x%d, v%d%s",inst->rdst,inst->rsrc2,vm_name(inst->funct7));
+            break;
+        case RISCV_VIOTA_M:
+            sprintf(buff,"viota.m v%d, v%d%s",inst->rdst,inst->rsrc2,vm_name(inst->funct7));
+            break;
+        case RISCV_VID_V:
+            sprintf(buff,"vid.v v%d%s",inst->rdst,vm_name(inst->funct7));
+            break;
+        case RISCV_VMANDN_MM:
+            sprintf(buff,"vmandn.mm v%d, v%d, v%d",inst->rdst,inst->rsrc2,inst->rsrc1);
+            break;
+        case RISCV_VMAND_MM:
+            sprintf(buff,"vmand.mm v%d, v%d, v%d",inst->rdst,inst->rsrc2,inst->rsrc1);
+            break;
+        case RISCV_VMOR_MM:
+            sprintf(buff,"vmor.mm v%d, v%d, v%d",inst->rdst,inst->rsrc2,inst->rsrc1);
+            break;
+        case RISCV_VMXOR_MM:
+            sprintf(buff,"vmxor.mm v%d, v%d, v%d",inst->rdst,inst->rsrc2,inst->rsrc1);
+            break;
+        case RISCV_VMORN_MM:
+            sprintf(buff,"vmorn.mm v%d, v%d, v%d",inst->rdst,inst->rsrc2,inst->rsrc1);
+            break;
+        case RISCV_VMNAND_MM:
+            sprintf(buff,"vmnand.mm v%d, v%d, v%d",inst->rdst,inst->rsrc2,inst->rsrc1);
+            break;
+        case RISCV_VMNOR_MM:
+            sprintf(buff,"vmnor.mm v%d, v%d, v%d",inst->rdst,inst->rsrc2,inst->rsrc1);
+            break;
+        case RISCV_VMXNOR_MM:
+            sprintf(buff,"vmxnor.mm v%d, v%d, v%d",inst->rdst,inst->rsrc2,inst->rsrc1);
+            break;
+        case RISCV_VFADD_VV:
+            sprintf(buff,"vfadd.vv v%d, v%d, v%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VFADD_VF:
+            sprintf(buff,"vfadd.vf v%d, v%d, f%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VFSUB_VV:
+            sprintf(buff,"vfsub.vv v%d, v%d, v%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VFSUB_VF:
+            sprintf(buff,"vfsub.vf v%d, v%d, f%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VFRSUB_VF:
+            sprintf(buff,"vfrsub.vf v%d, v%d, f%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VFMIN_VV:
+            sprintf(buff,"vfmin.vv v%d, v%d, v%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VFMIN_VF:
+            sprintf(buff,"vfmin.vf v%d, v%d, f%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VFMAX_VV:
+            sprintf(buff,"vfmax.vv v%d, v%d, v%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VFMAX_VF:
+            sprintf(buff,"vfmax.vf v%d, v%d, f%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VFSGNJ_VV:
+            sprintf(buff,"vfsgnj.vv v%d, v%d, v%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VFSGNJ_VF:
+            sprintf(buff,"vfsgnj.vf v%d, v%d, f%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VFSGNJN_VV:
+            sprintf(buff,"vfsgnjn.vv v%d, v%d, v%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VFSGNJN_VF:
+            sprintf(buff,"vfsgnjn.vf v%d, v%d, f%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VFSGNJX_VV:
+            sprintf(buff,"vfsgnjx.vv v%d, v%d, v%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VFSGNJX_VF:
+            sprintf(buff,"vfsgnjx.vf v%d, v%d, f%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VFDIV_VV:
+            sprintf(buff,"vfdiv.vv v%d, v%d, v%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VFDIV_VF:
+            sprintf(buff,"vfdiv.vf v%d, v%d, f%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VFRDIV_VF:
+            sprintf(buff,"vfrdiv.vf v%d, v%d, f%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VFMUL_VV:
+            sprintf(buff,"vfmul.vv v%d, v%d, v%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VFMUL_VF:
+            sprintf(buff,"vfmul.vf v%d, v%d, f%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
+            break;
+        case RISCV_VMFEQ_VV:
+            sprintf(buff,"vmfeq.vv v%d, v%d, v%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
             break;
-        case RISCV_JAL:
-            sprintf(buff,"jal x%d, 0x%012" PRIx64,inst->rdst, inst->target_address);
+        case RISCV_VMFEQ_VF:
+            sprintf(buff,"vmfeq.vf v%d, v%d, f%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
             break;
-        case RISCV_JALR:
-            sprintf(buff,"jalr x%d, x%d, 0x%x",inst->rdst,inst->rsrc1, inst->imm);
+        case RISCV_VMFLE_VV:
+            sprintf(buff,"vmfle.vv v%d, v%d, v%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
             break;
-        case RISCV_BEQ:
-            sprintf(buff,"beq x%d, x%d, 0x%x",inst->rsrc1,inst->rsrc2,inst->imm);
+        case RISCV_VMFLE_VF:
+            sprintf(buff,"vmfle.vf v%d, v%d, f%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
             break;
-        case RISCV_BNE:
-            sprintf(buff,"bne x%d, x%d, 0x%x",inst->rsrc1,inst->rsrc2,inst->imm);
+        case RISCV_VMFLT_VV:
+            sprintf(buff,"vmflt.vv v%d, v%d, v%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
             break;
-        case RISCV_BLT:
-            sprintf(buff,"blt x%d, x%d, 0x%x",inst->rsrc1,inst->rsrc2,inst->imm);
+        case RISCV_VMFLT_VF:
+            sprintf(buff,"vmflt.vf v%d, v%d, f%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
             break;
-        case RISCV_BGE:
-            sprintf(buff,"bge x%d, x%d, 0x%x",inst->rsrc1,inst->rsrc2,inst->imm);
+        case RISCV_VMFNE_VV:
+            sprintf(buff,"vmfne.vv v%d, v%d, v%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
             break;
-        case RISCV_BLTU:
-            sprintf(buff,"bltu x%d, x%d, 0x%x",inst->rsrc1,inst->rsrc2,inst->imm);
+        case RISCV_VMFNE_VF:
+            sprintf(buff,"vmfne.vf v%d, v%d, f%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
             break;
-        case RISCV_BGEU:
-            sprintf(buff,"bgeu x%d, x%d, 0x%x",inst->rsrc1,inst->rsrc2,inst->imm);
+        case RISCV_VMFGT_VF:
+            sprintf(buff,"vmfgt.vf v%d, v%d, f%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
             break;
-        case RISCV_LB:
-            sprintf(buff,"lb x%d, %d[x%d]",inst->rdst, inst->imm,inst->rsrc1);
+        case RISCV_VMFGE_VF:
+            sprintf(buff,"vmfge.vf v%d, v%d, f%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
             break;
-        case RISCV_LH:
-            sprintf(buff,"lh x%d, %d[x%d]",inst->rdst, inst->imm,inst->rsrc1);
+        case RISCV_VFMADD_VV:
+            sprintf(buff,"vfmadd.vv v%d, v%d, v%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,vm_name(inst->funct7));
             break;
-        case RISCV_LW:
-            sprintf(buff,"lw x%d, %d[x%d]",inst->rdst, inst->imm,inst->rsrc1);
+        case RISCV_VFMADD_VF:
+            sprintf(buff,"vfmadd.vf v%d, f%d, v%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,vm_name(inst->funct7));
             break;
-        case RISCV_LBU:
-            sprintf(buff,"lbu x%d, %d[x%d]",inst->rdst, inst->imm,inst->rsrc1);
+        case RISCV_VFNMADD_VV:
+            sprintf(buff,"vfnmadd.vv v%d, v%d, v%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,vm_name(inst->funct7));
             break;
-        case RISCV_LHU:
-            sprintf(buff,"lhu x%d, %d[x%d]",inst->rdst, inst->imm,inst->rsrc1);
+        case RISCV_VFNMADD_VF:
+            sprintf(buff,"vfnmadd.vf v%d, f%d, v%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,vm_name(inst->funct7));
             break;
-        case RISCV_SB:
-            sprintf(buff,"sb x%d, %d[x%d]",inst->rsrc2, inst->imm,inst->rsrc1);
+        case RISCV_VFMSUB_VV:
+            sprintf(buff,"vfmsub.vv v%d, v%d, v%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,vm_name(inst->funct7));
             break;
-        case RISCV_SH:
-            sprintf(buff,"sh x%d, %d[x%d]",inst->rsrc2, inst->imm,inst->rsrc1);
+        case RISCV_VFMSUB_VF:
+            sprintf(buff,"vfmsub.vf v%d, f%d, v%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,vm_name(inst->funct7));
             break;
-        case RISCV_SW:
-            sprintf(buff,"sw x%d, %d[x%d]",inst->rsrc0, inst->imm,inst->rsrc1);
+        case RISCV_VFNMSUB_VV:
+            sprintf(buff,"vfnmsub.vv v%d, v%d, v%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,vm_name(inst->funct7));
             break;
-        case RISCV_ADDI:
-            if (inst->rdst == 0 && inst->rsrc1 == 0 && inst->imm == 0)
-                sprintf(buff,"nop");
-            else
-                sprintf(buff,"addi x%d, x%d, 0x%x",inst->rdst,inst->rsrc1,inst->imm);
+        case RISCV_VFNMSUB_VF:
+            sprintf(buff,"vfnmsub.vf v%d, f%d, v%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,vm_name(inst->funct7));
             break;
-        case RISCV_SLTI:
-            sprintf(buff,"slti x%d, x%d, 0x%x",inst->rdst,inst->rsrc1,inst->imm);
+        case RISCV_VFMACC_VV:
+            sprintf(buff,"vfmacc.vv v%d, v%d, v%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,vm_name(inst->funct7));
             break;
-        case RISCV_SLTIU:
-            sprintf(buff,"sltiu x%d, x%d, 0x%x",inst->rdst,inst->rsrc1,inst->imm);
+        case RISCV_VFMACC_VF:
+            sprintf(buff,"vfmacc.vf v%d, f%d, v%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,vm_name(inst->funct7));
             break;
-        case RISCV_XORI:
-            sprintf(buff,"xori x%d, x%d, 0x%x",inst->rdst,inst->rsrc1,inst->imm);
+        case RISCV_VFNMACC_VV:
+            sprintf(buff,"vfnmacc.vv v%d, v%d, v%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,vm_name(inst->funct7));
             break;
-        case RISCV_ORI:
-            sprintf(buff,"ori x%d, x%d, 0x%x",inst->rdst,inst->rsrc1,inst->imm);
+        case RISCV_VFNMACC_VF:
+            sprintf(buff,"vfnmacc.vf v%d, f%d, v%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,vm_name(inst->funct7));
             break;
-        case RISCV_ANDI:
-            sprintf(buff,"andi x%d, x%d, 0x%x",inst->rdst,inst->rsrc1,inst->imm);
+        case RISCV_VFMSAC_VV:
+            sprintf(buff,"vfmsac.vv v%d, v%d, v%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,vm_name(inst->funct7));
             break;
-        case RISCV_SLLI:
-            sprintf(buff,"slli x%d, x%d, 0x%x",inst->rdst,inst->rsrc1,inst->rsrc2);
+        case RISCV_VFMSAC_VF:
+            sprintf(buff,"vfmsac.vf v%d, f%d, v%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,vm_name(inst->funct7));
             break;
-        case RISCV_SRLI:
-            sprintf(buff,"srli x%d, x%d, 0x%x",inst->rdst,inst->rsrc1,inst->rsrc2);
+        case RISCV_VFNMSAC_VV:
+            sprintf(buff,"vfnmsac.vv v%d, v%d, v%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,vm_name(inst->funct7));
             break;
-        case RISCV_SRAI:
-            sprintf(buff,"srai x%d, x%d, 0x%x",inst->rdst,inst->rsrc1,inst->rsrc2);
+        case RISCV_VFNMSAC_VF:
+            sprintf(buff,"vfnmsac.vf v%d, f%d, v%d%s",inst->rdst,inst->rsrc1,inst->rsrc2,vm_name(inst->funct7));
             break;
-        case RISCV_ADD:
-            sprintf(buff,"add x%d, x%d, x%d",inst->rdst,inst->rsrc1,inst->rsrc2);
+        case RISCV_VFREDUSUM_VS:
+            sprintf(buff,"vfredusum.vs v%d, v%d, v%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
             break;
-        case RISCV_SUB:
-            sprintf(buff,"sub x%d, x%d, x%d",inst->rdst,inst->rsrc1,inst->rsrc2);
+        case RISCV_VFREDOSUM_VS:
+            sprintf(buff,"vfredosum.vs v%d, v%d, v%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
             break;
-        case RISCV_MUL:
-            sprintf(buff,"mul x%d, x%d, x%d",inst->rdst,inst->rsrc1,inst->rsrc2);
+        case RISCV_VFREDMIN_VS:
+            sprintf(buff,"vfredmin.vs v%d, v%d, v%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
             break;
-        case RISCV_DIV:
-            sprintf(buff,"div x%d, x%d, x%d",inst->rdst,inst->rsrc1,inst->rsrc2);
+        case RISCV_VFREDMAX_VS:
+            sprintf(buff,"vfredmax.vs v%d, v%d, v%d%s",inst->rdst,inst->rsrc2,inst->rsrc1,vm_name(inst->funct7));
             break;
-        case RISCV_SLL:
-            sprintf(buff,"sll x%d, x%d, x%d",inst->rdst,inst->rsrc1,inst->rsrc2);
+        case RISCV_VFSQRT_V:
+            sprintf(buff,"vfsqrt.v v%d, v%d%s",inst->rdst,inst->rsrc2,vm_name(inst->funct7));
             break;
-        case RISCV_SLT:
-            sprintf(buff,"slt x%d, x%d, x%d",inst->rdst,inst->rsrc1,inst->rsrc2);
+        case RISCV_VFCVT_XU_F_V:
+            sprintf(buff,"vfcvt.xu.f.v v%d, v%d%s",inst->rdst,inst->rsrc2,vm_name(inst->funct7));
             break;
-        case RISCV_SLTU:
-            sprintf(buff,"sltu x%d, x%d, x%d",inst->rdst,inst->rsrc1,inst->rsrc2);
+        case RISCV_VFCVT_X_F_V:
+            sprintf(buff,"vfcvt.x.f.v v%d, v%d%s",inst->rdst,inst->rsrc2,vm_name(inst->funct7));
             break;
-        case RISCV_XOR:
-            sprintf(buff,"xor x%d, x%d, x%d",inst->rdst,inst->rsrc1,inst->rsrc2);
+        case RISCV_VFCVT_F_XU_V:
+            sprintf(buff,"vfcvt.f.xu.v v%d, v%d%s",inst->rdst,inst->rsrc2,vm_name(inst->funct7));
             break;
-        case RISCV_SRL:
-            sprintf(buff,"srl x%d, x%d, x%d",inst->rdst,inst->rsrc1,inst->rsrc2);
+        case RISCV_VFCVT_F_X_V:
+            sprintf(buff,"vfcvt.f.x.v v%d, v%d%s",inst->rdst,inst->rsrc2,vm_name(inst->funct7));
             break;
-        case RISCV_SRA:
-            sprintf(buff,"sra x%d, x%d, x%d",inst->rdst,inst->rsrc1,inst->rsrc2);
+        case RISCV_VFCVT_RTZ_XU_F_V:
+            sprintf(buff,"vfcvt.rtz.xu.f.v v%d, v%d%s",inst->rdst,inst->rsrc2,vm_name(inst->funct7));
             break;
-        case RISCV_OR:
-            sprintf(buff,"or x%d, x%d, x%d",inst->rdst,inst->rsrc1,inst->rsrc2);
+        case RISCV_VFCVT_RTZ_X_F_V:
+            sprintf(buff,"vfcvt.rtz.x.f.v v%d, v%d%s",inst->rdst,inst->rsrc2,vm_name(inst->funct7));
             break;
-        case RISCV_AND:
-            sprintf(buff,"and x%d, x%d, x%d",inst->rdst,inst->rsrc1,inst->rsrc2);
+        case RISCV_VFMV_F_S:
+            sprintf(buff,"vfmv.f.s f%d, v%d",inst->rdst,inst->rsrc2);
             break;
-        case RISCV_ECALL:
-            sprintf(buff, "ecall");
+        case RISCV_VFMV_S_F:
+            sprintf(buff,"vfmv.s.f v%d, f%d",inst->rdst,inst->rsrc1);
             break;
-        case RISCV_EBREAK:
-            sprintf(buff,  "ebreak");
+        case RISCV_VFMV_V_F:
+            sprintf(buff,"vfmv.v.f v%d, f%d",inst->rdst,inst->rsrc1);
+            break;
+        case RISCV_VFMERGE_VFM:
+            sprintf(buff,"vfmerge.vfm v%d, v%d, f%d, v0",inst->rdst,inst->rsrc2,inst->rsrc1);
             break;
         case RISCV_J:
             sprintf(buff, "j 0x%012" PRIx64, inst->target_address);
@@ -197,6 +1329,135 @@ static void sprint_asm(char *buff, instruction_t *inst){
     }
 }
 
+/* assembly for an instruction that the -compress pass shrunk to 16 bits */
+static void sprint_rvc(char *buff, instruction_t *inst){
+    /* the source that is not also the destination, for the two operand forms */
+    uint32_t other = (inst->rdst == inst->rsrc1) ? inst->rsrc2 : inst->rsrc1;
+
+    switch(rvc_form(inst)){
+        case RVC_ADDI4SPN:
+            sprintf(buff,"c.addi4spn x%d, x2, %d",inst->rdst,inst->imm);
+            break;
+        case RVC_FLD:
+            sprintf(buff,"c.fld f%d, %d[x%d]",inst->rdst,inst->imm,inst->rsrc1);
+            break;
+        case RVC_LW:
+            sprintf(buff,"c.lw x%d, %d[x%d]",inst->rdst,inst->imm,inst->rsrc1);
+            break;
+        case RVC_LD:
+            sprintf(buff,"c.ld x%d, %d[x%d]",inst->rdst,inst->imm,inst->rsrc1);
+            break;
+        case RVC_FSD:
+            sprintf(buff,"c.fsd f%d, %d[x%d]",inst->rsrc2,inst->imm,inst->rsrc1);
+            break;
+        case RVC_SW:
+            sprintf(buff,"c.sw x%d, %d[x%d]",inst->rsrc2,inst->imm,inst->rsrc1);
+            break;
+        case RVC_SD:
+            sprintf(buff,"c.sd x%d, %d[x%d]",inst->rsrc2,inst->imm,inst->rsrc1);
+            break;
+        case RVC_NOP:
+            sprintf(buff,"c.nop");
+            break;
+        case RVC_ADDI:
+            sprintf(buff,"c.addi x%d, %d",inst->rdst,inst->imm);
+            break;
+        case RVC_ADDIW:
+            sprintf(buff,"c.addiw x%d, %d",inst->rdst,inst->imm);
+            break;
+        case RVC_LI:
+            sprintf(buff,"c.li x%d, %d",inst->rdst,inst->imm);
+            break;
+        case RVC_ADDI16SP:
+            sprintf(buff,"c.addi16sp x2, %d",inst->imm);
+            break;
+        case RVC_LUI:
+            sprintf(buff,"c.lui x%d, 0x%x",inst->rdst,inst->imm & 0xfffff);
+            break;
+        case RVC_SRLI:
+            sprintf(buff,"c.srli x%d, 0x%x",inst->rdst,inst->rsrc2);
+            break;
+        case RVC_SRAI:
+            sprintf(buff,"c.srai x%d, 0x%x",inst->rdst,inst->rsrc2);
+            break;
+        case RVC_ANDI:
+            sprintf(buff,"c.andi x%d, %d",inst->rdst,inst->imm);
+            break;
+        case RVC_SUB:
+            sprintf(buff,"c.sub x%d, x%d",inst->rdst,inst->rsrc2);
+            break;
+        case RVC_XOR:
+            sprintf(buff,"c.xor x%d, x%d",inst->rdst,other);
+            break;
+        case RVC_OR:
+            sprintf(buff,"c.or x%d, x%d",inst->rdst,other);
+            break;
+        case RVC_AND:
+            sprintf(buff,"c.and x%d, x%d",inst->rdst,other);
+            break;
+        case RVC_SUBW:
+            sprintf(buff,"c.subw x%d, x%d",inst->rdst,inst->rsrc2);
+            break;
+        case RVC_ADDW:
+            sprintf(buff,"c.addw x%d, x%d",inst->rdst,other);
+            break;
+        case RVC_J:
+            sprintf(buff,"c.j 0x%012" PRIx64,inst->target_address);
+            break;
+        case RVC_BEQZ:
+            sprintf(buff,"c.beqz x%d, 0x%x",inst->rsrc2 ? inst->rsrc2 : inst->rsrc1,inst->imm);
+            break;
+        case RVC_BNEZ:
+            sprintf(buff,"c.bnez x%d, 0x%x",inst->rsrc2 ? inst->rsrc2 : inst->rsrc1,inst->imm);
+            break;
+        case RVC_SLLI:
+            sprintf(buff,"c.slli x%d, 0x%x",inst->rdst,inst->rsrc2);
+            break;
+        case RVC_FLDSP:
+            sprintf(buff,"c.fldsp f%d, %d[x2]",inst->rdst,inst->imm);
+            break;
+        case RVC_LWSP:
+            sprintf(buff,"c.lwsp x%d, %d[x2]",inst->rdst,inst->imm);
+            break;
+        case RVC_LDSP:
+            sprintf(buff,"c.ldsp x%d, %d[x2]",inst->rdst,inst->imm);
+            break;
+        case RVC_JR:
+            sprintf(buff,"c.jr x%d",inst->rsrc1);
+            break;
+        case RVC_MV:
+            sprintf(buff,"c.mv x%d, x%d",inst->rdst,
+                    ((inst->inst_id == RISCV_ADD) && (inst->rsrc1 == 0)) ? inst->rsrc2 : inst->rsrc1);
+            break;
+        case RVC_EBREAK:
+            sprintf(buff,"c.ebreak");
+            break;
+        case RVC_JALR:
+            sprintf(buff,"c.jalr x%d",inst->rsrc1);
+            break;
+        case RVC_ADD:
+            sprintf(buff,"c.add x%d, x%d",inst->rdst,other);
+            break;
+        case RVC_FSDSP:
+            sprintf(buff,"c.fsdsp f%d, %d[x2]",inst->rsrc2,inst->imm);
+            break;
+        case RVC_SWSP:
+            sprintf(buff,"c.swsp x%d, %d[x2]",inst->rsrc2,inst->imm);
+            break;
+        case RVC_SDSP:
+            sprintf(buff,"c.sdsp x%d, %d[x2]",inst->rsrc2,inst->imm);
+            break;
+    }
+}
+
+/* prints an instruction entry the way -checking shows it, in its 16-bit form if it was compressed */
+void sprint_entry(char *buff, mem_entry_t *entry){
+    if (entry->size == 2)
+        sprint_rvc(buff,entry->inst);
+    else
+        sprint_asm(buff,entry->inst);
+}
+
 void print_memlist_info(){
     memblock_list_t *list = block_list;
 
@@ -204,7 +1465,12 @@ void print_memlist_info(){
         mem_entry_t *working = list->head;
         printf("\nmem() block: 0x%012" PRIx64 ":\n",list->min_address);
         while (working){
-            if (working->type == ENTRY_INSTRUCTION){
+            if ((working->type == ENTRY_INSTRUCTION) && (working->size == 2)){
+                char buff[200];
+                sprint_rvc(buff,working->inst);
+                printf("inst:\t@0x%012" PRIx64 "\t0x%04" PRIx32 "\t%s\n",working->address,working->encoding,buff);
+            }
+            else if (working->type == ENTRY_INSTRUCTION){
                 char buff[200];
                 sprint_asm(buff,working->inst);
                 printf("inst:\t@0x%012" PRIx64 "\t0x%08" PRIx32 "\t%s\n",working->address,working->encoding,buff);
@@ -230,6 +1496,26 @@ void print_memlist_info(){
             else if (working->type == ENTRY_SDATA){
                 printf("sdata:\t@0x%012" PRIx64 "\t\"%s\"\n",working->address,working->svalue);
             }
+            else if (working->type == ENTRY_BLOB){
+                printf("incbin:\t@0x%012" PRIx64 "\t%" PRIu32 " bytes\n",working->address,working->size);
+            }
+            else if (working->type == ENTRY_ARRAY){
+                printf("array:\t@0x%012" PRIx64 "\t%" PRIu32 " x %" PRIu32 " bytes\n",working->address,
+                    working->size / working->array->width,working->array->width);
+            }
+            else if ((working->type == ENTRY_GEN) && (working->array->generator == GEN_IOTA)){
+                printf("iota:\t@0x%012" PRIx64 "\t%" PRIu32 " x %" PRIu32 " bytes from %" PRId64 " step %" PRId64 "\n",working->address,
+                    working->size / working->array->width,working->array->width,working->array->start,working->array->step);
+            }
+            else if (working->type == ENTRY_GEN){
+                printf("%s:\t@0x%012" PRIx64 "\t%" PRIu32 " x %" PRIu32 " bytes seed %" PRIu64 "\n",
+                    (working->array->generator == GEN_CHASE) ? "chase" : "random",working->address,
+                    working->size / working->array->width,working->array->width,working->array->seed);
+            }
+            else if (working->type == ENTRY_FILL){
+                printf("fill:\t@0x%012" PRIx64 "\t%" PRIu32 " x %" PRIu32 " bytes of 0x%" PRIx64 "\n",working->address,
+                    working->size / working->array->width,working->array->width,working->array->value);
+            }
             else if (working->type == ENTRY_DEFINITION){
                 if (working->name)
                     printf("def:\t%s skipped\n",working->name);
@@ -266,12 +1552,184 @@ static void elf_alignment(int fd, mem_entry_t *working){
     }
 }
 
+/* a run is expanded a chunk at a time, the chunk is whole elements of any width */
+/* write(2) may stop short, and Linux caps one call near 2 GB */
+static void elf_write(int fd, const uint8_t *bytes, uint64_t size, const char *message){
+    while (size){
+        ssize_t written = write(fd, bytes, size);
+        if (written < 0 && errno == EINTR)
+            continue;
+        if (written <= 0)
+            yyerror(message);
+        bytes += written;
+        size -= written;
+    }
+}
+
+static void elf_fill(int fd, mem_entry_t *working){
+    static uint8_t chunk[65536];
+    uint64_t remaining = working->size;
+
+    fill_bytes(chunk, working->array, (remaining < sizeof(chunk)) ? remaining : sizeof(chunk));
+    while (remaining){
+        uint64_t length = (remaining < sizeof(chunk)) ? remaining : sizeof(chunk);
+        elf_write(fd, chunk, length, "Error in writing fill data to output file");
+        remaining -= length;
+    }
+}
+
+/* null, .symtab, .strtab, .shstrtab, .debug_line, .debug_info, .debug_abbrev, 
+   then a .text for each mem() block */
+#define ELF_SECTIONS 7
+
+/* 
+   appends .symtab, .strtab and .shstrtab after the segments: every 
+   labeled address, with the perf and bench results tables as sized 
+   objects, so a harness can look them up with nm or readelf. then the 
+   DWARF line table, and a .text section over each block's bytes, so 
+   addr2line and perf can name the source line of a pc. returns the 
+   offset of the section headers.
+*/
+static uint64_t write_elf_symbols(int fd, uint64_t *block_offsets, int nblocks){
+    static const char shstrtab[] = "\0.symtab\0.strtab\0.shstrtab\0.debug_line\0.debug_info\0.debug_abbrev\0.text";
+    uint64_t header_bias = sizeof(Elf64_Ehdr) + sizeof(Elf64_Phdr); // same offset the address-of operator adds
+    symtab_entry_t *working;
+    Elf64_Sym *symbols;
+    Elf64_Shdr *sections;
+    dwarf_sections_t dwarf;
+    memblock_list_t *list;
+    char *strtab;
+    uint64_t strtab_size = 1;
+    uint64_t offset;
+    int count = 1; // entry 0 is the null symbol
+    int i;
+
+    for (working=symtab_entries();working;working=working->next){
+        if ((working->type == SYMTAB_MEM) && strncmp(working->name,"__",2)){
+            strtab_size += strlen(working->name) + 1;
+            count++;
+        }
+    }
+    symbols = (Elf64_Sym*)calloc(count,sizeof(Elf64_Sym));
+    strtab = (char*)calloc(strtab_size,1);
+    if (!symbols || !strtab) yyerror("Unable to allocate memory for the ELF symbol table");
+
+    strtab_size = 1;
+    i = 1;
+    for (working=symtab_entries();working;working=working->next){
+        perf_table_t *table;
+        if ((working->type != SYMTAB_MEM) || !strncmp(working->name,"__",2))
+            continue;
+        symbols[i].st_name = strtab_size;
+        symbols[i].st_info = ELF64_ST_INFO(STB_GLOBAL,STT_NOTYPE);
+        symbols[i].st_shndx = SHN_ABS;
+        symbols[i].st_value = working->value + header_bias;
+        for (table=perf_tables;table;table=table->next){
+            if (strcmp(table->name,working->name) == 0){
+                symbols[i].st_info = ELF64_ST_INFO(STB_GLOBAL,STT_OBJECT);
+                symbols[i].st_size = table->samples * 16;
+            }
+        }
+        strcpy(strtab + strtab_size,working->name);
+        strtab_size += strlen(working->name) + 1;
+        i++;
+    }
+
+    offset = lseek(fd,0,SEEK_CUR);
+    while (offset & 0x7){
+        uint8_t data = 0;
+        if (write(fd,&data,1) != 1)
+            yyerror("Error in writing padding to output file");
+        offset++;
+    }
+
+    sections = (Elf64_Shdr*)calloc(ELF_SECTIONS + nblocks,sizeof(Elf64_Shdr));
+    if (!sections) yyerror("Unable to allocate memory for the ELF section headers");
+    sections[1].sh_name = 1;
+    sections[1].sh_type = SHT_SYMTAB;
+    sections[1].sh_offset = offset;
+    sections[1].sh_size = count * sizeof(Elf64_Sym);
+    sections[1].sh_link = 2;
+    sections[1].sh_info = 1; // index of the first global
+    sections[1].sh_addralign = 8;
+    sections[1].sh_entsize = sizeof(Elf64_Sym);
+    sections[2].sh_name = 9;
+    sections[2].sh_type = SHT_STRTAB;
+    sections[2].sh_offset = sections[1].sh_offset + sections[1].sh_size;
+    sections[2].sh_size = strtab_size;
+    sections[2].sh_addralign = 1;
+    sections[3].sh_name = 17;
+    sections[3].sh_type = SHT_STRTAB;
+    sections[3].sh_offset = sections[2].sh_offset + sections[2].sh_size;
+    sections[3].sh_size = sizeof(shstrtab);
+    sections[3].sh_addralign = 1;
+
+    build_dwarf_sections(&dwarf,header_bias);
+    sections[4].sh_name = 27;
+    sections[4].sh_type = SHT_PROGBITS;
+    sections[4].sh_offset = sections[3].sh_offset + sections[3].sh_size;
+    sections[4].sh_size = dwarf.line_size;
+    sections[4].sh_addralign = 1;
+    sections[5].sh_name = 39;
+    sections[5].sh_type = SHT_PROGBITS;
+    sections[5].sh_offset = sections[4].sh_offset + sections[4].sh_size;
+    sections[5].sh_size = dwarf.info_size;
+    sections[5].sh_addralign = 1;
+    sections[6].sh_name = 51;
+    sections[6].sh_type = SHT_PROGBITS;
+    sections[6].sh_offset = sections[5].sh_offset + sections[5].sh_size;
+    sections[6].sh_size = dwarf.abbrev_size;
+    sections[6].sh_addralign = 1;
+    for (i=0,list=block_list;list;i++,list=list->next){
+        Elf64_Shdr *text = &sections[ELF_SECTIONS + i];
+        mem_entry_t *working;
+        text->sh_name = 65;
+        text->sh_type = SHT_PROGBITS;
+        text->sh_flags = SHF_ALLOC | SHF_WRITE | SHF_EXECINSTR;
+        text->sh_addr = list->min_address + header_bias;
+        text->sh_offset = block_offsets[i];
+        for (working=list->head;working;working=working->next){
+            if (working->address + working->size > list->min_address + text->sh_size)
+                text->sh_size = working->address + working->size - list->min_address;
+        }
+        text->sh_addralign = inst_alignment;
+    }
+
+    if (write(fd,symbols,count * sizeof(Elf64_Sym)) != (count * sizeof(Elf64_Sym)))
+        yyerror("Error writing ELF symbol table to output file");
+    if (write(fd,strtab,strtab_size) != strtab_size)
+        yyerror("Error writing ELF string table to output file");
+    if (write(fd,shstrtab,sizeof(shstrtab)) != sizeof(shstrtab))
+        yyerror("Error writing ELF section names to output file");
+    if ((write(fd,dwarf.line,dwarf.line_size) != dwarf.line_size) ||
+        (write(fd,dwarf.info,dwarf.info_size) != dwarf.info_size) ||
+        (write(fd,dwarf.abbrev,dwarf.abbrev_size) != dwarf.abbrev_size))
+        yyerror("Error writing DWARF line table to output file");
+    free_dwarf_sections(&dwarf);
+
+    offset = sections[6].sh_offset + sections[6].sh_size;
+    while (offset & 0x7){
+        uint8_t data = 0;
+        if (write(fd,&data,1) != 1)
+            yyerror("Error in writing padding to output file");
+        offset++;
+    }
+    if (write(fd,sections,sizeof(Elf64_Shdr) * (ELF_SECTIONS + nblocks)) != sizeof(Elf64_Shdr) * (ELF_SECTIONS + nblocks))
+        yyerror("Error writing ELF section headers to output file");
+
+    free(sections);
+    free(symbols);
+    free(strtab);
+    return offset;
+}
+
 void write_elf(char * file) {
     int fd;
     int nblocks = 0; // number of memory blocks parsed
     Elf64_Ehdr *elf_header;
     Elf64_Phdr *prog_header;
     memblock_list_t *list;
+    uint64_t *block_offsets;
 
     fd = open(file, O_CREAT | O_WRONLY | O_TRUNC, S_IRUSR | S_IWUSR | S_IXUSR);
     if (fd < 0) yyerror("Unable to open output file");
@@ -302,7 +1760,7 @@ void write_elf(char * file) {
     elf_header->e_entry = pc + sizeof(Elf64_Ehdr) + sizeof(Elf64_Phdr); // FIXME needs to be sizeof(Elf64_Phdr) * number of headers?
     elf_header->e_phoff = sizeof(Elf64_Ehdr);
     elf_header->e_shoff = 0;
-    elf_header->e_flags = 0;
+    elf_header->e_flags = (inst_alignment == 2) ? EF_RISCV_RVC : 0; // -compress output needs the c extension
     elf_header->e_ehsize = sizeof(Elf64_Ehdr);
     elf_header->e_phentsize = sizeof(Elf64_Phdr);
     elf_header->e_phnum = nblocks;
@@ -330,12 +1788,17 @@ void write_elf(char * file) {
     if (write(fd, prog_header, sizeof(Elf64_Phdr) * nblocks) != (sizeof(Elf64_Phdr) * nblocks))
         yyerror("Error writing program headers to output file");
 
+    block_offsets = (uint64_t*) malloc(sizeof(uint64_t) * nblocks);
+    if (!block_offsets) yyerror("Unable to allocate memory for ELF section offsets");
+    nblocks = 0;
     list = block_list;
     while (list){
         mem_entry_t *working = list->head;
+        block_offsets[nblocks++] = lseek(fd, 0, SEEK_CUR);
         while (working){
             if (working->type == ENTRY_INSTRUCTION){
-                if (write(fd, &(working->encoding), sizeof(working->encoding)) != working->size) 
+                /* little-endian, so the low half word is first for compressed instructions */
+                if (write(fd, &(working->encoding), working->size) != working->size) 
                     yyerror("Error in writing instruction to output file");
 
                 elf_alignment(fd, working);
@@ -376,7 +1839,7 @@ void write_elf(char * file) {
                 elf_alignment(fd, working);
             }
             else if (working->type == ENTRY_DDATA){
-                double data = (double)working->fvalue;
+                double data = working->dvalue;
                 if (write(fd, &(data), sizeof(data)) != working->size) 
                     yyerror("Error in writing floating point double data to output file");
 
@@ -388,6 +1851,20 @@ void write_elf(char * file) {
 
                 elf_alignment(fd, working);
             }
+            else if (working->type == ENTRY_BLOB){
+                elf_write(fd, working->blob, working->size, "Error in writing .incbin data to output file");
+
+                elf_alignment(fd, working);
+            }
+            else if ((working->type == ENTRY_ARRAY) || (working->type == ENTRY_GEN)){
+                elf_write(fd, working->array->bytes, working->size, "Error in writing data list to output file");
+
+                elf_alignment(fd, working);
+            }
+            else if (working->type == ENTRY_FILL){
+                elf_fill(fd, working);
+                elf_alignment(fd, working);
+            }
             else if ((working->type == ENTRY_DEFINITION) || (working->type == ENTRY_JOIN_NODE)){
                 // skip, do not write anything
             }
@@ -398,9 +1875,94 @@ void write_elf(char * file) {
         }
         list = list->next;
     }
+
+    /* now that the section headers have a place, point the ELF header at them */
+    elf_header->e_shoff = write_elf_symbols(fd, block_offsets, nblocks);
+    free(block_offsets);
+    elf_header->e_shentsize = sizeof(Elf64_Shdr);
+    elf_header->e_shnum = ELF_SECTIONS + nblocks;
+    elf_header->e_shstrndx = 3;
+    if (pwrite(fd, elf_header, sizeof(Elf64_Ehdr), 0) != sizeof(Elf64_Ehdr))
+        yyerror("Error writing ELF header to output file");
+
+    output_bytes += lseek(fd, 0, SEEK_END);
     if (close(fd) != 0) yyerror("Error closing output file");
 }
 
+/* 
+   the bytes of a mem() block from adj_start_addr up to adj_end_addr, 
+   all multibyte values in little-endian order. -text and -bin copy 
+   everything into a buffer like this first, then write it out. I found 
+   that to be easier and more consistent than trying to print directly
+*/
+static unsigned char *memblock_image(memblock_list_t *list, uint64_t adj_start_addr, uint64_t adj_end_addr){
+    mem_entry_t *working = list->head;
+    unsigned char *buff = (unsigned char *) malloc(adj_end_addr - adj_start_addr);
+    bzero(buff, adj_end_addr - adj_start_addr);
+
+    while (working){
+        if (working->type == ENTRY_INSTRUCTION){
+            if ((working->address & (inst_alignment - 1)) != 0) yyerror("unaligned instruction encoding");
+            int idx = working->address - adj_start_addr;
+            buff[idx+0] = (working->encoding>>0)  & 0xff;
+            buff[idx+1] = (working->encoding>>8)  & 0xff;
+            if (working->size == 4){
+                buff[idx+2] = (working->encoding>>16) & 0xff;
+                buff[idx+3] = (working->encoding>>24) & 0xff;
+            }
+        }
+        else if (working->type == ENTRY_BDATA){
+            int idx = working->address - adj_start_addr;
+            buff[idx+0] = (working->ivalue>>0)  & 0xff;
+        }
+        else if (working->type == ENTRY_HDATA){
+            if ((working->address & 0x1) != 0) yyerror("unaligned half word");
+            int idx = working->address - adj_start_addr;
+            buff[idx+0] = (working->ivalue>>0)  & 0xff;
+            buff[idx+1] = (working->ivalue>>8)  & 0xff;
+        }
+        else if (working->type == ENTRY_WDATA){
+            if ((working->address & 0x3) != 0) yyerror("unaligned word");
+            int idx = working->address - adj_start_addr;
+            buff[idx+0] = (working->ivalue>>0)  & 0xff;
+            buff[idx+1] = (working->ivalue>>8)  & 0xff;
+            buff[idx+2] = (working->ivalue>>16) & 0xff;
+            buff[idx+3] = (working->ivalue>>24) & 0xff;
+        }
+        else if (working->type == ENTRY_LDATA){
+            yyerror("Writing long data to flat text files not yet supported.");
+        }
+        else if (working->type == ENTRY_FDATA){
+            yyerror("Writing fp data to flat text files not yet supported.");
+        }
+        else if (working->type == ENTRY_DDATA){
+            yyerror("Writing fp data to flat text files not yet supported.");
+        }
+        else if (working->type == ENTRY_SDATA){
+            yyerror("Writing string data to flat text files not yet supported.");
+        }
+        else if (working->type == ENTRY_BLOB){
+            int idx = working->address - adj_start_addr;
+            memcpy(buff + idx, working->blob, working->size);
+        }
+        else if ((working->type == ENTRY_ARRAY) || (working->type == ENTRY_GEN)){
+            int idx = working->address - adj_start_addr;
+            memcpy(buff + idx, working->array->bytes, working->size);
+        }
+        else if (working->type == ENTRY_FILL){
+            int idx = working->address - adj_start_addr;
+            fill_bytes(buff + idx, working->array, working->size);
+        }
+        else if ((working->type == ENTRY_DEFINITION) || (working->type == ENTRY_JOIN_NODE)){
+        }
+        else {
+            yyerror("Invalid entry type when emitting text memory image");
+        }
+        working = working->next;
+    }
+    return buff;
+}
+
 void write_text(char * file) {
     FILE *fp = fopen(file,"w");
     if (!fp){
@@ -411,61 +1973,7 @@ void write_text(char * file) {
     while (list){
         uint64_t adj_start_addr = list->min_address & ~((uint64_t)0xf); // align to 16 bytes
         uint64_t adj_end_addr = (list->max_address + 16) & ~((uint64_t)0xf);
-        mem_entry_t *working = list->head;
-
-        // copy all encodings/data into a buffer first,
-        // then dump the buffer to the text file. I found 
-        // that to be easier and more consistent than 
-        // trying to print directly
-        unsigned char *buff = (unsigned char *) malloc(adj_end_addr - adj_start_addr);
-        bzero(buff, adj_end_addr - adj_start_addr);
-        while (working){
-            // writes all multibyte values in little-endian order
-            if (working->type == ENTRY_INSTRUCTION){
-                if ((working->address & 0x3) != 0) yyerror("unaligned instruction encoding");
-                int idx = working->address - adj_start_addr;
-                buff[idx+0] = (working->encoding>>0)  & 0xff;
-                buff[idx+1] = (working->encoding>>8)  & 0xff;
-                buff[idx+2] = (working->encoding>>16) & 0xff;
-                buff[idx+3] = (working->encoding>>24) & 0xff;
-            }
-            else if (working->type == ENTRY_BDATA){
-                int idx = working->address - adj_start_addr;
-                buff[idx+0] = (working->ivalue>>0)  & 0xff;
-            }
-            else if (working->type == ENTRY_HDATA){
-                if ((working->address & 0x1) != 0) yyerror("unaligned half word");
-                int idx = working->address - adj_start_addr;
-                buff[idx+0] = (working->ivalue>>0)  & 0xff;
-                buff[idx+1] = (working->ivalue>>8)  & 0xff;
-            }
-            else if (working->type == ENTRY_WDATA){
-                if ((working->address & 0x3) != 0) yyerror("unaligned word");
-                int idx = working->address - adj_start_addr;
-                buff[idx+0] = (working->ivalue>>0)  & 0xff;
-                buff[idx+1] = (working->ivalue>>8)  & 0xff;
-                buff[idx+2] = (working->ivalue>>16) & 0xff;
-                buff[idx+3] = (working->ivalue>>24) & 0xff;
-            }
-            else if (working->type == ENTRY_LDATA){
-                yyerror("Writing long data to flat text files not yet supported.");
-            }
-            else if (working->type == ENTRY_FDATA){
-                yyerror("Writing fp data to flat text files not yet supported.");
-            }
-            else if (working->type == ENTRY_DDATA){
-                yyerror("Writing fp data to flat text files not yet supported.");
-            }
-            else if (working->type == ENTRY_SDATA){
-                yyerror("Writing string data to flat text files not yet supported.");
-            }
-            else if ((working->type == ENTRY_DEFINITION) || (working->type == ENTRY_JOIN_NODE)){
-            }
-            else {
-                yyerror("Invalid entry type when emitting text memory image");
-            }
-            working = working->next;
-        }
+        unsigned char *buff = memblock_image(list, adj_start_addr, adj_end_addr);
 
         for (int i = 0; i < (adj_end_addr - adj_start_addr); i++){
             if ((i & 0xf) == 0) fprintf(fp,"%012" PRIx64 "  ", adj_start_addr + i);
@@ -478,80 +1986,36 @@ void write_text(char * file) {
         list = list->next;
     }
 
+    output_bytes += ftell(fp);
     fclose(fp);
 }
 
+/* one mem() block's .bin file, the 16 byte aligned starting address 
+   and then the block's bytes from there */
+void write_bin_memblock(char *filename, memblock_list_t *list){
+    uint64_t adj_start_addr = list->min_address & ~((uint64_t)0xf); // align to 16 bytes
+    uint64_t adj_end_addr = (list->max_address + 16) & ~((uint64_t)0xf);
+    int fd = open(filename, O_CREAT | O_WRONLY | O_TRUNC, S_IRUSR | S_IWUSR);
+    if (fd < 0) yyerror("Unable to open output file for binary output.");
+
+    unsigned char *buff = memblock_image(list, adj_start_addr, adj_end_addr);
+    // write the 16 byte aligned starting address first
+    write(fd,&adj_start_addr,sizeof(uint64_t));
+    // then write all of the data/encodings
+    write(fd,buff,adj_end_addr - adj_start_addr);
+    free(buff);
+    output_bytes += lseek(fd, 0, SEEK_END);
+    close(fd);
+}
+
 void write_bin(char * file_base) {
     int num_memblocks = 0;
     memblock_list_t *list = block_list;
     while (list){
-        uint64_t adj_start_addr = list->min_address & ~((uint64_t)0xf); // align to 16 bytes
-        uint64_t adj_end_addr = (list->max_address + 16) & ~((uint64_t)0xf);
-        mem_entry_t *working = list->head;
         char *filename = (char*) malloc(strlen(file_base) + strlen(".txt") + 10); // extra 10 for the memblock number
         sprintf(filename,"%s-%d.bin",file_base,num_memblocks++);
-        int fd = open(filename, O_CREAT | O_WRONLY | O_TRUNC, S_IRUSR | S_IWUSR);
-        if (fd < 0) yyerror("Unable to open output file for binary output.");
-
-
-        // copy all encodings/data into a buffer first,
-        // similar to text output
-        unsigned char *buff = (unsigned char *) malloc(adj_end_addr - adj_start_addr);
-        bzero(buff, adj_end_addr - adj_start_addr);
-        while (working){
-            // writes all multibyte values in little-endian order
-            if (working->type == ENTRY_INSTRUCTION){
-                if ((working->address & 0x3) != 0) yyerror("unaligned instruction encoding");
-                int idx = working->address - adj_start_addr;
-                buff[idx+0] = (working->encoding>>0)  & 0xff;
-                buff[idx+1] = (working->encoding>>8)  & 0xff;
-                buff[idx+2] = (working->encoding>>16) & 0xff;
-                buff[idx+3] = (working->encoding>>24) & 0xff;
-            }
-            else if (working->type == ENTRY_BDATA){
-                int idx = working->address - adj_start_addr;
-                buff[idx+0] = (working->ivalue>>0)  & 0xff;
-            }
-            else if (working->type == ENTRY_HDATA){
-                if ((working->address & 0x1) != 0) yyerror("unaligned half word");
-                int idx = working->address - adj_start_addr;
-                buff[idx+0] = (working->ivalue>>0)  & 0xff;
-                buff[idx+1] = (working->ivalue>>8)  & 0xff;
-            }
-            else if (working->type == ENTRY_WDATA){
-                if ((working->address & 0x3) != 0) yyerror("unaligned word");
-                int idx = working->address - adj_start_addr;
-                buff[idx+0] = (working->ivalue>>0)  & 0xff;
-                buff[idx+1] = (working->ivalue>>8)  & 0xff;
-                buff[idx+2] = (working->ivalue>>16) & 0xff;
-                buff[idx+3] = (working->ivalue>>24) & 0xff;
-            }
-            else if (working->type == ENTRY_LDATA){
-                yyerror("Writing long data to flat text files not yet supported.");
-            }
-            else if (working->type == ENTRY_FDATA){
-                yyerror("Writing fp data to flat text files not yet supported.");
-            }
-            else if (working->type == ENTRY_DDATA){
-                yyerror("Writing fp data to flat text files not yet supported.");
-            }
-            else if (working->type == ENTRY_SDATA){
-                yyerror("Writing string data to flat text files not yet supported.");
-            }
-            else if ((working->type == ENTRY_DEFINITION) || (working->type == ENTRY_JOIN_NODE)){
-            }
-            else {
-                yyerror("Invalid entry type when emitting text memory image");
-            }
-            working = working->next;
-        }
-
-        // write the 16 byte aligned starting address first
-        write(fd,&adj_start_addr,sizeof(uint64_t));
-        // then write all of the data/encodings
-        write(fd,buff,adj_end_addr - adj_start_addr);
-        free(buff);
-        close(fd);
+        write_bin_memblock(filename,list);
+        free(filename);
 
         list = list->next;
     }
@@ -38,9 +38,17 @@
 #ifndef __OUTPUT_H__
 #define __OUTPUT_H__
 
+#include "inst.h"
+#include "mem.h"
+
+extern uint64_t output_bytes;
+
+void sprint_asm(char *, instruction_t *);
+void sprint_entry(char *, mem_entry_t *);
 void print_memlist_info();
 void write_elf(char *);
 void write_text(char *);
 void write_bin(char *);
+void write_bin_memblock(char *, memblock_list_t *);
 
 #endif
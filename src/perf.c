@@ -0,0 +1,357 @@
+/* This file is part of the DuctTape (dt) high-level assembler for 
+ * RISC-V. The dt project was written by Justin Severeid and Elliott 
+ * Forbes, University of Wisconsin-La Crosse, copyright 2020-2024.
+ *
+ * DuctTape is free software: you can redistribute it and/or modify 
+ * it under the terms of the GNU General Public License as published 
+ * by the Free Software Foundation, either version 3 of the License, 
+ * or (at your option) any later version.
+ *
+ * DuctTape is distributed in the hope that it will be useful, but 
+ * WITHOUT ANY WARRANTY; without even the implied warranty of 
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU 
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License 
+ * along with DuctTape. If not, see <https://www.gnu.org/licenses/>. 
+ *
+ *
+ *
+ * The dt project can be found at https://cs.uwlax.edu/~eforbes/dt/
+ *
+ * If you use dt in your published research, please consider 
+ * citing the following:
+ *
+ * Severeid, J. and Forbes, E., "dt: A High-level Assembler for RISC-V," 
+ * Proceedings of the 53rd Midwest Instruction and Computing Symposium, 
+ * April 2020. 
+ *
+ * If you found dt helpful, please let us know! Email eforbes@uwlax.edu
+ *
+ * There are bound to be bugs, let us know those too.
+ */
+
+
+/*
+ * perf (name) { ... } and bench (warmup, iters) { ... } regions: the 
+ * cycle and instret counters are read before and after the region, with 
+ * a fence on each side, and the differences are stored in a results 
+ * table at the end of the mem() block. The table is a named symbol, in 
+ * the -checking output and the ELF symbol table, so a harness can find 
+ * it after the run.
+ *
+ * Nothing is kept in registers across the region, so the body is free 
+ * to use any register, but $t4-$t6 are clobbered around it.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <inttypes.h>
+
+#include "riscvarch.h"
+#include "perf.h"
+#include "imm.h"
+#include "inst.h"
+#include "mem.h"
+#include "symtab.h"
+#include "util.h"
+
+#define PERF_ADDR_REG 29 // $t4
+#define PERF_REG_A 30    // $t5
+#define PERF_REG_B 31    // $t6
+
+#define PERF_SAMPLE_SIZE 16 /* a cycle and an instret delta */
+
+perf_table_t *perf_tables = NULL;
+static perf_table_t *last_table = NULL;
+static int bench_count = 0;
+
+/* tables waiting for the end of the current mem() block */
+static mem_entry_t *pending_tables = NULL;
+
+mem_entry_t *gen_fence(){
+    mem_entry_t *entry = new_instruction(OP_FENCE);
+    entry->inst->inst_id = RISCV_FENCE;
+    entry->inst->funct3 = F3_FENCE;
+    entry->inst->imm = FENCE_ALL;
+    entry->status = ENTRY_COMPLETE;
+    return entry;
+}
+
+mem_entry_t *gen_csr_read(uint32_t rd, int csr){
+    mem_entry_t *entry = new_instruction(OP_CSRRS);
+    entry->inst->inst_id = RISCV_CSRRS;
+    entry->inst->funct3 = F3_CSRRS;
+    entry->inst->rdst = rd;
+    entry->inst->rsrc1 = 0;
+    entry->inst->imm = csr;
+    entry->status = ENTRY_COMPLETE;
+    return entry;
+}
+
+/* rd = @name, offsets get filled in by calculate_offsets() */
+mem_entry_t *gen_address(uint32_t rd, char *name){
+    mem_entry_t *upper = new_instruction(OP_LUI);
+    mem_entry_t *lower = new_instruction(OP_ADDIW);
+    upper->inst->inst_id = RISCV_LUI;
+    upper->inst->rdst = rd;
+    upper->inst->target_name = strdup(name);
+    lower->inst->inst_id = RISCV_ADDIW;
+    lower->inst->funct3 = F3_ADDIW;
+    lower->inst->rdst = rd;
+    lower->inst->rsrc1 = rd;
+    lower->inst->target_name = strdup(name);
+    return append_inst(upper,lower);
+}
+
+mem_entry_t *gen_load(uint32_t rd, uint32_t base, int32_t offset){
+    mem_entry_t *entry = new_instruction(OP_LD);
+    entry->inst->inst_id = RISCV_LD;
+    entry->inst->funct3 = F3_LD;
+    entry->inst->rdst = rd;
+    entry->inst->rsrc1 = base;
+    entry->inst->imm = offset;
+    entry->status = ENTRY_COMPLETE;
+    return entry;
+}
+
+mem_entry_t *gen_store(uint32_t value, uint32_t base, int32_t offset){
+    mem_entry_t *entry = new_instruction(OP_SD);
+    entry->inst->inst_id = RISCV_SD;
+    entry->inst->funct3 = F3_SD;
+    entry->inst->rsrc1 = base;
+    entry->inst->rsrc2 = value;
+    entry->inst->imm = offset;
+    entry->status = ENTRY_COMPLETE;
+    return entry;
+}
+
+mem_entry_t *gen_sub(uint32_t rd, uint32_t rs1, uint32_t rs2){
+    mem_entry_t *entry = new_instruction(OP_SUB);
+    entry->inst->inst_id = RISCV_SUB;
+    entry->inst->funct3 = F3_SUB;
+    entry->inst->funct7 = F7_SUB;
+    entry->inst->rdst = rd;
+    entry->inst->rsrc1 = rs1;
+    entry->inst->rsrc2 = rs2;
+    entry->status = ENTRY_COMPLETE;
+    return entry;
+}
+
+mem_entry_t *gen_add(uint32_t rd, uint32_t rs1, uint32_t rs2){
+    mem_entry_t *entry = new_instruction(OP_ADD);
+    entry->inst->inst_id = RISCV_ADD;
+    entry->inst->funct3 = F3_ADD;
+    entry->inst->funct7 = F7_ADD;
+    entry->inst->rdst = rd;
+    entry->inst->rsrc1 = rs1;
+    entry->inst->rsrc2 = rs2;
+    entry->status = ENTRY_COMPLETE;
+    return entry;
+}
+
+mem_entry_t *gen_imm_op(int inst_id, uint32_t opcode, uint32_t funct3, uint32_t rd, uint32_t rs1, int32_t imm){
+    mem_entry_t *entry = new_instruction(opcode);
+    entry->inst->inst_id = inst_id;
+    entry->inst->funct3 = funct3;
+    entry->inst->rdst = rd;
+    entry->inst->rsrc1 = rs1;
+    entry->inst->imm = imm;
+    entry->status = ENTRY_COMPLETE;
+    return entry;
+}
+
+mem_entry_t *gen_slli(uint32_t rd, uint32_t rs1, uint32_t shamt){
+    mem_entry_t *entry = new_instruction(OP_SLLI);
+    entry->inst->inst_id = RISCV_SLLI;
+    entry->inst->funct3 = F3_SLLI;
+    entry->inst->funct7 = F7_SLLI;
+    entry->inst->rdst = rd;
+    entry->inst->rsrc1 = rs1;
+    entry->inst->rsrc2 = shamt; // shamt
+    entry->status = ENTRY_COMPLETE;
+    return entry;
+}
+
+mem_entry_t *gen_branch(int inst_id, uint32_t opcode, uint32_t funct3, uint32_t rs1, uint32_t rs2, char *target){
+    mem_entry_t *entry = new_instruction(opcode);
+    entry->inst->inst_id = inst_id;
+    entry->inst->funct3 = funct3;
+    entry->inst->rsrc1 = rs1;
+    entry->inst->rsrc2 = rs2;
+    entry->inst->target_name = strdup(target);
+    return entry;
+}
+
+/* count zeroed long words for a table, the first one named */
+static mem_entry_t *new_table(char *name, int64_t count){
+    mem_entry_t *list = NULL;
+    int64_t i;
+    for (i=0;i<count;i++){
+        mem_entry_t *slot = new_mem_entry(ENTRY_LDATA,8);
+        slot->ivalue = 0;
+        slot->status = ENTRY_COMPLETE;
+        if (i == 0){
+            slot->name = strdup(name);
+            symtab_new(slot->name,SYMTAB_MEM);
+        }
+        list = append_inst(list,slot);
+    }
+    pending_tables = append_inst(pending_tables,list);
+    return list;
+}
+
+static void add_table(perf_kind_t kind, char *name, mem_entry_t *first, int64_t warmup, int64_t samples){
+    perf_table_t *table = (perf_table_t*)malloc(sizeof(perf_table_t));
+    table->kind = kind;
+    table->name = strdup(name);
+    table->first = first;
+    table->warmup = warmup;
+    table->samples = samples;
+    table->next = NULL;
+    if (last_table)
+        last_table->next = table;
+    else
+        perf_tables = table;
+    last_table = table;
+}
+
+/* 
+   fence, read cycle then instret, and park them in slots 0 and 8 of the 
+   table whose address is in $t4
+*/
+static mem_entry_t *gen_start(char *table){
+    mem_entry_t *list = gen_fence();
+    list = append_inst(list,gen_address(PERF_ADDR_REG,table));
+    list = append_inst(list,gen_csr_read(PERF_REG_A,CSR_CYCLE));
+    list = append_inst(list,gen_csr_read(PERF_REG_B,CSR_INSTRET));
+    list = append_inst(list,gen_store(PERF_REG_A,PERF_ADDR_REG,0));
+    list = append_inst(list,gen_store(PERF_REG_B,PERF_ADDR_REG,8));
+    return list;
+}
+
+/* 
+   fence, read the counters in the opposite order so the two reads nest, 
+   and replace the parked start values with the deltas -- $t4 is left 
+   holding the table address
+*/
+static mem_entry_t *gen_stop(char *table){
+    mem_entry_t *list = gen_fence();
+    list = append_inst(list,gen_csr_read(PERF_REG_B,CSR_INSTRET));
+    list = append_inst(list,gen_csr_read(PERF_REG_A,CSR_CYCLE));
+    list = append_inst(list,gen_address(PERF_ADDR_REG,table));
+    list = append_inst(list,gen_load(PERF_ADDR_REG,PERF_ADDR_REG,0));
+    list = append_inst(list,gen_sub(PERF_REG_A,PERF_REG_A,PERF_ADDR_REG));
+    list = append_inst(list,gen_address(PERF_ADDR_REG,table));
+    list = append_inst(list,gen_store(PERF_REG_A,PERF_ADDR_REG,0));
+    list = append_inst(list,gen_load(PERF_REG_A,PERF_ADDR_REG,8));
+    list = append_inst(list,gen_sub(PERF_REG_B,PERF_REG_B,PERF_REG_A));
+    list = append_inst(list,gen_store(PERF_REG_B,PERF_ADDR_REG,8));
+    return list;
+}
+
+mem_entry_t *perf_region(char *name, mem_entry_t *body){
+    mem_entry_t *table = new_table(name,PERF_SAMPLE_SIZE/8);
+    mem_entry_t *list;
+
+    add_table(PERF_REGION,name,table,0,1);
+    list = gen_start(name);
+    list = append_inst(list,body);
+    list = append_inst(list,gen_stop(name));
+    return list;
+}
+
+/* 
+   the state table holds the trips left and the parked counters, each 
+   trip leaves its deltas in the state table and the measured ones copy 
+   them to sample iters-1-left of the bench table
+*/
+mem_entry_t *bench_region(int64_t warmup, int64_t iters, mem_entry_t *body){
+    char name[32];
+    char *state_name = internal_name();
+    mem_entry_t *samples;
+    mem_entry_t *top;
+    mem_entry_t *skip = new_mem_entry(ENTRY_JOIN_NODE,0);
+    mem_entry_t *list;
+
+    if (warmup < 0)
+        yyerror("bench needs a warmup count of zero or more");
+    if (iters < 1)
+        yyerror("bench needs at least one measured iteration");
+
+    sprintf(name,"bench%d",bench_count++);
+    new_table(state_name,3);
+    samples = new_table(name,iters*(PERF_SAMPLE_SIZE/8));
+    add_table(PERF_BENCH,name,samples,warmup,iters);
+
+    /* trips left = warmup + iters */
+    list = gen_address(PERF_ADDR_REG,state_name);
+    list = append_inst(list,load_immediate(PERF_REG_A,warmup + iters));
+    list = append_inst(list,gen_store(PERF_REG_A,PERF_ADDR_REG,16));
+
+    /* the counters are parked in the state table's first two slots */
+    top = gen_start(state_name);
+    top->name = internal_name();
+    symtab_new(top->name,SYMTAB_MEM);
+    list = append_inst(list,top);
+    list = append_inst(list,body);
+    list = append_inst(list,gen_stop(state_name));
+
+    /* one trip fewer to go */
+    list = append_inst(list,gen_load(PERF_REG_A,PERF_ADDR_REG,16));
+    list = append_inst(list,gen_imm_op(RISCV_ADDI,OP_ADDI,F3_ADDI,PERF_REG_A,PERF_REG_A,-1));
+    list = append_inst(list,gen_store(PERF_REG_A,PERF_ADDR_REG,16));
+
+    /* still warming up while left >= iters */
+    list = append_inst(list,load_immediate(PERF_REG_B,iters));
+    list = append_inst(list,gen_sub(PERF_REG_B,PERF_REG_A,PERF_REG_B));
+    skip->name = internal_name();
+    symtab_new(skip->name,SYMTAB_MEM);
+    list = append_inst(list,gen_branch(RISCV_BGE,OP_BGE,F3_BGE,PERF_REG_B,0,skip->name));
+
+    /* sample address = bench + (iters - 1 - left) * 16, and ~(left - iters) is iters - 1 - left */
+    list = append_inst(list,gen_imm_op(RISCV_XORI,OP_XORI,F3_XORI,PERF_REG_B,PERF_REG_B,-1));
+    list = append_inst(list,gen_slli(PERF_REG_B,PERF_REG_B,4));
+    list = append_inst(list,gen_address(PERF_REG_A,name));
+    list = append_inst(list,gen_add(PERF_REG_B,PERF_REG_B,PERF_REG_A));
+    list = append_inst(list,gen_load(PERF_REG_A,PERF_ADDR_REG,0));
+    list = append_inst(list,gen_store(PERF_REG_A,PERF_REG_B,0));
+    list = append_inst(list,gen_load(PERF_REG_A,PERF_ADDR_REG,8));
+    list = append_inst(list,gen_store(PERF_REG_A,PERF_REG_B,8));
+
+    /* go around again while trips are left */
+    list = append_inst(list,skip);
+    list = append_inst(list,gen_load(PERF_REG_A,PERF_ADDR_REG,16));
+    list = append_inst(list,gen_branch(RISCV_BNE,OP_BNE,F3_BNE,PERF_REG_A,0,top->name));
+    return list;
+}
+
+/* appends the pending results tables to the end of a mem() block */
+mem_entry_t *flush_perf_tables(mem_entry_t *list){
+    mem_entry_t *tables = pending_tables;
+    pending_tables = NULL;
+    if (tables)
+        return append_inst(list,tables);
+    return list;
+}
+
+void dump_perf_tables(){
+    perf_table_t *table = perf_tables;
+
+    if (!table)
+        return;
+    printf("\nPerf tables: (each sample is a cycle then an instret delta, 8 bytes apiece)\n");
+    while (table){
+        if (table->kind == PERF_REGION)
+            printf("perf:\t%s\t@0x%012" PRIx64 "\t%d bytes, 1 sample\n",
+                   table->name,table->first->address,PERF_SAMPLE_SIZE);
+        else
+            printf("bench:\t%s\t@0x%012" PRIx64 "\t%" PRId64 " bytes, %" PRId64 " sample%s after %" PRId64 " warmup run%s\n",
+                   table->name,table->first->address,table->samples*PERF_SAMPLE_SIZE,
+                   table->samples,(table->samples == 1) ? "" : "s",
+                   table->warmup,(table->warmup == 1) ? "" : "s");
+        table = table->next;
+    }
+}
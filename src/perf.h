@@ -0,0 +1,81 @@
+/* This file is part of the DuctTape (dt) high-level assembler for 
+ * RISC-V. The dt project was written by Justin Severeid and Elliott 
+ * Forbes, University of Wisconsin-La Crosse, copyright 2020-2024.
+ *
+ * DuctTape is free software: you can redistribute it and/or modify 
+ * it under the terms of the GNU General Public License as published 
+ * by the Free Software Foundation, either version 3 of the License, 
+ * or (at your option) any later version.
+ *
+ * DuctTape is distributed in the hope that it will be useful, but 
+ * WITHOUT ANY WARRANTY; without even the implied warranty of 
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU 
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License 
+ * along with DuctTape. If not, see <https://www.gnu.org/licenses/>. 
+ *
+ *
+ *
+ * The dt project can be found at https://cs.uwlax.edu/~eforbes/dt/
+ *
+ * If you use dt in your published research, please consider 
+ * citing the following:
+ *
+ * Severeid, J. and Forbes, E., "dt: A High-level Assembler for RISC-V," 
+ * Proceedings of the 53rd Midwest Instruction and Computing Symposium, 
+ * April 2020. 
+ *
+ * If you found dt helpful, please let us know! Email eforbes@uwlax.edu
+ *
+ * There are bound to be bugs, let us know those too.
+ */
+
+
+/*
+ * prototypes for the perf and bench measurement regions
+ */
+
+#ifndef __PERF_H__
+#define __PERF_H__
+
+#include <stdint.h>
+#include <inttypes.h>
+
+#include "mem.h"
+
+typedef enum {
+    PERF_REGION,
+    PERF_BENCH
+} perf_kind_t;
+
+/* a results table, laid out at the end of the mem() block the region is in */
+typedef struct perf_table_type {
+    perf_kind_t kind;
+    char *name;
+    mem_entry_t *first;  /* the first slot, for the table's address */
+    int64_t warmup;      /* bench only */
+    int64_t samples;     /* one for a perf region, iters for a bench */
+    struct perf_table_type *next;
+} perf_table_t;
+
+/* instruction builders, also used by the hart blocks */
+mem_entry_t *gen_fence();
+mem_entry_t *gen_csr_read(uint32_t, int);
+mem_entry_t *gen_address(uint32_t, char *);
+mem_entry_t *gen_load(uint32_t, uint32_t, int32_t);
+mem_entry_t *gen_store(uint32_t, uint32_t, int32_t);
+mem_entry_t *gen_sub(uint32_t, uint32_t, uint32_t);
+mem_entry_t *gen_add(uint32_t, uint32_t, uint32_t);
+mem_entry_t *gen_imm_op(int, uint32_t, uint32_t, uint32_t, uint32_t, int32_t);
+mem_entry_t *gen_slli(uint32_t, uint32_t, uint32_t);
+mem_entry_t *gen_branch(int, uint32_t, uint32_t, uint32_t, uint32_t, char *);
+
+mem_entry_t * perf_region(char *, mem_entry_t *);
+mem_entry_t * bench_region(int64_t, int64_t, mem_entry_t *);
+mem_entry_t * flush_perf_tables(mem_entry_t *);
+void dump_perf_tables();
+
+extern perf_table_t *perf_tables;
+
+#endif
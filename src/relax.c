@@ -0,0 +1,291 @@
+/* This file is part of the DuctTape (dt) high-level assembler for 
+ * RISC-V. The dt project was written by Justin Severeid and Elliott 
+ * Forbes, University of Wisconsin-La Crosse, copyright 2020-2024.
+ *
+ * DuctTape is free software: you can redistribute it and/or modify 
+ * it under the terms of the GNU General Public License as published 
+ * by the Free Software Foundation, either version 3 of the License, 
+ * or (at your option) any later version.
+ *
+ * DuctTape is distributed in the hope that it will be useful, but 
+ * WITHOUT ANY WARRANTY; without even the implied warranty of 
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU 
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License 
+ * along with DuctTape. If not, see <https://www.gnu.org/licenses/>. 
+ *
+ *
+ *
+ * The dt project can be found at https://cs.uwlax.edu/~eforbes/dt/
+ *
+ * If you use dt in your published research, please consider 
+ * citing the following:
+ *
+ * Severeid, J. and Forbes, E., "dt: A High-level Assembler for RISC-V," 
+ * Proceedings of the 53rd Midwest Instruction and Computing Symposium, 
+ * April 2020. 
+ *
+ * If you found dt helpful, please let us know! Email eforbes@uwlax.edu
+ *
+ * There are bound to be bugs, let us know those too.
+ */
+
+
+/*
+ * branch and jump relaxation: rewrites branches and jumps whose labeled 
+ * target is out of range into longer sequences, to a fixed point
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <inttypes.h>
+
+#include "riscvarch.h"
+#include "relax.h"
+#include "compress.h"
+#include "inst.h"
+#include "mem.h"
+#include "symtab.h"
+#include "util.h"
+
+/* scratch register for a relaxed j, the same one the standard tail pseudo uses */
+#define RELAX_SCRATCH_REG 6 // $t1
+
+
+int relax_passes = 0;
+static uint32_t scratch_reg = RELAX_SCRATCH_REG;
+static int relaxed_branches = 0;
+static int relaxed_jumps = 0;
+static int widened_rvc = 0;
+
+static BOOL is_branch(instruction_t *inst){
+    return (inst->inst_id == RISCV_BEQ) || (inst->inst_id == RISCV_BNE) ||
+           (inst->inst_id == RISCV_BLT) || (inst->inst_id == RISCV_BGE) ||
+           (inst->inst_id == RISCV_BLTU) || (inst->inst_id == RISCV_BGEU);
+}
+
+static BOOL is_jump(instruction_t *inst){
+    return (inst->inst_id == RISCV_JAL) || (inst->inst_id == RISCV_J);
+}
+
+/* TRUE if inst reads or writes integer register reg */
+static BOOL uses_int_reg(instruction_t *inst, uint32_t reg){
+    operands_t ops;
+    int i;
+
+    find_operands(inst,&ops);
+    for (i=0;i<ops.src_count;i++){
+        if ((ops.src[i].reg_class == OPERAND_INT) && (operand_reg(&ops.src[i]) == reg))
+            return TRUE;
+    }
+    return ops.dst.field && (ops.dst.reg_class == OPERAND_INT) && (operand_reg(&ops.dst) == reg);
+}
+
+/* the auipc+jalr that relax_jump() made out of a j */
+static BOOL relaxed_j(mem_entry_t *entry){
+    mem_entry_t *next = entry->next;
+    return (entry->inst->inst_id == RISCV_AUIPC) && next && (next->type == ENTRY_INSTRUCTION) &&
+           (next->inst->inst_id == RISCV_JALR) && (next->inst->rdst == 0) && next->inst->target_name;
+}
+
+/* the first instruction in a mem() block that reads or writes the 
+   scratch register, leaving out the j's relaxed through it already */
+static mem_entry_t *scratch_user(memblock_list_t *list){
+    mem_entry_t *working;
+
+    for (working = list->head; working; working = working->next){
+        if (working->type != ENTRY_INSTRUCTION)
+            continue;
+        if (relaxed_j(working))
+            working = working->next;
+        else if (uses_int_reg(working->inst,scratch_reg))
+            return working;
+    }
+    return NULL;
+}
+
+/* a relaxed j would overwrite whatever the block keeps in the scratch register */
+static void check_scratch(memblock_list_t *list, mem_entry_t *jump){
+    mem_entry_t *user = scratch_user(list);
+    char buff[300];
+
+    if (!user)
+        return;
+    sprintf(buff,"Jump to label \"%s\" is out of range, and relaxing it to auipc+jalr "
+                 "would overwrite x%u, which this mem() block uses (line %u). "
+                 "Pick a register it does not use with -relaxreg <n>.",
+                 jump->inst->target_name,scratch_reg,user->loc.line);
+    yyerror_at(jump->loc.file,jump->loc.line,buff);
+}
+
+void set_relax_scratch_reg(int reg){
+    scratch_reg = reg;
+}
+
+/* a full size branch or jump to a label that its offset field cannot reach */
+int target_out_of_range(mem_entry_t *entry){
+    int64_t target_address;
+    int64_t offset;
+
+    if ((entry->type != ENTRY_INSTRUCTION) || (entry->size != 4) || !entry->inst->target_name)
+        return FALSE;
+    if (!is_branch(entry->inst) && !is_jump(entry->inst))
+        return FALSE;
+    target_address = symtab_lookup(entry->inst->target_name);
+    if ((target_address < 0) || (symtab_type(entry->inst->target_name) != SYMTAB_MEM))
+        return FALSE; // let calculate_offsets() complain about it
+    offset = target_address - (int64_t)entry->address;
+    if (is_branch(entry->inst))
+        return !fits_signed(offset,13);
+    return !fits_signed(offset,21);
+}
+
+/* insert new_entry right after entry */
+static void insert_after(mem_entry_t *entry, mem_entry_t *new_entry){
+    new_entry->next = entry->next;
+    entry->next = new_entry;
+}
+
+/* 
+   bcc rs1, rs2, target  becomes  b!cc rs1, rs2, skip
+                                  j target
+                           skip :
+   the j can itself be relaxed on a later pass if the target is really far away
+*/
+static mem_entry_t *relax_branch(mem_entry_t *entry){
+    mem_entry_t *jump = new_instruction(OP_JAL);
+    mem_entry_t *join_node = new_mem_entry(ENTRY_JOIN_NODE,0);
+
+    switch(entry->inst->inst_id){
+        case RISCV_BEQ:
+            entry->inst->inst_id = RISCV_BNE;
+            entry->inst->funct3 = F3_BNE;
+            break;
+        case RISCV_BNE:
+            entry->inst->inst_id = RISCV_BEQ;
+            entry->inst->funct3 = F3_BEQ;
+            break;
+        case RISCV_BLT:
+            entry->inst->inst_id = RISCV_BGE;
+            entry->inst->funct3 = F3_BGE;
+            break;
+        case RISCV_BGE:
+            entry->inst->inst_id = RISCV_BLT;
+            entry->inst->funct3 = F3_BLT;
+            break;
+        case RISCV_BLTU:
+            entry->inst->inst_id = RISCV_BGEU;
+            entry->inst->funct3 = F3_BGEU;
+            break;
+        case RISCV_BGEU:
+            entry->inst->inst_id = RISCV_BLTU;
+            entry->inst->funct3 = F3_BLTU;
+            break;
+    }
+
+    /* the unconditional jump takes over the original target */
+    jump->inst->inst_id = RISCV_J;
+    jump->inst->rdst = 0;
+    jump->inst->target_name = entry->inst->target_name;
+
+    /* both belong to the source line of the branch */
+    jump->loc = entry->loc;
+    join_node->loc = entry->loc;
+
+    /* and the inverted branch skips over it */
+    join_node->name = internal_name();
+    symtab_new(join_node->name,SYMTAB_MEM);
+    entry->inst->target_name = strdup(join_node->name);
+
+    insert_after(entry,jump);
+    insert_after(jump,join_node);
+    relaxed_branches++;
+    return join_node;
+}
+
+/* 
+   jal rd, target  becomes  auipc rd, %hi(target)
+                            jalr rd, %lo(target)[rd]
+   j target uses $t1 (or the -relaxreg register) in place of rd, like the 
+   tail pseudo instruction
+*/
+static mem_entry_t *relax_jump(mem_entry_t *entry){
+    mem_entry_t *jump = new_instruction(OP_JALR);
+    uint32_t rd = entry->inst->rdst;
+    uint32_t base = (rd != 0) ? rd : scratch_reg;
+
+    jump->inst->inst_id = RISCV_JALR;
+    jump->inst->funct3 = F3_JALR;
+    jump->inst->rdst = rd;
+    jump->inst->rsrc1 = base;
+    jump->inst->target_name = strdup(entry->inst->target_name);
+    jump->loc = entry->loc;
+
+    entry->inst->inst_id = RISCV_AUIPC;
+    entry->inst->opcode = OP_AUIPC;
+    entry->inst->rdst = base;
+
+    insert_after(entry,jump);
+    relaxed_jumps++;
+    return jump;
+}
+
+/* 
+   lay out the mem() blocks, then rewrite anything that cannot reach its target 
+   and lay them out again, until nothing changes. compressed branches and jumps 
+   are widened to their 4 byte form first; full size ones are only rewritten when 
+   expand is set (i.e. without -norelax). entries only ever grow, so this reaches 
+   a fixed point.
+*/
+void relax_memblocks(int expand){
+    BOOL changed = TRUE;
+    memblock_list_t *list;
+
+    while (changed){
+        changed = FALSE;
+        relax_passes++;
+        for (list = block_list; list; list = list->next)
+            relayout_memblock(list);
+        for (list = block_list; list; list = list->next){
+            mem_entry_t *working;
+            BOOL scratch_checked = FALSE;
+            for (working = list->head; working; working = working->next){
+                if ((working->type == ENTRY_INSTRUCTION) && (working->size == 2) && 
+                    working->inst->target_name && !rvc_target_in_range(working)){
+                    working->size = 4;
+                    widened_rvc++;
+                    changed = TRUE;
+                }
+                else if (expand && target_out_of_range(working)){
+                    /* skip over the new entries, they do not have an address until the next pass */
+                    if (is_branch(working->inst))
+                        working = relax_branch(working);
+                    else {
+                        if ((working->inst->rdst == 0) && !scratch_checked){
+                            check_scratch(list,working);
+                            scratch_checked = TRUE;
+                        }
+                        working = relax_jump(working);
+                    }
+                    changed = TRUE;
+                }
+            }
+        }
+    }
+}
+
+/* relaxation statistics for -checking, if relaxation changed anything */
+void dump_relax_stats(){
+    if ((relaxed_branches + relaxed_jumps + widened_rvc) == 0)
+        return;
+    printf("\nRelaxation: %d pass%s, %d branch%s inverted around a jump, %d jump%s through auipc+jalr",
+           relax_passes,(relax_passes == 1) ? "" : "es",
+           relaxed_branches,(relaxed_branches == 1) ? "" : "es",
+           relaxed_jumps,(relaxed_jumps == 1) ? "" : "s");
+    if (widened_rvc)
+        printf(", %d compressed branch%s widened",widened_rvc,(widened_rvc == 1) ? "" : "es");
+    printf("\n");
+}
@@ -98,6 +98,361 @@
 #define RISCV_MUL       51
 #define RISCV_DIV       52
 
+/* rv64i */
+#define RISCV_ADDIW     53
+#define RISCV_LD        54
+#define RISCV_SD        55
+#define RISCV_LWU       56
+#define RISCV_SLLIW     57
+#define RISCV_SRLIW     58
+#define RISCV_SRAIW     59
+#define RISCV_ADDW      60
+#define RISCV_SUBW      61
+#define RISCV_SLLW      62
+#define RISCV_SRLW      63
+#define RISCV_SRAW      64
+
+/* rv32m/rv64m */
+#define RISCV_MULH      65
+#define RISCV_MULHSU    66
+#define RISCV_MULHU     67
+#define RISCV_DIVU      68
+#define RISCV_REM       69
+#define RISCV_REMU      70
+#define RISCV_MULW      71
+#define RISCV_DIVW      72
+#define RISCV_DIVUW     73
+#define RISCV_REMW      74
+#define RISCV_REMUW     75
+
+/* rv64f/rv64d */
+#define RISCV_FLW         76
+#define RISCV_FSW         77
+#define RISCV_FMADD_S     78
+#define RISCV_FMSUB_S     79
+#define RISCV_FNMSUB_S    80
+#define RISCV_FNMADD_S    81
+#define RISCV_FADD_S      82
+#define RISCV_FSUB_S      83
+#define RISCV_FMUL_S      84
+#define RISCV_FDIV_S      85
+#define RISCV_FSQRT_S     86
+#define RISCV_FSGNJ_S     87
+#define RISCV_FSGNJN_S    88
+#define RISCV_FSGNJX_S    89
+#define RISCV_FMIN_S      90
+#define RISCV_FMAX_S      91
+#define RISCV_FEQ_S       92
+#define RISCV_FLT_S       93
+#define RISCV_FLE_S       94
+#define RISCV_FCLASS_S    95
+#define RISCV_FCVT_W_S    96
+#define RISCV_FCVT_WU_S   97
+#define RISCV_FCVT_L_S    98
+#define RISCV_FCVT_LU_S   99
+#define RISCV_FCVT_S_W    100
+#define RISCV_FCVT_S_WU   101
+#define RISCV_FCVT_S_L    102
+#define RISCV_FCVT_S_LU   103
+#define RISCV_FMV_X_W     104
+#define RISCV_FMV_W_X     105
+#define RISCV_FLD         106
+#define RISCV_FSD         107
+#define RISCV_FMADD_D     108
+#define RISCV_FMSUB_D     109
+#define RISCV_FNMSUB_D    110
+#define RISCV_FNMADD_D    111
+#define RISCV_FADD_D      112
+#define RISCV_FSUB_D      113
+#define RISCV_FMUL_D      114
+#define RISCV_FDIV_D      115
+#define RISCV_FSQRT_D     116
+#define RISCV_FSGNJ_D     117
+#define RISCV_FSGNJN_D    118
+#define RISCV_FSGNJX_D    119
+#define RISCV_FMIN_D      120
+#define RISCV_FMAX_D      121
+#define RISCV_FEQ_D       122
+#define RISCV_FLT_D       123
+#define RISCV_FLE_D       124
+#define RISCV_FCLASS_D    125
+#define RISCV_FCVT_W_D    126
+#define RISCV_FCVT_WU_D   127
+#define RISCV_FCVT_L_D    128
+#define RISCV_FCVT_LU_D   129
+#define RISCV_FCVT_D_W    130
+#define RISCV_FCVT_D_WU   131
+#define RISCV_FCVT_D_L    132
+#define RISCV_FCVT_D_LU   133
+#define RISCV_FMV_X_D     134
+#define RISCV_FMV_D_X     135
+#define RISCV_FCVT_S_D    136
+#define RISCV_FCVT_D_S    137
+
+/* rvv 1.0 */
+#define RISCV_VSETVLI         138
+#define RISCV_VSETIVLI        139
+#define RISCV_VSETVL          140
+#define RISCV_VLE8_V          141
+#define RISCV_VLE8FF_V        142
+#define RISCV_VSE8_V          143
+#define RISCV_VLSE8_V         144
+#define RISCV_VSSE8_V         145
+#define RISCV_VLUXEI8_V       146
+#define RISCV_VLOXEI8_V       147
+#define RISCV_VSUXEI8_V       148
+#define RISCV_VSOXEI8_V       149
+#define RISCV_VLE16_V         150
+#define RISCV_VLE16FF_V       151
+#define RISCV_VSE16_V         152
+#define RISCV_VLSE16_V        153
+#define RISCV_VSSE16_V        154
+#define RISCV_VLUXEI16_V      155
+#define RISCV_VLOXEI16_V      156
+#define RISCV_VSUXEI16_V      157
+#define RISCV_VSOXEI16_V      158
+#define RISCV_VLE32_V         159
+#define RISCV_VLE32FF_V       160
+#define RISCV_VSE32_V         161
+#define RISCV_VLSE32_V        162
+#define RISCV_VSSE32_V        163
+#define RISCV_VLUXEI32_V      164
+#define RISCV_VLOXEI32_V      165
+#define RISCV_VSUXEI32_V      166
+#define RISCV_VSOXEI32_V      167
+#define RISCV_VLE64_V         168
+#define RISCV_VLE64FF_V       169
+#define RISCV_VSE64_V         170
+#define RISCV_VLSE64_V        171
+#define RISCV_VSSE64_V        172
+#define RISCV_VLUXEI64_V      173
+#define RISCV_VLOXEI64_V      174
+#define RISCV_VSUXEI64_V      175
+#define RISCV_VSOXEI64_V      176
+#define RISCV_VLM_V           177
+#define RISCV_VSM_V           178
+#define RISCV_VADD_VV         179
+#define RISCV_VADD_VX         180
+#define RISCV_VADD_VI         181
+#define RISCV_VSUB_VV         182
+#define RISCV_VSUB_VX         183
+#define RISCV_VRSUB_VX        184
+#define RISCV_VRSUB_VI        185
+#define RISCV_VMINU_VV        186
+#define RISCV_VMINU_VX        187
+#define RISCV_VMIN_VV         188
+#define RISCV_VMIN_VX         189
+#define RISCV_VMAXU_VV        190
+#define RISCV_VMAXU_VX        191
+#define RISCV_VMAX_VV         192
+#define RISCV_VMAX_VX         193
+#define RISCV_VAND_VV         194
+#define RISCV_VAND_VX         195
+#define RISCV_VAND_VI         196
+#define RISCV_VOR_VV          197
+#define RISCV_VOR_VX          198
+#define RISCV_VOR_VI          199
+#define RISCV_VXOR_VV         200
+#define RISCV_VXOR_VX         201
+#define RISCV_VXOR_VI         202
+#define RISCV_VRGATHER_VV     203
+#define RISCV_VRGATHER_VX     204
+#define RISCV_VRGATHER_VI     205
+#define RISCV_VSLIDEUP_VX     206
+#define RISCV_VSLIDEUP_VI     207
+#define RISCV_VSLIDEDOWN_VX   208
+#define RISCV_VSLIDEDOWN_VI   209
+#define RISCV_VMSEQ_VV        210
+#define RISCV_VMSEQ_VX        211
+#define RISCV_VMSEQ_VI        212
+#define RISCV_VMSNE_VV        213
+#define RISCV_VMSNE_VX        214
+#define RISCV_VMSNE_VI        215
+#define RISCV_VMSLTU_VV       216
+#define RISCV_VMSLTU_VX       217
+#define RISCV_VMSLT_VV        218
+#define RISCV_VMSLT_VX        219
+#define RISCV_VMSLEU_VV       220
+#define RISCV_VMSLEU_VX       221
+#define RISCV_VMSLEU_VI       222
+#define RISCV_VMSLE_VV        223
+#define RISCV_VMSLE_VX        224
+#define RISCV_VMSLE_VI        225
+#define RISCV_VMSGTU_VX       226
+#define RISCV_VMSGTU_VI       227
+#define RISCV_VMSGT_VX        228
+#define RISCV_VMSGT_VI        229
+#define RISCV_VSLL_VV         230
+#define RISCV_VSLL_VX         231
+#define RISCV_VSLL_VI         232
+#define RISCV_VSRL_VV         233
+#define RISCV_VSRL_VX         234
+#define RISCV_VSRL_VI         235
+#define RISCV_VSRA_VV         236
+#define RISCV_VSRA_VX         237
+#define RISCV_VSRA_VI         238
+#define RISCV_VNSRL_WV        239
+#define RISCV_VNSRL_WX        240
+#define RISCV_VNSRL_WI        241
+#define RISCV_VNSRA_WV        242
+#define RISCV_VNSRA_WX        243
+#define RISCV_VNSRA_WI        244
+#define RISCV_VMERGE_VVM      245
+#define RISCV_VMERGE_VXM      246
+#define RISCV_VMERGE_VIM      247
+#define RISCV_VMV_V_V         248
+#define RISCV_VMV_V_X         249
+#define RISCV_VMV_V_I         250
+#define RISCV_VDIVU_VV        251
+#define RISCV_VDIVU_VX        252
+#define RISCV_VDIV_VV         253
+#define RISCV_VDIV_VX         254
+#define RISCV_VREMU_VV        255
+#define RISCV_VREMU_VX        256
+#define RISCV_VREM_VV         257
+#define RISCV_VREM_VX         258
+#define RISCV_VMULHU_VV       259
+#define RISCV_VMULHU_VX       260
+#define RISCV_VMUL_VV         261
+#define RISCV_VMUL_VX         262
+#define RISCV_VMULHSU_VV      263
+#define RISCV_VMULHSU_VX      264
+#define RISCV_VMULH_VV        265
+#define RISCV_VMULH_VX        266
+#define RISCV_VWADDU_VV       267
+#define RISCV_VWADDU_VX       268
+#define RISCV_VWADD_VV        269
+#define RISCV_VWADD_VX        270
+#define RISCV_VWSUBU_VV       271
+#define RISCV_VWSUBU_VX       272
+#define RISCV_VWSUB_VV        273
+#define RISCV_VWSUB_VX        274
+#define RISCV_VWMULU_VV       275
+#define RISCV_VWMULU_VX       276
+#define RISCV_VWMULSU_VV      277
+#define RISCV_VWMULSU_VX      278
+#define RISCV_VWMUL_VV        279
+#define RISCV_VWMUL_VX        280
+#define RISCV_VMADD_VV        281
+#define RISCV_VMADD_VX        282
+#define RISCV_VNMSUB_VV       283
+#define RISCV_VNMSUB_VX       284
+#define RISCV_VMACC_VV        285
+#define RISCV_VMACC_VX        286
+#define RISCV_VNMSAC_VV       287
+#define RISCV_VNMSAC_VX       288
+#define RISCV_VWMACCU_VV      289
+#define RISCV_VWMACCU_VX      290
+#define RISCV_VWMACC_VV       291
+#define RISCV_VWMACC_VX       292
+#define RISCV_VREDSUM_VS      293
+#define RISCV_VREDAND_VS      294
+#define RISCV_VREDOR_VS       295
+#define RISCV_VREDXOR_VS      296
+#define RISCV_VREDMINU_VS     297
+#define RISCV_VREDMIN_VS      298
+#define RISCV_VREDMAXU_VS     299
+#define RISCV_VREDMAX_VS      300
+#define RISCV_VSLIDE1UP_VX    301
+#define RISCV_VSLIDE1DOWN_VX  302
+#define RISCV_VMV_X_S         303
+#define RISCV_VMV_S_X         304
+#define RISCV_VCPOP_M         305
+#define RISCV_VFIRST_M        306
+#define RISCV_VIOTA_M         307
+#define RISCV_VID_V           308
+#define RISCV_VMANDN_MM       309
+#define RISCV_VMAND_MM        310
+#define RISCV_VMOR_MM         311
+#define RISCV_VMXOR_MM        312
+#define RISCV_VMORN_MM        313
+#define RISCV_VMNAND_MM       314
+#define RISCV_VMNOR_MM        315
+#define RISCV_VMXNOR_MM       316
+#define RISCV_VFADD_VV        317
+#define RISCV_VFADD_VF        318
+#define RISCV_VFSUB_VV        319
+#define RISCV_VFSUB_VF        320
+#define RISCV_VFRSUB_VF       321
+#define RISCV_VFMIN_VV        322
+#define RISCV_VFMIN_VF        323
+#define RISCV_VFMAX_VV        324
+#define RISCV_VFMAX_VF        325
+#define RISCV_VFSGNJ_VV       326
+#define RISCV_VFSGNJ_VF       327
+#define RISCV_VFSGNJN_VV      328
+#define RISCV_VFSGNJN_VF      329
+#define RISCV_VFSGNJX_VV      330
+#define RISCV_VFSGNJX_VF      331
+#define RISCV_VFDIV_VV        332
+#define RISCV_VFDIV_VF        333
+#define RISCV_VFRDIV_VF       334
+#define RISCV_VFMUL_VV        335
+#define RISCV_VFMUL_VF        336
+#define RISCV_VMFEQ_VV        337
+#define RISCV_VMFEQ_VF        338
+#define RISCV_VMFLE_VV        339
+#define RISCV_VMFLE_VF        340
+#define RISCV_VMFLT_VV        341
+#define RISCV_VMFLT_VF        342
+#define RISCV_VMFNE_VV        343
+#define RISCV_VMFNE_VF        344
+#define RISCV_VMFGT_VF        345
+#define RISCV_VMFGE_VF        346
+#define RISCV_VFMADD_VV       347
+#define RISCV_VFMADD_VF       348
+#define RISCV_VFNMADD_VV      349
+#define RISCV_VFNMADD_VF      350
+#define RISCV_VFMSUB_VV       351
+#define RISCV_VFMSUB_VF       352
+#define RISCV_VFNMSUB_VV      353
+#define RISCV_VFNMSUB_VF      354
+#define RISCV_VFMACC_VV       355
+#define RISCV_VFMACC_VF       356
+#define RISCV_VFNMACC_VV      357
+#define RISCV_VFNMACC_VF      358
+#define RISCV_VFMSAC_VV       359
+#define RISCV_VFMSAC_VF       360
+#define RISCV_VFNMSAC_VV      361
+#define RISCV_VFNMSAC_VF      362
+#define RISCV_VFREDUSUM_VS    363
+#define RISCV_VFREDOSUM_VS    364
+#define RISCV_VFREDMIN_VS     365
+#define RISCV_VFREDMAX_VS     366
+#define RISCV_VFSQRT_V        367
+#define RISCV_VFCVT_XU_F_V    368
+#define RISCV_VFCVT_X_F_V     369
+#define RISCV_VFCVT_F_XU_V    370
+#define RISCV_VFCVT_F_X_V     371
+#define RISCV_VFCVT_RTZ_XU_F_V 372
+#define RISCV_VFCVT_RTZ_X_F_V 373
+#define RISCV_VFMV_F_S        374
+#define RISCV_VFMV_S_F        375
+#define RISCV_VFMV_V_F        376
+#define RISCV_VFMERGE_VFM     377
+#define RISCV_AMOADD_W        378
+#define RISCV_LR_W            379
+#define RISCV_SC_W            380
+#define RISCV_AMOSWAP_W       381
+#define RISCV_AMOXOR_W        382
+#define RISCV_AMOAND_W        383
+#define RISCV_AMOOR_W         384
+#define RISCV_AMOMIN_W        385
+#define RISCV_AMOMAX_W        386
+#define RISCV_AMOMINU_W       387
+#define RISCV_AMOMAXU_W       388
+#define RISCV_LR_D            389
+#define RISCV_SC_D            390
+#define RISCV_AMOSWAP_D       391
+#define RISCV_AMOADD_D        392
+#define RISCV_AMOXOR_D        393
+#define RISCV_AMOAND_D        394
+#define RISCV_AMOOR_D         395
+#define RISCV_AMOMIN_D        396
+#define RISCV_AMOMAX_D        397
+#define RISCV_AMOMINU_D       398
+#define RISCV_AMOMAXU_D       399
+
 /* opcode */
 #define OP_LUI          0x37
 #define OP_AUIPC        0x17
@@ -140,6 +495,361 @@
 #define OP_EBREAK       0x73
 #define OP_MUL          0x33
 #define OP_DIV          0x33
+#define OP_ADDIW        0x1b
+#define OP_LD           0x3
+#define OP_SD           0x23
+#define OP_LWU          0x3
+#define OP_SLLIW        0x1b
+#define OP_SRLIW        0x1b
+#define OP_SRAIW        0x1b
+#define OP_ADDW         0x3b
+#define OP_SUBW         0x3b
+#define OP_SLLW         0x3b
+#define OP_SRLW         0x3b
+#define OP_SRAW         0x3b
+#define OP_MULH         0x33
+#define OP_MULHSU       0x33
+#define OP_MULHU        0x33
+#define OP_DIVU         0x33
+#define OP_REM          0x33
+#define OP_REMU         0x33
+#define OP_MULW         0x3b
+#define OP_DIVW         0x3b
+#define OP_DIVUW        0x3b
+#define OP_REMW         0x3b
+#define OP_REMUW        0x3b
+#define OP_FLW          0x07
+#define OP_FSW          0x27
+#define OP_FMADD_S      0x43
+#define OP_FMSUB_S      0x47
+#define OP_FNMSUB_S     0x4b
+#define OP_FNMADD_S     0x4f
+#define OP_FADD_S       0x53
+#define OP_FSUB_S       0x53
+#define OP_FMUL_S       0x53
+#define OP_FDIV_S       0x53
+#define OP_FSQRT_S      0x53
+#define OP_FSGNJ_S      0x53
+#define OP_FSGNJN_S     0x53
+#define OP_FSGNJX_S     0x53
+#define OP_FMIN_S       0x53
+#define OP_FMAX_S       0x53
+#define OP_FEQ_S        0x53
+#define OP_FLT_S        0x53
+#define OP_FLE_S        0x53
+#define OP_FCLASS_S     0x53
+#define OP_FCVT_W_S     0x53
+#define OP_FCVT_WU_S    0x53
+#define OP_FCVT_L_S     0x53
+#define OP_FCVT_LU_S    0x53
+#define OP_FCVT_S_W     0x53
+#define OP_FCVT_S_WU    0x53
+#define OP_FCVT_S_L     0x53
+#define OP_FCVT_S_LU    0x53
+#define OP_FMV_X_W      0x53
+#define OP_FMV_W_X      0x53
+#define OP_FLD          0x07
+#define OP_FSD          0x27
+#define OP_FMADD_D      0x43
+#define OP_FMSUB_D      0x47
+#define OP_FNMSUB_D     0x4b
+#define OP_FNMADD_D     0x4f
+#define OP_FADD_D       0x53
+#define OP_FSUB_D       0x53
+#define OP_FMUL_D       0x53
+#define OP_FDIV_D       0x53
+#define OP_FSQRT_D      0x53
+#define OP_FSGNJ_D      0x53
+#define OP_FSGNJN_D     0x53
+#define OP_FSGNJX_D     0x53
+#define OP_FMIN_D       0x53
+#define OP_FMAX_D       0x53
+#define OP_FEQ_D        0x53
+#define OP_FLT_D        0x53
+#define OP_FLE_D        0x53
+#define OP_FCLASS_D     0x53
+#define OP_FCVT_W_D     0x53
+#define OP_FCVT_WU_D    0x53
+#define OP_FCVT_L_D     0x53
+#define OP_FCVT_LU_D    0x53
+#define OP_FCVT_D_W     0x53
+#define OP_FCVT_D_WU    0x53
+#define OP_FCVT_D_L     0x53
+#define OP_FCVT_D_LU    0x53
+#define OP_FMV_X_D      0x53
+#define OP_FMV_D_X      0x53
+#define OP_FCVT_S_D     0x53
+#define OP_FCVT_D_S     0x53
+#define OP_CSRRW        0x73
+#define OP_CSRRS        0x73
+#define OP_CSRRC        0x73
+#define OP_CSRRWI       0x73
+#define OP_CSRRSI       0x73
+#define OP_CSRRCI       0x73
+#define OP_FENCE        0x0f
+#define OP_FENCE_I      0x0f
+#define OP_VSETVLI          0x57
+#define OP_VSETIVLI         0x57
+#define OP_VSETVL           0x57
+#define OP_VLE8_V           0x07
+#define OP_VLE8FF_V         0x07
+#define OP_VSE8_V           0x27
+#define OP_VLSE8_V          0x07
+#define OP_VSSE8_V          0x27
+#define OP_VLUXEI8_V        0x07
+#define OP_VLOXEI8_V        0x07
+#define OP_VSUXEI8_V        0x27
+#define OP_VSOXEI8_V        0x27
+#define OP_VLE16_V          0x07
+#define OP_VLE16FF_V        0x07
+#define OP_VSE16_V          0x27
+#define OP_VLSE16_V         0x07
+#define OP_VSSE16_V         0x27
+#define OP_VLUXEI16_V       0x07
+#define OP_VLOXEI16_V       0x07
+#define OP_VSUXEI16_V       0x27
+#define OP_VSOXEI16_V       0x27
+#define OP_VLE32_V          0x07
+#define OP_VLE32FF_V        0x07
+#define OP_VSE32_V          0x27
+#define OP_VLSE32_V         0x07
+#define OP_VSSE32_V         0x27
+#define OP_VLUXEI32_V       0x07
+#define OP_VLOXEI32_V       0x07
+#define OP_VSUXEI32_V       0x27
+#define OP_VSOXEI32_V       0x27
+#define OP_VLE64_V          0x07
+#define OP_VLE64FF_V        0x07
+#define OP_VSE64_V          0x27
+#define OP_VLSE64_V         0x07
+#define OP_VSSE64_V         0x27
+#define OP_VLUXEI64_V       0x07
+#define OP_VLOXEI64_V       0x07
+#define OP_VSUXEI64_V       0x27
+#define OP_VSOXEI64_V       0x27
+#define OP_VLM_V            0x07
+#define OP_VSM_V            0x27
+#define OP_VADD_VV          0x57
+#define OP_VADD_VX          0x57
+#define OP_VADD_VI          0x57
+#define OP_VSUB_VV          0x57
+#define OP_VSUB_VX          0x57
+#define OP_VRSUB_VX         0x57
+#define OP_VRSUB_VI         0x57
+#define OP_VMINU_VV         0x57
+#define OP_VMINU_VX         0x57
+#define OP_VMIN_VV          0x57
+#define OP_VMIN_VX          0x57
+#define OP_VMAXU_VV         0x57
+#define OP_VMAXU_VX         0x57
+#define OP_VMAX_VV          0x57
+#define OP_VMAX_VX          0x57
+#define OP_VAND_VV          0x57
+#define OP_VAND_VX          0x57
+#define OP_VAND_VI          0x57
+#define OP_VOR_VV           0x57
+#define OP_VOR_VX           0x57
+#define OP_VOR_VI           0x57
+#define OP_VXOR_VV          0x57
+#define OP_VXOR_VX          0x57
+#define OP_VXOR_VI          0x57
+#define OP_VRGATHER_VV      0x57
+#define OP_VRGATHER_VX      0x57
+#define OP_VRGATHER_VI      0x57
+#define OP_VSLIDEUP_VX      0x57
+#define OP_VSLIDEUP_VI      0x57
+#define OP_VSLIDEDOWN_VX    0x57
+#define OP_VSLIDEDOWN_VI    0x57
+#define OP_VMSEQ_VV         0x57
+#define OP_VMSEQ_VX         0x57
+#define OP_VMSEQ_VI         0x57
+#define OP_VMSNE_VV         0x57
+#define OP_VMSNE_VX         0x57
+#define OP_VMSNE_VI         0x57
+#define OP_VMSLTU_VV        0x57
+#define OP_VMSLTU_VX        0x57
+#define OP_VMSLT_VV         0x57
+#define OP_VMSLT_VX         0x57
+#define OP_VMSLEU_VV        0x57
+#define OP_VMSLEU_VX        0x57
+#define OP_VMSLEU_VI        0x57
+#define OP_VMSLE_VV         0x57
+#define OP_VMSLE_VX         0x57
+#define OP_VMSLE_VI         0x57
+#define OP_VMSGTU_VX        0x57
+#define OP_VMSGTU_VI        0x57
+#define OP_VMSGT_VX         0x57
+#define OP_VMSGT_VI         0x57
+#define OP_VSLL_VV          0x57
+#define OP_VSLL_VX          0x57
+#define OP_VSLL_VI          0x57
+#define OP_VSRL_VV          0x57
+#define OP_VSRL_VX          0x57
+#define OP_VSRL_VI          0x57
+#define OP_VSRA_VV          0x57
+#define OP_VSRA_VX          0x57
+#define OP_VSRA_VI          0x57
+#define OP_VNSRL_WV         0x57
+#define OP_VNSRL_WX         0x57
+#define OP_VNSRL_WI         0x57
+#define OP_VNSRA_WV         0x57
+#define OP_VNSRA_WX         0x57
+#define OP_VNSRA_WI         0x57
+#define OP_VMERGE_VVM       0x57
+#define OP_VMERGE_VXM       0x57
+#define OP_VMERGE_VIM       0x57
+#define OP_VMV_V_V          0x57
+#define OP_VMV_V_X          0x57
+#define OP_VMV_V_I          0x57
+#define OP_VDIVU_VV         0x57
+#define OP_VDIVU_VX         0x57
+#define OP_VDIV_VV          0x57
+#define OP_VDIV_VX          0x57
+#define OP_VREMU_VV         0x57
+#define OP_VREMU_VX         0x57
+#define OP_VREM_VV          0x57
+#define OP_VREM_VX          0x57
+#define OP_VMULHU_VV        0x57
+#define OP_VMULHU_VX        0x57
+#define OP_VMUL_VV          0x57
+#define OP_VMUL_VX          0x57
+#define OP_VMULHSU_VV       0x57
+#define OP_VMULHSU_VX       0x57
+#define OP_VMULH_VV         0x57
+#define OP_VMULH_VX         0x57
+#define OP_VWADDU_VV        0x57
+#define OP_VWADDU_VX        0x57
+#define OP_VWADD_VV         0x57
+#define OP_VWADD_VX         0x57
+#define OP_VWSUBU_VV        0x57
+#define OP_VWSUBU_VX        0x57
+#define OP_VWSUB_VV         0x57
+#define OP_VWSUB_VX         0x57
+#define OP_VWMULU_VV        0x57
+#define OP_VWMULU_VX        0x57
+#define OP_VWMULSU_VV       0x57
+#define OP_VWMULSU_VX       0x57
+#define OP_VWMUL_VV         0x57
+#define OP_VWMUL_VX         0x57
+#define OP_VMADD_VV         0x57
+#define OP_VMADD_VX         0x57
+#define OP_VNMSUB_VV        0x57
+#define OP_VNMSUB_VX        0x57
+#define OP_VMACC_VV         0x57
+#define OP_VMACC_VX         0x57
+#define OP_VNMSAC_VV        0x57
+#define OP_VNMSAC_VX        0x57
+#define OP_VWMACCU_VV       0x57
+#define OP_VWMACCU_VX       0x57
+#define OP_VWMACC_VV        0x57
+#define OP_VWMACC_VX        0x57
+#define OP_VREDSUM_VS       0x57
+#define OP_VREDAND_VS       0x57
+#define OP_VREDOR_VS        0x57
+#define OP_VREDXOR_VS       0x57
+#define OP_VREDMINU_VS      0x57
+#define OP_VREDMIN_VS       0x57
+#define OP_VREDMAXU_VS      0x57
+#define OP_VREDMAX_VS       0x57
+#define OP_VSLIDE1UP_VX     0x57
+#define OP_VSLIDE1DOWN_VX   0x57
+#define OP_VMV_X_S          0x57
+#define OP_VMV_S_X          0x57
+#define OP_VCPOP_M          0x57
+#define OP_VFIRST_M         0x57
+#define OP_VIOTA_M          0x57
+#define OP_VID_V            0x57
+#define OP_VMANDN_MM        0x57
+#define OP_VMAND_MM         0x57
+#define OP_VMOR_MM          0x57
+#define OP_VMXOR_MM         0x57
+#define OP_VMORN_MM         0x57
+#define OP_VMNAND_MM        0x57
+#define OP_VMNOR_MM         0x57
+#define OP_VMXNOR_MM        0x57
+#define OP_VFADD_VV         0x57
+#define OP_VFADD_VF         0x57
+#define OP_VFSUB_VV         0x57
+#define OP_VFSUB_VF         0x57
+#define OP_VFRSUB_VF        0x57
+#define OP_VFMIN_VV         0x57
+#define OP_VFMIN_VF         0x57
+#define OP_VFMAX_VV         0x57
+#define OP_VFMAX_VF         0x57
+#define OP_VFSGNJ_VV        0x57
+#define OP_VFSGNJ_VF        0x57
+#define OP_VFSGNJN_VV       0x57
+#define OP_VFSGNJN_VF       0x57
+#define OP_VFSGNJX_VV       0x57
+#define OP_VFSGNJX_VF       0x57
+#define OP_VFDIV_VV         0x57
+#define OP_VFDIV_VF         0x57
+#define OP_VFRDIV_VF        0x57
+#define OP_VFMUL_VV         0x57
+#define OP_VFMUL_VF         0x57
+#define OP_VMFEQ_VV         0x57
+#define OP_VMFEQ_VF         0x57
+#define OP_VMFLE_VV         0x57
+#define OP_VMFLE_VF         0x57
+#define OP_VMFLT_VV         0x57
+#define OP_VMFLT_VF         0x57
+#define OP_VMFNE_VV         0x57
+#define OP_VMFNE_VF         0x57
+#define OP_VMFGT_VF         0x57
+#define OP_VMFGE_VF         0x57
+#define OP_VFMADD_VV        0x57
+#define OP_VFMADD_VF        0x57
+#define OP_VFNMADD_VV       0x57
+#define OP_VFNMADD_VF       0x57
+#define OP_VFMSUB_VV        0x57
+#define OP_VFMSUB_VF        0x57
+#define OP_VFNMSUB_VV       0x57
+#define OP_VFNMSUB_VF       0x57
+#define OP_VFMACC_VV        0x57
+#define OP_VFMACC_VF        0x57
+#define OP_VFNMACC_VV       0x57
+#define OP_VFNMACC_VF       0x57
+#define OP_VFMSAC_VV        0x57
+#define OP_VFMSAC_VF        0x57
+#define OP_VFNMSAC_VV       0x57
+#define OP_VFNMSAC_VF       0x57
+#define OP_VFREDUSUM_VS     0x57
+#define OP_VFREDOSUM_VS     0x57
+#define OP_VFREDMIN_VS      0x57
+#define OP_VFREDMAX_VS      0x57
+#define OP_VFSQRT_V         0x57
+#define OP_VFCVT_XU_F_V     0x57
+#define OP_VFCVT_X_F_V      0x57
+#define OP_VFCVT_F_XU_V     0x57
+#define OP_VFCVT_F_X_V      0x57
+#define OP_VFCVT_RTZ_XU_F_V 0x57
+#define OP_VFCVT_RTZ_X_F_V  0x57
+#define OP_VFMV_F_S         0x57
+#define OP_VFMV_S_F         0x57
+#define OP_VFMV_V_F         0x57
+#define OP_VFMERGE_VFM      0x57
+#define OP_AMOADD_W         0x2f
+#define OP_LR_W             0x2f
+#define OP_SC_W             0x2f
+#define OP_AMOSWAP_W        0x2f
+#define OP_AMOXOR_W         0x2f
+#define OP_AMOAND_W         0x2f
+#define OP_AMOOR_W          0x2f
+#define OP_AMOMIN_W         0x2f
+#define OP_AMOMAX_W         0x2f
+#define OP_AMOMINU_W        0x2f
+#define OP_AMOMAXU_W        0x2f
+#define OP_LR_D             0x2f
+#define OP_SC_D             0x2f
+#define OP_AMOSWAP_D        0x2f
+#define OP_AMOADD_D         0x2f
+#define OP_AMOXOR_D         0x2f
+#define OP_AMOAND_D         0x2f
+#define OP_AMOOR_D          0x2f
+#define OP_AMOMIN_D         0x2f
+#define OP_AMOMAX_D         0x2f
+#define OP_AMOMINU_D        0x2f
+#define OP_AMOMAXU_D        0x2f
 
 
 /* funct3 defines */
@@ -181,6 +891,328 @@
 #define F3_EBREAK       0x0
 #define F3_MUL          0x0
 #define F3_DIV          0x4
+#define F3_ADDIW        0x0
+#define F3_LD           0x3
+#define F3_SD           0x3
+#define F3_LWU          0x6
+#define F3_SLLIW        0x1
+#define F3_SRLIW        0x5
+#define F3_SRAIW        0x5
+#define F3_ADDW         0x0
+#define F3_SUBW         0x0
+#define F3_SLLW         0x1
+#define F3_SRLW         0x5
+#define F3_SRAW         0x5
+#define F3_MULH         0x1
+#define F3_MULHSU       0x2
+#define F3_MULHU        0x3
+#define F3_DIVU         0x5
+#define F3_REM          0x6
+#define F3_REMU         0x7
+#define F3_MULW         0x0
+#define F3_DIVW         0x4
+#define F3_DIVUW        0x5
+#define F3_REMW         0x6
+#define F3_REMUW        0x7
+#define F3_FLW          0x2
+#define F3_FSW          0x2
+#define F3_FSGNJ_S      0x0
+#define F3_FSGNJN_S     0x1
+#define F3_FSGNJX_S     0x2
+#define F3_FMIN_S       0x0
+#define F3_FMAX_S       0x1
+#define F3_FEQ_S        0x2
+#define F3_FLT_S        0x1
+#define F3_FLE_S        0x0
+#define F3_FCLASS_S     0x1
+#define F3_FMV_X_W      0x0
+#define F3_FMV_W_X      0x0
+#define F3_FLD          0x3
+#define F3_FSD          0x3
+#define F3_FSGNJ_D      0x0
+#define F3_FSGNJN_D     0x1
+#define F3_FSGNJX_D     0x2
+#define F3_FMIN_D       0x0
+#define F3_FMAX_D       0x1
+#define F3_FEQ_D        0x2
+#define F3_FLT_D        0x1
+#define F3_FLE_D        0x0
+#define F3_FCLASS_D     0x1
+#define F3_FCVT_D_W     0x0
+#define F3_FCVT_D_WU    0x0
+#define F3_FMV_X_D      0x0
+#define F3_FMV_D_X      0x0
+#define F3_FCVT_D_S     0x0
+#define F3_CSRRW         0x1
+#define F3_CSRRS         0x2
+#define F3_CSRRC         0x3
+#define F3_CSRRWI        0x5
+#define F3_CSRRSI        0x6
+#define F3_CSRRCI        0x7
+#define F3_FENCE         0x0
+#define F3_FENCE_I       0x1
+#define F3_VSETVLI          0x7
+#define F3_VSETIVLI         0x7
+#define F3_VSETVL           0x7
+#define F3_VLE8_V           0x0
+#define F3_VLE8FF_V         0x0
+#define F3_VSE8_V           0x0
+#define F3_VLSE8_V          0x0
+#define F3_VSSE8_V          0x0
+#define F3_VLUXEI8_V        0x0
+#define F3_VLOXEI8_V        0x0
+#define F3_VSUXEI8_V        0x0
+#define F3_VSOXEI8_V        0x0
+#define F3_VLE16_V          0x5
+#define F3_VLE16FF_V        0x5
+#define F3_VSE16_V          0x5
+#define F3_VLSE16_V         0x5
+#define F3_VSSE16_V         0x5
+#define F3_VLUXEI16_V       0x5
+#define F3_VLOXEI16_V       0x5
+#define F3_VSUXEI16_V       0x5
+#define F3_VSOXEI16_V       0x5
+#define F3_VLE32_V          0x6
+#define F3_VLE32FF_V        0x6
+#define F3_VSE32_V          0x6
+#define F3_VLSE32_V         0x6
+#define F3_VSSE32_V         0x6
+#define F3_VLUXEI32_V       0x6
+#define F3_VLOXEI32_V       0x6
+#define F3_VSUXEI32_V       0x6
+#define F3_VSOXEI32_V       0x6
+#define F3_VLE64_V          0x7
+#define F3_VLE64FF_V        0x7
+#define F3_VSE64_V          0x7
+#define F3_VLSE64_V         0x7
+#define F3_VSSE64_V         0x7
+#define F3_VLUXEI64_V       0x7
+#define F3_VLOXEI64_V       0x7
+#define F3_VSUXEI64_V       0x7
+#define F3_VSOXEI64_V       0x7
+#define F3_VLM_V            0x0
+#define F3_VSM_V            0x0
+#define F3_VADD_VV          0x0
+#define F3_VADD_VX          0x4
+#define F3_VADD_VI          0x3
+#define F3_VSUB_VV          0x0
+#define F3_VSUB_VX          0x4
+#define F3_VRSUB_VX         0x4
+#define F3_VRSUB_VI         0x3
+#define F3_VMINU_VV         0x0
+#define F3_VMINU_VX         0x4
+#define F3_VMIN_VV          0x0
+#define F3_VMIN_VX          0x4
+#define F3_VMAXU_VV         0x0
+#define F3_VMAXU_VX         0x4
+#define F3_VMAX_VV          0x0
+#define F3_VMAX_VX          0x4
+#define F3_VAND_VV          0x0
+#define F3_VAND_VX          0x4
+#define F3_VAND_VI          0x3
+#define F3_VOR_VV           0x0
+#define F3_VOR_VX           0x4
+#define F3_VOR_VI           0x3
+#define F3_VXOR_VV          0x0
+#define F3_VXOR_VX          0x4
+#define F3_VXOR_VI          0x3
+#define F3_VRGATHER_VV      0x0
+#define F3_VRGATHER_VX      0x4
+#define F3_VRGATHER_VI      0x3
+#define F3_VSLIDEUP_VX      0x4
+#define F3_VSLIDEUP_VI      0x3
+#define F3_VSLIDEDOWN_VX    0x4
+#define F3_VSLIDEDOWN_VI    0x3
+#define F3_VMSEQ_VV         0x0
+#define F3_VMSEQ_VX         0x4
+#define F3_VMSEQ_VI         0x3
+#define F3_VMSNE_VV         0x0
+#define F3_VMSNE_VX         0x4
+#define F3_VMSNE_VI         0x3
+#define F3_VMSLTU_VV        0x0
+#define F3_VMSLTU_VX        0x4
+#define F3_VMSLT_VV         0x0
+#define F3_VMSLT_VX         0x4
+#define F3_VMSLEU_VV        0x0
+#define F3_VMSLEU_VX        0x4
+#define F3_VMSLEU_VI        0x3
+#define F3_VMSLE_VV         0x0
+#define F3_VMSLE_VX         0x4
+#define F3_VMSLE_VI         0x3
+#define F3_VMSGTU_VX        0x4
+#define F3_VMSGTU_VI        0x3
+#define F3_VMSGT_VX         0x4
+#define F3_VMSGT_VI         0x3
+#define F3_VSLL_VV          0x0
+#define F3_VSLL_VX          0x4
+#define F3_VSLL_VI          0x3
+#define F3_VSRL_VV          0x0
+#define F3_VSRL_VX          0x4
+#define F3_VSRL_VI          0x3
+#define F3_VSRA_VV          0x0
+#define F3_VSRA_VX          0x4
+#define F3_VSRA_VI          0x3
+#define F3_VNSRL_WV         0x0
+#define F3_VNSRL_WX         0x4
+#define F3_VNSRL_WI         0x3
+#define F3_VNSRA_WV         0x0
+#define F3_VNSRA_WX         0x4
+#define F3_VNSRA_WI         0x3
+#define F3_VMERGE_VVM       0x0
+#define F3_VMERGE_VXM       0x4
+#define F3_VMERGE_VIM       0x3
+#define F3_VMV_V_V          0x0
+#define F3_VMV_V_X          0x4
+#define F3_VMV_V_I          0x3
+#define F3_VDIVU_VV         0x2
+#define F3_VDIVU_VX         0x6
+#define F3_VDIV_VV          0x2
+#define F3_VDIV_VX          0x6
+#define F3_VREMU_VV         0x2
+#define F3_VREMU_VX         0x6
+#define F3_VREM_VV          0x2
+#define F3_VREM_VX          0x6
+#define F3_VMULHU_VV        0x2
+#define F3_VMULHU_VX        0x6
+#define F3_VMUL_VV          0x2
+#define F3_VMUL_VX          0x6
+#define F3_VMULHSU_VV       0x2
+#define F3_VMULHSU_VX       0x6
+#define F3_VMULH_VV         0x2
+#define F3_VMULH_VX         0x6
+#define F3_VWADDU_VV        0x2
+#define F3_VWADDU_VX        0x6
+#define F3_VWADD_VV         0x2
+#define F3_VWADD_VX         0x6
+#define F3_VWSUBU_VV        0x2
+#define F3_VWSUBU_VX        0x6
+#define F3_VWSUB_VV         0x2
+#define F3_VWSUB_VX         0x6
+#define F3_VWMULU_VV        0x2
+#define F3_VWMULU_VX        0x6
+#define F3_VWMULSU_VV       0x2
+#define F3_VWMULSU_VX       0x6
+#define F3_VWMUL_VV         0x2
+#define F3_VWMUL_VX         0x6
+#define F3_VMADD_VV         0x2
+#define F3_VMADD_VX         0x6
+#define F3_VNMSUB_VV        0x2
+#define F3_VNMSUB_VX        0x6
+#define F3_VMACC_VV         0x2
+#define F3_VMACC_VX         0x6
+#define F3_VNMSAC_VV        0x2
+#define F3_VNMSAC_VX        0x6
+#define F3_VWMACCU_VV       0x2
+#define F3_VWMACCU_VX       0x6
+#define F3_VWMACC_VV        0x2
+#define F3_VWMACC_VX        0x6
+#define F3_VREDSUM_VS       0x2
+#define F3_VREDAND_VS       0x2
+#define F3_VREDOR_VS        0x2
+#define F3_VREDXOR_VS       0x2
+#define F3_VREDMINU_VS      0x2
+#define F3_VREDMIN_VS       0x2
+#define F3_VREDMAXU_VS      0x2
+#define F3_VREDMAX_VS       0x2
+#define F3_VSLIDE1UP_VX     0x6
+#define F3_VSLIDE1DOWN_VX   0x6
+#define F3_VMV_X_S          0x2
+#define F3_VMV_S_X          0x6
+#define F3_VCPOP_M          0x2
+#define F3_VFIRST_M         0x2
+#define F3_VIOTA_M          0x2
+#define F3_VID_V            0x2
+#define F3_VMANDN_MM        0x2
+#define F3_VMAND_MM         0x2
+#define F3_VMOR_MM          0x2
+#define F3_VMXOR_MM         0x2
+#define F3_VMORN_MM         0x2
+#define F3_VMNAND_MM        0x2
+#define F3_VMNOR_MM         0x2
+#define F3_VMXNOR_MM        0x2
+#define F3_VFADD_VV         0x1
+#define F3_VFADD_VF         0x5
+#define F3_VFSUB_VV         0x1
+#define F3_VFSUB_VF         0x5
+#define F3_VFRSUB_VF        0x5
+#define F3_VFMIN_VV         0x1
+#define F3_VFMIN_VF         0x5
+#define F3_VFMAX_VV         0x1
+#define F3_VFMAX_VF         0x5
+#define F3_VFSGNJ_VV        0x1
+#define F3_VFSGNJ_VF        0x5
+#define F3_VFSGNJN_VV       0x1
+#define F3_VFSGNJN_VF       0x5
+#define F3_VFSGNJX_VV       0x1
+#define F3_VFSGNJX_VF       0x5
+#define F3_VFDIV_VV         0x1
+#define F3_VFDIV_VF         0x5
+#define F3_VFRDIV_VF        0x5
+#define F3_VFMUL_VV         0x1
+#define F3_VFMUL_VF         0x5
+#define F3_VMFEQ_VV         0x1
+#define F3_VMFEQ_VF         0x5
+#define F3_VMFLE_VV         0x1
+#define F3_VMFLE_VF         0x5
+#define F3_VMFLT_VV         0x1
+#define F3_VMFLT_VF         0x5
+#define F3_VMFNE_VV         0x1
+#define F3_VMFNE_VF         0x5
+#define F3_VMFGT_VF         0x5
+#define F3_VMFGE_VF         0x5
+#define F3_VFMADD_VV        0x1
+#define F3_VFMADD_VF        0x5
+#define F3_VFNMADD_VV       0x1
+#define F3_VFNMADD_VF       0x5
+#define F3_VFMSUB_VV        0x1
+#define F3_VFMSUB_VF        0x5
+#define F3_VFNMSUB_VV       0x1
+#define F3_VFNMSUB_VF       0x5
+#define F3_VFMACC_VV        0x1
+#define F3_VFMACC_VF        0x5
+#define F3_VFNMACC_VV       0x1
+#define F3_VFNMACC_VF       0x5
+#define F3_VFMSAC_VV        0x1
+#define F3_VFMSAC_VF        0x5
+#define F3_VFNMSAC_VV       0x1
+#define F3_VFNMSAC_VF       0x5
+#define F3_VFREDUSUM_VS     0x1
+#define F3_VFREDOSUM_VS     0x1
+#define F3_VFREDMIN_VS      0x1
+#define F3_VFREDMAX_VS      0x1
+#define F3_VFSQRT_V         0x1
+#define F3_VFCVT_XU_F_V     0x1
+#define F3_VFCVT_X_F_V      0x1
+#define F3_VFCVT_F_XU_V     0x1
+#define F3_VFCVT_F_X_V      0x1
+#define F3_VFCVT_RTZ_XU_F_V 0x1
+#define F3_VFCVT_RTZ_X_F_V  0x1
+#define F3_VFMV_F_S         0x1
+#define F3_VFMV_S_F         0x5
+#define F3_VFMV_V_F         0x5
+#define F3_VFMERGE_VFM      0x5
+#define F3_AMOADD_W         0x2
+#define F3_LR_W             0x2
+#define F3_SC_W             0x2
+#define F3_AMOSWAP_W        0x2
+#define F3_AMOXOR_W         0x2
+#define F3_AMOAND_W         0x2
+#define F3_AMOOR_W          0x2
+#define F3_AMOMIN_W         0x2
+#define F3_AMOMAX_W         0x2
+#define F3_AMOMINU_W        0x2
+#define F3_AMOMAXU_W        0x2
+#define F3_LR_D             0x3
+#define F3_SC_D             0x3
+#define F3_AMOSWAP_D        0x3
+#define F3_AMOADD_D         0x3
+#define F3_AMOXOR_D         0x3
+#define F3_AMOAND_D         0x3
+#define F3_AMOOR_D          0x3
+#define F3_AMOMIN_D         0x3
+#define F3_AMOMAX_D         0x3
+#define F3_AMOMINU_D        0x3
+#define F3_AMOMAXU_D        0x3
 
 /* funct7 defines */
 #define F7_ANDI         0x0
@@ -199,5 +1231,493 @@
 #define F7_AND          0x0
 #define F7_MUL          0x1
 #define F7_DIV          0x1
+#define F7_SLLIW        0x0
+#define F7_SRLIW        0x0
+#define F7_SRAIW        0x20
+#define F7_ADDW         0x0
+#define F7_SUBW         0x20
+#define F7_SLLW         0x0
+#define F7_SRLW         0x0
+#define F7_SRAW         0x20
+#define F7_MULH         0x1
+#define F7_MULHSU       0x1
+#define F7_MULHU        0x1
+#define F7_DIVU         0x1
+#define F7_REM          0x1
+#define F7_REMU         0x1
+#define F7_MULW         0x1
+#define F7_DIVW         0x1
+#define F7_DIVUW        0x1
+#define F7_REMW         0x1
+#define F7_REMUW        0x1
+/* the r4-type fused multiply-adds only use the low two bits (fmt) */
+#define F7_FMADD_S      0x0
+#define F7_FMSUB_S      0x0
+#define F7_FNMSUB_S     0x0
+#define F7_FNMADD_S     0x0
+#define F7_FADD_S       0x0
+#define F7_FSUB_S       0x4
+#define F7_FMUL_S       0x8
+#define F7_FDIV_S       0xc
+#define F7_FSQRT_S      0x2c
+#define F7_FSGNJ_S      0x10
+#define F7_FSGNJN_S     0x10
+#define F7_FSGNJX_S     0x10
+#define F7_FMIN_S       0x14
+#define F7_FMAX_S       0x14
+#define F7_FEQ_S        0x50
+#define F7_FLT_S        0x50
+#define F7_FLE_S        0x50
+#define F7_FCLASS_S     0x70
+#define F7_FCVT_W_S     0x60
+#define F7_FCVT_WU_S    0x60
+#define F7_FCVT_L_S     0x60
+#define F7_FCVT_LU_S    0x60
+#define F7_FCVT_S_W     0x68
+#define F7_FCVT_S_WU    0x68
+#define F7_FCVT_S_L     0x68
+#define F7_FCVT_S_LU    0x68
+#define F7_FMV_X_W      0x70
+#define F7_FMV_W_X      0x78
+#define F7_FMADD_D      0x1
+#define F7_FMSUB_D      0x1
+#define F7_FNMSUB_D     0x1
+#define F7_FNMADD_D     0x1
+#define F7_FADD_D       0x1
+#define F7_FSUB_D       0x5
+#define F7_FMUL_D       0x9
+#define F7_FDIV_D       0xd
+#define F7_FSQRT_D      0x2d
+#define F7_FSGNJ_D      0x11
+#define F7_FSGNJN_D     0x11
+#define F7_FSGNJX_D     0x11
+#define F7_FMIN_D       0x15
+#define F7_FMAX_D       0x15
+#define F7_FEQ_D        0x51
+#define F7_FLT_D        0x51
+#define F7_FLE_D        0x51
+#define F7_FCLASS_D     0x71
+#define F7_FCVT_W_D     0x61
+#define F7_FCVT_WU_D    0x61
+#define F7_FCVT_L_D     0x61
+#define F7_FCVT_LU_D    0x61
+#define F7_FCVT_D_W     0x69
+#define F7_FCVT_D_WU    0x69
+#define F7_FCVT_D_L     0x69
+#define F7_FCVT_D_LU    0x69
+#define F7_FMV_X_D      0x71
+#define F7_FMV_D_X      0x79
+#define F7_FCVT_S_D     0x20
+#define F7_FCVT_D_S     0x21
+#define F7_VSETVL       0x40
+/* the amos carry funct5 in the top of funct7, then the aq and rl bits */
+#define F7_LR_W         0x08
+#define F7_SC_W         0x0c
+#define F7_AMOSWAP_W    0x04
+#define F7_AMOADD_W     0x00
+#define F7_AMOXOR_W     0x10
+#define F7_AMOAND_W     0x30
+#define F7_AMOOR_W      0x20
+#define F7_AMOMIN_W     0x40
+#define F7_AMOMAX_W     0x50
+#define F7_AMOMINU_W    0x60
+#define F7_AMOMAXU_W    0x70
+#define F7_LR_D         0x08
+#define F7_SC_D         0x0c
+#define F7_AMOSWAP_D    0x04
+#define F7_AMOADD_D     0x00
+#define F7_AMOXOR_D     0x10
+#define F7_AMOAND_D     0x30
+#define F7_AMOOR_D      0x20
+#define F7_AMOMIN_D     0x40
+#define F7_AMOMAX_D     0x50
+#define F7_AMOMINU_D    0x60
+#define F7_AMOMAXU_D    0x70
+#define F7_AMO_AQ       0x2
+#define F7_AMO_RL       0x1
+
+/* rs2 field defines, for fp instructions that use it as an extra function code */
+#define RS2_FSQRT_S     0x0
+#define RS2_FCLASS_S    0x0
+#define RS2_FCVT_W_S    0x0
+#define RS2_FCVT_WU_S   0x1
+#define RS2_FCVT_L_S    0x2
+#define RS2_FCVT_LU_S   0x3
+#define RS2_FCVT_S_W    0x0
+#define RS2_FCVT_S_WU   0x1
+#define RS2_FCVT_S_L    0x2
+#define RS2_FCVT_S_LU   0x3
+#define RS2_FMV_X_W     0x0
+#define RS2_FMV_W_X     0x0
+#define RS2_FSQRT_D     0x0
+#define RS2_FCLASS_D    0x0
+#define RS2_FCVT_W_D    0x0
+#define RS2_FCVT_WU_D   0x1
+#define RS2_FCVT_L_D    0x2
+#define RS2_FCVT_LU_D   0x3
+#define RS2_FCVT_D_W    0x0
+#define RS2_FCVT_D_WU   0x1
+#define RS2_FCVT_D_L    0x2
+#define RS2_FCVT_D_LU   0x3
+#define RS2_FMV_X_D     0x0
+#define RS2_FMV_D_X     0x0
+#define RS2_FCVT_S_D    0x1
+#define RS2_FCVT_D_S    0x0
+
+/* vector funct6 defines, the vm bit makes up the rest of funct7 */
+#define F6_VADD_VV          0x00
+#define F6_VADD_VX          0x00
+#define F6_VADD_VI          0x00
+#define F6_VSUB_VV          0x02
+#define F6_VSUB_VX          0x02
+#define F6_VRSUB_VX         0x03
+#define F6_VRSUB_VI         0x03
+#define F6_VMINU_VV         0x04
+#define F6_VMINU_VX         0x04
+#define F6_VMIN_VV          0x05
+#define F6_VMIN_VX          0x05
+#define F6_VMAXU_VV         0x06
+#define F6_VMAXU_VX         0x06
+#define F6_VMAX_VV          0x07
+#define F6_VMAX_VX          0x07
+#define F6_VAND_VV          0x09
+#define F6_VAND_VX          0x09
+#define F6_VAND_VI          0x09
+#define F6_VOR_VV           0x0a
+#define F6_VOR_VX           0x0a
+#define F6_VOR_VI           0x0a
+#define F6_VXOR_VV          0x0b
+#define F6_VXOR_VX          0x0b
+#define F6_VXOR_VI          0x0b
+#define F6_VRGATHER_VV      0x0c
+#define F6_VRGATHER_VX      0x0c
+#define F6_VRGATHER_VI      0x0c
+#define F6_VSLIDEUP_VX      0x0e
+#define F6_VSLIDEUP_VI      0x0e
+#define F6_VSLIDEDOWN_VX    0x0f
+#define F6_VSLIDEDOWN_VI    0x0f
+#define F6_VMSEQ_VV         0x18
+#define F6_VMSEQ_VX         0x18
+#define F6_VMSEQ_VI         0x18
+#define F6_VMSNE_VV         0x19
+#define F6_VMSNE_VX         0x19
+#define F6_VMSNE_VI         0x19
+#define F6_VMSLTU_VV        0x1a
+#define F6_VMSLTU_VX        0x1a
+#define F6_VMSLT_VV         0x1b
+#define F6_VMSLT_VX         0x1b
+#define F6_VMSLEU_VV        0x1c
+#define F6_VMSLEU_VX        0x1c
+#define F6_VMSLEU_VI        0x1c
+#define F6_VMSLE_VV         0x1d
+#define F6_VMSLE_VX         0x1d
+#define F6_VMSLE_VI         0x1d
+#define F6_VMSGTU_VX        0x1e
+#define F6_VMSGTU_VI        0x1e
+#define F6_VMSGT_VX         0x1f
+#define F6_VMSGT_VI         0x1f
+#define F6_VSLL_VV          0x25
+#define F6_VSLL_VX          0x25
+#define F6_VSLL_VI          0x25
+#define F6_VSRL_VV          0x28
+#define F6_VSRL_VX          0x28
+#define F6_VSRL_VI          0x28
+#define F6_VSRA_VV          0x29
+#define F6_VSRA_VX          0x29
+#define F6_VSRA_VI          0x29
+#define F6_VNSRL_WV         0x2c
+#define F6_VNSRL_WX         0x2c
+#define F6_VNSRL_WI         0x2c
+#define F6_VNSRA_WV         0x2d
+#define F6_VNSRA_WX         0x2d
+#define F6_VNSRA_WI         0x2d
+#define F6_VMERGE_VVM       0x17
+#define F6_VMERGE_VXM       0x17
+#define F6_VMERGE_VIM       0x17
+#define F6_VMV_V_V          0x17
+#define F6_VMV_V_X          0x17
+#define F6_VMV_V_I          0x17
+#define F6_VDIVU_VV         0x20
+#define F6_VDIVU_VX         0x20
+#define F6_VDIV_VV          0x21
+#define F6_VDIV_VX          0x21
+#define F6_VREMU_VV         0x22
+#define F6_VREMU_VX         0x22
+#define F6_VREM_VV          0x23
+#define F6_VREM_VX          0x23
+#define F6_VMULHU_VV        0x24
+#define F6_VMULHU_VX        0x24
+#define F6_VMUL_VV          0x25
+#define F6_VMUL_VX          0x25
+#define F6_VMULHSU_VV       0x26
+#define F6_VMULHSU_VX       0x26
+#define F6_VMULH_VV         0x27
+#define F6_VMULH_VX         0x27
+#define F6_VWADDU_VV        0x30
+#define F6_VWADDU_VX        0x30
+#define F6_VWADD_VV         0x31
+#define F6_VWADD_VX         0x31
+#define F6_VWSUBU_VV        0x32
+#define F6_VWSUBU_VX        0x32
+#define F6_VWSUB_VV         0x33
+#define F6_VWSUB_VX         0x33
+#define F6_VWMULU_VV        0x38
+#define F6_VWMULU_VX        0x38
+#define F6_VWMULSU_VV       0x3a
+#define F6_VWMULSU_VX       0x3a
+#define F6_VWMUL_VV         0x3b
+#define F6_VWMUL_VX         0x3b
+#define F6_VMADD_VV         0x29
+#define F6_VMADD_VX         0x29
+#define F6_VNMSUB_VV        0x2b
+#define F6_VNMSUB_VX        0x2b
+#define F6_VMACC_VV         0x2d
+#define F6_VMACC_VX         0x2d
+#define F6_VNMSAC_VV        0x2f
+#define F6_VNMSAC_VX        0x2f
+#define F6_VWMACCU_VV       0x3c
+#define F6_VWMACCU_VX       0x3c
+#define F6_VWMACC_VV        0x3d
+#define F6_VWMACC_VX        0x3d
+#define F6_VREDSUM_VS       0x00
+#define F6_VREDAND_VS       0x01
+#define F6_VREDOR_VS        0x02
+#define F6_VREDXOR_VS       0x03
+#define F6_VREDMINU_VS      0x04
+#define F6_VREDMIN_VS       0x05
+#define F6_VREDMAXU_VS      0x06
+#define F6_VREDMAX_VS       0x07
+#define F6_VSLIDE1UP_VX     0x0e
+#define F6_VSLIDE1DOWN_VX   0x0f
+#define F6_VMV_X_S          0x10
+#define F6_VMV_S_X          0x10
+#define F6_VCPOP_M          0x10
+#define F6_VFIRST_M         0x10
+#define F6_VIOTA_M          0x14
+#define F6_VID_V            0x14
+#define F6_VMANDN_MM        0x18
+#define F6_VMAND_MM         0x19
+#define F6_VMOR_MM          0x1a
+#define F6_VMXOR_MM         0x1b
+#define F6_VMORN_MM         0x1c
+#define F6_VMNAND_MM        0x1d
+#define F6_VMNOR_MM         0x1e
+#define F6_VMXNOR_MM        0x1f
+#define F6_VFADD_VV         0x00
+#define F6_VFADD_VF         0x00
+#define F6_VFSUB_VV         0x02
+#define F6_VFSUB_VF         0x02
+#define F6_VFRSUB_VF        0x27
+#define F6_VFMIN_VV         0x04
+#define F6_VFMIN_VF         0x04
+#define F6_VFMAX_VV         0x06
+#define F6_VFMAX_VF         0x06
+#define F6_VFSGNJ_VV        0x08
+#define F6_VFSGNJ_VF        0x08
+#define F6_VFSGNJN_VV       0x09
+#define F6_VFSGNJN_VF       0x09
+#define F6_VFSGNJX_VV       0x0a
+#define F6_VFSGNJX_VF       0x0a
+#define F6_VFDIV_VV         0x20
+#define F6_VFDIV_VF         0x20
+#define F6_VFRDIV_VF        0x21
+#define F6_VFMUL_VV         0x24
+#define F6_VFMUL_VF         0x24
+#define F6_VMFEQ_VV         0x18
+#define F6_VMFEQ_VF         0x18
+#define F6_VMFLE_VV         0x19
+#define F6_VMFLE_VF         0x19
+#define F6_VMFLT_VV         0x1b
+#define F6_VMFLT_VF         0x1b
+#define F6_VMFNE_VV         0x1c
+#define F6_VMFNE_VF         0x1c
+#define F6_VMFGT_VF         0x1d
+#define F6_VMFGE_VF         0x1f
+#define F6_VFMADD_VV        0x28
+#define F6_VFMADD_VF        0x28
+#define F6_VFNMADD_VV       0x29
+#define F6_VFNMADD_VF       0x29
+#define F6_VFMSUB_VV        0x2a
+#define F6_VFMSUB_VF        0x2a
+#define F6_VFNMSUB_VV       0x2b
+#define F6_VFNMSUB_VF       0x2b
+#define F6_VFMACC_VV        0x2c
+#define F6_VFMACC_VF        0x2c
+#define F6_VFNMACC_VV       0x2d
+#define F6_VFNMACC_VF       0x2d
+#define F6_VFMSAC_VV        0x2e
+#define F6_VFMSAC_VF        0x2e
+#define F6_VFNMSAC_VV       0x2f
+#define F6_VFNMSAC_VF       0x2f
+#define F6_VFREDUSUM_VS     0x01
+#define F6_VFREDOSUM_VS     0x03
+#define F6_VFREDMIN_VS      0x05
+#define F6_VFREDMAX_VS      0x07
+#define F6_VFSQRT_V         0x13
+#define F6_VFCVT_XU_F_V     0x12
+#define F6_VFCVT_X_F_V      0x12
+#define F6_VFCVT_F_XU_V     0x12
+#define F6_VFCVT_F_X_V      0x12
+#define F6_VFCVT_RTZ_XU_F_V 0x12
+#define F6_VFCVT_RTZ_X_F_V  0x12
+#define F6_VFMV_F_S         0x10
+#define F6_VFMV_S_F         0x10
+#define F6_VFMV_V_F         0x17
+#define F6_VFMERGE_VFM      0x17
+
+/* vector load/store addressing modes (mop), nf and mew are always zero */
+#define MOP_VLE8_V          0x0
+#define MOP_VLE8FF_V        0x0
+#define MOP_VSE8_V          0x0
+#define MOP_VLSE8_V         0x2
+#define MOP_VSSE8_V         0x2
+#define MOP_VLUXEI8_V       0x1
+#define MOP_VLOXEI8_V       0x3
+#define MOP_VSUXEI8_V       0x1
+#define MOP_VSOXEI8_V       0x3
+#define MOP_VLE16_V         0x0
+#define MOP_VLE16FF_V       0x0
+#define MOP_VSE16_V         0x0
+#define MOP_VLSE16_V        0x2
+#define MOP_VSSE16_V        0x2
+#define MOP_VLUXEI16_V      0x1
+#define MOP_VLOXEI16_V      0x3
+#define MOP_VSUXEI16_V      0x1
+#define MOP_VSOXEI16_V      0x3
+#define MOP_VLE32_V         0x0
+#define MOP_VLE32FF_V       0x0
+#define MOP_VSE32_V         0x0
+#define MOP_VLSE32_V        0x2
+#define MOP_VSSE32_V        0x2
+#define MOP_VLUXEI32_V      0x1
+#define MOP_VLOXEI32_V      0x3
+#define MOP_VSUXEI32_V      0x1
+#define MOP_VSOXEI32_V      0x3
+#define MOP_VLE64_V         0x0
+#define MOP_VLE64FF_V       0x0
+#define MOP_VSE64_V         0x0
+#define MOP_VLSE64_V        0x2
+#define MOP_VSSE64_V        0x2
+#define MOP_VLUXEI64_V      0x1
+#define MOP_VLOXEI64_V      0x3
+#define MOP_VSUXEI64_V      0x1
+#define MOP_VSOXEI64_V      0x3
+#define MOP_VLM_V           0x0
+#define MOP_VSM_V           0x0
+
+/* fixed vs1 (unary ops) or lumop/sumop (unit-stride memory ops) fields */
+#define RS2_VLE8_V          0x00
+#define RS2_VLE8FF_V        0x10
+#define RS2_VSE8_V          0x00
+#define RS2_VLE16_V         0x00
+#define RS2_VLE16FF_V       0x10
+#define RS2_VSE16_V         0x00
+#define RS2_VLE32_V         0x00
+#define RS2_VLE32FF_V       0x10
+#define RS2_VSE32_V         0x00
+#define RS2_VLE64_V         0x00
+#define RS2_VLE64FF_V       0x10
+#define RS2_VSE64_V         0x00
+#define RS2_VLM_V           0x0b
+#define RS2_VSM_V           0x0b
+#define RS1_VMV_X_S         0x00
+#define RS1_VCPOP_M         0x10
+#define RS1_VFIRST_M        0x11
+#define RS1_VIOTA_M         0x10
+#define RS1_VID_V           0x11
+#define RS1_VFSQRT_V        0x00
+#define RS1_VFCVT_XU_F_V    0x00
+#define RS1_VFCVT_X_F_V     0x01
+#define RS1_VFCVT_F_XU_V    0x02
+#define RS1_VFCVT_F_X_V     0x03
+#define RS1_VFCVT_RTZ_XU_F_V 0x06
+#define RS1_VFCVT_RTZ_X_F_V 0x07
+#define RS1_VFMV_F_S        0x00
+
+/* vtype fields, already shifted into place */
+#define VSEW_E8         (0x0<<3)
+#define VSEW_E16        (0x1<<3)
+#define VSEW_E32        (0x2<<3)
+#define VSEW_E64        (0x3<<3)
+#define VLMUL_MF8       0x5
+#define VLMUL_MF4       0x6
+#define VLMUL_MF2       0x7
+#define VLMUL_M1        0x0
+#define VLMUL_M2        0x1
+#define VLMUL_M4        0x2
+#define VLMUL_M8        0x3
+#define VTYPE_TA        (0x1<<6)
+#define VTYPE_MA        (0x1<<7)
+
+/* fp rounding modes, carried in the funct3 field */
+#define FRM_RNE         0x0
+#define FRM_RTZ         0x1
+#define FRM_RDN         0x2
+#define FRM_RUP         0x3
+#define FRM_RMM         0x4
+#define FRM_DYN         0x7
+
+/* fp csr numbers */
+#define CSR_FFLAGS      0x001
+#define CSR_FRM         0x002
+#define CSR_FCSR        0x003
+
+/* counter csr numbers, the hpm counters run from 3 to 31 */
+#define CSR_CYCLE           0xc00
+#define CSR_TIME            0xc01
+#define CSR_INSTRET         0xc02
+#define CSR_HPMCOUNTER3     0xc03
+#define CSR_MCYCLE          0xb00
+#define CSR_MINSTRET        0xb02
+#define CSR_MHPMCOUNTER3    0xb03
+#define CSR_MCOUNTINHIBIT   0x320
+#define CSR_MHPMEVENT3      0x323
+
+/* the hart running the code */
+#define CSR_MHARTID         0xf14
+
+/* fence iorw, iorw */
+#define FENCE_ALL           0x0ff
+
+
+/* rvc forms, chosen by the -compress pass */
+#define RVC_NONE        -1
+#define RVC_ADDI4SPN     0
+#define RVC_FLD          1
+#define RVC_LW           2
+#define RVC_LD           3
+#define RVC_FSD          4
+#define RVC_SW           5
+#define RVC_SD           6
+#define RVC_NOP          7
+#define RVC_ADDI         8
+#define RVC_ADDIW        9
+#define RVC_LI          10
+#define RVC_ADDI16SP    11
+#define RVC_LUI         12
+#define RVC_SRLI        13
+#define RVC_SRAI        14
+#define RVC_ANDI        15
+#define RVC_SUB         16
+#define RVC_XOR         17
+#define RVC_OR          18
+#define RVC_AND         19
+#define RVC_SUBW        20
+#define RVC_ADDW        21
+#define RVC_J           22
+#define RVC_BEQZ        23
+#define RVC_BNEZ        24
+#define RVC_SLLI        25
+#define RVC_FLDSP       26
+#define RVC_LWSP        27
+#define RVC_LDSP        28
+#define RVC_JR          29
+#define RVC_MV          30
+#define RVC_EBREAK      31
+#define RVC_JALR        32
+#define RVC_ADD         33
+#define RVC_FSDSP       34
+#define RVC_SWSP        35
+#define RVC_SDSP        36
 
 #endif
@@ -0,0 +1,1318 @@
+/* This file is part of the DuctTape (dt) high-level assembler for 
+ * RISC-V. The dt project was written by Justin Severeid and Elliott 
+ * Forbes, University of Wisconsin-La Crosse, copyright 2020-2024.
+ *
+ * DuctTape is free software: you can redistribute it and/or modify 
+ * it under the terms of the GNU General Public License as published 
+ * by the Free Software Foundation, either version 3 of the License, 
+ * or (at your option) any later version.
+ *
+ * DuctTape is distributed in the hope that it will be useful, but 
+ * WITHOUT ANY WARRANTY; without even the implied warranty of 
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU 
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License 
+ * along with DuctTape. If not, see <https://www.gnu.org/licenses/>. 
+ *
+ *
+ *
+ * The dt project can be found at https://cs.uwlax.edu/~eforbes/dt/
+ *
+ * If you use dt in your published research, please consider 
+ * citing the following:
+ *
+ * Severeid, J. and Forbes, E., "dt: A High-level Assembler for RISC-V," 
+ * Proceedings of the 53rd Midwest Instruction and Computing Symposium, 
+ * April 2020. 
+ *
+ * If you found dt helpful, please let us know! Email eforbes@uwlax.edu
+ *
+ * There are bound to be bugs, let us know those too.
+ */
+
+
+/*
+ * -run: executes the assembled program in-process, the way it would run
+ * as a Linux ELF. Every instruction is predecoded once, from its
+ * encoding, into a slot array per mem() block, so the main loop is a
+ * single switch over the decoded operation. Compressed instructions are
+ * expanded to their 32-bit operation when they are decoded. Memory is a
+ * sparse set of 4KiB pages that are allocated, zero filled, on first
+ * touch, with a small direct-mapped cache in front of the page table.
+ *
+ * RV64IMAFD and the Zicsr counters are simulated, vector instructions
+ * are not. The write, exit, exit_group and brk system calls
+ * are emulated, every other call returns -ENOSYS. The instructions are
+ * decoded before the run starts, so stores into code are not seen by
+ * the instruction fetch.
+ *
+ * With $harts set there is a hart per hart, all starting at $pc. They
+ * take turns on the one host thread, a fixed number of instructions at a
+ * time, so every run interleaves them the same way. exit ends the hart
+ * that calls it, exit_group ends them all.
+ *
+ * When the program exits, the retired instruction count for each label
+ * and the final register state are printed to stderr, and dt exits with
+ * the program's exit code.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+#include <elf.h>
+
+#include "riscvarch.h"
+#include "sim.h"
+#include "hart.h"
+#include "inst.h"
+#include "mem.h"
+#include "pc.h"
+#include "util.h"
+
+/* the ELF writer puts the headers in front of the first block, so every address is biased by them */
+#define SIM_LOAD_BIAS (sizeof(Elf64_Ehdr) + sizeof(Elf64_Phdr))
+
+#define SIM_PAGE_BITS 12
+#define SIM_PAGE_SIZE (1 << SIM_PAGE_BITS)
+#define SIM_PAGE_MASK (SIM_PAGE_SIZE - 1)
+#define SIM_TLB_SIZE 256
+
+#define SIM_STACK_TOP 0x3ffffff000ULL /* where a Linux RV64 stack would be */
+#define SIM_STACK_FRAME 64            /* argc, argv, envp and auxv, all empty */
+
+#define SIM_QUANTUM 1000 /* instructions a hart runs before the next one's turn */
+
+#define SIM_SYS_WRITE 64
+#define SIM_SYS_EXIT 93
+#define SIM_SYS_EXIT_GROUP 94
+#define SIM_SYS_BRK 214
+#define SIM_EBADF 9
+#define SIM_ENOSYS 38
+
+#define SIM_CANONICAL_NAN_S 0x7fc00000U
+#define SIM_CANONICAL_NAN_D 0x7ff8000000000000ULL
+#define SIM_BOX_S 0xffffffff00000000ULL
+
+typedef enum {
+    SIM_ILLEGAL,
+    SIM_LUI, SIM_AUIPC, SIM_JAL, SIM_JALR,
+    SIM_BEQ, SIM_BNE, SIM_BLT, SIM_BGE, SIM_BLTU, SIM_BGEU,
+    SIM_LB, SIM_LH, SIM_LW, SIM_LD, SIM_LBU, SIM_LHU, SIM_LWU,
+    SIM_SB, SIM_SH, SIM_SW, SIM_SD,
+    SIM_ADDI, SIM_SLTI, SIM_SLTIU, SIM_XORI, SIM_ORI, SIM_ANDI,
+    SIM_SLLI, SIM_SRLI, SIM_SRAI,
+    SIM_ADDIW, SIM_SLLIW, SIM_SRLIW, SIM_SRAIW,
+    SIM_ADD, SIM_SUB, SIM_SLL, SIM_SLT, SIM_SLTU, SIM_XOR, SIM_SRL, SIM_SRA, SIM_OR, SIM_AND,
+    SIM_ADDW, SIM_SUBW, SIM_SLLW, SIM_SRLW, SIM_SRAW,
+    SIM_MUL, SIM_MULH, SIM_MULHSU, SIM_MULHU, SIM_DIV, SIM_DIVU, SIM_REM, SIM_REMU,
+    SIM_MULW, SIM_DIVW, SIM_DIVUW, SIM_REMW, SIM_REMUW,
+    SIM_FENCE, SIM_ECALL, SIM_EBREAK,
+    SIM_CSRRW, SIM_CSRRS, SIM_CSRRC, SIM_CSRRWI, SIM_CSRRSI, SIM_CSRRCI,
+    SIM_FLW, SIM_FLD, SIM_FSW, SIM_FSD,
+    SIM_FMADD_S, SIM_FMSUB_S, SIM_FNMSUB_S, SIM_FNMADD_S,
+    SIM_FMADD_D, SIM_FMSUB_D, SIM_FNMSUB_D, SIM_FNMADD_D,
+    SIM_FADD_S, SIM_FSUB_S, SIM_FMUL_S, SIM_FDIV_S, SIM_FSQRT_S,
+    SIM_FSGNJ_S, SIM_FSGNJN_S, SIM_FSGNJX_S, SIM_FMIN_S, SIM_FMAX_S,
+    SIM_FEQ_S, SIM_FLT_S, SIM_FLE_S, SIM_FCLASS_S,
+    SIM_FCVT_W_S, SIM_FCVT_WU_S, SIM_FCVT_L_S, SIM_FCVT_LU_S,
+    SIM_FCVT_S_W, SIM_FCVT_S_WU, SIM_FCVT_S_L, SIM_FCVT_S_LU,
+    SIM_FMV_X_W, SIM_FMV_W_X,
+    SIM_FADD_D, SIM_FSUB_D, SIM_FMUL_D, SIM_FDIV_D, SIM_FSQRT_D,
+    SIM_FSGNJ_D, SIM_FSGNJN_D, SIM_FSGNJX_D, SIM_FMIN_D, SIM_FMAX_D,
+    SIM_FEQ_D, SIM_FLT_D, SIM_FLE_D, SIM_FCLASS_D,
+    SIM_FCVT_W_D, SIM_FCVT_WU_D, SIM_FCVT_L_D, SIM_FCVT_LU_D,
+    SIM_FCVT_D_W, SIM_FCVT_D_WU, SIM_FCVT_D_L, SIM_FCVT_D_LU,
+    SIM_FMV_X_D, SIM_FMV_D_X,
+    SIM_FCVT_S_D, SIM_FCVT_D_S,
+    SIM_LR_W, SIM_SC_W, SIM_AMOSWAP_W, SIM_AMOADD_W, SIM_AMOXOR_W, SIM_AMOAND_W, SIM_AMOOR_W,
+    SIM_AMOMIN_W, SIM_AMOMAX_W, SIM_AMOMINU_W, SIM_AMOMAXU_W,
+    SIM_LR_D, SIM_SC_D, SIM_AMOSWAP_D, SIM_AMOADD_D, SIM_AMOXOR_D, SIM_AMOAND_D, SIM_AMOOR_D,
+    SIM_AMOMIN_D, SIM_AMOMAX_D, SIM_AMOMINU_D, SIM_AMOMAXU_D,
+    SIM_END
+} sim_op_t;
+
+/* one predecoded instruction */
+typedef struct {
+    uint8_t op;     /* a sim_op_t */
+    uint8_t rd;
+    uint8_t rs1;
+    uint8_t rs2;
+    uint8_t rs3;
+    uint8_t rm;     /* rounding mode, for the fp to integer conversions, 7 is frm */
+    uint8_t size;   /* 2 or 4 bytes */
+    int64_t imm;    /* the raw encoding for SIM_ILLEGAL */
+    uint64_t count; /* times retired */
+} sim_inst_t;
+
+/* the predecoded instructions of one mem() block, one slot per half word and one past the end */
+typedef struct {
+    uint64_t base;
+    uint64_t span;
+    sim_inst_t *insts;
+    memblock_list_t *list;
+} sim_code_t;
+
+static sim_code_t *code_blocks = NULL;
+static int code_block_count = 0;
+
+/* sparse memory, an open addressed table of pages and a cache in front of it */
+static uint64_t *page_numbers = NULL;
+static uint8_t **pages = NULL;
+static uint64_t page_slots = 0;
+static uint64_t page_count = 0;
+static uint64_t tlb_tag[SIM_TLB_SIZE];
+static uint8_t *tlb_page[SIM_TLB_SIZE];
+
+/* the running hart's registers, the others are parked in their sim_hart_t */
+static uint64_t xreg[32];
+static uint64_t freg[32];
+static uint32_t fflags = 0; /* never raised, the host's exception flags are not tracked */
+static uint32_t frm = 0;
+static uint64_t brk_start, brk_current;
+static uint64_t fault_pc;
+
+/* a hart that is not running */
+typedef struct {
+    uint64_t xreg[32];
+    uint64_t freg[32];
+    uint64_t pc;
+    uint64_t retired;
+    BOOL exited;
+} sim_hart_t;
+
+static sim_hart_t *hart_state = NULL;
+static uint64_t hart_id = 0;
+
+/* the lr reservation, dropped whenever another hart gets a turn */
+#define SIM_NO_RESERVATION 1
+static uint64_t reservation = SIM_NO_RESERVATION;
+
+/* the pc is given as it is at run time and as it is in the -checking listing */
+static void sim_fault(const char *what){
+    char buff[200];
+    sprintf(buff,"-run: %s at pc 0x%" PRIx64 " (0x%" PRIx64 " in the listing)",what,fault_pc,fault_pc - SIM_LOAD_BIAS);
+    yyerror(buff);
+}
+
+/* Memory ###################################################################*/
+
+static uint64_t page_hash(uint64_t number){
+    return (number * 0x9e3779b97f4a7c15ULL) >> 17;
+}
+
+static void page_insert(uint64_t number, uint8_t *page){
+    uint64_t slot = page_hash(number) & (page_slots - 1);
+    while (pages[slot])
+        slot = (slot + 1) & (page_slots - 1);
+    page_numbers[slot] = number;
+    pages[slot] = page;
+}
+
+static uint8_t *page_lookup(uint64_t number){
+    uint64_t slot;
+
+    if (2 * (page_count + 1) > page_slots){
+        uint64_t *old_numbers = page_numbers;
+        uint8_t **old_pages = pages;
+        uint64_t old_slots = page_slots;
+        uint64_t i;
+
+        page_slots = page_slots ? 2 * page_slots : 1024;
+        page_numbers = (uint64_t*) calloc(page_slots,sizeof(uint64_t));
+        pages = (uint8_t**) calloc(page_slots,sizeof(uint8_t*));
+        if (!page_numbers || !pages) yyerror("-run: unable to allocate the page table");
+        for (i=0;i<old_slots;i++){
+            if (old_pages[i])
+                page_insert(old_numbers[i],old_pages[i]);
+        }
+        free(old_numbers);
+        free(old_pages);
+    }
+
+    slot = page_hash(number) & (page_slots - 1);
+    while (pages[slot]){
+        if (page_numbers[slot] == number)
+            return pages[slot];
+        slot = (slot + 1) & (page_slots - 1);
+    }
+    pages[slot] = (uint8_t*) calloc(1,SIM_PAGE_SIZE);
+    if (!pages[slot]) yyerror("-run: unable to allocate simulated memory");
+    page_numbers[slot] = number;
+    page_count++;
+    return pages[slot];
+}
+
+static inline uint8_t *sim_page(uint64_t addr){
+    uint64_t number = addr >> SIM_PAGE_BITS;
+    uint32_t way = number & (SIM_TLB_SIZE - 1);
+
+    if ((tlb_tag[way] != number) || !tlb_page[way]){
+        tlb_tag[way] = number;
+        tlb_page[way] = page_lookup(number);
+    }
+    return tlb_page[way];
+}
+
+/* byte at a time, for the accesses that straddle two pages */
+static void copy_in(uint64_t addr, void *dst, int size){
+    int i;
+    for (i=0;i<size;i++)
+        ((uint8_t*)dst)[i] = sim_page(addr + i)[(addr + i) & SIM_PAGE_MASK];
+}
+
+static void copy_out(uint64_t addr, const void *src, int size){
+    int i;
+    for (i=0;i<size;i++)
+        sim_page(addr + i)[(addr + i) & SIM_PAGE_MASK] = ((const uint8_t*)src)[i];
+}
+
+/* a page at a time, for loading .incbin payloads and data lists */
+static void copy_out_pages(uint64_t addr, const uint8_t *src, uint64_t size){
+    while (size){
+        uint64_t chunk = SIM_PAGE_SIZE - (addr & SIM_PAGE_MASK);
+        if (chunk > size)
+            chunk = size;
+        memcpy(sim_page(addr) + (addr & SIM_PAGE_MASK),src,chunk);
+        addr += chunk;
+        src += chunk;
+        size -= chunk;
+    }
+}
+
+/* runs are expanded straight into the pages, zeros are already there */
+static void fill_pages(uint64_t addr, data_array_t *run, uint64_t size){
+    uint8_t pattern[SIM_PAGE_SIZE];
+
+    if (run->value == 0)
+        return;
+    fill_bytes(pattern,run,(size < SIM_PAGE_SIZE) ? size : SIM_PAGE_SIZE);
+    while (size){
+        uint64_t chunk = (size < SIM_PAGE_SIZE) ? size : SIM_PAGE_SIZE;
+        copy_out_pages(addr,pattern,chunk);
+        addr += chunk;
+        size -= chunk;
+    }
+}
+
+#define SIM_ACCESSORS(bits) \
+static inline uint##bits##_t load##bits(uint64_t addr){ \
+    uint##bits##_t value; \
+    if ((addr & SIM_PAGE_MASK) <= (SIM_PAGE_SIZE - sizeof(value))) \
+        memcpy(&value,sim_page(addr) + (addr & SIM_PAGE_MASK),sizeof(value)); \
+    else \
+        copy_in(addr,&value,sizeof(value)); \
+    return value; \
+} \
+static inline void store##bits(uint64_t addr, uint##bits##_t value){ \
+    if ((addr & SIM_PAGE_MASK) <= (SIM_PAGE_SIZE - sizeof(value))) \
+        memcpy(sim_page(addr) + (addr & SIM_PAGE_MASK),&value,sizeof(value)); \
+    else \
+        copy_out(addr,&value,sizeof(value)); \
+}
+
+SIM_ACCESSORS(8)
+SIM_ACCESSORS(16)
+SIM_ACCESSORS(32)
+SIM_ACCESSORS(64)
+
+/* copies the program into memory, byte for byte what write_elf would put in the file */
+static void load_image(){
+    memblock_list_t *list = block_list;
+    uint64_t top = 0;
+
+    while (list){
+        mem_entry_t *working = list->head;
+        while (working){
+            uint64_t addr = working->address + SIM_LOAD_BIAS;
+            switch (working->type){
+                case ENTRY_INSTRUCTION:
+                    copy_out(addr,&(working->encoding),working->size);
+                    break;
+                case ENTRY_BDATA:
+                    store8(addr,(uint8_t)working->ivalue);
+                    break;
+                case ENTRY_HDATA:
+                    store16(addr,(uint16_t)working->ivalue);
+                    break;
+                case ENTRY_WDATA:
+                    store32(addr,(uint32_t)working->ivalue);
+                    break;
+                case ENTRY_LDATA:
+                    store64(addr,working->ivalue);
+                    break;
+                case ENTRY_FDATA:
+                    copy_out(addr,&(working->fvalue),sizeof(float));
+                    break;
+                case ENTRY_DDATA:
+                    copy_out(addr,&(working->dvalue),sizeof(double));
+                    break;
+                case ENTRY_SDATA:
+                    copy_out(addr,working->svalue,strlen(working->svalue) + 1);
+                    break;
+                case ENTRY_BLOB:
+                    copy_out_pages(addr,working->blob,working->size);
+                    break;
+                case ENTRY_ARRAY:
+                case ENTRY_GEN:
+                    copy_out_pages(addr,working->array->bytes,working->size);
+                    break;
+                case ENTRY_FILL:
+                    fill_pages(addr,working->array,working->size);
+                    break;
+                default:
+                    break;
+            }
+            if (addr + working->size > top)
+                top = addr + working->size;
+            working = working->next;
+        }
+        list = list->next;
+    }
+
+    brk_start = (top + SIM_PAGE_MASK) & ~(uint64_t)SIM_PAGE_MASK;
+    brk_current = brk_start;
+}
+
+/* Decode ###################################################################*/
+
+static int64_t sext(uint64_t value, int bits){
+    return (int64_t)(value << (64 - bits)) >> (64 - bits);
+}
+
+static void set_op(sim_inst_t *s, sim_op_t op, int rd, int rs1, int rs2, int64_t imm){
+    s->op = op;
+    s->rd = rd;
+    s->rs1 = rs1;
+    s->rs2 = rs2;
+    s->imm = imm;
+}
+
+static void decode_fp(sim_inst_t *s, int rd, int rs1, int rs2, int funct3, int funct7){
+    static const sim_op_t arith[2][4] = {
+        {SIM_FADD_S, SIM_FSUB_S, SIM_FMUL_S, SIM_FDIV_S},
+        {SIM_FADD_D, SIM_FSUB_D, SIM_FMUL_D, SIM_FDIV_D}
+    };
+    int d = funct7 & 1; /* the fmt field, 0 single, 1 double */
+
+    s->rm = funct3;
+    switch (funct7 >> 2){
+        case 0x00: case 0x01: case 0x02: case 0x03:
+            set_op(s,arith[d][funct7 >> 2],rd,rs1,rs2,0);
+            break;
+        case 0x0b:
+            set_op(s,d ? SIM_FSQRT_D : SIM_FSQRT_S,rd,rs1,0,0);
+            break;
+        case 0x04:
+            if (funct3 <= 2)
+                set_op(s,(d ? SIM_FSGNJ_D : SIM_FSGNJ_S) + funct3,rd,rs1,rs2,0);
+            break;
+        case 0x05:
+            if (funct3 <= 1)
+                set_op(s,(d ? SIM_FMIN_D : SIM_FMIN_S) + funct3,rd,rs1,rs2,0);
+            break;
+        case 0x08:
+            if ((funct7 == F7_FCVT_S_D) && (rs2 == 1))
+                set_op(s,SIM_FCVT_S_D,rd,rs1,0,0);
+            else if ((funct7 == F7_FCVT_D_S) && (rs2 == 0))
+                set_op(s,SIM_FCVT_D_S,rd,rs1,0,0);
+            break;
+        case 0x14:
+            /* flt is funct3 1, fle 0, feq 2 */
+            if (funct3 == 2)
+                set_op(s,d ? SIM_FEQ_D : SIM_FEQ_S,rd,rs1,rs2,0);
+            else if (funct3 == 1)
+                set_op(s,d ? SIM_FLT_D : SIM_FLT_S,rd,rs1,rs2,0);
+            else if (funct3 == 0)
+                set_op(s,d ? SIM_FLE_D : SIM_FLE_S,rd,rs1,rs2,0);
+            break;
+        case 0x18:
+            if (rs2 <= 3)
+                set_op(s,(d ? SIM_FCVT_W_D : SIM_FCVT_W_S) + rs2,rd,rs1,0,0);
+            break;
+        case 0x1a:
+            if (rs2 <= 3)
+                set_op(s,(d ? SIM_FCVT_D_W : SIM_FCVT_S_W) + rs2,rd,rs1,0,0);
+            break;
+        case 0x1c:
+            if ((funct3 == 0) && (rs2 == 0))
+                set_op(s,d ? SIM_FMV_X_D : SIM_FMV_X_W,rd,rs1,0,0);
+            else if ((funct3 == 1) && (rs2 == 0))
+                set_op(s,d ? SIM_FCLASS_D : SIM_FCLASS_S,rd,rs1,0,0);
+            break;
+        case 0x1e:
+            if ((funct3 == 0) && (rs2 == 0))
+                set_op(s,d ? SIM_FMV_D_X : SIM_FMV_W_X,rd,rs1,0,0);
+            break;
+        default:
+            break;
+    }
+    if ((funct7 & 2) && (s->op != SIM_ILLEGAL)) /* the quad and half fmts */
+        s->op = SIM_ILLEGAL;
+}
+
+static void decode32(sim_inst_t *s, uint32_t w){
+    int opcode = w & 0x7f;
+    int rd = (w >> 7) & 0x1f;
+    int funct3 = (w >> 12) & 0x7;
+    int rs1 = (w >> 15) & 0x1f;
+    int rs2 = (w >> 20) & 0x1f;
+    int funct7 = w >> 25;
+    int64_t imm_i = sext(w >> 20,12);
+    int64_t imm_s = sext(((w >> 25) << 5) | ((w >> 7) & 0x1f),12);
+    int64_t imm_b = sext((((w >> 31) & 1) << 12) | (((w >> 7) & 1) << 11) | (((w >> 25) & 0x3f) << 5) | (((w >> 8) & 0xf) << 1),13);
+    int64_t imm_u = sext(w & 0xfffff000,32);
+    int64_t imm_j = sext((((w >> 31) & 1) << 20) | (((w >> 12) & 0xff) << 12) | (((w >> 20) & 1) << 11) | (((w >> 21) & 0x3ff) << 1),21);
+
+    s->size = 4;
+    s->op = SIM_ILLEGAL;
+    s->imm = w;
+    switch (opcode){
+        case OP_LUI:
+            set_op(s,SIM_LUI,rd,0,0,imm_u);
+            break;
+        case OP_AUIPC:
+            set_op(s,SIM_AUIPC,rd,0,0,imm_u);
+            break;
+        case OP_JAL:
+            set_op(s,SIM_JAL,rd,0,0,imm_j);
+            break;
+        case OP_JALR:
+            if (funct3 == 0)
+                set_op(s,SIM_JALR,rd,rs1,0,imm_i);
+            break;
+        case OP_BEQ:
+            if ((funct3 != 2) && (funct3 != 3))
+                set_op(s,(funct3 < 2) ? SIM_BEQ + funct3 : SIM_BLT + (funct3 - 4),0,rs1,rs2,imm_b);
+            break;
+        case OP_LB:
+            if (funct3 != 7)
+                set_op(s,SIM_LB + funct3,rd,rs1,0,imm_i);
+            break;
+        case OP_SB:
+            if (funct3 <= 3)
+                set_op(s,SIM_SB + funct3,0,rs1,rs2,imm_s);
+            break;
+        case OP_ADDI:
+            switch (funct3){
+                case 0: set_op(s,SIM_ADDI,rd,rs1,0,imm_i); break;
+                case 1: if ((w >> 26) == 0) set_op(s,SIM_SLLI,rd,rs1,0,(w >> 20) & 0x3f); break;
+                case 2: set_op(s,SIM_SLTI,rd,rs1,0,imm_i); break;
+                case 3: set_op(s,SIM_SLTIU,rd,rs1,0,imm_i); break;
+                case 4: set_op(s,SIM_XORI,rd,rs1,0,imm_i); break;
+                case 5:
+                    if ((w >> 26) == 0) set_op(s,SIM_SRLI,rd,rs1,0,(w >> 20) & 0x3f);
+                    else if ((w >> 26) == 0x10) set_op(s,SIM_SRAI,rd,rs1,0,(w >> 20) & 0x3f);
+                    break;
+                case 6: set_op(s,SIM_ORI,rd,rs1,0,imm_i); break;
+                case 7: set_op(s,SIM_ANDI,rd,rs1,0,imm_i); break;
+            }
+            break;
+        case OP_ADDIW:
+            if (funct3 == 0) set_op(s,SIM_ADDIW,rd,rs1,0,imm_i);
+            else if ((funct3 == 1) && (funct7 == 0)) set_op(s,SIM_SLLIW,rd,rs1,0,rs2);
+            else if ((funct3 == 5) && (funct7 == 0)) set_op(s,SIM_SRLIW,rd,rs1,0,rs2);
+            else if ((funct3 == 5) && (funct7 == 0x20)) set_op(s,SIM_SRAIW,rd,rs1,0,rs2);
+            break;
+        case OP_ADD:
+            if (funct7 == 0){
+                static const sim_op_t ops[8] = {SIM_ADD, SIM_SLL, SIM_SLT, SIM_SLTU, SIM_XOR, SIM_SRL, SIM_OR, SIM_AND};
+                set_op(s,ops[funct3],rd,rs1,rs2,0);
+            }
+            else if (funct7 == 1)
+                set_op(s,SIM_MUL + funct3,rd,rs1,rs2,0);
+            else if ((funct7 == 0x20) && (funct3 == 0))
+                set_op(s,SIM_SUB,rd,rs1,rs2,0);
+            else if ((funct7 == 0x20) && (funct3 == 5))
+                set_op(s,SIM_SRA,rd,rs1,rs2,0);
+            break;
+        case OP_ADDW:
+            if ((funct7 == 0) && (funct3 == 0)) set_op(s,SIM_ADDW,rd,rs1,rs2,0);
+            else if ((funct7 == 0x20) && (funct3 == 0)) set_op(s,SIM_SUBW,rd,rs1,rs2,0);
+            else if ((funct7 == 0) && (funct3 == 1)) set_op(s,SIM_SLLW,rd,rs1,rs2,0);
+            else if ((funct7 == 0) && (funct3 == 5)) set_op(s,SIM_SRLW,rd,rs1,rs2,0);
+            else if ((funct7 == 0x20) && (funct3 == 5)) set_op(s,SIM_SRAW,rd,rs1,rs2,0);
+            else if ((funct7 == 1) && (funct3 == 0)) set_op(s,SIM_MULW,rd,rs1,rs2,0);
+            else if ((funct7 == 1) && (funct3 >= 4)) set_op(s,SIM_DIVW + (funct3 - 4),rd,rs1,rs2,0);
+            break;
+        case OP_FENCE:
+            set_op(s,SIM_FENCE,0,0,0,0);
+            break;
+        case OP_ECALL:
+            if (w == 0x00000073)
+                set_op(s,SIM_ECALL,0,0,0,0);
+            else if (w == 0x00100073)
+                set_op(s,SIM_EBREAK,0,0,0,0);
+            else if ((funct3 != 0) && (funct3 != 4))
+                set_op(s,(funct3 < 4) ? SIM_CSRRW + (funct3 - 1) : SIM_CSRRWI + (funct3 - 5),rd,rs1,0,w >> 20);
+            break;
+        case OP_FLW:
+            /* the other widths are vector loads */
+            if (funct3 == 2) set_op(s,SIM_FLW,rd,rs1,0,imm_i);
+            else if (funct3 == 3) set_op(s,SIM_FLD,rd,rs1,0,imm_i);
+            break;
+        case OP_FSW:
+            if (funct3 == 2) set_op(s,SIM_FSW,0,rs1,rs2,imm_s);
+            else if (funct3 == 3) set_op(s,SIM_FSD,0,rs1,rs2,imm_s);
+            break;
+        case OP_FMADD_S: case OP_FMSUB_S: case OP_FNMSUB_S: case OP_FNMADD_S:
+            if ((funct7 & 3) <= 1){
+                set_op(s,((funct7 & 1) ? SIM_FMADD_D : SIM_FMADD_S) + ((opcode >> 2) & 3),rd,rs1,rs2,0);
+                s->rs3 = w >> 27;
+            }
+            break;
+        case OP_FADD_S:
+            decode_fp(s,rd,rs1,rs2,funct3,funct7);
+            break;
+        case OP_AMOADD_W: {
+            /* the aq and rl bits change nothing, every access is in order */
+            static const int funct7s[] = {F7_LR_W,F7_SC_W,F7_AMOSWAP_W,F7_AMOADD_W,F7_AMOXOR_W,F7_AMOAND_W,F7_AMOOR_W,
+                                          F7_AMOMIN_W,F7_AMOMAX_W,F7_AMOMINU_W,F7_AMOMAXU_W};
+            int i;
+            if ((funct3 != F3_AMOADD_W) && (funct3 != F3_AMOADD_D))
+                break;
+            for (i=0;i<(int)(sizeof(funct7s)/sizeof(funct7s[0]));i++){
+                if (((funct7 & ~3) == funct7s[i]) && ((i != 0) || (rs2 == 0)))
+                    set_op(s,((funct3 == F3_AMOADD_D) ? SIM_LR_D : SIM_LR_W) + i,rd,rs1,rs2,0);
+            }
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+/* expands a compressed instruction to the operation of its 32-bit form */
+static void decode16(sim_inst_t *s, uint32_t w){
+    int funct3 = (w >> 13) & 0x7;
+    int rd = (w >> 7) & 0x1f;
+    int rs2 = (w >> 2) & 0x1f;
+    int rdp = ((w >> 2) & 0x7) + 8;
+    int rs1p = ((w >> 7) & 0x7) + 8;
+    int64_t imm6 = sext((((w >> 12) & 1) << 5) | ((w >> 2) & 0x1f),6);
+    uint32_t uimm_d = (((w >> 10) & 0x7) << 3) | (((w >> 5) & 0x3) << 6);
+    uint32_t uimm_w = (((w >> 10) & 0x7) << 3) | (((w >> 6) & 1) << 2) | (((w >> 5) & 1) << 6);
+
+    s->size = 2;
+    s->op = SIM_ILLEGAL;
+    s->imm = w;
+    switch (((w & 0x3) << 3) | funct3){
+        case 0x00: /* c.addi4spn */
+            if (w != 0)
+                set_op(s,SIM_ADDI,rdp,2,0,(((w >> 6) & 1) << 2) | (((w >> 5) & 1) << 3) | (((w >> 11) & 0x3) << 4) | (((w >> 7) & 0xf) << 6));
+            if (s->imm == 0)
+                s->op = SIM_ILLEGAL;
+            break;
+        case 0x01: set_op(s,SIM_FLD,rdp,rs1p,0,uimm_d); break;
+        case 0x02: set_op(s,SIM_LW,rdp,rs1p,0,uimm_w); break;
+        case 0x03: set_op(s,SIM_LD,rdp,rs1p,0,uimm_d); break;
+        case 0x05: set_op(s,SIM_FSD,0,rs1p,rdp,uimm_d); break;
+        case 0x06: set_op(s,SIM_SW,0,rs1p,rdp,uimm_w); break;
+        case 0x07: set_op(s,SIM_SD,0,rs1p,rdp,uimm_d); break;
+
+        case 0x08: set_op(s,SIM_ADDI,rd,rd,0,imm6); break;
+        case 0x09: if (rd) set_op(s,SIM_ADDIW,rd,rd,0,imm6); break;
+        case 0x0a: set_op(s,SIM_ADDI,rd,0,0,imm6); break;
+        case 0x0b:
+            if (rd == 2)
+                set_op(s,SIM_ADDI,2,2,0,sext((((w >> 12) & 1) << 9) | (((w >> 6) & 1) << 4) | (((w >> 5) & 1) << 6) | (((w >> 3) & 0x3) << 7) | (((w >> 2) & 1) << 5),10));
+            else
+                set_op(s,SIM_LUI,rd,0,0,sext((((w >> 12) & 1) << 17) | (((w >> 2) & 0x1f) << 12),18));
+            if (s->imm == 0)
+                s->op = SIM_ILLEGAL;
+            break;
+        case 0x0c:
+            switch ((w >> 10) & 0x3){
+                case 0: set_op(s,SIM_SRLI,rs1p,rs1p,0,imm6 & 0x3f); break;
+                case 1: set_op(s,SIM_SRAI,rs1p,rs1p,0,imm6 & 0x3f); break;
+                case 2: set_op(s,SIM_ANDI,rs1p,rs1p,0,imm6); break;
+                case 3: {
+                    static const sim_op_t ops[8] = {SIM_SUB, SIM_XOR, SIM_OR, SIM_AND, SIM_SUBW, SIM_ADDW, SIM_ILLEGAL, SIM_ILLEGAL};
+                    set_op(s,ops[(((w >> 12) & 1) << 2) | ((w >> 5) & 0x3)],rs1p,rs1p,rdp,0);
+                    break;
+                }
+            }
+            break;
+        case 0x0d:
+            set_op(s,SIM_JAL,0,0,0,sext((((w >> 12) & 1) << 11) | (((w >> 11) & 1) << 4) | (((w >> 9) & 0x3) << 8) | (((w >> 8) & 1) << 10) | (((w >> 7) & 1) << 6) | (((w >> 6) & 1) << 7) | (((w >> 3) & 0x7) << 1) | (((w >> 2) & 1) << 5),12));
+            break;
+        case 0x0e: case 0x0f:
+            set_op(s,(funct3 == 6) ? SIM_BEQ : SIM_BNE,0,rs1p,0,sext((((w >> 12) & 1) << 8) | (((w >> 10) & 0x3) << 3) | (((w >> 5) & 0x3) << 6) | (((w >> 3) & 0x3) << 1) | (((w >> 2) & 1) << 5),9));
+            break;
+
+        case 0x10: set_op(s,SIM_SLLI,rd,rd,0,imm6 & 0x3f); break;
+        case 0x11: set_op(s,SIM_FLD,rd,2,0,(((w >> 12) & 1) << 5) | (((w >> 5) & 0x3) << 3) | (((w >> 2) & 0x7) << 6)); break;
+        case 0x12: if (rd) set_op(s,SIM_LW,rd,2,0,(((w >> 12) & 1) << 5) | (((w >> 4) & 0x7) << 2) | (((w >> 2) & 0x3) << 6)); break;
+        case 0x13: if (rd) set_op(s,SIM_LD,rd,2,0,(((w >> 12) & 1) << 5) | (((w >> 5) & 0x3) << 3) | (((w >> 2) & 0x7) << 6)); break;
+        case 0x14:
+            if (((w >> 12) & 1) == 0){
+                if (rs2 == 0){ if (rd) set_op(s,SIM_JALR,0,rd,0,0); } /* c.jr */
+                else set_op(s,SIM_ADD,rd,0,rs2,0);                    /* c.mv */
+            }
+            else {
+                if ((rd == 0) && (rs2 == 0)) set_op(s,SIM_EBREAK,0,0,0,0);
+                else if (rs2 == 0) set_op(s,SIM_JALR,1,rd,0,0);       /* c.jalr */
+                else set_op(s,SIM_ADD,rd,rd,rs2,0);                   /* c.add */
+            }
+            break;
+        case 0x15: set_op(s,SIM_FSD,0,2,rs2,(((w >> 10) & 0x7) << 3) | (((w >> 7) & 0x7) << 6)); break;
+        case 0x16: set_op(s,SIM_SW,0,2,rs2,(((w >> 9) & 0xf) << 2) | (((w >> 7) & 0x3) << 6)); break;
+        case 0x17: set_op(s,SIM_SD,0,2,rs2,(((w >> 10) & 0x7) << 3) | (((w >> 7) & 0x7) << 6)); break;
+        default:
+            break;
+    }
+}
+
+static void predecode(){
+    memblock_list_t *list;
+    int i = 0;
+
+    for (list=block_list;list;list=list->next)
+        code_block_count++;
+    code_blocks = (sim_code_t*) calloc(code_block_count,sizeof(sim_code_t));
+    if (!code_blocks) yyerror("-run: unable to allocate the decoded program");
+
+    for (list=block_list;list;list=list->next,i++){
+        sim_code_t *code = &code_blocks[i];
+        mem_entry_t *working;
+
+        code->base = list->min_address + SIM_LOAD_BIAS;
+        code->list = list;
+        for (working=list->head;working;working=working->next){
+            if (working->address + working->size - list->min_address > code->span)
+                code->span = working->address + working->size - list->min_address;
+        }
+        code->insts = (sim_inst_t*) calloc((code->span + 1) / 2 + 1,sizeof(sim_inst_t));
+        if (!code->insts) yyerror("-run: unable to allocate the decoded program");
+        code->insts[(code->span + 1) / 2].op = SIM_END;
+
+        for (working=list->head;working;working=working->next){
+            if ((working->type == ENTRY_INSTRUCTION) && !(working->address & 1)){
+                sim_inst_t *s = &code->insts[(working->address - list->min_address) >> 1];
+                if (working->size == 2)
+                    decode16(s,working->encoding & 0xffff);
+                else
+                    decode32(s,working->encoding);
+            }
+        }
+    }
+}
+
+static sim_code_t *code_at(uint64_t addr){
+    int i;
+    for (i=0;i<code_block_count;i++){
+        if ((addr - code_blocks[i].base) < code_blocks[i].span)
+            return &code_blocks[i];
+    }
+    return NULL;
+}
+
+static sim_code_t *find_code(uint64_t addr){
+    sim_code_t *code = code_at(addr);
+    char buff[100];
+
+    if (!code){
+        sprintf(buff,"jump to 0x%" PRIx64 ", outside the program,",addr);
+        sim_fault(buff);
+    }
+    return code;
+}
+
+/* Floating point ###########################################################*/
+
+static inline float get_s(int r){
+    uint32_t bits = SIM_CANONICAL_NAN_S;
+    float value;
+
+    if ((freg[r] >> 32) == 0xffffffff) /* anything not nan-boxed reads as the canonical nan */
+        bits = (uint32_t)freg[r];
+    memcpy(&value,&bits,sizeof(value));
+    return value;
+}
+
+static inline void set_s(int r, float value){
+    uint32_t bits;
+    memcpy(&bits,&value,sizeof(bits));
+    if (isnan(value))
+        bits = SIM_CANONICAL_NAN_S;
+    freg[r] = SIM_BOX_S | bits;
+}
+
+static inline double get_d(int r){
+    double value;
+    memcpy(&value,&freg[r],sizeof(value));
+    return value;
+}
+
+static inline void set_d(int r, double value){
+    memcpy(&freg[r],&value,sizeof(value));
+    if (isnan(value))
+        freg[r] = SIM_CANONICAL_NAN_D;
+}
+
+static inline uint32_t bits_s(int r){
+    return ((freg[r] >> 32) == 0xffffffff) ? (uint32_t)freg[r] : SIM_CANONICAL_NAN_S;
+}
+
+static double round_rm(double value, int rm){
+    switch ((rm == 7) ? (int)frm : rm){
+        case 1: return trunc(value);
+        case 2: return floor(value);
+        case 3: return ceil(value);
+        case 4: return round(value);
+        default: return nearbyint(value); /* the host runs round to nearest even */
+    }
+}
+
+static uint64_t cvt_signed(double value, int rm, int bits){
+    double max = ldexp(1.0,bits - 1);
+    double r = round_rm(value,rm);
+
+    if (isnan(value) || (r >= max))
+        return (bits == 32) ? (uint64_t)(int64_t)INT32_MAX : (uint64_t)INT64_MAX;
+    if (r < -max)
+        return (bits == 32) ? (uint64_t)(int64_t)INT32_MIN : (uint64_t)INT64_MIN;
+    return (bits == 32) ? (uint64_t)(int64_t)(int32_t)r : (uint64_t)(int64_t)r;
+}
+
+static uint64_t cvt_unsigned(double value, int rm, int bits){
+    double max = ldexp(1.0,bits);
+    double r = round_rm(value,rm);
+
+    if (isnan(value) || (r >= max))
+        return UINT64_MAX; /* the 32-bit maximum is sign extended too */
+    if (r <= 0.0)
+        return 0;
+    return (bits == 32) ? (uint64_t)(int64_t)(int32_t)(uint32_t)r : (uint64_t)r;
+}
+
+static double fmin_max(double a, double b, BOOL max){
+    if (isnan(a) && isnan(b)) return NAN;
+    if (isnan(a)) return b;
+    if (isnan(b)) return a;
+    if ((a == b) && (a == 0.0)) /* -0.0 is less than +0.0 */
+        return (signbit(a) == max) ? b : a;
+    if (max) return (a > b) ? a : b;
+    return (a < b) ? a : b;
+}
+
+static uint64_t fclass(BOOL negative, BOOL exp_max, BOOL exp_zero, BOOL mantissa_zero, BOOL quiet){
+    if (exp_max){
+        if (mantissa_zero) return negative ? 0x001 : 0x080;
+        return quiet ? 0x200 : 0x100;
+    }
+    if (exp_zero){
+        if (mantissa_zero) return negative ? 0x008 : 0x010;
+        return negative ? 0x004 : 0x020;
+    }
+    return negative ? 0x002 : 0x040;
+}
+
+/* System ###################################################################*/
+
+static uint64_t csr_read(uint32_t csr, uint64_t retired){
+    switch (csr){
+        case CSR_FFLAGS: return fflags;
+        case CSR_FRM: return frm;
+        case CSR_FCSR: return (frm << 5) | fflags;
+        case CSR_CYCLE: case CSR_TIME: case CSR_INSTRET:
+        case CSR_MCYCLE: case CSR_MINSTRET:
+            return retired; /* one instruction per cycle, and per tick */
+        case CSR_MHARTID:
+            return hart_id;
+        default:
+            return 0; /* the hpm counters never count */
+    }
+}
+
+static void csr_write(uint32_t csr, uint64_t value){
+    switch (csr){
+        case CSR_FFLAGS: fflags = value & 0x1f; break;
+        case CSR_FRM: frm = value & 0x7; break;
+        case CSR_FCSR: fflags = value & 0x1f; frm = (value >> 5) & 0x7; break;
+        default: break;
+    }
+}
+
+/* returns TRUE when the hart has exited, and sets *group when they all have */
+static BOOL sim_syscall(int *exit_code, BOOL *group){
+    uint64_t *a = &xreg[10];
+
+    switch (xreg[17]){
+        case SIM_SYS_WRITE: {
+            uint64_t i;
+            if ((a[0] != 1) && (a[0] != 2)){
+                a[0] = -SIM_EBADF;
+                break;
+            }
+            for (i=0;i<a[2];){
+                uint8_t *page = sim_page(a[1] + i);
+                uint64_t offset = (a[1] + i) & SIM_PAGE_MASK;
+                uint64_t chunk = SIM_PAGE_SIZE - offset;
+                if (chunk > a[2] - i) chunk = a[2] - i;
+                if (write(a[0],page + offset,chunk) != (ssize_t)chunk)
+                    break;
+                i += chunk;
+            }
+            a[0] = i;
+            break;
+        }
+        case SIM_SYS_EXIT:
+        case SIM_SYS_EXIT_GROUP:
+            *exit_code = (int)(a[0] & 0xff);
+            *group = (xreg[17] == SIM_SYS_EXIT_GROUP);
+            return TRUE;
+        case SIM_SYS_BRK:
+            if ((a[0] >= brk_start) && (a[0] < SIM_STACK_TOP - (1ULL << 30)))
+                brk_current = a[0];
+            a[0] = brk_current;
+            break;
+        default:
+            a[0] = -SIM_ENOSYS;
+            break;
+    }
+    return FALSE;
+}
+
+/* Execute ##################################################################*/
+
+/* the slot for a jump target in another block */
+static sim_inst_t *jump_far(sim_code_t **code, uint64_t target, uint64_t from){
+    fault_pc = from;
+    *code = find_code(target);
+    return &(*code)->insts[(target - (*code)->base) >> 1];
+}
+
+/* the pc of the slot being executed, only worked out by the instructions that need it */
+#define SIM_PC (code->base + ((uint64_t)(in - code->insts) << 1))
+
+#define SIM_JUMP(target) \
+    do { \
+        uint64_t target_ = (target); \
+        if ((target_ - code->base) < code->span) \
+            next = &code->insts[(target_ - code->base) >> 1]; \
+        else \
+            next = jump_far(&code,target_,SIM_PC); \
+    } while (0)
+
+/* the atomics fault on a misaligned address */
+#define SIM_ALIGNED(addr, size) \
+    do { \
+        if ((addr) & ((size) - 1)){ \
+            fault_pc = SIM_PC; \
+            sim_fault("misaligned atomic access"); \
+        } \
+    } while (0)
+
+/* rd = the old value, sign extended, and [rs1] = op of it (a) and rs2 (b) */
+#define SIM_AMO(bits, op) \
+    do { \
+        uint64_t addr_ = x[in->rs1]; \
+        int##bits##_t a, b = (int##bits##_t)x[in->rs2]; \
+        SIM_ALIGNED(addr_,bits/8); \
+        a = (int##bits##_t)load##bits(addr_); \
+        store##bits(addr_,(uint##bits##_t)(op)); \
+        x[in->rd] = (int64_t)a; \
+    } while (0)
+
+/* 
+   runs the current hart from *pc until it exits, or until its retired 
+   count reaches limit, when *pc is left where it stopped -- returns TRUE 
+   if it exited
+*/
+static BOOL execute(uint64_t *pc_at, uint64_t *retired_at, uint64_t limit, int *exit_code, BOOL *group){
+    sim_code_t *code;
+    sim_inst_t *in;
+    uint64_t *x = xreg;
+    uint64_t retired = *retired_at;
+
+    fault_pc = *pc_at;
+    reservation = SIM_NO_RESERVATION;
+    code = find_code(fault_pc);
+    in = &code->insts[(fault_pc - code->base) >> 1];
+
+    for (;;){
+        sim_inst_t *next = in + (in->size >> 1);
+
+        if (retired == limit){
+            *pc_at = SIM_PC;
+            *retired_at = retired;
+            return FALSE;
+        }
+
+        in->count++;
+        retired++;
+
+        switch (in->op){
+            case SIM_LUI: x[in->rd] = in->imm; break;
+            case SIM_AUIPC: x[in->rd] = SIM_PC + in->imm; break;
+            case SIM_JAL: x[in->rd] = SIM_PC + in->size; SIM_JUMP(SIM_PC + in->imm); break;
+            case SIM_JALR: {
+                uint64_t target = (x[in->rs1] + in->imm) & ~(uint64_t)1;
+                x[in->rd] = SIM_PC + in->size;
+                SIM_JUMP(target);
+                break;
+            }
+            case SIM_BEQ: if (x[in->rs1] == x[in->rs2]) SIM_JUMP(SIM_PC + in->imm); break;
+            case SIM_BNE: if (x[in->rs1] != x[in->rs2]) SIM_JUMP(SIM_PC + in->imm); break;
+            case SIM_BLT: if ((int64_t)x[in->rs1] < (int64_t)x[in->rs2]) SIM_JUMP(SIM_PC + in->imm); break;
+            case SIM_BGE: if ((int64_t)x[in->rs1] >= (int64_t)x[in->rs2]) SIM_JUMP(SIM_PC + in->imm); break;
+            case SIM_BLTU: if (x[in->rs1] < x[in->rs2]) SIM_JUMP(SIM_PC + in->imm); break;
+            case SIM_BGEU: if (x[in->rs1] >= x[in->rs2]) SIM_JUMP(SIM_PC + in->imm); break;
+
+            case SIM_LB: x[in->rd] = (int64_t)(int8_t)load8(x[in->rs1] + in->imm); break;
+            case SIM_LH: x[in->rd] = (int64_t)(int16_t)load16(x[in->rs1] + in->imm); break;
+            case SIM_LW: x[in->rd] = (int64_t)(int32_t)load32(x[in->rs1] + in->imm); break;
+            case SIM_LD: x[in->rd] = load64(x[in->rs1] + in->imm); break;
+            case SIM_LBU: x[in->rd] = load8(x[in->rs1] + in->imm); break;
+            case SIM_LHU: x[in->rd] = load16(x[in->rs1] + in->imm); break;
+            case SIM_LWU: x[in->rd] = load32(x[in->rs1] + in->imm); break;
+            case SIM_SB: store8(x[in->rs1] + in->imm,x[in->rs2]); break;
+            case SIM_SH: store16(x[in->rs1] + in->imm,x[in->rs2]); break;
+            case SIM_SW: store32(x[in->rs1] + in->imm,x[in->rs2]); break;
+            case SIM_SD: store64(x[in->rs1] + in->imm,x[in->rs2]); break;
+
+            case SIM_ADDI: x[in->rd] = x[in->rs1] + in->imm; break;
+            case SIM_SLTI: x[in->rd] = (int64_t)x[in->rs1] < in->imm; break;
+            case SIM_SLTIU: x[in->rd] = x[in->rs1] < (uint64_t)in->imm; break;
+            case SIM_XORI: x[in->rd] = x[in->rs1] ^ in->imm; break;
+            case SIM_ORI: x[in->rd] = x[in->rs1] | in->imm; break;
+            case SIM_ANDI: x[in->rd] = x[in->rs1] & in->imm; break;
+            case SIM_SLLI: x[in->rd] = x[in->rs1] << in->imm; break;
+            case SIM_SRLI: x[in->rd] = x[in->rs1] >> in->imm; break;
+            case SIM_SRAI: x[in->rd] = (int64_t)x[in->rs1] >> in->imm; break;
+            case SIM_ADDIW: x[in->rd] = (int64_t)(int32_t)(x[in->rs1] + in->imm); break;
+            case SIM_SLLIW: x[in->rd] = (int64_t)(int32_t)((uint32_t)x[in->rs1] << in->imm); break;
+            case SIM_SRLIW: x[in->rd] = (int64_t)(int32_t)((uint32_t)x[in->rs1] >> in->imm); break;
+            case SIM_SRAIW: x[in->rd] = (int64_t)((int32_t)x[in->rs1] >> in->imm); break;
+
+            case SIM_ADD: x[in->rd] = x[in->rs1] + x[in->rs2]; break;
+            case SIM_SUB: x[in->rd] = x[in->rs1] - x[in->rs2]; break;
+            case SIM_SLL: x[in->rd] = x[in->rs1] << (x[in->rs2] & 0x3f); break;
+            case SIM_SLT: x[in->rd] = (int64_t)x[in->rs1] < (int64_t)x[in->rs2]; break;
+            case SIM_SLTU: x[in->rd] = x[in->rs1] < x[in->rs2]; break;
+            case SIM_XOR: x[in->rd] = x[in->rs1] ^ x[in->rs2]; break;
+            case SIM_SRL: x[in->rd] = x[in->rs1] >> (x[in->rs2] & 0x3f); break;
+            case SIM_SRA: x[in->rd] = (int64_t)x[in->rs1] >> (x[in->rs2] & 0x3f); break;
+            case SIM_OR: x[in->rd] = x[in->rs1] | x[in->rs2]; break;
+            case SIM_AND: x[in->rd] = x[in->rs1] & x[in->rs2]; break;
+            case SIM_ADDW: x[in->rd] = (int64_t)(int32_t)(x[in->rs1] + x[in->rs2]); break;
+            case SIM_SUBW: x[in->rd] = (int64_t)(int32_t)(x[in->rs1] - x[in->rs2]); break;
+            case SIM_SLLW: x[in->rd] = (int64_t)(int32_t)((uint32_t)x[in->rs1] << (x[in->rs2] & 0x1f)); break;
+            case SIM_SRLW: x[in->rd] = (int64_t)(int32_t)((uint32_t)x[in->rs1] >> (x[in->rs2] & 0x1f)); break;
+            case SIM_SRAW: x[in->rd] = (int64_t)((int32_t)x[in->rs1] >> (x[in->rs2] & 0x1f)); break;
+
+            case SIM_MUL: x[in->rd] = x[in->rs1] * x[in->rs2]; break;
+            case SIM_MULH: x[in->rd] = ((__int128)(int64_t)x[in->rs1] * (__int128)(int64_t)x[in->rs2]) >> 64; break;
+            case SIM_MULHSU: x[in->rd] = ((__int128)(int64_t)x[in->rs1] * (__int128)x[in->rs2]) >> 64; break;
+            case SIM_MULHU: x[in->rd] = ((unsigned __int128)x[in->rs1] * (unsigned __int128)x[in->rs2]) >> 64; break;
+            case SIM_DIV: {
+                int64_t a = x[in->rs1], b = x[in->rs2];
+                x[in->rd] = (b == 0) ? (uint64_t)-1 : ((a == INT64_MIN) && (b == -1)) ? (uint64_t)a : (uint64_t)(a / b);
+                break;
+            }
+            case SIM_DIVU: x[in->rd] = (x[in->rs2] == 0) ? UINT64_MAX : x[in->rs1] / x[in->rs2]; break;
+            case SIM_REM: {
+                int64_t a = x[in->rs1], b = x[in->rs2];
+                x[in->rd] = (b == 0) ? (uint64_t)a : ((a == INT64_MIN) && (b == -1)) ? 0 : (uint64_t)(a % b);
+                break;
+            }
+            case SIM_REMU: x[in->rd] = (x[in->rs2] == 0) ? x[in->rs1] : x[in->rs1] % x[in->rs2]; break;
+            case SIM_MULW: x[in->rd] = (int64_t)(int32_t)(x[in->rs1] * x[in->rs2]); break;
+            case SIM_DIVW: {
+                int32_t a = x[in->rs1], b = x[in->rs2];
+                x[in->rd] = (int64_t)((b == 0) ? -1 : ((a == INT32_MIN) && (b == -1)) ? a : a / b);
+                break;
+            }
+            case SIM_DIVUW: {
+                uint32_t a = x[in->rs1], b = x[in->rs2];
+                x[in->rd] = (int64_t)(int32_t)((b == 0) ? UINT32_MAX : a / b);
+                break;
+            }
+            case SIM_REMW: {
+                int32_t a = x[in->rs1], b = x[in->rs2];
+                x[in->rd] = (int64_t)((b == 0) ? a : ((a == INT32_MIN) && (b == -1)) ? 0 : a % b);
+                break;
+            }
+            case SIM_REMUW: {
+                uint32_t a = x[in->rs1], b = x[in->rs2];
+                x[in->rd] = (int64_t)(int32_t)((b == 0) ? a : a % b);
+                break;
+            }
+
+            case SIM_FENCE: break;
+            case SIM_ECALL:
+                if (sim_syscall(exit_code,group)){
+                    *retired_at = retired;
+                    return TRUE;
+                }
+                break;
+            case SIM_EBREAK:
+                fault_pc = SIM_PC;
+                sim_fault("ebreak");
+                break;
+            case SIM_CSRRW: case SIM_CSRRS: case SIM_CSRRC:
+            case SIM_CSRRWI: case SIM_CSRRSI: case SIM_CSRRCI: {
+                uint64_t old = csr_read(in->imm,retired);
+                uint64_t value = (in->op >= SIM_CSRRWI) ? in->rs1 : x[in->rs1];
+                switch (in->op){
+                    case SIM_CSRRW: case SIM_CSRRWI: csr_write(in->imm,value); break;
+                    case SIM_CSRRS: case SIM_CSRRSI: if (in->rs1) csr_write(in->imm,old | value); break;
+                    default: if (in->rs1) csr_write(in->imm,old & ~value); break;
+                }
+                x[in->rd] = old;
+                break;
+            }
+
+            case SIM_FLW: freg[in->rd] = SIM_BOX_S | load32(x[in->rs1] + in->imm); break;
+            case SIM_FLD: freg[in->rd] = load64(x[in->rs1] + in->imm); break;
+            case SIM_FSW: store32(x[in->rs1] + in->imm,(uint32_t)freg[in->rs2]); break;
+            case SIM_FSD: store64(x[in->rs1] + in->imm,freg[in->rs2]); break;
+
+            case SIM_FMADD_S: set_s(in->rd,fmaf(get_s(in->rs1),get_s(in->rs2),get_s(in->rs3))); break;
+            case SIM_FMSUB_S: set_s(in->rd,fmaf(get_s(in->rs1),get_s(in->rs2),-get_s(in->rs3))); break;
+            case SIM_FNMSUB_S: set_s(in->rd,fmaf(-get_s(in->rs1),get_s(in->rs2),get_s(in->rs3))); break;
+            case SIM_FNMADD_S: set_s(in->rd,fmaf(-get_s(in->rs1),get_s(in->rs2),-get_s(in->rs3))); break;
+            case SIM_FMADD_D: set_d(in->rd,fma(get_d(in->rs1),get_d(in->rs2),get_d(in->rs3))); break;
+            case SIM_FMSUB_D: set_d(in->rd,fma(get_d(in->rs1),get_d(in->rs2),-get_d(in->rs3))); break;
+            case SIM_FNMSUB_D: set_d(in->rd,fma(-get_d(in->rs1),get_d(in->rs2),get_d(in->rs3))); break;
+            case SIM_FNMADD_D: set_d(in->rd,fma(-get_d(in->rs1),get_d(in->rs2),-get_d(in->rs3))); break;
+
+            case SIM_FADD_S: set_s(in->rd,get_s(in->rs1) + get_s(in->rs2)); break;
+            case SIM_FSUB_S: set_s(in->rd,get_s(in->rs1) - get_s(in->rs2)); break;
+            case SIM_FMUL_S: set_s(in->rd,get_s(in->rs1) * get_s(in->rs2)); break;
+            case SIM_FDIV_S: set_s(in->rd,get_s(in->rs1) / get_s(in->rs2)); break;
+            case SIM_FSQRT_S: set_s(in->rd,sqrtf(get_s(in->rs1))); break;
+            case SIM_FSGNJ_S: freg[in->rd] = SIM_BOX_S | (bits_s(in->rs1) & 0x7fffffff) | (bits_s(in->rs2) & 0x80000000); break;
+            case SIM_FSGNJN_S: freg[in->rd] = SIM_BOX_S | (bits_s(in->rs1) & 0x7fffffff) | (~bits_s(in->rs2) & 0x80000000); break;
+            case SIM_FSGNJX_S: freg[in->rd] = SIM_BOX_S | (bits_s(in->rs1) ^ (bits_s(in->rs2) & 0x80000000)); break;
+            case SIM_FMIN_S: set_s(in->rd,fmin_max(get_s(in->rs1),get_s(in->rs2),FALSE)); break;
+            case SIM_FMAX_S: set_s(in->rd,fmin_max(get_s(in->rs1),get_s(in->rs2),TRUE)); break;
+            case SIM_FEQ_S: x[in->rd] = get_s(in->rs1) == get_s(in->rs2); break;
+            case SIM_FLT_S: x[in->rd] = get_s(in->rs1) < get_s(in->rs2); break;
+            case SIM_FLE_S: x[in->rd] = get_s(in->rs1) <= get_s(in->rs2); break;
+            case SIM_FCLASS_S: {
+                uint32_t b = bits_s(in->rs1);
+                x[in->rd] = fclass(b >> 31,((b >> 23) & 0xff) == 0xff,((b >> 23) & 0xff) == 0,(b & 0x7fffff) == 0,(b >> 22) & 1);
+                break;
+            }
+            case SIM_FCVT_W_S: x[in->rd] = cvt_signed(get_s(in->rs1),in->rm,32); break;
+            case SIM_FCVT_WU_S: x[in->rd] = cvt_unsigned(get_s(in->rs1),in->rm,32); break;
+            case SIM_FCVT_L_S: x[in->rd] = cvt_signed(get_s(in->rs1),in->rm,64); break;
+            case SIM_FCVT_LU_S: x[in->rd] = cvt_unsigned(get_s(in->rs1),in->rm,64); break;
+            case SIM_FCVT_S_W: set_s(in->rd,(float)(int32_t)x[in->rs1]); break;
+            case SIM_FCVT_S_WU: set_s(in->rd,(float)(uint32_t)x[in->rs1]); break;
+            case SIM_FCVT_S_L: set_s(in->rd,(float)(int64_t)x[in->rs1]); break;
+            case SIM_FCVT_S_LU: set_s(in->rd,(float)x[in->rs1]); break;
+            case SIM_FMV_X_W: x[in->rd] = (int64_t)(int32_t)freg[in->rs1]; break;
+            case SIM_FMV_W_X: freg[in->rd] = SIM_BOX_S | (uint32_t)x[in->rs1]; break;
+
+            case SIM_FADD_D: set_d(in->rd,get_d(in->rs1) + get_d(in->rs2)); break;
+            case SIM_FSUB_D: set_d(in->rd,get_d(in->rs1) - get_d(in->rs2)); break;
+            case SIM_FMUL_D: set_d(in->rd,get_d(in->rs1) * get_d(in->rs2)); break;
+            case SIM_FDIV_D: set_d(in->rd,get_d(in->rs1) / get_d(in->rs2)); break;
+            case SIM_FSQRT_D: set_d(in->rd,sqrt(get_d(in->rs1))); break;
+            case SIM_FSGNJ_D: freg[in->rd] = (freg[in->rs1] & ~(1ULL << 63)) | (freg[in->rs2] & (1ULL << 63)); break;
+            case SIM_FSGNJN_D: freg[in->rd] = (freg[in->rs1] & ~(1ULL << 63)) | (~freg[in->rs2] & (1ULL << 63)); break;
+            case SIM_FSGNJX_D: freg[in->rd] = freg[in->rs1] ^ (freg[in->rs2] & (1ULL << 63)); break;
+            case SIM_FMIN_D: set_d(in->rd,fmin_max(get_d(in->rs1),get_d(in->rs2),FALSE)); break;
+            case SIM_FMAX_D: set_d(in->rd,fmin_max(get_d(in->rs1),get_d(in->rs2),TRUE)); break;
+            case SIM_FEQ_D: x[in->rd] = get_d(in->rs1) == get_d(in->rs2); break;
+            case SIM_FLT_D: x[in->rd] = get_d(in->rs1) < get_d(in->rs2); break;
+            case SIM_FLE_D: x[in->rd] = get_d(in->rs1) <= get_d(in->rs2); break;
+            case SIM_FCLASS_D: {
+                uint64_t b = freg[in->rs1];
+                x[in->rd] = fclass(b >> 63,((b >> 52) & 0x7ff) == 0x7ff,((b >> 52) & 0x7ff) == 0,(b & 0xfffffffffffffULL) == 0,(b >> 51) & 1);
+                break;
+            }
+            case SIM_FCVT_W_D: x[in->rd] = cvt_signed(get_d(in->rs1),in->rm,32); break;
+            case SIM_FCVT_WU_D: x[in->rd] = cvt_unsigned(get_d(in->rs1),in->rm,32); break;
+            case SIM_FCVT_L_D: x[in->rd] = cvt_signed(get_d(in->rs1),in->rm,64); break;
+            case SIM_FCVT_LU_D: x[in->rd] = cvt_unsigned(get_d(in->rs1),in->rm,64); break;
+            case SIM_FCVT_D_W: set_d(in->rd,(double)(int32_t)x[in->rs1]); break;
+            case SIM_FCVT_D_WU: set_d(in->rd,(double)(uint32_t)x[in->rs1]); break;
+            case SIM_FCVT_D_L: set_d(in->rd,(double)(int64_t)x[in->rs1]); break;
+            case SIM_FCVT_D_LU: set_d(in->rd,(double)x[in->rs1]); break;
+            case SIM_FMV_X_D: x[in->rd] = freg[in->rs1]; break;
+            case SIM_FMV_D_X: freg[in->rd] = x[in->rs1]; break;
+            case SIM_FCVT_S_D: set_s(in->rd,(float)get_d(in->rs1)); break;
+            case SIM_FCVT_D_S: set_d(in->rd,(double)get_s(in->rs1)); break;
+
+            case SIM_LR_W: SIM_ALIGNED(x[in->rs1],4); reservation = x[in->rs1]; x[in->rd] = (int64_t)(int32_t)load32(reservation); break;
+            case SIM_LR_D: SIM_ALIGNED(x[in->rs1],8); reservation = x[in->rs1]; x[in->rd] = load64(reservation); break;
+            case SIM_SC_W:
+            case SIM_SC_D: {
+                uint64_t addr = x[in->rs1];
+                SIM_ALIGNED(addr,(in->op == SIM_SC_D) ? 8 : 4);
+                if (addr == reservation){
+                    if (in->op == SIM_SC_D)
+                        store64(addr,x[in->rs2]);
+                    else
+                        store32(addr,(uint32_t)x[in->rs2]);
+                }
+                x[in->rd] = (addr != reservation);
+                reservation = SIM_NO_RESERVATION;
+                break;
+            }
+            case SIM_AMOSWAP_W: SIM_AMO(32,b); break;
+            case SIM_AMOADD_W: SIM_AMO(32,(uint32_t)a + (uint32_t)b); break;
+            case SIM_AMOXOR_W: SIM_AMO(32,a ^ b); break;
+            case SIM_AMOAND_W: SIM_AMO(32,a & b); break;
+            case SIM_AMOOR_W: SIM_AMO(32,a | b); break;
+            case SIM_AMOMIN_W: SIM_AMO(32,(a < b) ? a : b); break;
+            case SIM_AMOMAX_W: SIM_AMO(32,(a > b) ? a : b); break;
+            case SIM_AMOMINU_W: SIM_AMO(32,((uint32_t)a < (uint32_t)b) ? a : b); break;
+            case SIM_AMOMAXU_W: SIM_AMO(32,((uint32_t)a > (uint32_t)b) ? a : b); break;
+            case SIM_AMOSWAP_D: SIM_AMO(64,b); break;
+            case SIM_AMOADD_D: SIM_AMO(64,(uint64_t)a + (uint64_t)b); break;
+            case SIM_AMOXOR_D: SIM_AMO(64,a ^ b); break;
+            case SIM_AMOAND_D: SIM_AMO(64,a & b); break;
+            case SIM_AMOOR_D: SIM_AMO(64,a | b); break;
+            case SIM_AMOMIN_D: SIM_AMO(64,(a < b) ? a : b); break;
+            case SIM_AMOMAX_D: SIM_AMO(64,(a > b) ? a : b); break;
+            case SIM_AMOMINU_D: SIM_AMO(64,((uint64_t)a < (uint64_t)b) ? a : b); break;
+            case SIM_AMOMAXU_D: SIM_AMO(64,((uint64_t)a > (uint64_t)b) ? a : b); break;
+
+            case SIM_END:
+                /* not an instruction, the slot just past the end of the block */
+                in->count--;
+                retired--;
+                fault_pc = SIM_PC;
+                if (!code_at(fault_pc))
+                    sim_fault("execution ran past the end of its mem() block");
+                SIM_JUMP(fault_pc);
+                break;
+
+            default: {
+                char buff[100];
+                fault_pc = SIM_PC;
+                if ((in != code->insts) && (in[-1].size == 4))
+                    sim_fault("execution reached the middle of an instruction");
+                if (in->size == 0)
+                    sim_fault("execution reached data");
+                sprintf(buff,"illegal or unsupported instruction 0x%0*" PRIx64,2 * in->size,(uint64_t)in->imm);
+                sim_fault(buff);
+                break;
+            }
+        }
+        x[0] = 0;
+        in = next;
+    }
+}
+
+/* Report ###################################################################*/
+
+static BOOL is_user_label(mem_entry_t *entry){
+    return entry->name && (entry->type != ENTRY_DEFINITION) && strncmp(entry->name,"__",2);
+}
+
+static void report_label(const char *name, uint64_t count){
+    if (count)
+        fprintf(stderr,"    %-32s %12" PRIu64 "\n",name,count);
+}
+
+/* instructions are charged to the closest label before them */
+static void report_labels(){
+    int i;
+
+    fprintf(stderr,"\nInstructions retired by label:\n");
+    for (i=0;i<code_block_count;i++){
+        sim_code_t *code = &code_blocks[i];
+        mem_entry_t *working;
+        char name[64];
+        uint64_t count = 0;
+
+        sprintf(name,"<0x%08" PRIx64 ">",code->list->min_address);
+        for (working=code->list->head;working;working=working->next){
+            if (is_user_label(working)){
+                report_label(name,count);
+                snprintf(name,sizeof(name),"%s",working->name);
+                count = 0;
+            }
+            if ((working->type == ENTRY_INSTRUCTION) && !(working->address & 1))
+                count += code->insts[(working->address - code->list->min_address) >> 1].count;
+        }
+        report_label(name,count);
+    }
+}
+
+static void report_registers(sim_hart_t *hart, int64_t id){
+    int i;
+    BOOL fp_used = FALSE;
+
+    if (harts > 1)
+        fprintf(stderr,"\nRegisters, hart %" PRId64 ":\n",id);
+    else
+        fprintf(stderr,"\nRegisters:\n");
+    for (i=0;i<32;i++){
+        fprintf(stderr,"%sx%-2d 0x%016" PRIx64 "%s",(i % 4) ? "  " : "    ",i,hart->xreg[i],((i % 4) == 3) ? "\n" : "");
+        if (hart->freg[i])
+            fp_used = TRUE;
+    }
+    if (!fp_used)
+        return;
+    for (i=0;i<32;i++)
+        fprintf(stderr,"%sf%-2d 0x%016" PRIx64 "%s",(i % 4) ? "  " : "    ",i,hart->freg[i],((i % 4) == 3) ? "\n" : "");
+}
+
+static double seconds_now(){
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC,&now);
+    return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+/* runs the program until it exits, and returns its exit code */
+int simulate_memblocks(){
+    int exit_code = 0;
+    uint64_t retired = 0;
+    int64_t running = harts;
+    int64_t i;
+    double start, elapsed;
+
+    predecode();
+    load_image();
+    hart_state = (sim_hart_t*)calloc(harts,sizeof(sim_hart_t));
+    if (!hart_state) yyerror("-run: unable to allocate the harts");
+    for (i=0;i<harts;i++){
+        hart_state[i].pc = pc + SIM_LOAD_BIAS;
+        hart_state[i].xreg[2] = SIM_STACK_TOP - SIM_STACK_FRAME;
+    }
+
+    fflush(stdout); /* the program writes straight to the file descriptors */
+    start = seconds_now();
+    while (running){
+        for (i=0;(i<harts) && running;i++){
+            sim_hart_t *hart = &hart_state[i];
+            uint64_t limit = (harts > 1) ? hart->retired + SIM_QUANTUM : UINT64_MAX;
+            BOOL group = FALSE;
+
+            if (hart->exited)
+                continue;
+            hart_id = i;
+            memcpy(xreg,hart->xreg,sizeof(xreg));
+            memcpy(freg,hart->freg,sizeof(freg));
+            hart->exited = execute(&hart->pc,&hart->retired,limit,&exit_code,&group);
+            memcpy(hart->xreg,xreg,sizeof(xreg));
+            memcpy(hart->freg,freg,sizeof(freg));
+            if (hart->exited)
+                running = group ? 0 : running - 1;
+        }
+    }
+    elapsed = seconds_now() - start;
+    for (i=0;i<harts;i++)
+        retired += hart_state[i].retired;
+
+    fprintf(stderr,"\nSimulation: exit code %d, %" PRIu64 " instructions retired\n",exit_code,retired);
+    fprintf(stderr,"Simulation speed: %.1f MIPS (%.3f s)\n",(elapsed > 0) ? retired / elapsed / 1e6 : 0.0,elapsed);
+    report_labels();
+    for (i=0;i<harts;i++)
+        report_registers(&hart_state[i],i);
+    free(hart_state);
+
+    return exit_code;
+}
@@ -0,0 +1,287 @@
+/* This file is part of the DuctTape (dt) high-level assembler for 
+ * RISC-V. The dt project was written by Justin Severeid and Elliott 
+ * Forbes, University of Wisconsin-La Crosse, copyright 2020-2024.
+ *
+ * DuctTape is free software: you can redistribute it and/or modify 
+ * it under the terms of the GNU General Public License as published 
+ * by the Free Software Foundation, either version 3 of the License, 
+ * or (at your option) any later version.
+ *
+ * DuctTape is distributed in the hope that it will be useful, but 
+ * WITHOUT ANY WARRANTY; without even the implied warranty of 
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU 
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License 
+ * along with DuctTape. If not, see <https://www.gnu.org/licenses/>. 
+ *
+ *
+ *
+ * The dt project can be found at https://cs.uwlax.edu/~eforbes/dt/
+ *
+ * If you use dt in your published research, please consider 
+ * citing the following:
+ *
+ * Severeid, J. and Forbes, E., "dt: A High-level Assembler for RISC-V," 
+ * Proceedings of the 53rd Midwest Instruction and Computing Symposium, 
+ * April 2020. 
+ *
+ * If you found dt helpful, please let us know! Email eforbes@uwlax.edu
+ *
+ * There are bound to be bugs, let us know those too.
+ */
+
+
+/*
+ * -time: how long each phase of main() took, on a monotonic clock, with 
+ * the lines and instructions assembled per second and the peak resident 
+ * set size. Every phase is always timed, it costs two clock reads, and 
+ * the report is only printed when it is asked for.
+ *
+ * -stats adds the size of what was built: entries by type, the symbol 
+ * table's occupancy and probe counts, bytes allocated for the IR, and 
+ * bytes written. -trace-json writes the same data as a Chrome trace 
+ * event file, for chrome://tracing or Perfetto.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <time.h>
+#include <sys/resource.h>
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+#include "stats.h"
+#include "include.h"
+#include "stream.h"
+#include "mem.h"
+#include "output.h"
+#include "symtab.h"
+#include "util.h"
+
+typedef struct phase_type {
+    char *name;
+    double start;    /* seconds since the first phase began */
+    double seconds;
+    uint64_t lines;  /* source lines, for the parse phases */
+    struct phase_type *next;
+} phase_t;
+
+static phase_t *phases = NULL;
+static phase_t *last_phase = NULL;
+static double phase_start;
+static double first_start = -1;
+
+static double seconds_now(){
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC,&now);
+    return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+void phase_begin(const char *name){
+    phase_t *phase = (phase_t*) malloc(sizeof(phase_t));
+    if (!phase) yyerror("Unable to allocate memory for phase timing");
+
+    phase->name = strdup(name);
+    phase->seconds = 0;
+    phase->lines = 0;
+    phase->next = NULL;
+    if (last_phase)
+        last_phase->next = phase;
+    else
+        phases = phase;
+    last_phase = phase;
+    phase_start = seconds_now();
+    if (first_start < 0)
+        first_start = phase_start;
+    phase->start = phase_start - first_start;
+}
+
+/* lines is the number of source lines the phase read, zero for the later phases */
+void phase_end(uint64_t lines){
+    last_phase->seconds = seconds_now() - phase_start;
+    last_phase->lines = lines;
+}
+
+static uint64_t count_instructions(){
+    memblock_list_t *list;
+    mem_entry_t *working;
+    uint64_t count = 0;
+
+    for (list=block_list;list;list=list->next){
+        for (working=list->head;working;working=working->next){
+            if (working->type == ENTRY_INSTRUCTION)
+                count++;
+        }
+    }
+    return count;
+}
+
+void print_phase_times(){
+    phase_t *phase;
+    struct rusage usage;
+    double total = 0;
+    uint64_t lines = 0;
+    uint64_t insts = count_instructions();
+
+    fprintf(stderr,"\nPhase times:\n");
+    for (phase=phases;phase;phase=phase->next){
+        fprintf(stderr,"    %-40s %10.6f s",phase->name,phase->seconds);
+        if (phase->lines)
+            fprintf(stderr,"  %" PRIu64 " lines",phase->lines);
+        fprintf(stderr,"\n");
+        total += phase->seconds;
+        lines += phase->lines;
+    }
+    fprintf(stderr,"    %-40s %10.6f s\n","total",total);
+
+    fprintf(stderr,"Throughput: %" PRIu64 " lines, %" PRIu64 " instructions, %.0f lines/s, %.0f instructions/s\n",
+        lines,insts,(total > 0) ? lines / total : 0.0,(total > 0) ? insts / total : 0.0);
+    getrusage(RUSAGE_SELF,&usage);
+    fprintf(stderr,"Peak RSS: %ld KB\n",usage.ru_maxrss); /* kilobytes on Linux */
+}
+
+static const char *entry_type_names[] = {
+    "definition",
+    "join node",
+    "instruction",
+    "byte data",
+    "half data",
+    "word data",
+    "long data",
+    "float data",
+    "double data",
+    "string data",
+    "incbin data",
+    "data list",
+    "data run",
+    "generated data"
+};
+#define NUM_ENTRY_TYPES ((int)(sizeof(entry_type_names) / sizeof(entry_type_names[0])))
+
+static void count_entries(uint64_t *counts){
+    memblock_list_t *list;
+    mem_entry_t *working;
+    int i;
+
+    for (i=0;i<NUM_ENTRY_TYPES;i++)
+        counts[i] = 0;
+    for (list=block_list;list;list=list->next){
+        for (working=list->head;working;working=working->next){
+            if (working->type < NUM_ENTRY_TYPES)
+                counts[working->type]++;
+        }
+    }
+}
+
+/* bytes malloc has handed out and not had back, zero where that can't be asked */
+static uint64_t heap_in_use(){
+#if defined(__GLIBC__) && ((__GLIBC__ > 2) || (__GLIBC_MINOR__ >= 33))
+    struct mallinfo2 info = mallinfo2();
+    return info.uordblks + info.hblkhd;
+#else
+    return 0;
+#endif
+}
+
+void print_stats(){
+    uint64_t counts[NUM_ENTRY_TYPES];
+    uint64_t total = 0;
+    symtab_stats_t symtab;
+    int i;
+
+    print_phase_times();
+
+    count_entries(counts);
+    fprintf(stderr,"\nEntries:\n");
+    for (i=0;i<NUM_ENTRY_TYPES;i++){
+        fprintf(stderr,"    %-40s %12" PRIu64 "\n",entry_type_names[i],counts[i]);
+        total += counts[i];
+    }
+    fprintf(stderr,"    %-40s %12" PRIu64 "\n","total",total);
+
+    symtab_get_stats(&symtab);
+    fprintf(stderr,"Symbol table: %" PRIu64 " entries in %" PRIu64 " of %" PRIu64 " buckets, longest chain %" PRIu64 "\n",
+        symtab.entries,symtab.buckets_used,symtab.buckets,symtab.longest_chain);
+    fprintf(stderr,"Symbol lookups: %" PRIu64 ", %" PRIu64 " probes, %.2f probes per lookup\n",
+        symtab.lookups,symtab.probes,symtab.lookups ? (double)symtab.probes / symtab.lookups : 0.0);
+    fprintf(stderr,"Allocated: %" PRIu64 " bytes of IR, %" PRIu64 " bytes of heap in use\n",
+        mem_alloc_bytes,heap_in_use());
+    fprintf(stderr,"Output: %" PRIu64 " bytes\n",output_bytes);
+    print_include_stats();
+    print_stream_stats();
+}
+
+/* phase names carry file names, which may need escaping */
+static void json_string(FILE *fp, const char *s){
+    fputc('"',fp);
+    for (;*s;s++){
+        if ((*s == '"') || (*s == '\\'))
+            fprintf(fp,"\\%c",*s);
+        else if ((unsigned char)*s < 0x20)
+            fprintf(fp,"\\u%04x",(unsigned char)*s);
+        else
+            fputc(*s,fp);
+    }
+    fputc('"',fp);
+}
+
+/*
+ * Every phase is a complete ("X") event on one thread, timestamps in 
+ * microseconds, and the counts are counter ("C") events at the end of 
+ * the last phase so they show up as tracks under the timeline.
+ */
+void write_trace_json(char *file){
+    FILE *fp = fopen(file,"w");
+    uint64_t counts[NUM_ENTRY_TYPES];
+    symtab_stats_t symtab;
+    struct rusage usage;
+    phase_t *phase;
+    double end = 0;
+    int i;
+
+    if (!fp) yyerror("Unable to open file for the JSON trace.");
+
+    fprintf(fp,"{\"traceEvents\":[\n");
+    fprintf(fp,"{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"dt\"}}");
+    for (phase=phases;phase;phase=phase->next){
+        fprintf(fp,",\n{\"name\":");
+        json_string(fp,phase->name);
+        fprintf(fp,",\"cat\":\"phase\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":1",
+            phase->start * 1e6,phase->seconds * 1e6);
+        if (phase->lines)
+            fprintf(fp,",\"args\":{\"lines\":%" PRIu64 "}",phase->lines);
+        fprintf(fp,"}");
+        if (phase->start + phase->seconds > end)
+            end = phase->start + phase->seconds;
+    }
+
+    count_entries(counts);
+    fprintf(fp,",\n{\"name\":\"entries\",\"ph\":\"C\",\"ts\":%.3f,\"pid\":1,\"args\":{",end * 1e6);
+    for (i=0;i<NUM_ENTRY_TYPES;i++){
+        if (i) fputc(',',fp);
+        json_string(fp,entry_type_names[i]);
+        fprintf(fp,":%" PRIu64,counts[i]);
+    }
+    fprintf(fp,"}}");
+
+    symtab_get_stats(&symtab);
+    fprintf(fp,",\n{\"name\":\"symtab\",\"ph\":\"C\",\"ts\":%.3f,\"pid\":1,\"args\":{"
+        "\"entries\":%" PRIu64 ",\"buckets used\":%" PRIu64 ",\"longest chain\":%" PRIu64 ","
+        "\"lookups\":%" PRIu64 ",\"probes\":%" PRIu64 "}}",
+        end * 1e6,symtab.entries,symtab.buckets_used,symtab.longest_chain,symtab.lookups,symtab.probes);
+
+    getrusage(RUSAGE_SELF,&usage);
+    fprintf(fp,",\n{\"name\":\"memory\",\"ph\":\"C\",\"ts\":%.3f,\"pid\":1,\"args\":{"
+        "\"IR bytes\":%" PRIu64 ",\"heap bytes\":%" PRIu64 ",\"peak RSS KB\":%ld}}",
+        end * 1e6,mem_alloc_bytes,heap_in_use(),usage.ru_maxrss);
+    fprintf(fp,",\n{\"name\":\"output\",\"ph\":\"C\",\"ts\":%.3f,\"pid\":1,\"args\":{"
+        "\"bytes\":%" PRIu64 "}}",end * 1e6,output_bytes);
+    fprintf(fp,"\n],\"displayTimeUnit\":\"ms\"}\n");
+
+    if (fclose(fp) != 0) yyerror("Error closing the JSON trace.");
+}
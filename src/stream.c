@@ -0,0 +1,256 @@
+/* This file is part of the DuctTape (dt) high-level assembler for 
+ * RISC-V. The dt project was written by Justin Severeid and Elliott 
+ * Forbes, University of Wisconsin-La Crosse, copyright 2020-2024.
+ *
+ * DuctTape is free software: you can redistribute it and/or modify 
+ * it under the terms of the GNU General Public License as published 
+ * by the Free Software Foundation, either version 3 of the License, 
+ * or (at your option) any later version.
+ *
+ * DuctTape is distributed in the hope that it will be useful, but 
+ * WITHOUT ANY WARRANTY; without even the implied warranty of 
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU 
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License 
+ * along with DuctTape. If not, see <https://www.gnu.org/licenses/>. 
+ *
+ *
+ *
+ * The dt project can be found at https://cs.uwlax.edu/~eforbes/dt/
+ *
+ * If you use dt in your published research, please consider 
+ * citing the following:
+ *
+ * Severeid, J. and Forbes, E., "dt: A High-level Assembler for RISC-V," 
+ * Proceedings of the 53rd Midwest Instruction and Computing Symposium, 
+ * April 2020. 
+ *
+ * If you found dt helpful, please let us know! Email eforbes@uwlax.edu
+ *
+ * There are bound to be bugs, let us know those too.
+ */
+
+
+
+/*
+ * -stream, bounded memory output
+ *
+ * Normally every mem() block stays in memory until the whole program is 
+ * parsed. With -stream each block goes through the passes on its own as 
+ * soon as its closing brace is parsed, is written to its .bin file, and 
+ * is then freed. The most that is ever in memory is one block's entries.
+ *
+ * A branch, jump or @name whose label is in a later block cannot be 
+ * finished yet. It is written with an offset of zero and kept on a list 
+ * of fixups, just the entry and where its bytes are in which file. Once 
+ * the last block is parsed, the fixups get their offsets and encodings 
+ * the same way as everything else and are patched into the files with 
+ * pwrite(). A reference to a later block cannot be relaxed, so it has to 
+ * be in range as written.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "riscvarch.h"
+#include "stream.h"
+#include "compress.h"
+#include "gen.h"
+#include "inst.h"
+#include "mem.h"
+#include "opt.h"
+#include "output.h"
+#include "relax.h"
+#include "symtab.h"
+#include "util.h"
+
+
+typedef struct {
+    mem_entry_t *entry;
+    uint32_t file;   /* which block's .bin file */
+    uint64_t offset; /* where the encoding is in it */
+} fixup_t;
+
+static BOOL stream = FALSE;
+static char *stream_base = NULL;
+static BOOL stream_optimize = FALSE;
+static BOOL stream_compress = FALSE;
+static BOOL stream_relax = TRUE;
+static char **stream_files = NULL;
+static memblock_list_t *streamed = NULL; /* just the bounds of the blocks written so far */
+static uint32_t streamed_count = 0;
+static fixup_t *fixups = NULL;
+static uint64_t fixup_count = 0;
+static uint64_t fixup_capacity = 0;
+static uint64_t largest_block = 0; /* in entries */
+
+void begin_stream(char *file_base, BOOL optimize, BOOL compress, BOOL relax){
+    stream = TRUE;
+    stream_base = file_base;
+    stream_optimize = optimize;
+    stream_compress = compress;
+    stream_relax = relax;
+}
+
+BOOL streaming(){
+    return stream;
+}
+
+/* branches, jumps and @names whose label has not been parsed yet, they 
+   are left with an offset of zero for finish_stream() to patch */
+static void defer_forward_references(memblock_list_t *block){
+    uint64_t adj_start_addr = block->min_address & ~((uint64_t)0xf); /* as write_bin_memblock() lays out the file */
+    mem_entry_t *working;
+
+    for (working = block->head; working; working = working->next){
+        if ((working->type != ENTRY_INSTRUCTION) || (working->status != ENTRY_INCOMPLETE) ||
+            (symtab_lookup(working->inst->target_name) >= 0))
+            continue;
+        if (fixup_count == fixup_capacity){
+            fixup_capacity = fixup_capacity ? fixup_capacity * 2 : 64;
+            fixups = (fixup_t*)realloc(fixups,sizeof(fixup_t)*fixup_capacity);
+            if (!fixups) yyerror("Unable to allocate memory for -stream fixups");
+        }
+        fixups[fixup_count].entry = working;
+        fixups[fixup_count].file = streamed_count;
+        fixups[fixup_count].offset = sizeof(uint64_t) + (working->address - adj_start_addr);
+        fixup_count++;
+        working->status = ENTRY_COMPLETE;
+    }
+}
+
+/* a mem() block has just been parsed -- the passes main() would run on 
+   the whole program, on this block alone, and then out to its file */
+void stream_memblock(mem_entry_t *list){
+    memblock_list_t *block;
+    memblock_list_t *done;
+    mem_entry_t *working;
+    mem_entry_t *next;
+    uint64_t first_fixup = fixup_count;
+    uint64_t entries = 0;
+    uint64_t i;
+
+    block_list = NULL;
+    add_memblock(list);
+    block = block_list;
+
+    if (stream_optimize)
+        optimize_memblocks();
+    if (stream_compress)
+        compress_memblocks();
+    if (stream_relax || stream_compress)
+        relax_memblocks(stream_relax);
+    if (stream_compress)
+        report_compression();
+    for (done = streamed; done; done = done->next){
+        check_memblock_overlap(block,done);
+        check_memblock_overlap(done,block);
+    }
+    defer_forward_references(block);
+    calculate_offsets();
+    encode_instructions();
+    resolve_generated_data();
+
+    stream_files = (char**)realloc(stream_files,sizeof(char*)*(streamed_count+1));
+    stream_files[streamed_count] = (char*)malloc(strlen(stream_base) + 16);
+    sprintf(stream_files[streamed_count],"%s-%d.bin",stream_base,(int)streamed_count);
+    write_bin_memblock(stream_files[streamed_count],block);
+
+    /* everything but the fixups can go, the symbol table has the addresses */
+    i = first_fixup;
+    for (working = block->head; working; working = next){
+        next = working->next;
+        entries++;
+        if ((i < fixup_count) && (fixups[i].entry == working)){
+            working->next = NULL;
+            i++;
+        }
+        else
+            free_mem_entry(working);
+    }
+    if (entries > largest_block)
+        largest_block = entries;
+
+    block->head = NULL;
+    block->next = streamed;
+    streamed = block;
+    streamed_count++;
+    block_list = NULL;
+}
+
+/* a branch or jump into a later block was written as it was in the 
+   source, so if its target ended up too far away that is an error at 
+   its own line */
+static void check_fixup_range(mem_entry_t *entry){
+    char buff[300];
+
+    if (!target_out_of_range(entry))
+        return;
+    sprintf(buff,"%s to label \"%s\" is out of range (offset %" PRId64 "). "
+                 "With -stream a reference into a later mem() block is patched in "
+                 "as written and cannot be relaxed.",
+                 ((entry->inst->inst_id == RISCV_JAL) || (entry->inst->inst_id == RISCV_J)) ? "Jump" : "Branch",
+                 entry->inst->target_name,
+                 symtab_lookup(entry->inst->target_name) - (int64_t)entry->address);
+    yyerror_at(entry->loc.file,entry->loc.line,buff);
+}
+
+/* every block is out, the fixups get their offsets and are written over 
+   the zeroes left for them */
+void finish_stream(){
+    memblock_list_t pending;
+    int fd = -1;
+    uint32_t open_file = 0;
+    uint64_t i;
+
+    if (fixup_count == 0)
+        return;
+    for (i=0;i<fixup_count;i++){
+        check_fixup_range(fixups[i].entry);
+        fixups[i].entry->status = ENTRY_INCOMPLETE;
+        fixups[i].entry->next = (i+1 < fixup_count) ? fixups[i+1].entry : NULL;
+    }
+    pending.min_address = 0;
+    pending.max_address = 0;
+    pending.head = fixups[0].entry;
+    pending.next = NULL;
+    block_list = &pending;
+    calculate_offsets();
+    encode_instructions();
+    block_list = NULL;
+
+    /* in file order, as they were found */
+    for (i=0;i<fixup_count;i++){
+        uint8_t bytes[4];
+        uint32_t encoding = fixups[i].entry->encoding;
+
+        if ((fd < 0) || (fixups[i].file != open_file)){
+            if (fd >= 0)
+                close(fd);
+            open_file = fixups[i].file;
+            fd = open(stream_files[open_file], O_WRONLY);
+            if (fd < 0) yyerror("Unable to reopen binary output to patch a forward reference.");
+        }
+        bytes[0] = (encoding>>0)  & 0xff;
+        bytes[1] = (encoding>>8)  & 0xff;
+        bytes[2] = (encoding>>16) & 0xff;
+        bytes[3] = (encoding>>24) & 0xff;
+        if (pwrite(fd,bytes,fixups[i].entry->size,fixups[i].offset) != fixups[i].entry->size)
+            yyerror("Unable to patch a forward reference into binary output.");
+    }
+    if (fd >= 0)
+        close(fd);
+}
+
+void print_stream_stats(){
+    if (!stream)
+        return;
+    fprintf(stderr,"Stream: %" PRIu32 " mem() blocks, at most %" PRIu64 " entries in memory, %" PRIu64 " fixups patched\n",
+            streamed_count,largest_block,fixup_count);
+}
@@ -49,51 +49,65 @@ static symtab_entry_t * symtab_head = NULL;
 /* this is used to generate random labels/names for the join nodes */
 char *internal_name(){
     int i;
-    char *retval = (char*)malloc(sizeof(char)*20);
+    char *retval = (char*)malloc(sizeof(char)*21);
     sprintf(retval,"__internal_");
     for (i=11;i<20;i++){
         retval[i] = 'a' + (random()%26); // generates a random character from a-z
     }
+    retval[20] = '\0';
     return retval;
 }
 
-void symtab_new(char* name, symtab_type_t entry_type){
-    int found = 0;
-    symtab_entry_t * working = symtab_head;
+/* lookups go through a hash of the name, the plain list is only kept 
+   so that dump_symtab() prints entries in the same order as always */
+#define SYMTAB_BUCKETS 16384
+
+static symtab_entry_t * symtab_buckets[SYMTAB_BUCKETS];
+static uint64_t symtab_count = 0;
+static uint64_t symtab_lookups = 0;
+static uint64_t symtab_probes = 0; /* entries compared against, over every lookup */
+
+static uint32_t symtab_hash(char* name){
+    return fnv1a(FNV1A_BASIS,name,strlen(name)) % SYMTAB_BUCKETS;
+}
+
+static symtab_entry_t * symtab_find(char* name){
+    symtab_entry_t * working = symtab_buckets[symtab_hash(name)];
+    symtab_lookups++;
     while (working){
+        symtab_probes++;
         if (strcmp(name, working->name) == 0)
-            found = 1;
-        working = working->next;
+            return working;
+        working = working->hash_next;
     }
+    return NULL;
+}
 
-    if (found){
+void symtab_new(char* name, symtab_type_t entry_type){
+    if (symtab_find(name)){
         char buff[100];
-        sprintf(buff,"Duplicate label declaration: %s.",name);
+        snprintf(buff,sizeof(buff),"Duplicate label declaration: %s.",name);
         yyerror(buff);
     }
     else{
+        uint32_t bucket = symtab_hash(name);
         symtab_entry_t *new_entry = (symtab_entry_t*) malloc(sizeof(symtab_entry_t));
         new_entry->name = strdup(name);
         new_entry->type = entry_type;
         new_entry->next = symtab_head;
         symtab_head = new_entry;
+        new_entry->hash_next = symtab_buckets[bucket];
+        symtab_buckets[bucket] = new_entry;
+        symtab_count++;
     }
 }
 
 void symtab_update(char* name, uint64_t value){
-    symtab_entry_t * working = symtab_head;
-    symtab_entry_t * entry = NULL;
-    while (working){
-        if (strcmp(name, working->name) == 0){
-            entry = working;
-            break;
-        }
-        working = working->next;
-    }
+    symtab_entry_t * entry = symtab_find(name);
 
     if (!entry){
         char buff[100];
-        sprintf(buff,"Label not declared: %s",name);
+        snprintf(buff,sizeof(buff),"Label not declared: %s",name);
         yyerror(buff);
     }
     else{
@@ -102,15 +116,7 @@ void symtab_update(char* name, uint64_t value){
 }
 
 int64_t symtab_lookup(char* name){
-    symtab_entry_t * working = symtab_head;
-    symtab_entry_t * entry = NULL;
-    while (working){
-        if (strcmp(name, working->name) == 0){
-            entry = working;
-            break;
-        }
-        working = working->next;
-    }
+    symtab_entry_t * entry = symtab_find(name);
 
     if (!entry){
         return -1;
@@ -121,15 +127,7 @@ int64_t symtab_lookup(char* name){
 }
 
 symtab_type_t symtab_type(char* name){
-    symtab_entry_t * working = symtab_head;
-    symtab_entry_t * entry = NULL;
-    while (working){
-        if (strcmp(name, working->name) == 0){
-            entry = working;
-            break;
-        }
-        working = working->next;
-    }
+    symtab_entry_t * entry = symtab_find(name);
 
     if (!entry){
         return -1;
@@ -139,6 +137,35 @@ symtab_type_t symtab_type(char* name){
     }
 }
 
+/* the whole table, newest entry first, for walking it when writing output */
+symtab_entry_t *symtab_entries(){
+    return symtab_head;
+}
+
+/* sizes and probe counts for -stats */
+void symtab_get_stats(symtab_stats_t *stats){
+    int i;
+
+    stats->entries = symtab_count;
+    stats->buckets = SYMTAB_BUCKETS;
+    stats->buckets_used = 0;
+    stats->longest_chain = 0;
+    stats->lookups = symtab_lookups;
+    stats->probes = symtab_probes;
+    for (i=0;i<SYMTAB_BUCKETS;i++){
+        symtab_entry_t *working = symtab_buckets[i];
+        uint64_t chain = 0;
+        while (working){
+            chain++;
+            working = working->hash_next;
+        }
+        if (chain)
+            stats->buckets_used++;
+        if (chain > stats->longest_chain)
+            stats->longest_chain = chain;
+    }
+}
+
 void dump_symtab(){
     int i = 0;
     symtab_entry_t * working = symtab_head;
@@ -148,6 +175,10 @@ void dump_symtab(){
             printf("entry[%d]: %s\tmem\t0x%012" PRIx64 "\n", i,
                                                           working->name,
                                                           working->value);
+        else if (working->type == SYMTAB_FREG)
+            printf("entry[%d]: %s\treg\t$f%" PRIu64 "\n", i,
+                                                        working->name,
+                                                        working->value);
         else
             printf("entry[%d]: %s\treg\t$x%" PRIu64 "\n", i,
                                                         working->name,
@@ -43,7 +43,7 @@
 
 typedef enum {
     SYMTAB_IREG,
-    SYMTAB_FREG, // floating-point regs, once implemented
+    SYMTAB_FREG, // floating-point regs
     SYMTAB_MEM
 } symtab_type_t;
 
@@ -52,13 +52,25 @@ typedef struct symtab_entry_type {
     symtab_type_t type;
     uint64_t value; /* either address or reg no */
     struct symtab_entry_type * next;
+    struct symtab_entry_type * hash_next; /* chain within a hash bucket */
 } symtab_entry_t;
 
+typedef struct {
+    uint64_t entries;
+    uint64_t buckets;
+    uint64_t buckets_used;
+    uint64_t longest_chain;
+    uint64_t lookups;
+    uint64_t probes;
+} symtab_stats_t;
+
 void symtab_new(char*, symtab_type_t);
 void symtab_update(char*, uint64_t);
 int64_t symtab_lookup(char*);
 symtab_type_t symtab_type(char*);
 void dump_symtab();
+symtab_entry_t *symtab_entries();
+void symtab_get_stats(symtab_stats_t*);
 char *internal_name();
 
 
@@ -38,6 +38,7 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <stdint.h>
 
 #include "util.h"
 
@@ -98,3 +99,17 @@ char * parse_string(char * str) {
     return ret;
 }
 
+// TRUE if value fits in a two's complement field of the given width
+BOOL fits_signed(int64_t value, int bits){
+    return (value >= -((int64_t)1 << (bits-1))) && (value < ((int64_t)1 << (bits-1)));
+}
+
+// FNV-1a, 64 bit -- start from FNV1A_BASIS, or from the hash of the data before
+uint64_t fnv1a(uint64_t hash, const char *data, size_t length){
+    size_t i;
+    for (i=0;i<length;i++){
+        hash ^= (unsigned char)data[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
@@ -38,9 +38,13 @@
 #ifndef __UTIL_H__
 #define __UTIL_H__
 
+#include <stdint.h>
+#include <stddef.h>
+
 /* declarations for yacc types */
 int yylex();
 int yyerror(const char *s);
+int yyerror_at(char *file, int line, const char *s);
 extern void yyrestart(FILE*);
 
 typedef char BOOL;
@@ -48,6 +52,10 @@ typedef char BOOL;
 #define FALSE 0
 
 char *parse_string(char *);
+BOOL fits_signed(int64_t, int);
+
+#define FNV1A_BASIS 14695981039346656037ull
+uint64_t fnv1a(uint64_t, const char *, size_t);
 
 extern int dt_major_vers, dt_minor_vers, dt_patch_vers, dt_year;
 
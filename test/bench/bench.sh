@@ -0,0 +1,75 @@
+#!/bin/sh
+#
+# make bench: generates each synthetic workload with benchgen, assembles 
+# it with dt -time -elf, and prints the throughput, peak RSS and phase 
+# times. Each workload is compared with test/bench/baseline.txt, and a 
+# total time or peak RSS more than BENCH_TOLERANCE percent over the 
+# baseline is flagged. The baseline is only compared at the divisor it 
+# was taken with, since small inputs are dominated by start up. Times 
+# only mean something on the machine and build that took them, so no 
+# baseline is shipped: run make bench-baseline once before comparing.
+#
+# usage: bench.sh <top> [divisor] [baseline]
+#        a third argument of "baseline" rewrites the baseline file
+
+TOP=$1
+DIV=${2:-1}
+MODE=$3
+TOLERANCE=${BENCH_TOLERANCE:-10}
+OUT=$TOP/obj/bench
+BASE=$TOP/test/bench/baseline.txt
+
+mkdir -p $OUT
+if [ "$MODE" = "baseline" ]; then
+    echo "# workload divisor total-seconds peak-rss-kb, written by make bench-baseline" > $BASE.new
+fi
+
+printf "%-8s %9s %9s %10s %10s %8s %8s %8s %8s %8s %8s %8s %8s  %s\n" \
+    workload lines insts lines/s insts/s "rss KB" parse relax bounds offsets encode write total "vs baseline"
+
+for w in flat nested labels blocks data; do
+    $TOP/bin/benchgen $w $DIV > $OUT/$w.dt
+    if ! $TOP/bin/dt -time -elf -out $OUT/$w $OUT/$w.dt > /dev/null 2> $OUT/$w.time; then
+        echo "$w: dt failed, see $OUT/$w.time"
+        continue
+    fi
+
+    awk -v w=$w -v div=$DIV -v tol=$TOLERANCE -v base=$BASE '
+        /^    parse /           { parse += $(NF-3) }
+        /^    relax_memblocks/  { relax = $2 }
+        /^    check_mem_bounds/ { bounds = $2 }
+        /^    calculate_offsets/ { offsets = $2 }
+        /^    encode_instructions/ { encode = $2 }
+        /^    write_elf/        { write = $2 }
+        /^    total/            { total = $2 }
+        /^Throughput:/          { lines = $2; insts = $4; lps = $6; ips = $8 }
+        /^Peak RSS:/            { rss = $3 }
+        END {
+            verdict = "no baseline"
+            while ((getline line < base) > 0){
+                n = split(line,f," ")
+                if ((n == 4) && (f[1] == w)){
+                    if (f[2] != div)
+                        verdict = "baseline is at divisor " f[2]
+                    else {
+                        dt = 100 * (total - f[3]) / f[3]
+                        dr = 100 * (rss - f[4]) / f[4]
+                        verdict = sprintf("time %+.1f%%, rss %+.1f%%",dt,dr)
+                        if ((dt > tol) || (dr > tol))
+                            verdict = verdict "  REGRESSION"
+                    }
+                }
+            }
+            printf "%-8s %9d %9d %10d %10d %8d %8.3f %8.3f %8.3f %8.3f %8.3f %8.3f %8.3f  %s\n",
+                w,lines,insts,lps,ips,rss,parse,relax,bounds,offsets,encode,write,total,verdict
+        }' $OUT/$w.time
+
+    if [ "$MODE" = "baseline" ]; then
+        awk -v w=$w -v div=$DIV '/^    total/ { total = $2 } /^Peak RSS:/ { rss = $3 } END { print w, div, total, rss }' $OUT/$w.time >> $BASE.new
+    fi
+done
+
+if [ "$MODE" = "baseline" ]; then
+    mv $BASE.new $BASE
+    echo "baseline written to $BASE"
+fi
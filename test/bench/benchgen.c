@@ -0,0 +1,203 @@
+/* This file is part of the DuctTape (dt) high-level assembler for 
+ * RISC-V. The dt project was written by Justin Severeid and Elliott 
+ * Forbes, University of Wisconsin-La Crosse, copyright 2020-2024.
+ *
+ * DuctTape is free software: you can redistribute it and/or modify 
+ * it under the terms of the GNU General Public License as published 
+ * by the Free Software Foundation, either version 3 of the License, 
+ * or (at your option) any later version.
+ *
+ * DuctTape is distributed in the hope that it will be useful, but 
+ * WITHOUT ANY WARRANTY; without even the implied warranty of 
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU 
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License 
+ * along with DuctTape. If not, see <https://www.gnu.org/licenses/>. 
+ *
+ *
+ *
+ * The dt project can be found at https://cs.uwlax.edu/~eforbes/dt/
+ *
+ * If you use dt in your published research, please consider 
+ * citing the following:
+ *
+ * Severeid, J. and Forbes, E., "dt: A High-level Assembler for RISC-V," 
+ * Proceedings of the 53rd Midwest Instruction and Computing Symposium, 
+ * April 2020. 
+ *
+ * If you found dt helpful, please let us know! Email eforbes@uwlax.edu
+ *
+ * There are bound to be bugs, let us know those too.
+ */
+
+
+/*
+ * benchgen: writes the synthetic dt programs that make bench assembles. 
+ * The output only depends on the workload name and the divisor, so runs 
+ * on different machines and different days assemble the same input. 
+ * The divisor shrinks every workload, for a quick run.
+ *
+ * usage: benchgen <flat|nested|labels|blocks|data> [divisor]
+ *        benchgen <includes|part> [divisor]
+ *
+ * includes and part are for make cachebench: includes is one mem() 
+ * block made of .include "part.dt" lines, and part is the code each of 
+ * them reads in, which has to be written beside it as part.dt.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <inttypes.h>
+
+#define FLAT_INSTS 10000000  /* one mem() block of straight-line code */
+#define NEST_DEPTH 100       /* if and while nested this deep... */
+#define NEST_GROUPS 2000     /* ...this many times */
+#define LABELS 100000
+#define BLOCKS 10000
+#define INCLUDES 1000        /* .include lines... */
+#define PART_INSTS 1000      /* ...each reading in this much straight-line code */
+#define STRINGS 200000       /* .stringz lines, then as many of each data fill */
+
+static const char *regs[] = {"$t0","$t1","$t2","$t3","$t4","$t5","$t6","$a0","$a1","$a2","$a3","$a4","$a5","$s1","$s2","$s3"};
+#define NREGS (sizeof(regs) / sizeof(regs[0]))
+
+/* one of a fixed rotation of instructions, the mix a hand written test case has */
+static void instruction(FILE *out, uint64_t i){
+    const char *d = regs[i % NREGS];
+    const char *a = regs[(i * 7 + 3) % NREGS];
+    const char *b = regs[(i * 5 + 1) % NREGS];
+
+    switch (i % 8){
+        case 0: fprintf(out,"    add %s, %s, %s\n",d,a,b); break;
+        case 1: fprintf(out,"    addi %s, %s, %d\n",d,a,(int)(i % 2048) - 1024); break;
+        case 2: fprintf(out,"    ld %s, %d[$sp]\n",d,(int)(i % 32) * 8); break;
+        case 3: fprintf(out,"    sd %s, %d[$sp]\n",a,(int)(i % 32) * 8); break;
+        case 4: fprintf(out,"    %s = %s + %s\n",d,a,b); break;
+        case 5: fprintf(out,"    mul %s, %s, %s\n",d,a,b); break;
+        case 6: fprintf(out,"    slli %s, %s, %d\n",d,a,(int)(i % 64)); break;
+        default: fprintf(out,"    %s = %s ^ %d\n",d,a,(int)(i % 1000)); break;
+    }
+}
+
+static void flat(FILE *out, uint64_t div){
+    uint64_t i;
+
+    fprintf(out,"$pc = 0x10000\n\nmem (0x10000) {\n");
+    for (i=0;i<FLAT_INSTS / div;i++)
+        instruction(out,i);
+    fprintf(out,"}\n");
+}
+
+/* alternating while and if, each level with a little code before and after the next */
+static void nested(FILE *out, uint64_t div){
+    uint64_t group;
+    int level;
+
+    fprintf(out,"$pc = 0x10000\n\nmem (0x10000) {\n");
+    for (group=0;group<NEST_GROUPS / div;group++){
+        for (level=0;level<NEST_DEPTH;level++){
+            instruction(out,group + level);
+            fprintf(out,"%*s%s (%s) {\n",level,"",(level % 2) ? "if" : "while",regs[level % NREGS]);
+        }
+        instruction(out,group);
+        for (level=NEST_DEPTH-1;level>=0;level--){
+            fprintf(out,"%*s}\n",level,"");
+            instruction(out,group + level + 1);
+        }
+    }
+    fprintf(out,"}\n");
+}
+
+/* every line labeled, branching back to a nearby label and jumping to far ones */
+static void labels(FILE *out, uint64_t div){
+    uint64_t i;
+    uint64_t n = LABELS / div;
+
+    fprintf(out,"$pc = 0x10000\n\nmem (0x10000) {\n");
+    for (i=0;i<n;i++){
+        fprintf(out,"l%" PRIu64 ":\n",i);
+        if ((i % 4) == 3)
+            fprintf(out,"    bne %s, $zero, l%" PRIu64 "\n",regs[i % NREGS],i - 3);
+        else if ((i % 16) == 5)
+            fprintf(out,"    j l%" PRIu64 "\n",(i * 7919) % n);
+        else
+            instruction(out,i);
+    }
+    fprintf(out,"}\n");
+}
+
+static void blocks(FILE *out, uint64_t div){
+    uint64_t i;
+    int j;
+
+    fprintf(out,"$pc = 0x10000\n");
+    for (i=0;i<BLOCKS / div;i++){
+        fprintf(out,"\nmem (0x%" PRIx64 ") {\nb%" PRIu64 ":\n",0x10000 + i * 0x1000,i);
+        for (j=0;j<6;j++)
+            instruction(out,i + j);
+        fprintf(out,"    bne $t0, $zero, b%" PRIu64 "\n}\n",i);
+    }
+}
+
+static void data(FILE *out, uint64_t div){
+    uint64_t i;
+
+    fprintf(out,"$pc = 0x10000\n\nmem (0x10000) {\n");
+    for (i=0;i<STRINGS / div;i++)
+        fprintf(out,"    .stringz \"string %08" PRIu64 ": the quick brown fox jumps over the lazy dog\\n\"\n",i);
+    fprintf(out,"}\n\nmem (0x4000000) {\n");
+    for (i=0;i<STRINGS / div;i++){
+        fprintf(out,"    .long 0x%016" PRIx64 "\n",(uint64_t)(i * 0x9e3779b97f4a7c15ULL));
+        fprintf(out,"    .word %" PRIu64 "\n",i % 0x7fffffff);
+        fprintf(out,"    .half %" PRIu64 "\n",i % 0x7fff);
+        fprintf(out,"    .byte %" PRIu64 "\n",i % 0x7f);
+        fprintf(out,"    .double %" PRIu64 ".5\n",i);
+    }
+    fprintf(out,"}\n");
+}
+
+static void includes(FILE *out, uint64_t div){
+    uint64_t i;
+
+    fprintf(out,"$pc = 0x10000\n\nmem (0x10000) {\n");
+    for (i=0;i<INCLUDES / div;i++)
+        fprintf(out,"    .include \"part.dt\"\n");
+    fprintf(out,"}\n");
+}
+
+/* no labels, so it can be read in any number of times */
+static void part(FILE *out){
+    uint64_t i;
+
+    for (i=0;i<PART_INSTS;i++)
+        instruction(out,i);
+}
+
+int main(int argc, char *argv[]){
+    uint64_t div = 1;
+
+    if ((argc < 2) || (argc > 3)){
+        fprintf(stderr,"usage: %s <flat|nested|labels|blocks|data|includes|part> [divisor]\n",argv[0]);
+        exit(1);
+    }
+    if (argc == 3){
+        div = strtoull(argv[2],NULL,0);
+        if (div == 0) div = 1;
+    }
+
+    if (strcmp(argv[1],"flat") == 0) flat(stdout,div);
+    else if (strcmp(argv[1],"nested") == 0) nested(stdout,div);
+    else if (strcmp(argv[1],"labels") == 0) labels(stdout,div);
+    else if (strcmp(argv[1],"blocks") == 0) blocks(stdout,div);
+    else if (strcmp(argv[1],"data") == 0) data(stdout,div);
+    else if (strcmp(argv[1],"includes") == 0) includes(stdout,div);
+    else if (strcmp(argv[1],"part") == 0) part(stdout);
+    else {
+        fprintf(stderr,"%s: unknown workload %s\n",argv[0],argv[1]);
+        exit(1);
+    }
+    return 0;
+}